@@ -15,6 +15,7 @@
 #pragma once
 
 #include "Constants.h"
+#include "Parallel.h"
 #include "Types.h"
 
 namespace aprn{
@@ -75,11 +76,29 @@ template<class It>
 [[nodiscard]] constexpr IterType<It>
 MinEntry(const It first, const It last) { return *std::min_element(first, last); }
 
+/** Min value, given a first and last random-access iterator and an execution policy, e.g. MinEntry<Par>(first, last). */
+template<ExecutionPolicy P, std::random_access_iterator It>
+[[nodiscard]] IterType<It>
+MinEntry(const It first, const It last)
+{
+   if constexpr(isTypeSame<P, Seq>()) return MinEntry(first, last);
+   else return ParallelReduce(static_cast<size_t>(last - first), *first, [first](const size_t i){ return first[i]; }, Min<IterType<It>>);
+}
+
 /** Max value, given a first and last iterator. */
 template<class It>
 [[nodiscard]] constexpr IterType<It>
 MaxEntry(const It first, const It last) { return *std::max_element(first, last); }
 
+/** Max value, given a first and last random-access iterator and an execution policy, e.g. MaxEntry<Par>(first, last). */
+template<ExecutionPolicy P, std::random_access_iterator It>
+[[nodiscard]] IterType<It>
+MaxEntry(const It first, const It last)
+{
+   if constexpr(isTypeSame<P, Seq>()) return MaxEntry(first, last);
+   else return ParallelReduce(static_cast<size_t>(last - first), *first, [first](const size_t i){ return first[i]; }, Max<IterType<It>>);
+}
+
 /** Minmax values in a pair, given a first and last iterator. */
 template<class It>
 [[nodiscard]] constexpr Pair<IterType<It>>
@@ -94,6 +113,20 @@ template<class It, typename T>
 constexpr void
 BoundEntries(It first, It last, const T& min, const T& max) { FOR_ITER(it, first, last) Clip(*it, min, max); }
 
+/** Clipped values from a first to a last random-access iterator between a minimum and a maximum, with an execution policy. */
+template<ExecutionPolicy P, std::random_access_iterator It, typename T>
+void
+BoundEntries(It first, It last, const T& min, const T& max)
+{
+   if constexpr(isTypeSame<P, Seq>()) BoundEntries(first, last, min, max);
+   else
+   {
+      // Check the bounds up front, as exceptions cannot propagate out of the threads.
+      if(!(min < max)) throw std::invalid_argument("The minimum bound must be lesser than the maximum bound.");
+      ParallelFor(static_cast<size_t>(last - first), [first, &min, &max](const size_t i){ Clip(first[i], min, max); });
+   }
+}
+
 /***************************************************************************************************************************************************************
 * Signum and Absolute Value Functions
 ***************************************************************************************************************************************************************/
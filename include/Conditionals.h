@@ -15,6 +15,7 @@
 #pragma once
 
 #include <algorithm>
+#include <iterator>
 #include <tuple>
 
 namespace aprn {
@@ -49,7 +50,7 @@ struct ContainerOneOfHelper
 
    template<typename T>
    [[nodiscard]] friend constexpr bool
-   operator==(T&& lhs, ContainerOneOfHelper&& rhs) noexcept { return std::any_of(cbegin(rhs.Values), cend(rhs.Values), [&](auto val){ return lhs == val; }); }
+   operator==(T&& lhs, ContainerOneOfHelper&& rhs) noexcept { return std::any_of(std::cbegin(rhs.Values), std::cend(rhs.Values), [&](auto val){ return lhs == val; }); }
 
    template<typename T>
    [[nodiscard]] friend constexpr bool
@@ -59,7 +60,7 @@ struct ContainerOneOfHelper
 };
 
 template<typename T>
-auto isContainer(int) -> decltype(cbegin(std::declval<T>()) == cend(std::declval<T>()), std::true_type{});
+auto isContainer(int) -> decltype(std::cbegin(std::declval<T>()) == std::cend(std::declval<T>()), std::true_type{});
 
 template<typename T>
 std::false_type isContainer(...);
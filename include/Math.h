@@ -17,10 +17,12 @@
 #include "Comparators.h"
 #include "Constants.h"
 #include "Debug.h"
+#include "Parallel.h"
 #include "Types.h"
 
 #include <cmath>
 #include <functional>
+#include <iterator>
 #include <numeric>
 
 namespace aprn{
@@ -62,7 +64,7 @@ constexpr auto
 Sum(const T... values) { return (values + ... + 0); }
 
 /** Sum the terms of a sequence between two iterators. */
-template<class It>
+template<std::input_iterator It>
 constexpr auto
 Sum(const It first, const It last)
 {
@@ -70,13 +72,23 @@ Sum(const It first, const It last)
   return std::accumulate(first, last, static_cast<data_type>(0));
 }
 
+/** Sum the terms of a sequence between two random-access iterators with a given execution policy, e.g. Sum<Par>(first, last). */
+template<ExecutionPolicy P, std::random_access_iterator It>
+constexpr auto
+Sum(const It first, const It last)
+{
+  typedef typename std::iterator_traits<It>::value_type data_type;
+  if constexpr(isTypeSame<P, Seq>()) return Sum(first, last);
+  else return ParallelReduce(static_cast<size_t>(last - first), static_cast<data_type>(0), [first](const size_t i){ return first[i]; }, std::plus<data_type>());
+}
+
 /** Product the terms of a sequence with each other. */
 template<typename... T>
 constexpr auto
 Product(const T... values) { return (values * ... * 1); }
 
 /** Product the terms of a sequence between two iterators. */
-template<class It>
+template<std::input_iterator It>
 constexpr auto
 Product(const It first, const It last)
 {
@@ -84,6 +96,17 @@ Product(const It first, const It last)
   return std::accumulate(first, last, static_cast<data_type>(1), std::multiplies<data_type>());
 }
 
+/** Product the terms of a sequence between two random-access iterators with a given execution policy, e.g. Product<Par>(first, last). */
+template<ExecutionPolicy P, std::random_access_iterator It>
+constexpr auto
+Product(const It first, const It last)
+{
+  typedef typename std::iterator_traits<It>::value_type data_type;
+  if constexpr(isTypeSame<P, Seq>()) return Product(first, last);
+  else return ParallelReduce(static_cast<size_t>(last - first), static_cast<data_type>(1), [first](const size_t i){ return first[i]; },
+                             std::multiplies<data_type>());
+}
+
 /** Division function. */
 template<typename T>
 constexpr Real
@@ -0,0 +1,129 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+
+#pragma once
+
+#include "Loops.h"
+#include "Types.h"
+
+#include <stdexcept>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace aprn{
+
+/***************************************************************************************************************************************************************
+* Execution Policies
+***************************************************************************************************************************************************************/
+/** Serial and parallel execution policy tags, passed as the first template argument of algorithms with parallel variants, e.g. Sum<Par>(first, last). */
+struct Seq {};
+
+struct Par {};
+
+template<class P>
+concept ExecutionPolicy = isTypeSame<P, Seq>() || isTypeSame<P, Par>();
+
+/***************************************************************************************************************************************************************
+* Thread Settings
+***************************************************************************************************************************************************************/
+namespace detail {
+
+/** Number of entries below which parallel algorithms run serially, as forking threads costs more than is gained on small ranges. */
+inline size_t&
+ParallelThresholdValue()
+{
+   static size_t threshold = 1 << 15;
+   return threshold;
+}
+
+}
+
+/** Number of threads used by parallel algorithms. Without OpenMP, parallel algorithms run serially. */
+inline size_t
+nThreads()
+{
+#ifdef _OPENMP
+   return static_cast<size_t>(omp_get_max_threads());
+#else
+   return 1;
+#endif
+}
+
+inline void
+SetThreads(const size_t n_threads)
+{
+   if(!n_threads) throw std::invalid_argument("The number of threads must be non-zero.");
+#ifdef _OPENMP
+   omp_set_num_threads(static_cast<int>(n_threads));
+#endif
+}
+
+inline size_t ParallelThreshold() { return detail::ParallelThresholdValue(); }
+
+inline void SetParallelThreshold(const size_t threshold) { detail::ParallelThresholdValue() = threshold; }
+
+/** Check if a range of a given size is to be processed in parallel. */
+inline bool
+isParallel(const size_t n) { return n >= ParallelThreshold() && nThreads() > 1; }
+
+/***************************************************************************************************************************************************************
+* Parallel Loops
+***************************************************************************************************************************************************************/
+/** Apply a function to each index in [0, n), statically split into contiguous blocks between the threads. Iterations processing a number of entries each, e.g.
+ *  blocks of a matrix, pass it as their cost, which is weighed against the parallel threshold. */
+template<class F>
+void
+ParallelFor(const size_t n, F&& function, const size_t cost = 1)
+{
+   if(!isParallel(n * cost)) { FOR(i, n) function(i); return; }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+   for(size_t i = 0; i < n; ++i) function(i);
+#endif
+}
+
+/** Reduce the terms term(i), for each index in [0, n), with an associative operation. Each thread reduces a contiguous block, and the partial results are
+ *  combined in order, so that the result only depends on the number of threads. Terms reducing a number of entries each pass it as their cost. */
+template<typename T, class Term, class Op>
+T
+ParallelReduce(const size_t n, const T& identity, Term&& term, Op&& operation, const size_t cost = 1)
+{
+   T result = identity;
+   if(!isParallel(n * cost))
+   {
+      FOR(i, n) result = operation(result, term(i));
+      return result;
+   }
+
+#ifdef _OPENMP
+   std::vector<T> partials(nThreads(), identity);
+#pragma omp parallel
+   {
+      const auto thread    = static_cast<size_t>(omp_get_thread_num());
+      const auto n_threads = static_cast<size_t>(omp_get_num_threads());
+      T partial = identity;
+      FOR(i, n * thread / n_threads, n * (thread + 1) / n_threads) partial = operation(partial, term(i));
+      partials[thread] = partial;
+   }
+   FOR_EACH_CONST(partial, partials) result = operation(result, partial);
+#endif
+   return result;
+}
+
+}//aprn
@@ -0,0 +1,28 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+
+namespace aprn {
+
+/***************************************************************************************************************************************************************
+* Global Allocation Counting
+***************************************************************************************************************************************************************/
+/** The number of global operator new calls made so far. Only available to executables linked with AllocationCounterLibrary, which replaces the global
+ *  allocation and deallocation operators. */
+std::size_t AllocationCount();
+
+}
@@ -18,6 +18,8 @@
 #include "Timer.h"
 #include <DataContainer/include/Array.h>
 
+#include <unordered_map>
+
 namespace aprn {
 
 /** Benchmark class. */
@@ -38,6 +40,7 @@ class Benchmark
      if(!StopWatchMap.count(_timer_name)) StopWatchMap.insert({_timer_name, StopWatch()});
      else ASSERT(!StopWatchMap[_timer_name].isRunning, "The timer for ", _timer_name, " is already running.")
 
+     StopWatchMap[_timer_name].Timer::Reset(); // Each lap is timed from zero.
      StopWatchMap[_timer_name].Start();
    }
 
@@ -69,7 +72,7 @@ class Benchmark
    /** Print time benchmark result table header. */
    inline void PrintResultsHeader()
    {
-     Print();
+     Print("");
      Print("********************************************************************************************************************************");
      Print<'\0'>(Setw(MaxStringLength), " Timer Name ",
                  "|", Setw(11), " Lap Count ",
@@ -18,6 +18,7 @@
 #include "../../DataContainer/include/Array.h"
 
 #include <chrono>
+#include <numeric>
 
 namespace aprn {
 
@@ -106,7 +107,7 @@ class StopWatch : public Timer
 
    /** Default constructor. */
    StopWatch()
-      : LapTimeMin(MaxReal<>), LapTimeMax(LowestReal<>), LapTimeMean(Zero), LapTimeRMS(Zero), LapTimeStd(Zero), isFinalised(false)
+      : LapTimeMin(MaxFloat<>), LapTimeMax(LowestFloat<>), LapTimeMean(Zero), LapTimeRMS(Zero), LapTimeStd(Zero), isFinalised(false)
    {
       LapTimes.reserve(1e5);
    }
@@ -136,7 +137,7 @@ class StopWatch : public Timer
 
       // Finalise the mean and RMS.
       LapTimeMean = std::accumulate(LapTimes.begin(), LapTimes.end(), Zero); // Note: Last argument determines the type of the return value.
-      LapTimeMean /= (Real)LapTimes.size();
+      LapTimeMean /= static_cast<Real>(LapTimes.size());
 
       // Finalise the RMS and standard deviation.
       LapTimeRMS = Zero;
@@ -146,8 +147,8 @@ class StopWatch : public Timer
         LapTimeRMS += iPow(lap_time, 2);
         LapTimeStd += iPow(lap_time - LapTimeMean, 2);
       }
-      LapTimeRMS = Sqrt( LapTimeRMS / static_cast<Real>(LapTimes.size()) );
-      LapTimeStd = Sqrt( LapTimeStd / static_cast<Real>(LapTimes.size()) );
+      LapTimeRMS = std::sqrt( LapTimeRMS / static_cast<Real>(LapTimes.size()) );
+      LapTimeStd = std::sqrt( LapTimeStd / static_cast<Real>(LapTimes.size()) );
 
       isFinalised = true;
    }
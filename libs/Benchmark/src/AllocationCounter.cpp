@@ -0,0 +1,52 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#include "../include/AllocationCounter.h"
+
+#include <cstdlib>
+#include <new>
+
+/***************************************************************************************************************************************************************
+* Replacement Global Allocation Operators
+***************************************************************************************************************************************************************/
+namespace { std::size_t Count{}; }
+
+void* operator new(const std::size_t bytes)
+{
+   ++Count;
+   if(void* ptr = std::malloc(bytes)) return ptr;
+   throw std::bad_alloc();
+}
+
+void* operator new(const std::size_t bytes, const std::align_val_t alignment)
+{
+   ++Count;
+   const auto align = static_cast<std::size_t>(alignment);
+   if(void* ptr = std::aligned_alloc(align, (bytes + align - 1) / align * align)) return ptr;
+   throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, std::align_val_t) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept { std::free(ptr); }
+
+namespace aprn {
+
+std::size_t AllocationCount() { return Count; }
+
+}
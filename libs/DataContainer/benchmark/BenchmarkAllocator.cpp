@@ -0,0 +1,79 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#include "../../../include/Global.h"
+#include "../../Benchmark/include/AllocationCounter.h"
+#include "../../Benchmark/include/Benchmark.h"
+#include "../include/Array.h"
+
+using namespace aprn;
+
+/***************************************************************************************************************************************************************
+* Emulates the transient arrays built every frame by the visualiser - a list of object pointers grown by push_back, as in Visualiser::InitTeXBoxes, and a
+* pair of buffer pointers, as in PostProcessor::Render - with the default, aligned, and arena allocators.
+***************************************************************************************************************************************************************/
+struct FrameObject { Real Data[4]; };
+
+template<class PtrArray, class PairArray>
+void RenderFrame(DArray<FrameObject>& objects, PtrArray&& pointers, PairArray&& buffers)
+{
+   FOR_EACH(object, objects) pointers.push_back(&object);
+   buffers.push_back(&objects.front());
+   buffers.push_back(&objects.back());
+   FOR_EACH(pointer, pointers) pointer->Data[0] += One;
+}
+
+int main()
+{
+   constexpr size_t n_frames = 1000;
+   Benchmark benchmark(TimeUnit::MicroSecond);
+   MemoryArena arena;
+
+   for(const size_t n_objects : {10, 100, 1000})
+   {
+      DArray<FrameObject> objects(n_objects, FrameObject{});
+      const std::string suffix = " n=" + ToString(n_objects);
+      size_t default_count{}, aligned_count{}, arena_count{};
+
+      FOR(frame, n_frames)
+      {
+         size_t count = AllocationCount();
+         benchmark.StartTimer("Default" + suffix);
+         RenderFrame(objects, DArray<FrameObject*>(), DArray<FrameObject*>());
+         benchmark.StopTimer("Default" + suffix);
+         default_count += AllocationCount() - count;
+
+         count = AllocationCount();
+         benchmark.StartTimer("Aligned" + suffix);
+         RenderFrame(objects, AlignedDArray<FrameObject*>(), AlignedDArray<FrameObject*>());
+         benchmark.StopTimer("Aligned" + suffix);
+         aligned_count += AllocationCount() - count;
+
+         count = AllocationCount();
+         benchmark.StartTimer("Arena" + suffix);
+         arena.Reset();
+         const ArenaAllocator<FrameObject*> allocator(arena);
+         RenderFrame(objects, ArenaDArray<FrameObject*>(allocator), ArenaDArray<FrameObject*>(allocator));
+         benchmark.StopTimer("Arena" + suffix);
+         arena_count += AllocationCount() - count;
+      }
+
+      SetFormat(PrintFormat::Fixed);
+      SetPrecision(3);
+      Print("Objects per frame:", n_objects, "- allocations per frame (default/aligned/arena):", static_cast<Real>(default_count) / n_frames,
+            static_cast<Real>(aligned_count) / n_frames, static_cast<Real>(arena_count) / n_frames);
+   }
+
+   benchmark.PrintResults();
+}
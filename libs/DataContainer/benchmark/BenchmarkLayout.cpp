@@ -0,0 +1,107 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+
+#include "../../../include/Global.h"
+#include "../../Benchmark/include/Benchmark.h"
+#include "../include/MultiArray.h"
+
+using namespace aprn;
+
+/***************************************************************************************************************************************************************
+* Compares 2D and 3D sweeps over dynamic multi-arrays with column-major, row-major, and tiled layouts. Each sweep is run with the first and with the last index
+* in the inner loop, so that each of the strided layouts is favoured once.
+***************************************************************************************************************************************************************/
+constexpr size_t nRepeats = 5;
+
+template<class Layout>
+Real Sweep2D(Benchmark& benchmark, const std::string& layout_name, const size_t n)
+{
+   DynamicMultiArray<Real, Layout> grid(n, n), result(n, n);
+   FOR(i, n) FOR(j, n) grid(i, j) = static_cast<Real>(i + j);
+
+   const std::string suffix = " " + layout_name + " n=" + ToString(n);
+   Real checksum{};
+
+   FOR(repeat, nRepeats)
+   {
+      benchmark.StartTimer("2D sum, first index inner" + suffix);
+      FOR(j, n) FOR(i, n) checksum += grid(i, j);
+      benchmark.StopTimer("2D sum, first index inner" + suffix);
+
+      benchmark.StartTimer("2D sum, last index inner" + suffix);
+      FOR(i, n) FOR(j, n) checksum += grid(i, j);
+      benchmark.StopTimer("2D sum, last index inner" + suffix);
+
+      benchmark.StartTimer("2D stencil, first index inner" + suffix);
+      FOR(j, 1, n - 1) FOR(i, 1, n - 1) result(i, j) = grid(i - 1, j) + grid(i + 1, j) + grid(i, j - 1) + grid(i, j + 1) - 4 * grid(i, j);
+      benchmark.StopTimer("2D stencil, first index inner" + suffix);
+
+      benchmark.StartTimer("2D stencil, last index inner" + suffix);
+      FOR(i, 1, n - 1) FOR(j, 1, n - 1) result(i, j) = grid(i - 1, j) + grid(i + 1, j) + grid(i, j - 1) + grid(i, j + 1) - 4 * grid(i, j);
+      benchmark.StopTimer("2D stencil, last index inner" + suffix);
+      checksum += result(n / 2, n / 2);
+   }
+   return checksum;
+}
+
+template<class Layout>
+Real Sweep3D(Benchmark& benchmark, const std::string& layout_name, const size_t n)
+{
+   DynamicMultiArray<Real, Layout> grid(n, n, n), result(n, n, n);
+   FOR(i, n) FOR(j, n) FOR(k, n) grid(i, j, k) = static_cast<Real>(i + j + k);
+
+   const std::string suffix = " " + layout_name + " n=" + ToString(n);
+   const auto stencil = [&](const size_t i, const size_t j, const size_t k)
+   {
+      return grid(i - 1, j, k) + grid(i + 1, j, k) + grid(i, j - 1, k) + grid(i, j + 1, k) + grid(i, j, k - 1) + grid(i, j, k + 1) - 6 * grid(i, j, k);
+   };
+   Real checksum{};
+
+   FOR(repeat, nRepeats)
+   {
+      benchmark.StartTimer("3D stencil, first index inner" + suffix);
+      FOR(k, 1, n - 1) FOR(j, 1, n - 1) FOR(i, 1, n - 1) result(i, j, k) = stencil(i, j, k);
+      benchmark.StopTimer("3D stencil, first index inner" + suffix);
+
+      benchmark.StartTimer("3D stencil, last index inner" + suffix);
+      FOR(i, 1, n - 1) FOR(j, 1, n - 1) FOR(k, 1, n - 1) result(i, j, k) = stencil(i, j, k);
+      benchmark.StopTimer("3D stencil, last index inner" + suffix);
+      checksum += result(n / 2, n / 2, n / 2);
+   }
+   return checksum;
+}
+
+int main()
+{
+   Benchmark benchmark(TimeUnit::MilliSecond);
+   Real checksum{};
+
+   for(const size_t n : {512, 2048})
+   {
+      checksum += Sweep2D<ColumnMajor>(benchmark, "column-major", n);
+      checksum += Sweep2D<RowMajor>(benchmark, "row-major", n);
+      checksum += Sweep2D<Tiled<8>>(benchmark, "tiled", n);
+   }
+
+   for(const size_t n : {64, 256})
+   {
+      checksum += Sweep3D<ColumnMajor>(benchmark, "column-major", n);
+      checksum += Sweep3D<RowMajor>(benchmark, "row-major", n);
+      checksum += Sweep3D<Tiled<8>>(benchmark, "tiled", n);
+   }
+
+   Print("Checksum:", checksum);
+   benchmark.PrintResults();
+}
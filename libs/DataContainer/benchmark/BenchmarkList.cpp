@@ -0,0 +1,80 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+
+#include "../../../include/Global.h"
+#include "../../Benchmark/include/Benchmark.h"
+#include "../include/List.h"
+
+#include <list>
+
+using namespace aprn;
+
+/***************************************************************************************************************************************************************
+* Linked List with Indexing, as previously used by List
+***************************************************************************************************************************************************************/
+template<typename T>
+struct LinkedList : public std::list<T>
+{
+   T& operator[](const size_t index)
+   {
+      auto iterator = this->begin();
+      FOR(i, index) ++iterator;
+      return *iterator;
+   }
+};
+
+/***************************************************************************************************************************************************************
+* Compares indexed access, iteration, and middle insertion. Indexed access visits a fixed number of strided indices, as a full indexed loop over the linked
+* list is quadratic in the list size.
+***************************************************************************************************************************************************************/
+template<class L>
+Real RunBenchmarks(Benchmark& benchmark, const std::string& name, const size_t size)
+{
+   constexpr size_t n_samples = 1000;
+   const std::string suffix = " n=" + ToString(size);
+   Real checksum{};
+
+   L list;
+   FOR(i, size) list.push_back(static_cast<Real>(i));
+
+   benchmark.StartTimer(name + " indexed" + suffix);
+   FOR(i, n_samples) checksum += list[i * (size / n_samples)];
+   benchmark.StopTimer(name + " indexed" + suffix);
+
+   benchmark.StartTimer(name + " iterated" + suffix);
+   FOR_EACH(entry, list) checksum += entry;
+   benchmark.StopTimer(name + " iterated" + suffix);
+
+   benchmark.StartTimer(name + " middle insertion" + suffix);
+   FOR(i, n_samples) list.insert(std::next(list.begin(), list.size() / 2), static_cast<Real>(i));
+   benchmark.StopTimer(name + " middle insertion" + suffix);
+
+   return checksum + list.size();
+}
+
+int main()
+{
+   Benchmark benchmark(TimeUnit::MicroSecond);
+   Real checksum{};
+
+   for(const size_t size : {1000, 10000, 100000, 1000000})
+   {
+      checksum += RunBenchmarks<LinkedList<Real>>(benchmark, "Linked list", size);
+      checksum += RunBenchmarks<List<Real>>(benchmark, "List", size);
+   }
+
+   Print("Checksum:", checksum);
+   benchmark.PrintResults();
+}
@@ -0,0 +1,150 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#include "../../../include/Global.h"
+#include "../../Benchmark/include/Benchmark.h"
+#include "../include/Array.h"
+#include "../include/Simd.h"
+
+#include <cmath>
+#include <numeric>
+
+using namespace aprn;
+
+/***************************************************************************************************************************************************************
+* Compares the SIMD kernels at each supported instruction set level against the plain loops they replaced, for sizes from 16 up to 10^8 entries. The
+* largest size can be reduced with the first command line argument, since three arrays of 10^8 entries need 2.4GB of memory.
+***************************************************************************************************************************************************************/
+constexpr StaticArray<const char*, 4> SimdLevelNames{"Scalar", "SSE2", "AVX2", "AVX512"};
+
+int main(int argc, char** argv)
+{
+   const size_t max_size = argc > 1 ? std::stoul(argv[1]) : 100'000'000;
+   constexpr size_t n_laps = 10;
+   constexpr size_t entries_per_lap = 10'000'000;
+   Real checksum{};
+
+   for(const size_t size : {16, 256, 4'096, 65'536, 1'000'000, 10'000'000, 100'000'000})
+   {
+      if(size > max_size) break;
+
+      // Repeat short kernels within each lap so that each lap processes a similar number of entries.
+      const size_t n_reps = Max(entries_per_lap / size, size_t{1});
+      DynamicArray<Real> a(size), b(size), out(size);
+      std::iota(a.begin(), a.end(), One);
+      std::iota(b.begin(), b.end(), Two);
+      Benchmark benchmark(TimeUnit::MicroSecond);
+
+      FOR(lap, n_laps)
+      {
+         benchmark.StartTimer("Add Loop");
+         FOR(rep, n_reps) FOR(i, size) out[i] = a[i] + b[i];
+         benchmark.StopTimer("Add Loop");
+
+         benchmark.StartTimer("Subtract Loop");
+         FOR(rep, n_reps) FOR(i, size) out[i] = a[i] - b[i];
+         benchmark.StopTimer("Subtract Loop");
+
+         benchmark.StartTimer("Multiply Loop");
+         FOR(rep, n_reps) FOR(i, size) out[i] = a[i] * b[i];
+         benchmark.StopTimer("Multiply Loop");
+
+         benchmark.StartTimer("Divide Loop");
+         FOR(rep, n_reps) FOR(i, size) out[i] = a[i] / b[i];
+         benchmark.StopTimer("Divide Loop");
+
+         benchmark.StartTimer("Axpy Loop");
+         FOR(rep, n_reps) FOR(i, size) out[i] += Half * a[i];
+         benchmark.StopTimer("Axpy Loop");
+
+         benchmark.StartTimer("Dot Loop");
+         FOR(rep, n_reps) checksum += std::inner_product(a.begin(), a.end(), b.begin(), Zero);
+         benchmark.StopTimer("Dot Loop");
+
+         benchmark.StartTimer("Min Loop");
+         FOR(rep, n_reps) checksum += MinEntry(a.begin(), a.end());
+         benchmark.StopTimer("Min Loop");
+
+         benchmark.StartTimer("Max Loop");
+         FOR(rep, n_reps) checksum += MaxEntry(a.begin(), a.end());
+         benchmark.StopTimer("Max Loop");
+
+         benchmark.StartTimer("L1 Norm Loop");
+         FOR(rep, n_reps) checksum += std::accumulate(a.begin(), a.end(), Zero, [](const Real norm, const Real entry){ return norm + Abs(entry); });
+         benchmark.StopTimer("L1 Norm Loop");
+
+         benchmark.StartTimer("L2 Norm Loop");
+         FOR(rep, n_reps) checksum += std::sqrt(std::inner_product(a.begin(), a.end(), a.begin(), Zero));
+         benchmark.StopTimer("L2 Norm Loop");
+
+         benchmark.StartTimer("LInf Norm Loop");
+         FOR(rep, n_reps) checksum += std::accumulate(a.begin(), a.end(), Zero, [](const Real norm, const Real entry){ return Max(norm, Abs(entry)); });
+         benchmark.StopTimer("LInf Norm Loop");
+
+         for(int level = 0; level <= static_cast<int>(simd::DetectSimdLevel()); ++level)
+         {
+            simd::SetSimdLevel(static_cast<simd::SimdLevel>(level));
+            const std::string name = std::string(" ") + SimdLevelNames[level];
+
+            benchmark.StartTimer("Add" + name);
+            FOR(rep, n_reps) simd::Add(a.data(), b.data(), out.data(), size);
+            benchmark.StopTimer("Add" + name);
+
+            benchmark.StartTimer("Subtract" + name);
+            FOR(rep, n_reps) simd::Subtract(a.data(), b.data(), out.data(), size);
+            benchmark.StopTimer("Subtract" + name);
+
+            benchmark.StartTimer("Multiply" + name);
+            FOR(rep, n_reps) simd::Multiply(a.data(), b.data(), out.data(), size);
+            benchmark.StopTimer("Multiply" + name);
+
+            benchmark.StartTimer("Divide" + name);
+            FOR(rep, n_reps) simd::Divide(a.data(), b.data(), out.data(), size);
+            benchmark.StopTimer("Divide" + name);
+
+            benchmark.StartTimer("Axpy" + name);
+            FOR(rep, n_reps) simd::Axpy(Half, a.data(), out.data(), size);
+            benchmark.StopTimer("Axpy" + name);
+
+            benchmark.StartTimer("Dot" + name);
+            FOR(rep, n_reps) checksum += simd::Dot(a.data(), b.data(), size);
+            benchmark.StopTimer("Dot" + name);
+
+            benchmark.StartTimer("Min" + name);
+            FOR(rep, n_reps) checksum += simd::Min(a.data(), size);
+            benchmark.StopTimer("Min" + name);
+
+            benchmark.StartTimer("Max" + name);
+            FOR(rep, n_reps) checksum += simd::Max(a.data(), size);
+            benchmark.StopTimer("Max" + name);
+
+            benchmark.StartTimer("L1 Norm" + name);
+            FOR(rep, n_reps) checksum += simd::SumAbs(a.data(), size);
+            benchmark.StopTimer("L1 Norm" + name);
+
+            benchmark.StartTimer("L2 Norm" + name);
+            FOR(rep, n_reps) checksum += std::sqrt(simd::Dot(a.data(), a.data(), size));
+            benchmark.StopTimer("L2 Norm" + name);
+
+            benchmark.StartTimer("LInf Norm" + name);
+            FOR(rep, n_reps) checksum += simd::MaxAbs(a.data(), size);
+            benchmark.StopTimer("LInf Norm" + name);
+         }
+      }
+
+      Print("\nArray size:", size, "- repetitions per lap:", n_reps);
+      benchmark.PrintResults();
+   }
+   Print("Checksum:", checksum);
+}
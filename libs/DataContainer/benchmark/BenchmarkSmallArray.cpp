@@ -0,0 +1,94 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#include "../../../include/Global.h"
+#include "../../Benchmark/include/AllocationCounter.h"
+#include "../../Benchmark/include/Benchmark.h"
+#include "../include/Array.h"
+#include "../include/SmallArray.h"
+
+using namespace aprn;
+
+/***************************************************************************************************************************************************************
+* Emulates the small arrays migrated to SmallArray - the children of tree nodes, the attributes of vertex layouts, and frame buffer attachment lists - which
+* are built, copied, and traversed in bulk, with the default dynamic array and the small array.
+***************************************************************************************************************************************************************/
+struct Attribute
+{
+   unsigned Type;
+   unsigned nComponents;
+   bool     isNormalised;
+};
+
+template<class ChildArray, class AttributeArray, class AttachmentArray>
+size_t BuildArrays(const size_t n_instances)
+{
+   DArray<ChildArray> children(n_instances, ChildArray());
+   DArray<AttributeArray> layouts(n_instances, AttributeArray());
+   size_t checksum{};
+
+   FOR(i, n_instances)
+   {
+      FOR(j, i % 4 + 1) children[i].push_back(i + j);
+      FOR(j, 5) layouts[i].emplace_back(j, 3, false);
+
+      AttachmentArray attachments;
+      attachments.push_back(i);
+      attachments.push_back(i + 1);
+      checksum += attachments.size();
+   }
+
+   // Layouts are copied into each buffer that uses them.
+   const DArray<AttributeArray> layout_copies(layouts);
+
+   FOR_EACH(child_array, children) FOR_EACH(child, child_array) checksum += child;
+   FOR_EACH(layout, layout_copies) FOR_EACH(attribute, layout) checksum += attribute.nComponents;
+   return checksum;
+}
+
+int main()
+{
+   constexpr size_t n_repeats = 100;
+   Benchmark benchmark(TimeUnit::MicroSecond);
+   size_t checksum{};
+
+   for(const size_t n_instances : {10, 100, 1000, 10000})
+   {
+      const std::string suffix = " n=" + ToString(n_instances);
+      size_t dynamic_count{}, small_count{};
+
+      FOR(repeat, n_repeats)
+      {
+         size_t count = AllocationCount();
+         benchmark.StartTimer("DynamicArray" + suffix);
+         checksum += BuildArrays<DArray<size_t>, DArray<Attribute>, DArray<unsigned>>(n_instances);
+         benchmark.StopTimer("DynamicArray" + suffix);
+         dynamic_count += AllocationCount() - count;
+
+         count = AllocationCount();
+         benchmark.StartTimer("SmallArray" + suffix);
+         checksum += BuildArrays<SmallArray<size_t, 4>, SmallArray<Attribute, 8>, SmallArray<unsigned, 8>>(n_instances);
+         benchmark.StopTimer("SmallArray" + suffix);
+         small_count += AllocationCount() - count;
+      }
+
+      SetFormat(PrintFormat::Fixed);
+      SetPrecision(3);
+      Print("Instances:", n_instances, "- allocations per instance (dynamic/small):", static_cast<Real>(dynamic_count) / (n_repeats * n_instances),
+            static_cast<Real>(small_count) / (n_repeats * n_instances));
+   }
+
+   Print("Checksum:", checksum);
+   benchmark.PrintResults();
+}
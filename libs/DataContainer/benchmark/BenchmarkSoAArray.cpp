@@ -0,0 +1,147 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+
+#include "../../../include/Global.h"
+#include "../../Benchmark/include/Benchmark.h"
+#include "../include/Array.h"
+#include "../include/SoAArray.h"
+
+#include <cmath>
+
+using namespace aprn;
+
+/***************************************************************************************************************************************************************
+* Emulates the mesh vertices of the visualiser, with Phong normal computation and colour updates over a triangulated grid, with the vertices stored as an array
+* of structs (interleaved) and as a structure of arrays (separate).
+***************************************************************************************************************************************************************/
+struct Vec2 { float x, y; };
+
+struct Vec4 { float x, y, z, w; };
+
+struct Vec3
+{
+   Vec3& operator+=(const Vec3& v) { x += v.x; y += v.y; z += v.z; return *this; }
+
+   friend Vec3 operator-(const Vec3& a, const Vec3& b) { return {a.x - b.x, a.y - b.y, a.z - b.z}; }
+
+   float x, y, z;
+};
+
+Vec3 Cross(const Vec3& a, const Vec3& b) { return {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x}; }
+
+Vec3 Normalise(const Vec3& v)
+{
+   const float inverse_norm = 1.0f / std::sqrt(v.x * v.x + v.y * v.y + v.z * v.z);
+   return {v.x * inverse_norm, v.y * inverse_norm, v.z * inverse_norm};
+}
+
+struct Vertex
+{
+   Vec3 Position;
+   Vec3 Normal;
+   Vec3 Tangent;
+   Vec4 Colour;
+   Vec2 TextureCoordinates;
+};
+
+using VertexArrays = SoAArray<Vec3, Vec3, Vec3, Vec4, Vec2>;
+
+/** Compute Phong vertex normals, given accessors to the position and normal of each vertex. */
+template<class PositionAccessor, class NormalAccessor>
+void ComputeNormals(const DArray<unsigned>& indices, const size_t n_vertices, PositionAccessor position, NormalAccessor normal)
+{
+   FOR(iv, n_vertices) normal(iv) = {0.0f, 0.0f, 0.0f};
+
+   for(size_t it = 0; it < indices.size(); it += 3)
+   {
+      const unsigned iv0 = indices[it];
+      const unsigned iv1 = indices[it + 1];
+      const unsigned iv2 = indices[it + 2];
+      const Vec3 face_normal = Cross(position(iv1) - position(iv0), position(iv2) - position(iv0));
+      FOR(iv, 3) normal(indices[it + iv]) += face_normal;
+   }
+
+   FOR(iv, n_vertices) normal(iv) = Normalise(normal(iv));
+}
+
+int main()
+{
+   constexpr size_t n_repeats = 10;
+   Benchmark benchmark(TimeUnit::MilliSecond);
+   Real checksum{};
+
+   for(const size_t n : {100, 1000})
+   {
+      // Triangulate an n x n grid of vertices on a wavy surface.
+      const size_t n_vertices = n * n;
+      DArray<Vertex> vertices(n_vertices, Vertex());
+      VertexArrays separate_vertices(n_vertices);
+      FOR(j, n) FOR(i, n)
+      {
+         const float x = static_cast<float>(i) / static_cast<float>(n);
+         const float y = static_cast<float>(j) / static_cast<float>(n);
+         const Vec3 position{x, y, std::sin(10.0f * x) * std::cos(10.0f * y)};
+         vertices[i + n * j].Position = position;
+         std::get<0>(separate_vertices[i + n * j]) = position;
+      }
+
+      DArray<unsigned> indices;
+      indices.reserve(6 * (n - 1) * (n - 1));
+      FOR(j, n - 1) FOR(i, n - 1)
+      {
+         const auto v = static_cast<unsigned>(i + n * j);
+         const auto m = static_cast<unsigned>(n);
+         for(const unsigned index : {v, v + 1, v + m + 1, v, v + m + 1, v + m}) indices.push_back(index);
+      }
+
+      const std::string suffix = " n=" + ToString(n_vertices);
+      const Vec4 colour{0.5f, 0.5f, 1.0f, 1.0f};
+      FOR(repeat, n_repeats)
+      {
+         benchmark.StartTimer("AoS normals" + suffix);
+         ComputeNormals(indices, n_vertices, [&](const size_t i) -> const Vec3& { return vertices[i].Position; },
+                        [&](const size_t i) -> Vec3& { return vertices[i].Normal; });
+         benchmark.StopTimer("AoS normals" + suffix);
+
+         const Vec3* positions = separate_vertices.Field<0>().data();
+         Vec3* normals = separate_vertices.Field<1>().data();
+         benchmark.StartTimer("SoA normals" + suffix);
+         ComputeNormals(indices, n_vertices, [positions](const size_t i) -> const Vec3& { return positions[i]; },
+                        [normals](const size_t i) -> Vec3& { return normals[i]; });
+         benchmark.StopTimer("SoA normals" + suffix);
+
+         benchmark.StartTimer("AoS colour" + suffix);
+         FOR_EACH(vertex, vertices) vertex.Colour = colour;
+         benchmark.StopTimer("AoS colour" + suffix);
+
+         benchmark.StartTimer("SoA colour" + suffix);
+         FOR_EACH(vertex_colour, separate_vertices.Field<3>()) vertex_colour = colour;
+         benchmark.StopTimer("SoA colour" + suffix);
+
+         // Separate vertices are interleaved for every upload.
+         DArray<Vertex> upload(n_vertices, Vertex());
+         benchmark.StartTimer("SoA interleave" + suffix);
+         size_t iv{};
+         for(const auto& [position, normal, tangent, vertex_colour, texture_coordinates] : std::as_const(separate_vertices))
+            upload[iv++] = {position, normal, tangent, vertex_colour, texture_coordinates};
+         benchmark.StopTimer("SoA interleave" + suffix);
+
+         checksum += vertices[n_vertices / 2].Normal.z + normals[n_vertices / 2].z + upload.back().Colour.x;
+      }
+   }
+
+   Print("Checksum:", checksum);
+   benchmark.PrintResults();
+}
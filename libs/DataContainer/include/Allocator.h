@@ -0,0 +1,139 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+#include "../../../include/Global.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+
+namespace aprn {
+
+/** Size of a cache line, which is also the widest SIMD register width (AVX-512). */
+constexpr size_t CacheLineSize = 64;
+
+/***************************************************************************************************************************************************************
+* Aligned Allocator
+***************************************************************************************************************************************************************/
+
+/** Allocator returning memory aligned to a given power-of-two boundary, e.g. for SIMD loads or to avoid false sharing between threads. */
+template<typename T, size_t Alignment = CacheLineSize>
+class AlignedAllocator
+{
+   static_assert(Alignment >= alignof(T) && (Alignment & (Alignment - 1)) == 0, "The alignment must be a power of two no smaller than the type alignment.");
+
+ public:
+   using value_type = T;
+
+   template<typename U>
+   struct rebind { using other = AlignedAllocator<U, Alignment>; };
+
+   constexpr AlignedAllocator() noexcept = default;
+
+   template<typename U>
+   constexpr AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+   [[nodiscard]] T* allocate(const size_t n) { return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{Alignment})); }
+
+   void deallocate(T* ptr, const size_t) noexcept { ::operator delete(ptr, std::align_val_t{Alignment}); }
+
+   template<typename U>
+   constexpr bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept { return true; }
+};
+
+/***************************************************************************************************************************************************************
+* Memory Arena
+***************************************************************************************************************************************************************/
+
+/** Monotonic memory arena. Allocations bump a pointer through a list of large blocks and individual deallocations are no-ops; all memory is recycled at once
+ *  by Reset(), e.g. at the start of every frame. After a reset the blocks are coalesced into a single block, so that a steady-state workload makes no system
+ *  allocations at all. */
+class MemoryArena
+{
+ public:
+   explicit MemoryArena(const size_t block_size = 16 * 1024);
+
+   MemoryArena(const MemoryArena&) = delete;
+
+   MemoryArena& operator=(const MemoryArena&) = delete;
+
+   ~MemoryArena();
+
+   /** Allocate a number of bytes with a given power-of-two alignment. */
+   [[nodiscard]] void* Allocate(const size_t bytes, const size_t alignment = alignof(std::max_align_t));
+
+   /** Recycle all memory allocated since the last reset. Any memory still referenced becomes invalid. */
+   void Reset();
+
+   /** Statistics. */
+   inline size_t BytesUsed() const { return UsedBytes_ + Offset_; }
+
+   inline size_t Capacity() const;
+
+   inline size_t SystemAllocationCount() const { return SystemAllocations_; }
+
+ private:
+   struct Block
+   {
+      std::byte* Data;
+      size_t     Size;
+   };
+
+   void AllocateBlock(const size_t size);
+
+   void ReleaseBlocks();
+
+   std::vector<Block> Blocks_;
+   size_t             BlockSize_;
+   size_t             Current_{};
+   size_t             Offset_{};
+   size_t             UsedBytes_{}; // Bytes used in blocks preceding the current block.
+   size_t             SystemAllocations_{};
+};
+
+/***************************************************************************************************************************************************************
+* Arena Allocator
+***************************************************************************************************************************************************************/
+
+/** Standard-library compatible allocator drawing its memory from a MemoryArena. Containers using it must not outlive the next reset of the arena. */
+template<typename T>
+class ArenaAllocator
+{
+ public:
+   using value_type = T;
+
+   constexpr explicit ArenaAllocator(MemoryArena& arena) noexcept : Arena_(&arena) {}
+
+   template<typename U>
+   constexpr ArenaAllocator(const ArenaAllocator<U>& other) noexcept : Arena_(other.Arena()) {}
+
+   [[nodiscard]] T* allocate(const size_t n) { return static_cast<T*>(Arena_->Allocate(n * sizeof(T), alignof(T))); }
+
+   void deallocate(T*, const size_t) noexcept {}
+
+   constexpr MemoryArena* Arena() const noexcept { return Arena_; }
+
+   template<typename U>
+   constexpr bool operator==(const ArenaAllocator<U>& other) const noexcept { return Arena_ == other.Arena(); }
+
+ private:
+   MemoryArena* Arena_;
+};
+
+}
+
+#include "Allocator.tpp"
@@ -0,0 +1,94 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+namespace aprn {
+
+/***************************************************************************************************************************************************************
+* Memory Arena
+***************************************************************************************************************************************************************/
+inline
+MemoryArena::MemoryArena(const size_t block_size)
+   : BlockSize_(block_size)
+{
+   ASSERT(block_size, "The arena block size must be non-zero.")
+}
+
+inline
+MemoryArena::~MemoryArena() { ReleaseBlocks(); }
+
+inline void*
+MemoryArena::Allocate(const size_t bytes, const size_t alignment)
+{
+   DEBUG_ASSERT(alignment && (alignment & (alignment - 1)) == 0, "The alignment ", alignment, " must be a power of two.")
+
+   // Find the first block, starting from the current one, with enough space for the aligned allocation.
+   while(Current_ < Blocks_.size())
+   {
+      const auto address = reinterpret_cast<std::uintptr_t>(Blocks_[Current_].Data) + Offset_;
+      const size_t padding = (alignment - address % alignment) % alignment;
+      if(Offset_ + padding + bytes <= Blocks_[Current_].Size)
+      {
+         Offset_ += padding + bytes;
+         return reinterpret_cast<void*>(address + padding);
+      }
+      UsedBytes_ += Offset_;
+      Offset_ = 0;
+      ++Current_;
+   }
+
+   // Otherwise, allocate a new block, which is aligned to a cache line, and large enough for any alignment up to a cache line.
+   AllocateBlock(Max(BlockSize_, bytes + alignment));
+   return Allocate(bytes, alignment);
+}
+
+inline void
+MemoryArena::Reset()
+{
+   // Coalesce multiple blocks into one, so that the next cycle fits into a single block.
+   if(Blocks_.size() > 1)
+   {
+      const size_t capacity = Capacity();
+      ReleaseBlocks();
+      AllocateBlock(capacity);
+   }
+   Current_   = 0;
+   Offset_    = 0;
+   UsedBytes_ = 0;
+}
+
+inline size_t
+MemoryArena::Capacity() const
+{
+   size_t capacity{};
+   FOR_EACH_CONST(block, Blocks_) capacity += block.Size;
+   return capacity;
+}
+
+inline void
+MemoryArena::AllocateBlock(const size_t size)
+{
+   Blocks_.push_back({static_cast<std::byte*>(::operator new(size, std::align_val_t{CacheLineSize})), size});
+   ++SystemAllocations_;
+}
+
+inline void
+MemoryArena::ReleaseBlocks()
+{
+   FOR_EACH(block, Blocks_) ::operator delete(block.Data, std::align_val_t{CacheLineSize});
+   Blocks_.clear();
+}
+
+}
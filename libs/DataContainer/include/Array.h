@@ -15,9 +15,11 @@
 #pragma once
 
 #include "../../../include/Global.h"
+#include "Allocator.h"
 
 #include <array>
 #include <initializer_list>
+#include <iterator>
 #include <vector>
 
 namespace aprn {
@@ -90,32 +92,37 @@ class StaticArray : public std::array<T, N>,
 /***************************************************************************************************************************************************************
 * Dynamic Array Class
 ***************************************************************************************************************************************************************/
-template<typename T>
-class DynamicArray : public std::vector<T>,
-                     public Array<T, DynamicArray<T>>
+
+/** Dynamic array with an optional allocator, e.g. AlignedAllocator for SIMD-friendly storage or ArenaAllocator for transient per-frame arrays. */
+template<typename T, class Alloc = std::allocator<T>>
+class DynamicArray : public std::vector<T, Alloc>,
+                     public Array<T, DynamicArray<T, Alloc>>
 {
-   using Base = Array<T, DynamicArray<T>>;
+   using Base = Array<T, DynamicArray<T, Alloc>>;
+   using BaseVector = std::vector<T, Alloc>;
 
  public:
    DynamicArray();
 
-   explicit DynamicArray(const size_t size);
+   explicit DynamicArray(const Alloc& allocator);
+
+   explicit DynamicArray(const size_t size, const Alloc& allocator = Alloc());
 
-   DynamicArray(const size_t size, const std::convertible_to<T> auto& value);
+   DynamicArray(const size_t size, const std::convertible_to<T> auto& value, const Alloc& allocator = Alloc());
 
    template<std::convertible_to<T> T2>
-   DynamicArray(const std::initializer_list<T2>& list);
+   DynamicArray(const std::initializer_list<T2>& list, const Alloc& allocator = Alloc());
 
-   template<class It>
-   DynamicArray(It first, It last);
+   template<std::input_iterator It>
+   DynamicArray(It first, It last, const Alloc& allocator = Alloc());
 
    void Append(const T& value);
 
    void Append(T&& value) noexcept;
 
-   void Append(const DynamicArray<T>& other);
+   void Append(const DynamicArray<T, Alloc>& other);
 
-   void Append(DynamicArray<T>&& other) noexcept;
+   void Append(DynamicArray<T, Alloc>&& other) noexcept;
 
    template<class It>
    void Append(It first, It last, const bool move_all = false);
@@ -146,7 +153,11 @@ template<size_t N> using SArrayF = SArray<Real, N>;
 /***************************************************************************************************************************************************************
 * Dynamic Array Aliases
 ***************************************************************************************************************************************************************/
-template<typename T> using DArray = DynamicArray<T>;
+template<typename T, class Alloc = std::allocator<T>> using DArray = DynamicArray<T, Alloc>;
+
+/** Dynamic arrays with cache-line aligned storage, and with storage drawn from a memory arena. */
+template<typename T> using AlignedDArray = DArray<T, AlignedAllocator<T>>;
+template<typename T> using ArenaDArray   = DArray<T, ArenaAllocator<T>>;
 
 using DArrayB = DArray<Bool>;
 using DArrayU = DArray<size_t>;
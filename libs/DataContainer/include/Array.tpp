@@ -69,7 +69,7 @@ template<std::convertible_to<T> T2>
 constexpr D&
 Array<T, D>::operator=(const std::initializer_list<T2>& value_list) noexcept
 {
-   if constexpr(isTypeSame<D, DynamicArray<T>>()) Derived().resize(value_list.size());
+   if constexpr(requires(D& derived) { derived.resize(value_list.size()); }) Derived().resize(value_list.size());
    size_t index(0);
    FOR_EACH(entry, value_list) Derived()[index++] = entry;
    return Derived();
@@ -132,48 +132,52 @@ constexpr StaticArray<T, N>::StaticArray(It first, It last)
 /***************************************************************************************************************************************************************
 * Dynamic Array Class
 ***************************************************************************************************************************************************************/
-template<typename T>
-DynamicArray<T>::DynamicArray()
-   : std::vector<T>() {}
+template<typename T, class Alloc>
+DynamicArray<T, Alloc>::DynamicArray()
+   : BaseVector() {}
 
-template<typename T>
-DynamicArray<T>::DynamicArray(const size_t size)
-   : DynamicArray(size, DynamicInitValue<T>()) {}
+template<typename T, class Alloc>
+DynamicArray<T, Alloc>::DynamicArray(const Alloc& allocator)
+   : BaseVector(allocator) {}
 
-template<typename T>
-DynamicArray<T>::DynamicArray(const size_t size, const std::convertible_to<T> auto& value)
-   : std::vector<T>(size, value) {}
+template<typename T, class Alloc>
+DynamicArray<T, Alloc>::DynamicArray(const size_t size, const Alloc& allocator)
+   : DynamicArray(size, DynamicInitValue<T>(), allocator) {}
 
-template<typename T>
+template<typename T, class Alloc>
+DynamicArray<T, Alloc>::DynamicArray(const size_t size, const std::convertible_to<T> auto& value, const Alloc& allocator)
+   : BaseVector(size, value, allocator) {}
+
+template<typename T, class Alloc>
 template<std::convertible_to<T> T2>
-DynamicArray<T>::DynamicArray(const std::initializer_list<T2>& list)
-   : std::vector<T>(list) {}
+DynamicArray<T, Alloc>::DynamicArray(const std::initializer_list<T2>& list, const Alloc& allocator)
+   : BaseVector(list.begin(), list.end(), allocator) {}
 
-template<typename T>
-template<class It>
-DynamicArray<T>::DynamicArray(It first, It last)
-   : std::vector<T>(first, last) {}
+template<typename T, class Alloc>
+template<std::input_iterator It>
+DynamicArray<T, Alloc>::DynamicArray(It first, It last, const Alloc& allocator)
+   : BaseVector(first, last, allocator) {}
 
-template<typename T>
+template<typename T, class Alloc>
 void
-DynamicArray<T>::Append(const T& value) { this->push_back(value); }
+DynamicArray<T, Alloc>::Append(const T& value) { this->push_back(value); }
 
-template<typename T>
+template<typename T, class Alloc>
 void
-DynamicArray<T>::Append(T&& value) noexcept { this->push_back(std::move(value)); }
+DynamicArray<T, Alloc>::Append(T&& value) noexcept { this->push_back(std::move(value)); }
 
-template<typename T>
+template<typename T, class Alloc>
 void
-DynamicArray<T>::Append(const DynamicArray<T>& other) { Append(other.cbegin(), other.cend(), false); }
+DynamicArray<T, Alloc>::Append(const DynamicArray<T, Alloc>& other) { Append(other.cbegin(), other.cend(), false); }
 
-template<typename T>
+template<typename T, class Alloc>
 void
-DynamicArray<T>::Append(DynamicArray<T>&& other) noexcept { Append(other.begin(), other.end(), true); }
+DynamicArray<T, Alloc>::Append(DynamicArray<T, Alloc>&& other) noexcept { Append(other.begin(), other.end(), true); }
 
-template<typename T>
+template<typename T, class Alloc>
 template<class It>
 void
-DynamicArray<T>::Append(It first, It last, const bool move_all)
+DynamicArray<T, Alloc>::Append(It first, It last, const bool move_all)
 {
    this->reserve(this->size() + std::distance(first, last));
 
@@ -181,13 +185,12 @@ DynamicArray<T>::Append(It first, It last, const bool move_all)
    else          this->insert(this->end(), std::make_move_iterator(first), std::make_move_iterator(last));
 }
 
-template<typename T>
+template<typename T, class Alloc>
 void
-DynamicArray<T>::Erase()
+DynamicArray<T, Alloc>::Erase()
 {
    this->clear();
    this->shrink_to_fit();
 }
 
 }
-
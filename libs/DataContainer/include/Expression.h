@@ -0,0 +1,267 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+#include "../../../include/Global.h"
+#include "../../../include/Concepts.h"
+#include "Simd.h"
+
+#include <functional>
+
+namespace aprn {
+namespace detail {
+
+template<Arithmetic T, class D> class NumericContainer;
+
+/***************************************************************************************************************************************************************
+* Expression Abstract Base Class
+***************************************************************************************************************************************************************/
+
+/** Entries of an expression are only computed when it is assigned to (or used to construct) a numeric container, so that compound expressions such as
+ *  a + b * 2 - c are evaluated in a single pass without any intermediate containers. Derived classes must provide operator[] and size(). */
+template<Arithmetic T, class E>
+class Expression
+{
+ protected:
+   constexpr Expression() = default;
+
+ public:
+   /** Derived Class Access */
+   constexpr E& Derived() noexcept { return static_cast<E&>(*this); }
+
+   constexpr const E& Derived() const noexcept { return static_cast<const E&>(*this); }
+};
+
+/***************************************************************************************************************************************************************
+* Expression Type Traits
+***************************************************************************************************************************************************************/
+template<Arithmetic T, class D> T NumericEntryType(const NumericContainer<T, D>*);
+template<Arithmetic T, class E> T NumericEntryType(const Expression<T, E>*);
+template<Arithmetic T, class D> D NumericContainerType(const NumericContainer<T, D>*);
+template<Arithmetic T, class E> E ExpressionType(const Expression<T, E>*);
+
+/** Entry type of a numeric container or expression. */
+template<class X>
+using EntryType = decltype(NumericEntryType(std::declval<const RemoveConstRef<X>*>()));
+
+/** Most-derived type of a numeric container. */
+template<class X>
+using ContainerType = decltype(NumericContainerType(std::declval<const RemoveConstRef<X>*>()));
+
+template<class X> concept NumericContainerOperand = requires { typename ContainerType<X>; };
+template<class X> concept ExpressionOperand       = requires { ExpressionType(std::declval<const RemoveConstRef<X>*>()); };
+template<class X> concept NumericOperand          = NumericContainerOperand<X> || ExpressionOperand<X>;
+
+/** Pair of numeric operands with a common entry type. */
+template<class L, class R>
+concept NumericOperandPair = NumericOperand<L> && NumericOperand<R> && isTypeSame<EntryType<L>, EntryType<R>>();
+
+/** Numeric operands of which at least one is an unevaluated expression. */
+template<class... Xs>
+concept AnyExpressionOperand = (NumericOperand<Xs> && ...) && (ExpressionOperand<Xs> || ...);
+
+/** Scalars that may be combined with the entries of a numeric operand. */
+template<class S, class X>
+concept ScalarOperand = NumericOperand<X> && !NumericOperand<S> && std::convertible_to<S, EntryType<X>>;
+
+/** Operands addressed through a stride table, e.g. MultiArrayView, whose entries are accessed directly rather than by seeking an iterator. */
+template<class X>
+concept StridedOperand = requires(const X& operand, const size_t index) { operand.Strides(); operand[index]; };
+
+/***************************************************************************************************************************************************************
+* Expression Node Classes
+***************************************************************************************************************************************************************/
+
+/** Terminal expression wrapping a numeric container. Lvalue containers are referenced, whereas rvalue containers are moved into the expression so that an
+ *  expression never outlives its operands. */
+template<Arithmetic T, class C>
+class TerminalExpression final : public Expression<T, TerminalExpression<T, C>>
+{
+ public:
+   using Result = RemoveConstRef<C>;
+
+   constexpr explicit TerminalExpression(C&& container) : Container_(std::forward<C>(container)) {}
+
+   constexpr T operator[](const size_t index) const
+   {
+      if constexpr(StridedOperand<Result>) return Container_[index];
+      else                                 return *(Container_.begin() + index);
+   }
+
+   constexpr size_t size() const { return Container_.size(); }
+
+   constexpr const Result& Container() const { return Container_; }
+
+ private:
+   C Container_;
+};
+
+/** Entry-wise binary operation between two equally sized operands. */
+template<Arithmetic T, class L, class R, class Op>
+class BinaryExpression final : public Expression<T, BinaryExpression<T, L, R, Op>>
+{
+ public:
+   using Result    = typename L::Result;
+   using Operation = Op;
+
+   constexpr BinaryExpression(L left, R right);
+
+   constexpr T operator[](const size_t index) const { return Op{}(Left_[index], Right_[index]); }
+
+   constexpr size_t size() const { return Left_.size(); }
+
+   constexpr const L& Left() const { return Left_; }
+
+   constexpr const R& Right() const { return Right_; }
+
+ private:
+   L Left_;
+   R Right_;
+};
+
+/** Entry-wise binary operation between an operand and a scalar. */
+template<Arithmetic T, class E, typename S, class Op>
+class ScalarExpression final : public Expression<T, ScalarExpression<T, E, S, Op>>
+{
+ public:
+   using Result    = typename E::Result;
+   using Operation = Op;
+
+   constexpr ScalarExpression(E operand, const S scalar) : Operand_(std::move(operand)), Scalar_(scalar) {}
+
+   constexpr T operator[](const size_t index) const { return static_cast<T>(Op{}(Operand_[index], Scalar_)); }
+
+   constexpr size_t size() const { return Operand_.size(); }
+
+   constexpr const E& Operand() const { return Operand_; }
+
+   constexpr S Scalar() const { return Scalar_; }
+
+ private:
+   E Operand_;
+   S Scalar_;
+};
+
+/** Entry-wise unary operation. */
+template<Arithmetic T, class E, class Op>
+class UnaryExpression final : public Expression<T, UnaryExpression<T, E, Op>>
+{
+ public:
+   using Result = typename E::Result;
+
+   constexpr explicit UnaryExpression(E operand) : Operand_(std::move(operand)) {}
+
+   constexpr T operator[](const size_t index) const { return Op{}(Operand_[index]); }
+
+   constexpr size_t size() const { return Operand_.size(); }
+
+ private:
+   E Operand_;
+};
+
+/** Entry-wise division, asserting a non-zero divisor in debug mode. The vectorised divisions instead assert a non-zero minimum absolute divisor, which is
+ *  reduced with a single SIMD pass. */
+struct CheckedDivides
+{
+   template<typename T1, typename T2>
+   constexpr auto operator()(const T1& numerator, const T2& denominator) const
+   {
+      DEBUG_ASSERT(!isEqual(static_cast<Real>(denominator), Zero), "Cannot divide by zero.")
+      return numerator / denominator;
+   }
+};
+
+/***************************************************************************************************************************************************************
+* Expression Construction and Evaluation
+***************************************************************************************************************************************************************/
+
+/** Convert a numeric container or expression into an expression node. */
+template<class X>
+requires NumericOperand<X>
+constexpr auto MakeExpression(X&& operand);
+
+/** Evaluate an expression into its plain container type. Containers are returned as they are. */
+template<class X>
+requires NumericOperand<X>
+constexpr decltype(auto) Evaluate(X&& operand);
+
+/** Evaluate an entry-wise operation between contiguous containers and/or a scalar using the SIMD kernels. Returns false, without writing any entries, if
+ *  the expression has no matching kernel. */
+template<class E, simd::SimdScalar S>
+bool EvaluateSimd(const E& expression, S* out);
+
+/** Accumulate out += alpha * x using the SIMD axpy kernel, if the expression is of this form. Returns false, without writing any entries, otherwise. */
+template<class E, simd::SimdScalar S>
+bool AccumulateSimd(const E& expression, S* out, const S sign = S{1});
+
+/***************************************************************************************************************************************************************
+* Expression Operator Overloads
+***************************************************************************************************************************************************************/
+
+/** Entry-wise binary arithmetic operator overloads. */
+template<class L, class R>
+requires NumericOperandPair<L, R>
+constexpr auto operator+(L&& left, R&& right);
+
+template<class L, class R>
+requires NumericOperandPair<L, R>
+constexpr auto operator-(L&& left, R&& right);
+
+template<class L, class R>
+requires NumericOperandPair<L, R>
+constexpr auto operator*(L&& left, R&& right);
+
+template<class L, class R>
+requires NumericOperandPair<L, R>
+constexpr auto operator/(L&& left, R&& right);
+
+/** Scalar arithmetic operator overloads. */
+template<class X, class S>
+requires ScalarOperand<S, X>
+constexpr auto operator+(X&& operand, const S scalar);
+
+template<class X, class S>
+requires ScalarOperand<S, X>
+constexpr auto operator-(X&& operand, const S scalar);
+
+template<class X, class S>
+requires ScalarOperand<S, X>
+constexpr auto operator*(X&& operand, const S scalar);
+
+template<class X, class S>
+requires ScalarOperand<S, X>
+constexpr auto operator*(const S scalar, X&& operand);
+
+template<class X, class S>
+requires ScalarOperand<S, X>
+constexpr auto operator/(X&& operand, const S scalar);
+
+/** Entry-wise unary operator overloads. */
+template<class X>
+requires NumericOperand<X>
+constexpr auto operator-(X&& operand);
+
+/** Comparison operator overloads. */
+template<class L, class R>
+requires AnyExpressionOperand<L, R> && NumericOperandPair<L, R>
+constexpr bool operator==(const L& left, const R& right);
+
+}//detail
+
+using detail::Evaluate;
+
+}//aprn
+
+#include "Expression.tpp"
@@ -0,0 +1,226 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+namespace aprn {
+namespace detail {
+
+/***************************************************************************************************************************************************************
+* Expression Node Classes
+***************************************************************************************************************************************************************/
+template<Arithmetic T, class L, class R, class Op>
+constexpr BinaryExpression<T, L, R, Op>::BinaryExpression(L left, R right)
+   : Left_(std::move(left)), Right_(std::move(right))
+{
+   DEBUG_ASSERT(Left_.size() == Right_.size(), "The expression operand sizes ", Left_.size(), " and ", Right_.size(), " must be equal.")
+}
+
+/***************************************************************************************************************************************************************
+* Expression Construction and Evaluation
+***************************************************************************************************************************************************************/
+template<class X>
+requires NumericOperand<X>
+constexpr auto
+MakeExpression(X&& operand)
+{
+   if constexpr(ExpressionOperand<X>) return RemoveConstRef<X>(std::forward<X>(operand));
+   else
+   {
+      using T = EntryType<X>;
+      using D = ContainerType<X>;
+      if constexpr(isLValueReference<X&&>()) return TerminalExpression<T, const D&>(static_cast<const D&>(operand));
+      else                                   return TerminalExpression<T, D>(static_cast<D&&>(operand));
+   }
+}
+
+template<class X>
+requires NumericOperand<X>
+constexpr decltype(auto)
+Evaluate(X&& operand)
+{
+   if constexpr(ExpressionOperand<X>) return typename RemoveConstRef<X>::Result(operand);
+   else                               return std::forward<X>(operand);
+}
+
+/***************************************************************************************************************************************************************
+* SIMD Evaluation
+***************************************************************************************************************************************************************/
+template<class E, simd::SimdScalar S>
+bool
+EvaluateSimd(const E& expression, S* out)
+{
+   if constexpr(requires { { expression.Left().Container() } -> simd::SimdContiguous; { expression.Right().Container() } -> simd::SimdContiguous; })
+   {
+      using Op = typename E::Operation;
+      const S* left  = expression.Left().Container().data();
+      const S* right = expression.Right().Container().data();
+      const size_t n = expression.size();
+
+      if constexpr     (isTypeSame<Op, std::plus<S>>())       simd::Add(left, right, out, n);
+      else if constexpr(isTypeSame<Op, std::minus<S>>())      simd::Subtract(left, right, out, n);
+      else if constexpr(isTypeSame<Op, std::multiplies<S>>()) simd::Multiply(left, right, out, n);
+      else if constexpr(isTypeSame<Op, CheckedDivides>())
+      {
+         DEBUG_ASSERT(!n || !isEqual(static_cast<Real>(simd::MinAbs(right, n)), Zero), "Cannot divide by zero.")
+         simd::Divide(left, right, out, n);
+      }
+      else return false;
+      return true;
+   }
+   else if constexpr(requires { { expression.Operand().Container() } -> simd::SimdContiguous; })
+   {
+      using Op = typename E::Operation;
+      const S* operand = expression.Operand().Container().data();
+      const S  scalar  = static_cast<S>(expression.Scalar());
+      const size_t n   = expression.size();
+
+      if constexpr     (isTypeSame<Op, std::plus<>>())       simd::AddScalar(operand, scalar, out, n);
+      else if constexpr(isTypeSame<Op, std::minus<>>())      simd::SubtractScalar(operand, scalar, out, n);
+      else if constexpr(isTypeSame<Op, std::multiplies<>>()) simd::MultiplyScalar(operand, scalar, out, n);
+      else if constexpr(isTypeSame<Op, std::divides<>>())    simd::DivideScalar(operand, scalar, out, n);
+      else return false;
+      return true;
+   }
+   else return false;
+}
+
+template<class E, simd::SimdScalar S>
+bool
+AccumulateSimd(const E& expression, S* out, const S sign)
+{
+   if constexpr(requires { { expression.Operand().Container() } -> simd::SimdContiguous; })
+   {
+      if constexpr(isTypeSame<typename E::Operation, std::multiplies<>>())
+      {
+         simd::Axpy(sign * static_cast<S>(expression.Scalar()), expression.Operand().Container().data(), out, expression.size());
+         return true;
+      }
+   }
+   return false;
+}
+
+/***************************************************************************************************************************************************************
+* Expression Operator Overloads
+***************************************************************************************************************************************************************/
+
+/** Entry-wise binary arithmetic operator overloads. */
+template<class L, class R>
+requires NumericOperandPair<L, R>
+constexpr auto
+operator+(L&& left, R&& right)
+{
+   auto l = MakeExpression(std::forward<L>(left));
+   auto r = MakeExpression(std::forward<R>(right));
+   return BinaryExpression<EntryType<L>, decltype(l), decltype(r), std::plus<EntryType<L>>>(std::move(l), std::move(r));
+}
+
+template<class L, class R>
+requires NumericOperandPair<L, R>
+constexpr auto
+operator-(L&& left, R&& right)
+{
+   auto l = MakeExpression(std::forward<L>(left));
+   auto r = MakeExpression(std::forward<R>(right));
+   return BinaryExpression<EntryType<L>, decltype(l), decltype(r), std::minus<EntryType<L>>>(std::move(l), std::move(r));
+}
+
+template<class L, class R>
+requires NumericOperandPair<L, R>
+constexpr auto
+operator*(L&& left, R&& right)
+{
+   auto l = MakeExpression(std::forward<L>(left));
+   auto r = MakeExpression(std::forward<R>(right));
+   return BinaryExpression<EntryType<L>, decltype(l), decltype(r), std::multiplies<EntryType<L>>>(std::move(l), std::move(r));
+}
+
+template<class L, class R>
+requires NumericOperandPair<L, R>
+constexpr auto
+operator/(L&& left, R&& right)
+{
+   auto l = MakeExpression(std::forward<L>(left));
+   auto r = MakeExpression(std::forward<R>(right));
+   return BinaryExpression<EntryType<L>, decltype(l), decltype(r), CheckedDivides>(std::move(l), std::move(r));
+}
+
+/** Scalar arithmetic operator overloads. */
+template<class X, class S>
+requires ScalarOperand<S, X>
+constexpr auto
+operator+(X&& operand, const S scalar)
+{
+   auto x = MakeExpression(std::forward<X>(operand));
+   return ScalarExpression<EntryType<X>, decltype(x), S, std::plus<>>(std::move(x), scalar);
+}
+
+template<class X, class S>
+requires ScalarOperand<S, X>
+constexpr auto
+operator-(X&& operand, const S scalar)
+{
+   auto x = MakeExpression(std::forward<X>(operand));
+   return ScalarExpression<EntryType<X>, decltype(x), S, std::minus<>>(std::move(x), scalar);
+}
+
+template<class X, class S>
+requires ScalarOperand<S, X>
+constexpr auto
+operator*(X&& operand, const S scalar)
+{
+   auto x = MakeExpression(std::forward<X>(operand));
+   return ScalarExpression<EntryType<X>, decltype(x), S, std::multiplies<>>(std::move(x), scalar);
+}
+
+template<class X, class S>
+requires ScalarOperand<S, X>
+constexpr auto
+operator*(const S scalar, X&& operand) { return std::forward<X>(operand) * scalar; }
+
+template<class X, class S>
+requires ScalarOperand<S, X>
+constexpr auto
+operator/(X&& operand, const S scalar)
+{
+   DEBUG_ASSERT(!isEqual(static_cast<Real>(scalar), Zero), "Cannot divide by zero.")
+   auto x = MakeExpression(std::forward<X>(operand));
+   return ScalarExpression<EntryType<X>, decltype(x), S, std::divides<>>(std::move(x), scalar);
+}
+
+/** Entry-wise unary operator overloads. */
+template<class X>
+requires NumericOperand<X>
+constexpr auto
+operator-(X&& operand)
+{
+   auto x = MakeExpression(std::forward<X>(operand));
+   return UnaryExpression<EntryType<X>, decltype(x), std::negate<EntryType<X>>>(std::move(x));
+}
+
+/** Comparison operator overloads. */
+template<class L, class R>
+requires AnyExpressionOperand<L, R> && NumericOperandPair<L, R>
+constexpr bool
+operator==(const L& left, const R& right)
+{
+   const auto l = MakeExpression(left);
+   const auto r = MakeExpression(right);
+   if(l.size() != r.size()) return false;
+   FOR(i, l.size()) if(l[i] != r[i]) return false;
+   return true;
+}
+
+}//detail
+}//aprn
@@ -0,0 +1,76 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+
+#pragma once
+
+#include "../../../include/Global.h"
+
+#include <span>
+
+namespace aprn {
+
+/***************************************************************************************************************************************************************
+* Multi-dimensional Array Layout Policies
+***************************************************************************************************************************************************************/
+
+/** A layout policy maps a multi-index within given dimensions to a linear storage index, and back. The mappings are constexpr, so are resolved at compile time
+ *  for static arrays. */
+
+/** Column-major layout, in which the first index varies fastest, as in Fortran and BLAS. Suited to column-oriented algorithms such as LU and QR. */
+struct ColumnMajor
+{
+   static constexpr size_t LinearIndex(std::span<const size_t> dimensions, std::span<const size_t> multi_index);
+
+   static constexpr void MultiIndex(std::span<const size_t> dimensions, size_t index, std::span<size_t> multi_index);
+
+   static constexpr void Strides(std::span<const size_t> dimensions, std::span<size_t> strides);
+
+   static constexpr bool isCompatible(std::span<const size_t>) { return true; }
+};
+
+/** Row-major layout, in which the last index varies fastest, as in C. */
+struct RowMajor
+{
+   static constexpr size_t LinearIndex(std::span<const size_t> dimensions, std::span<const size_t> multi_index);
+
+   static constexpr void MultiIndex(std::span<const size_t> dimensions, size_t index, std::span<size_t> multi_index);
+
+   static constexpr void Strides(std::span<const size_t> dimensions, std::span<size_t> strides);
+
+   static constexpr bool isCompatible(std::span<const size_t>) { return true; }
+};
+
+/** Tiled layout, storing hyper-cubic tiles of TileSize entries per dimension contiguously, so that entries close in every dimension are close in memory. Suited
+ *  to stencil sweeps over large grids. Both the tiles and the entries within each tile are in column-major order. The dimensions must be multiples of the tile
+ *  size, which must be a power of two. */
+template<size_t TileSize>
+struct Tiled
+{
+   static_assert(TileSize && !(TileSize & (TileSize - 1)), "The tile size must be a power of two.");
+
+   static constexpr size_t LinearIndex(std::span<const size_t> dimensions, std::span<const size_t> multi_index);
+
+   static constexpr void MultiIndex(std::span<const size_t> dimensions, size_t index, std::span<size_t> multi_index);
+
+   static constexpr bool isCompatible(std::span<const size_t> dimensions);
+};
+
+/** Layouts in which each dimension has a constant stride, and hence which can be viewed by a MultiArrayView. */
+template<class L>
+concept StridedLayout = requires(std::span<const size_t> dimensions, std::span<size_t> strides) { L::Strides(dimensions, strides); };
+
+}
+
+#include "Layout.tpp"
@@ -0,0 +1,132 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+
+#pragma once
+
+namespace aprn {
+
+/***************************************************************************************************************************************************************
+* Column-major Layout
+***************************************************************************************************************************************************************/
+constexpr size_t
+ColumnMajor::LinearIndex(std::span<const size_t> dimensions, std::span<const size_t> multi_index)
+{
+   size_t index(0), factor(1);
+   FOR(i, dimensions.size())
+   {
+      index  += factor * multi_index[i];
+      factor *= dimensions[i];
+   }
+   return index;
+}
+
+constexpr void
+ColumnMajor::MultiIndex(std::span<const size_t> dimensions, size_t index, std::span<size_t> multi_index)
+{
+   FOR(i, dimensions.size())
+   {
+      multi_index[i] = index % dimensions[i];
+      index /= dimensions[i];
+   }
+}
+
+constexpr void
+ColumnMajor::Strides(std::span<const size_t> dimensions, std::span<size_t> strides)
+{
+   size_t stride(1);
+   FOR(i, dimensions.size())
+   {
+      strides[i] = stride;
+      stride *= dimensions[i];
+   }
+}
+
+/***************************************************************************************************************************************************************
+* Row-major Layout
+***************************************************************************************************************************************************************/
+constexpr size_t
+RowMajor::LinearIndex(std::span<const size_t> dimensions, std::span<const size_t> multi_index)
+{
+   size_t index(0);
+   FOR(i, dimensions.size()) index = index * dimensions[i] + multi_index[i];
+   return index;
+}
+
+constexpr void
+RowMajor::MultiIndex(std::span<const size_t> dimensions, size_t index, std::span<size_t> multi_index)
+{
+   for(size_t i = dimensions.size(); i-- > 0;)
+   {
+      multi_index[i] = index % dimensions[i];
+      index /= dimensions[i];
+   }
+}
+
+constexpr void
+RowMajor::Strides(std::span<const size_t> dimensions, std::span<size_t> strides)
+{
+   size_t stride(1);
+   for(size_t i = dimensions.size(); i-- > 0;)
+   {
+      strides[i] = stride;
+      stride *= dimensions[i];
+   }
+}
+
+/***************************************************************************************************************************************************************
+* Tiled Layout
+***************************************************************************************************************************************************************/
+template<size_t TileSize>
+constexpr size_t
+Tiled<TileSize>::LinearIndex(std::span<const size_t> dimensions, std::span<const size_t> multi_index)
+{
+   // Column-major index of the tile in the grid of tiles, and of the entry within the tile.
+   size_t tile_index(0), tile_factor(1), entry_index(0), entry_factor(1);
+   FOR(i, dimensions.size())
+   {
+      tile_index   += tile_factor * (multi_index[i] / TileSize);
+      tile_factor  *= dimensions[i] / TileSize;
+      entry_index  += entry_factor * (multi_index[i] % TileSize);
+      entry_factor *= TileSize;
+   }
+   return tile_index * entry_factor + entry_index;
+}
+
+template<size_t TileSize>
+constexpr void
+Tiled<TileSize>::MultiIndex(std::span<const size_t> dimensions, size_t index, std::span<size_t> multi_index)
+{
+   size_t tile_entry_count(1);
+   FOR(i, dimensions.size()) tile_entry_count *= TileSize;
+
+   size_t tile_index(index / tile_entry_count), entry_index(index % tile_entry_count);
+   FOR(i, dimensions.size())
+   {
+      const size_t tile_count = dimensions[i] / TileSize;
+      multi_index[i] = (tile_index % tile_count) * TileSize + entry_index % TileSize;
+      tile_index  /= tile_count;
+      entry_index /= TileSize;
+   }
+}
+
+template<size_t TileSize>
+constexpr bool
+Tiled<TileSize>::isCompatible(std::span<const size_t> dimensions)
+{
+   FOR(i, dimensions.size()) if(dimensions[i] % TileSize) return false;
+   return true;
+}
+
+}
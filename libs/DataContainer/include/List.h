@@ -12,64 +12,218 @@
 * If not, see <https://www.gnu.org/licenses/>.
 ***************************************************************************************************************************************************************/
 
+
 #pragma once
 
-#include "../include/Global.h"
+#include "../../../include/Global.h"
 
-#include <list>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
 
 namespace aprn {
 
+/***************************************************************************************************************************************************************
+* List Class
+***************************************************************************************************************************************************************/
+
+/** Sequence container with O(1) indexing and stable entry addresses. Entries are stored in fixed-size chunks, which are filled in order and never moved, while
+ *  the sequence order is held in a separate array of entry pointers. Hence, indexing is a single indirection, iteration walks mostly contiguous memory, and
+ *  insertion or removal in the middle only shifts pointers. As with std::list, references and pointers to entries remain valid until the entries are erased;
+ *  unlike std::list, iterators are invalidated by insertion and removal, as with std::vector. */
+template<typename T>
+class List
+{
+   template<bool isConst>
+   class Iterator;
+
+ public:
+   using value_type      = T;
+   using size_type       = size_t;
+   using difference_type = std::ptrdiff_t;
+   using reference       = T&;
+   using const_reference = const T&;
+   using pointer         = T*;
+   using const_pointer   = const T*;
+   using iterator        = Iterator<false>;
+   using const_iterator  = Iterator<true>;
+
+   List() = default;
+
+   explicit List(const size_t size, const T& value = T());
+
+   List(const std::initializer_list<T>& list);
+
+   template<std::input_iterator It>
+   List(It first, It last);
+
+   List(const List& other);
+
+   List(List&& other) noexcept;
+
+   ~List();
+
+   List& operator=(const List& other);
+
+   List& operator=(List&& other) noexcept;
+
+   /** Size and Index Range-checking */
+   void IndexBoundCheck(const size_t index) const;
+
+   void SizeCheck(const size_t size0, const size_t size1) const;
+
+   /** Subscript Operator Overloads */
+   T& operator[](const size_t index);
+
+   const T& operator[](const size_t index) const;
+
+   /** Assignment Operator Overloads */
+   List& operator=(const T& value) noexcept;
+
+   List& operator=(const std::initializer_list<T>& value_list);
+
+   /** Element Access */
+   inline T& front() { return (*this)[0]; }
+
+   inline const T& front() const { return (*this)[0]; }
+
+   inline T& back() { return (*this)[size() - 1]; }
+
+   inline const T& back() const { return (*this)[size() - 1]; }
+
+   /** Iterators */
+   inline iterator begin() noexcept { return iterator(Order_.data()); }
+
+   inline const_iterator begin() const noexcept { return const_iterator(Order_.data()); }
+
+   inline const_iterator cbegin() const noexcept { return begin(); }
+
+   inline iterator end() noexcept { return iterator(Order_.data() + Order_.size()); }
+
+   inline const_iterator end() const noexcept { return const_iterator(Order_.data() + Order_.size()); }
+
+   inline const_iterator cend() const noexcept { return end(); }
+
+   /** Capacity */
+   inline bool empty() const noexcept { return Order_.empty(); }
+
+   inline size_t size() const noexcept { return Order_.size(); }
+
+   /** Modifiers */
+   void clear() noexcept;
+
+   void push_back(const T& value);
+
+   void push_back(T&& value);
+
+   void push_front(const T& value);
+
+   void push_front(T&& value);
+
+   template<class... Args>
+   T& emplace_back(Args&&... args);
+
+   template<class... Args>
+   T& emplace_front(Args&&... args);
+
+   void pop_back();
+
+   void pop_front();
+
+   iterator insert(const_iterator position, const T& value);
+
+   iterator insert(const_iterator position, T&& value);
+
+   template<class... Args>
+   iterator emplace(const_iterator position, Args&&... args);
+
+   iterator erase(const_iterator position);
+
+   iterator erase(const_iterator first, const_iterator last);
+
+   void resize(const size_t size, const T& value = T());
+
+ private:
+   /** Construct an entry in a free slot, allocating a new chunk if none is left. */
+   template<class... Args>
+   T* Construct(Args&&... args);
+
+   /** Destroy an entry, and recycle its slot. */
+   void Destroy(T* entry);
+
+   /** Ensure that one more pointer can be inserted into the order array without reallocation, so that insertion cannot fail after construction. */
+   void ReserveOrder();
+
+   static constexpr size_t ChunkSize = Max(size_t(4096) / sizeof(T), size_t(1));
+
+   std::vector<T*> Order_;
+   std::vector<T*> Chunks_;
+   std::vector<T*> FreeSlots_;
+   size_t          ChunkFill_{ChunkSize}; // Number of slots used in the last chunk.
+};
+
+/***************************************************************************************************************************************************************
+* List Iterator Class
+***************************************************************************************************************************************************************/
+
+/** Random-access iterator over a list, walking its array of entry pointers. */
 template<typename T>
-class List : public std::list<T>
+template<bool isConst>
+class List<T>::Iterator
 {
-public:
-  List() = default;
-  ~List() = default;
-
-  /** Size and Index Range-checking ***************************************************************************************************************************/
-  void IndexBoundCheck(const size_t index) const
-  {
-    DEBUG_ASSERT(this->size(), "The list has not yet been sized.")
-    DEBUG_ASSERT(isBounded(index, size_t(0), this->size()), "The list index ", index, " must be in the range [0, ", this->size() - 1, "].")
-  }
-
-  void SizeCheck(const size_t _size0, const size_t _size1) const
-  {
-    DEBUG_ASSERT(areSizesEqual(_size0, _size1), "The list sizes ", _size0, " and ", _size1, " must be equal.")
-  }
-
-  /** Subscript Operator Overloads ****************************************************************************************************************************/
-  T& operator[](const size_t index)
-  {
-    IndexBoundCheck(index);
-    auto iterator = this->begin();
-    FOR(i, index) ++iterator;
-    return *iterator;
-  }
-
-  const T& operator[](const size_t index) const
-  {
-    IndexBoundCheck(index);
-    auto iterator = this->begin();
-    FOR(i, index) ++iterator;
-    return *iterator;
-  }
-
-  /** Assignment Operator Overloads ***************************************************************************************************************************/
-  List& operator=(const T& value) noexcept
-  {
-    FOR_EACH(entry, *this) entry = value;
-    return *this;
-  }
-
-  List& operator=(const std::initializer_list<T>& value_list)
-  {
-    SizeCheck(value_list.size(), this->size());
-    size_t index(0);
-    FOR_EACH(entry, value_list) (*this)[index++] = entry;
-    return *this;
-  }
+ public:
+   using iterator_concept  = std::random_access_iterator_tag;
+   using iterator_category = std::random_access_iterator_tag;
+   using value_type        = T;
+   using difference_type   = std::ptrdiff_t;
+   using pointer           = std::conditional_t<isConst, const T*, T*>;
+   using reference         = std::conditional_t<isConst, const T&, T&>;
+
+   Iterator() = default;
+
+   explicit Iterator(T* const* slot) noexcept : Slot_(slot) {}
+
+   /** Conversion from a mutable to a constant iterator. */
+   operator Iterator<true>() const noexcept requires(!isConst) { return Iterator<true>(Slot_); }
+
+   inline reference operator*() const noexcept { return **Slot_; }
+
+   inline pointer operator->() const noexcept { return *Slot_; }
+
+   inline reference operator[](const difference_type n) const noexcept { return *Slot_[n]; }
+
+   inline Iterator& operator++() noexcept { ++Slot_; return *this; }
+
+   inline Iterator operator++(int) noexcept { return Iterator(Slot_++); }
+
+   inline Iterator& operator--() noexcept { --Slot_; return *this; }
+
+   inline Iterator operator--(int) noexcept { return Iterator(Slot_--); }
+
+   inline Iterator& operator+=(const difference_type n) noexcept { Slot_ += n; return *this; }
+
+   inline Iterator& operator-=(const difference_type n) noexcept { Slot_ -= n; return *this; }
+
+   friend inline Iterator operator+(const Iterator& it, const difference_type n) noexcept { return Iterator(it.Slot_ + n); }
+
+   friend inline Iterator operator+(const difference_type n, const Iterator& it) noexcept { return Iterator(it.Slot_ + n); }
+
+   friend inline Iterator operator-(const Iterator& it, const difference_type n) noexcept { return Iterator(it.Slot_ - n); }
+
+   friend inline difference_type operator-(const Iterator& a, const Iterator& b) noexcept { return a.Slot_ - b.Slot_; }
+
+   friend inline bool operator==(const Iterator& a, const Iterator& b) noexcept = default;
+
+   friend inline auto operator<=>(const Iterator& a, const Iterator& b) noexcept = default;
+
+ private:
+   friend class List<T>;
+
+   T* const* Slot_{};
 };
 
 }
+
+#include "List.tpp"
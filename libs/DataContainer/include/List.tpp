@@ -0,0 +1,267 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+
+#pragma once
+
+namespace aprn {
+
+/***************************************************************************************************************************************************************
+* List Class
+***************************************************************************************************************************************************************/
+template<typename T>
+List<T>::List(const size_t size, const T& value) { resize(size, value); }
+
+template<typename T>
+List<T>::List(const std::initializer_list<T>& list)
+   : List(list.begin(), list.end()) {}
+
+template<typename T>
+template<std::input_iterator It>
+List<T>::List(It first, It last) { for(; first != last; ++first) emplace_back(*first); }
+
+template<typename T>
+List<T>::List(const List& other)
+   : List(other.begin(), other.end()) {}
+
+template<typename T>
+List<T>::List(List&& other) noexcept
+   : Order_(std::move(other.Order_)), Chunks_(std::move(other.Chunks_)), FreeSlots_(std::move(other.FreeSlots_)),
+     ChunkFill_(std::exchange(other.ChunkFill_, ChunkSize)) {}
+
+template<typename T>
+List<T>::~List() { clear(); }
+
+template<typename T>
+List<T>&
+List<T>::operator=(const List& other)
+{
+   if(this != &other)
+   {
+      clear();
+      FOR_EACH_CONST(entry, other) push_back(entry);
+   }
+   return *this;
+}
+
+template<typename T>
+List<T>&
+List<T>::operator=(List&& other) noexcept
+{
+   if(this != &other)
+   {
+      clear();
+      Order_     = std::move(other.Order_);
+      Chunks_    = std::move(other.Chunks_);
+      FreeSlots_ = std::move(other.FreeSlots_);
+      ChunkFill_ = std::exchange(other.ChunkFill_, ChunkSize);
+   }
+   return *this;
+}
+
+/** Size and Index Range-checking */
+template<typename T>
+void
+List<T>::IndexBoundCheck(const size_t index) const
+{
+   DEBUG_ASSERT(!empty(), "The list has not yet been sized.")
+   DEBUG_ASSERT(isBounded(index, size_t(0), size()), "The list index ", index, " must be in the range [0, ", size() - 1, "].")
+}
+
+template<typename T>
+void
+List<T>::SizeCheck(const size_t size0, const size_t size1) const
+{
+   DEBUG_ASSERT(size0 == size1, "The list sizes ", size0, " and ", size1, " must be equal.")
+}
+
+/** Subscript Operator Overloads */
+template<typename T>
+T&
+List<T>::operator[](const size_t index)
+{
+   IndexBoundCheck(index);
+   return *Order_[index];
+}
+
+template<typename T>
+const T&
+List<T>::operator[](const size_t index) const
+{
+   IndexBoundCheck(index);
+   return *Order_[index];
+}
+
+/** Assignment Operator Overloads */
+template<typename T>
+List<T>&
+List<T>::operator=(const T& value) noexcept
+{
+   FOR_EACH(entry, *this) entry = value;
+   return *this;
+}
+
+template<typename T>
+List<T>&
+List<T>::operator=(const std::initializer_list<T>& value_list)
+{
+   // Assign to the existing entries in place, so that their addresses remain valid.
+   while(size() > value_list.size()) pop_back();
+   auto value = value_list.begin();
+   FOR_EACH(entry, *this) entry = *value++;
+   for(; value != value_list.end(); ++value) push_back(*value);
+   return *this;
+}
+
+/** Modifiers */
+template<typename T>
+void
+List<T>::clear() noexcept
+{
+   FOR_EACH(entry, Order_) std::destroy_at(entry);
+   FOR_EACH(chunk, Chunks_) std::allocator<T>().deallocate(chunk, ChunkSize);
+   Order_.clear();
+   Chunks_.clear();
+   FreeSlots_.clear();
+   ChunkFill_ = ChunkSize;
+}
+
+template<typename T>
+void
+List<T>::push_back(const T& value) { emplace_back(value); }
+
+template<typename T>
+void
+List<T>::push_back(T&& value) { emplace_back(std::move(value)); }
+
+template<typename T>
+void
+List<T>::push_front(const T& value) { emplace_front(value); }
+
+template<typename T>
+void
+List<T>::push_front(T&& value) { emplace_front(std::move(value)); }
+
+template<typename T>
+template<class... Args>
+T&
+List<T>::emplace_back(Args&&... args) { return *emplace(cend(), std::forward<Args>(args)...); }
+
+template<typename T>
+template<class... Args>
+T&
+List<T>::emplace_front(Args&&... args) { return *emplace(cbegin(), std::forward<Args>(args)...); }
+
+template<typename T>
+void
+List<T>::pop_back()
+{
+   DEBUG_ASSERT(!empty(), "Cannot pop an entry from an empty list.")
+   erase(cend() - 1);
+}
+
+template<typename T>
+void
+List<T>::pop_front()
+{
+   DEBUG_ASSERT(!empty(), "Cannot pop an entry from an empty list.")
+   erase(cbegin());
+}
+
+template<typename T>
+typename List<T>::iterator
+List<T>::insert(const_iterator position, const T& value) { return emplace(position, value); }
+
+template<typename T>
+typename List<T>::iterator
+List<T>::insert(const_iterator position, T&& value) { return emplace(position, std::move(value)); }
+
+template<typename T>
+template<class... Args>
+typename List<T>::iterator
+List<T>::emplace(const_iterator position, Args&&... args)
+{
+   const auto index = position - cbegin();
+   DEBUG_ASSERT(isBounded(static_cast<size_t>(index), size_t(0), size() + 1), "The list insertion position ", index, " must be in the range [0, ", size(), "].")
+
+   ReserveOrder();
+   Order_.insert(Order_.begin() + index, Construct(std::forward<Args>(args)...));
+   return begin() + index;
+}
+
+template<typename T>
+typename List<T>::iterator
+List<T>::erase(const_iterator position) { return erase(position, position + 1); }
+
+template<typename T>
+typename List<T>::iterator
+List<T>::erase(const_iterator first, const_iterator last)
+{
+   const auto index_first = first - cbegin();
+   const auto index_last  = last - cbegin();
+   DEBUG_ASSERT(0 <= index_first && index_first <= index_last && static_cast<size_t>(index_last) <= size(), "The list erase range is out of bounds.")
+
+   std::for_each(Order_.begin() + index_first, Order_.begin() + index_last, [this](T* entry){ Destroy(entry); });
+   Order_.erase(Order_.begin() + index_first, Order_.begin() + index_last);
+   return begin() + index_first;
+}
+
+template<typename T>
+void
+List<T>::resize(const size_t size, const T& value)
+{
+   while(this->size() > size) pop_back();
+   while(this->size() < size) push_back(value);
+}
+
+/** Slot Management */
+template<typename T>
+template<class... Args>
+T*
+List<T>::Construct(Args&&... args)
+{
+   T* slot;
+   if(!FreeSlots_.empty())
+   {
+      slot = FreeSlots_.back();
+      FreeSlots_.pop_back();
+   }
+   else
+   {
+      if(ChunkFill_ == ChunkSize)
+      {
+         Chunks_.push_back(std::allocator<T>().allocate(ChunkSize));
+         ChunkFill_ = 0;
+      }
+      slot = Chunks_.back() + ChunkFill_++;
+   }
+   return std::construct_at(slot, std::forward<Args>(args)...);
+}
+
+template<typename T>
+void
+List<T>::Destroy(T* entry)
+{
+   std::destroy_at(entry);
+   FreeSlots_.push_back(entry);
+}
+
+template<typename T>
+void
+List<T>::ReserveOrder()
+{
+   if(Order_.size() == Order_.capacity()) Order_.reserve(Max(2 * Order_.size(), size_t(16)));
+}
+
+}
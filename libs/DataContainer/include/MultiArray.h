@@ -16,6 +16,8 @@
 
 #include "../../../include/Global.h"
 #include "Array.h"
+#include "Layout.h"
+#include "MultiArrayView.h"
 
 namespace aprn{
 
@@ -33,7 +35,7 @@ public:
   constexpr void
   MultiIndexBoundCheck(const std::convertible_to<size_t> auto... multi_index) const;
 
-  /** Multi-dimensional subscript index toggling. */
+  /** Multi-dimensional subscript index toggling, according to the layout policy of the derived class. */
   constexpr size_t
   ComputeLinearIndex(const std::convertible_to<size_t> auto... multi_index) const;
 
@@ -66,6 +68,34 @@ public:
   constexpr auto
   end() const { return Derived().Entries.end(); }
 
+  /** Number of entries. */
+  constexpr size_t
+  size() const { return Derived().Entries.size(); }
+
+  /** Number of dimensions, and size along a given dimension. */
+  constexpr size_t
+  nDimensions() const { return Derived().Dimensions.size(); }
+
+  constexpr size_t
+  Dimension(const size_t dim) const { return Derived().Dimensions[dim]; }
+
+  /** Entries, in the order of the layout. */
+  constexpr T*
+  Data() { return Derived().Entries.data(); }
+
+  constexpr const T*
+  Data() const { return Derived().Entries.data(); }
+
+  /** Non-owning views of the entries, which may be sliced, transposed, or reshaped without copying. The rank must equal the number of dimensions, and the
+   *  layout must be strided. */
+  template<size_t Rank>
+  MultiArrayView<T, Rank>
+  View();
+
+  template<size_t Rank>
+  MultiArrayView<const T, Rank>
+  View() const;
+
 private:
   /** Derived class access. */
   constexpr D&
@@ -78,35 +108,47 @@ private:
 /***************************************************************************************************************************************************************
 * Static Multi-dimensional Array Class
 ***************************************************************************************************************************************************************/
-template<typename T, size_t ...dims>
-class StaticMultiArray : public MultiArray<T, StaticMultiArray<T, dims...>>
+template<typename T, class Layout, size_t ...dims>
+class BasicStaticMultiArray : public MultiArray<T, BasicStaticMultiArray<T, Layout, dims...>>
 {
+  static_assert(Layout::isCompatible(std::array<size_t, sizeof...(dims)>{dims...}), "The dimensions are incompatible with the layout.");
+
 public:
+  using LayoutType = Layout;
+
   /** Constructors. */
-  constexpr StaticMultiArray();
+  constexpr BasicStaticMultiArray();
 
-  explicit constexpr StaticMultiArray(const T value);
+  explicit constexpr BasicStaticMultiArray(const T value);
 
 private:
   constexpr static StaticArray<size_t, sizeof...(dims)> Dimensions{dims...};
   constexpr static size_t nEntries{Product(dims...)};
   StaticArray<T, nEntries> Entries;
 
-  friend MultiArray<T, StaticMultiArray<T, dims...>>;
+  friend MultiArray<T, BasicStaticMultiArray<T, Layout, dims...>>;
 };
 
+/** Static multi-dimensional array with the default column-major layout. */
+template<typename T, size_t ...dims> using StaticMultiArray = BasicStaticMultiArray<T, ColumnMajor, dims...>;
+
 /***************************************************************************************************************************************************************
 * Dynamic Multi-dimensional Array Class
 ***************************************************************************************************************************************************************/
-template<typename T>
-class DynamicMultiArray : public MultiArray<T, DynamicMultiArray<T>>
+template<typename T, class Layout = ColumnMajor>
+class DynamicMultiArray : public MultiArray<T, DynamicMultiArray<T, Layout>>
 {
 public:
+  using LayoutType = Layout;
+
   /** Constructors. */
   DynamicMultiArray();
 
   DynamicMultiArray(const std::convertible_to<size_t> auto... _dimensions);
 
+  /** Dimensions known at run time, e.g. of a contraction result. */
+  explicit DynamicMultiArray(const DynamicArray<size_t>& _dimensions);
+
   /** Multi-array resize. */
   void Resize(const std::convertible_to<size_t> auto... _dimensions);
 
@@ -115,7 +157,7 @@ private:
   size_t nEntries;
   DynamicArray<T> Entries;
 
-  friend MultiArray<T, DynamicMultiArray<T>>;
+  friend MultiArray<T, DynamicMultiArray<T, Layout>>;
 };
 
 }
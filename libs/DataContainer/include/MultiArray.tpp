@@ -43,42 +43,19 @@ MultiArray<T, D>::ComputeLinearIndex(const std::convertible_to<size_t> auto... m
 {
   MultiIndexBoundCheck(multi_index...);
 
-  auto& dims = Derived().Dimensions;
   const size_t indices[] = {static_cast<size_t>(multi_index)...};
-
-  size_t index(0), factor(1);
-  FOR(i, dims.size())
-  {
-    index += factor * indices[i];
-    factor *= dims[i];
-  }
-//  this->IndexBoundCheck(index);
-
-  return index;
+  return D::LayoutType::LinearIndex(Derived().Dimensions, indices);
 }
 
 template<typename T, class D>
 constexpr auto
 MultiArray<T, D>::ComputeMultiIndex(size_t index) const
 {
-  EXIT("Yet to complete.")
-
-//  constexpr auto& dims = Derived().Dimensions;
-//  constexpr auto& n_entries = Derived().nEntries;
-//
-//  DEBUG_ASSERT(isBounded(index, 0, n_entries), "The passed index ", index, " should be in the range [0, ", n_entries, "].")
-//
-//  StaticArray<size_t, dims.size()> res;
-
-//  size_t factor = Multiply(dims...);
-//  for (size_t i = sizeof...(dims); i != 0; --i) {
-//    factor /= dims[i - 1];
-//    res[i - 1] = index / factor;
-//    assert(res[i - 1] < dims[i - 1]);
-//    index -= res[i - 1] * factor;
-//  }
-//  return res;
-  return 0;
+  DEBUG_ASSERT(index < Derived().nEntries, "The index ", index, " must be lesser than ", Derived().nEntries, ".")
+
+  auto multi_index = Derived().Dimensions;
+  D::LayoutType::MultiIndex(Derived().Dimensions, index, multi_index);
+  return multi_index;
 }
 
 /** Operator overloads. */
@@ -127,15 +104,44 @@ MultiArray<T, D>::operator=(const std::initializer_list<std::initializer_list<T>
   return derived_class;
 }
 
+/** Views */
+template<typename T, class D>
+template<size_t Rank>
+MultiArrayView<T, Rank>
+MultiArray<T, D>::View()
+{
+  STATIC_ASSERT(StridedLayout<typename D::LayoutType>, "Only strided layouts can be viewed.")
+  ASSERT(Rank == Derived().Dimensions.size(), "The view rank ", Rank, " must equal the number of dimensions ", Derived().Dimensions.size(), ".")
+
+  const StaticArray<size_t, Rank> dimensions(Derived().Dimensions.begin(), Derived().Dimensions.end());
+  StaticArray<size_t, Rank> strides;
+  D::LayoutType::Strides(dimensions, strides);
+  return MultiArrayView<T, Rank>(Derived().Entries.data(), dimensions, strides);
+}
+
+template<typename T, class D>
+template<size_t Rank>
+MultiArrayView<const T, Rank>
+MultiArray<T, D>::View() const
+{
+  STATIC_ASSERT(StridedLayout<typename D::LayoutType>, "Only strided layouts can be viewed.")
+  ASSERT(Rank == Derived().Dimensions.size(), "The view rank ", Rank, " must equal the number of dimensions ", Derived().Dimensions.size(), ".")
+
+  const StaticArray<size_t, Rank> dimensions(Derived().Dimensions.begin(), Derived().Dimensions.end());
+  StaticArray<size_t, Rank> strides;
+  D::LayoutType::Strides(dimensions, strides);
+  return MultiArrayView<const T, Rank>(Derived().Entries.data(), dimensions, strides);
+}
+
 /***************************************************************************************************************************************************************
 * Static Multi-dimensional Array Class
 ***************************************************************************************************************************************************************/
-template<typename T, size_t... dims>
-constexpr StaticMultiArray<T, dims...>::StaticMultiArray()
-  : StaticMultiArray(StaticInitValue<T>()) {}
+template<typename T, class Layout, size_t... dims>
+constexpr BasicStaticMultiArray<T, Layout, dims...>::BasicStaticMultiArray()
+  : BasicStaticMultiArray(StaticInitValue<T>()) {}
 
-template<typename T, size_t ...dims>
-constexpr StaticMultiArray<T, dims...>::StaticMultiArray(const T value)
+template<typename T, class Layout, size_t ...dims>
+constexpr BasicStaticMultiArray<T, Layout, dims...>::BasicStaticMultiArray(const T value)
   : Entries(value)
 {
   STATIC_ASSERT(0 < sizeof...(dims), "A multi-dimensional array must have at least 1 dimension.")
@@ -146,19 +152,30 @@ constexpr StaticMultiArray<T, dims...>::StaticMultiArray(const T value)
 ***************************************************************************************************************************************************************/
 
 /** Constructors/Destructors */
-template<typename T>
-DynamicMultiArray<T>::DynamicMultiArray()
+template<typename T, class Layout>
+DynamicMultiArray<T, Layout>::DynamicMultiArray()
   : DynamicMultiArray(0) {}
 
-template<typename T>
-DynamicMultiArray<T>::DynamicMultiArray(const std::convertible_to<size_t> auto... _dimensions)
-  : Dimensions{static_cast<size_t>(_dimensions)...}, nEntries(Product(_dimensions...)), Entries(nEntries, DynamicInitValue<T>()) {}
+template<typename T, class Layout>
+DynamicMultiArray<T, Layout>::DynamicMultiArray(const std::convertible_to<size_t> auto... _dimensions)
+  : Dimensions{static_cast<size_t>(_dimensions)...}, nEntries(Product(_dimensions...)), Entries(nEntries, DynamicInitValue<T>())
+{
+  ASSERT(Layout::isCompatible(Dimensions), "The dimensions are incompatible with the layout.")
+}
+
+template<typename T, class Layout>
+DynamicMultiArray<T, Layout>::DynamicMultiArray(const DynamicArray<size_t>& _dimensions)
+  : Dimensions(_dimensions), nEntries(Product(_dimensions.begin(), _dimensions.end())), Entries(nEntries, DynamicInitValue<T>())
+{
+  ASSERT(Layout::isCompatible(Dimensions), "The dimensions are incompatible with the layout.")
+}
 
 /** Multi-array Resize Functions */
-template<typename T>
-void DynamicMultiArray<T>::Resize(const std::convertible_to<size_t> auto... _dimensions)
+template<typename T, class Layout>
+void DynamicMultiArray<T, Layout>::Resize(const std::convertible_to<size_t> auto... _dimensions)
 {
   Dimensions = {_dimensions...};
+  ASSERT(Layout::isCompatible(Dimensions), "The dimensions are incompatible with the layout.")
   nEntries = Product(_dimensions...);
   Entries.resize(nEntries, DynamicInitValue<T>());
 }
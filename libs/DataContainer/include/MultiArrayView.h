@@ -0,0 +1,193 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+
+#pragma once
+
+#include "../../../include/Global.h"
+#include "Array.h"
+#include "NumericContainer.h"
+
+#include <iterator>
+
+namespace aprn {
+
+/***************************************************************************************************************************************************************
+* Multi-dimensional Array View Class
+***************************************************************************************************************************************************************/
+
+/** Non-owning view of a multi-dimensional array, whose entry (i_0, ..., i_{Rank-1}) is Data()[i_0 * Strides()[0] + ... + i_{Rank-1} * Strides()[Rank-1]].
+ *  Slicing, sub-blocks, transposition, and reshaping only change the dimensions, strides, and data offset of a view, and never touch the entries. Iteration
+ *  follows the column-major ordering of MultiArray, i.e. the first index varies fastest. Copying a view aliases the same entries, whereas assigning to a view
+ *  writes to them. A view must not outlive, nor be used after resizing, the array it refers to. */
+template<typename T, size_t Rank>
+class MultiArrayView : public detail::NumericContainer<RemoveConst<T>, MultiArrayView<T, Rank>>
+{
+   static_assert(Rank > 0, "A multi-dimensional array view must have at least 1 dimension.");
+
+   using Base = detail::NumericContainer<RemoveConst<T>, MultiArrayView<T, Rank>>;
+
+   class Iterator;
+
+ public:
+   using value_type      = RemoveConst<T>;
+   using size_type       = size_t;
+   using difference_type = std::ptrdiff_t;
+   using reference       = T&;
+   using pointer         = T*;
+   using iterator        = Iterator;
+   using const_iterator  = Iterator;
+   using MultiIndex      = StaticArray<size_t, Rank>;
+
+   /** Constructors */
+   MultiArrayView(T* data, const MultiIndex& dimensions, const MultiIndex& strides);
+
+   /** View of contiguous column-major entries with the given dimensions. */
+   MultiArrayView(T* data, const MultiIndex& dimensions);
+
+   MultiArrayView(const MultiArrayView&) = default;
+
+   /** Conversion from a mutable to a constant view. */
+   operator MultiArrayView<const T, Rank>() const requires(!std::is_const_v<T>) { return MultiArrayView<const T, Rank>(Data_, Dimensions_, Strides_); }
+
+   /** Entry-wise assignment to the viewed entries from an equally shaped, non-overlapping view. */
+   MultiArrayView& operator=(const MultiArrayView& other);
+
+   template<typename T2>
+   MultiArrayView& operator=(const MultiArrayView<T2, Rank>& other);
+
+   MultiArrayView& operator=(const std::convertible_to<RemoveConst<T>> auto value);
+
+   using Base::operator=;
+
+   /** Size and index range-checking. */
+   void MultiIndexBoundCheck(const MultiIndex& multi_index) const;
+
+   /** Entry access. */
+   T& operator()(const std::convertible_to<size_t> auto... multi_index) const;
+
+   /** Entry at a linear index in column-major order, addressed directly through the stride table. */
+   T& operator[](const size_t index) const;
+
+   /** Fix the index along one dimension, e.g. to take a row or a column of a matrix. */
+   MultiArrayView<T, Rank - 1> Slice(const size_t dimension, const size_t index) const requires(Rank > 1);
+
+   MultiArrayView<T, 1> Row(const size_t index) const requires(Rank == 2) { return Slice(0, index); }
+
+   MultiArrayView<T, 1> Column(const size_t index) const requires(Rank == 2) { return Slice(1, index); }
+
+   /** Sub-block with the given offsets and extents, optionally taking every step-th entry along each dimension. */
+   MultiArrayView Block(const MultiIndex& offsets, const MultiIndex& extents) const;
+
+   MultiArrayView Block(const MultiIndex& offsets, const MultiIndex& extents, const MultiIndex& steps) const;
+
+   /** Reorder the dimensions, such that dimension i of the result is dimension axes[i] of this view. */
+   MultiArrayView Permute(const MultiIndex& axes) const;
+
+   /** Reverse the order of the dimensions, e.g. the transpose of a matrix. */
+   MultiArrayView Transpose() const;
+
+   /** View the entries with different dimensions of the same total size. Only contiguous views can be reshaped without copying. */
+   template<size_t NewRank>
+   MultiArrayView<T, NewRank> Reshape(const StaticArray<size_t, NewRank>& dimensions) const;
+
+   /** Whether the entries are contiguous and in column-major order, as in a MultiArray. */
+   bool isContiguous() const;
+
+   /** Properties */
+   inline size_t size() const { return Product(Dimensions_.begin(), Dimensions_.end()); }
+
+   inline const MultiIndex& Dimensions() const { return Dimensions_; }
+
+   inline const MultiIndex& Strides() const { return Strides_; }
+
+   inline T* Data() const { return Data_; }
+
+   /** Iterators */
+   inline Iterator begin() const { return Iterator(*this, 0); }
+
+   inline Iterator end() const { return Iterator(*this, size()); }
+
+ private:
+   T*         Data_;
+   MultiIndex Dimensions_;
+   MultiIndex Strides_;
+};
+
+/***************************************************************************************************************************************************************
+* Multi-dimensional Array View Iterator Class
+***************************************************************************************************************************************************************/
+
+/** Random-access iterator over the entries of a view in column-major order. Incrementing steps through the multi-index, whereas random access decomposes the
+ *  linear index. Iterators hold a copy of the view's layout, so may outlive the view itself. */
+template<typename T, size_t Rank>
+class MultiArrayView<T, Rank>::Iterator
+{
+ public:
+   using iterator_concept  = std::random_access_iterator_tag;
+   using iterator_category = std::random_access_iterator_tag;
+   using value_type        = RemoveConst<T>;
+   using difference_type   = std::ptrdiff_t;
+   using pointer           = T*;
+   using reference         = T&;
+
+   Iterator() = default;
+
+   Iterator(const MultiArrayView& view, const size_t index);
+
+   inline reference operator*() const noexcept { return Data_[Offset_]; }
+
+   inline pointer operator->() const noexcept { return Data_ + Offset_; }
+
+   inline reference operator[](const difference_type n) const noexcept { return *(*this + n); }
+
+   Iterator& operator++() noexcept;
+
+   inline Iterator operator++(int) noexcept { auto it = *this; ++*this; return it; }
+
+   inline Iterator& operator--() noexcept { Seek(Index_ - 1); return *this; }
+
+   inline Iterator operator--(int) noexcept { auto it = *this; --*this; return it; }
+
+   inline Iterator& operator+=(const difference_type n) noexcept { Seek(Index_ + n); return *this; }
+
+   inline Iterator& operator-=(const difference_type n) noexcept { Seek(Index_ - n); return *this; }
+
+   friend inline Iterator operator+(Iterator it, const difference_type n) noexcept { return it += n; }
+
+   friend inline Iterator operator+(const difference_type n, Iterator it) noexcept { return it += n; }
+
+   friend inline Iterator operator-(Iterator it, const difference_type n) noexcept { return it -= n; }
+
+   friend inline difference_type operator-(const Iterator& a, const Iterator& b) noexcept { return static_cast<difference_type>(a.Index_ - b.Index_); }
+
+   friend inline bool operator==(const Iterator& a, const Iterator& b) noexcept { return a.Index_ == b.Index_; }
+
+   friend inline auto operator<=>(const Iterator& a, const Iterator& b) noexcept { return a.Index_ <=> b.Index_; }
+
+ private:
+   /** Move to a linear index, decomposing it into a multi-index. */
+   void Seek(const size_t index) noexcept;
+
+   T*                       Data_{};
+   std::array<size_t, Rank> Dimensions_{};
+   std::array<size_t, Rank> Strides_{};
+   std::array<size_t, Rank> MultiIndex_{};
+   size_t                   Index_{};
+   size_t                   Offset_{};
+};
+
+}
+
+#include "MultiArrayView.tpp"
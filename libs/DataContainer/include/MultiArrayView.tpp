@@ -0,0 +1,240 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+
+#pragma once
+
+namespace aprn {
+
+/***************************************************************************************************************************************************************
+* Multi-dimensional Array View Class
+***************************************************************************************************************************************************************/
+
+/** Constructors */
+template<typename T, size_t Rank>
+MultiArrayView<T, Rank>::MultiArrayView(T* data, const MultiIndex& dimensions, const MultiIndex& strides)
+   : Data_(data), Dimensions_(dimensions), Strides_(strides) {}
+
+template<typename T, size_t Rank>
+MultiArrayView<T, Rank>::MultiArrayView(T* data, const MultiIndex& dimensions)
+   : Data_(data), Dimensions_(dimensions)
+{
+   size_t stride(1);
+   FOR(i, Rank)
+   {
+      Strides_[i] = stride;
+      stride *= Dimensions_[i];
+   }
+}
+
+/** Assignment */
+template<typename T, size_t Rank>
+MultiArrayView<T, Rank>&
+MultiArrayView<T, Rank>::operator=(const MultiArrayView& other) { return operator=<T>(other); }
+
+template<typename T, size_t Rank>
+template<typename T2>
+MultiArrayView<T, Rank>&
+MultiArrayView<T, Rank>::operator=(const MultiArrayView<T2, Rank>& other)
+{
+   FOR(i, Rank) DEBUG_ASSERT(Dimensions_[i] == other.Dimensions()[i], "The view dimensions ", Dimensions_[i], " and ", other.Dimensions()[i], " must be equal.")
+
+   auto other_entry = other.begin();
+   FOR_EACH(entry, *this) entry = *other_entry++;
+   return *this;
+}
+
+template<typename T, size_t Rank>
+MultiArrayView<T, Rank>&
+MultiArrayView<T, Rank>::operator=(const std::convertible_to<RemoveConst<T>> auto value)
+{
+   FOR_EACH(entry, *this) entry = static_cast<RemoveConst<T>>(value);
+   return *this;
+}
+
+/** Size and index range-checking. */
+template<typename T, size_t Rank>
+void
+MultiArrayView<T, Rank>::MultiIndexBoundCheck(const MultiIndex& multi_index) const
+{
+#ifdef DEBUG_MODE
+   FOR(i, Rank) ASSERT(multi_index[i] < Dimensions_[i], "Multi index component ", multi_index[i], " must be lesser than ", Dimensions_[i], ".")
+#endif
+}
+
+/** Entry access. */
+template<typename T, size_t Rank>
+T&
+MultiArrayView<T, Rank>::operator()(const std::convertible_to<size_t> auto... multi_index) const
+{
+   static_assert(sizeof...(multi_index) == Rank, "The multi-index size must equal the view rank.");
+
+   const MultiIndex indices{static_cast<size_t>(multi_index)...};
+   MultiIndexBoundCheck(indices);
+
+   size_t offset(0);
+   FOR(i, Rank) offset += indices[i] * Strides_[i];
+   return Data_[offset];
+}
+
+template<typename T, size_t Rank>
+T&
+MultiArrayView<T, Rank>::operator[](const size_t index) const
+{
+   DEBUG_ASSERT(index < size(), "The index ", index, " must be lesser than the view size ", size(), ".")
+
+   // The last index needs no division, so rank-1 views reduce to a single multiplication.
+   size_t remainder(index), offset(0);
+   FOR(i, Rank - 1)
+   {
+      offset    += remainder % Dimensions_[i] * Strides_[i];
+      remainder /= Dimensions_[i];
+   }
+   return Data_[offset + remainder * Strides_[Rank - 1]];
+}
+
+/** Views */
+template<typename T, size_t Rank>
+MultiArrayView<T, Rank - 1>
+MultiArrayView<T, Rank>::Slice(const size_t dimension, const size_t index) const requires(Rank > 1)
+{
+   DEBUG_ASSERT(dimension < Rank, "The slice dimension ", dimension, " must be lesser than ", Rank, ".")
+   DEBUG_ASSERT(index < Dimensions_[dimension], "The slice index ", index, " must be lesser than ", Dimensions_[dimension], ".")
+
+   StaticArray<size_t, Rank - 1> dimensions, strides;
+   size_t j(0);
+   FOR(i, Rank) if(i != dimension)
+   {
+      dimensions[j] = Dimensions_[i];
+      strides[j++]  = Strides_[i];
+   }
+   return MultiArrayView<T, Rank - 1>(Data_ + index * Strides_[dimension], dimensions, strides);
+}
+
+template<typename T, size_t Rank>
+MultiArrayView<T, Rank>
+MultiArrayView<T, Rank>::Block(const MultiIndex& offsets, const MultiIndex& extents) const { return Block(offsets, extents, MultiIndex(1)); }
+
+template<typename T, size_t Rank>
+MultiArrayView<T, Rank>
+MultiArrayView<T, Rank>::Block(const MultiIndex& offsets, const MultiIndex& extents, const MultiIndex& steps) const
+{
+   MultiIndex strides;
+   size_t offset(0);
+   FOR(i, Rank)
+   {
+      DEBUG_ASSERT(steps[i] > 0, "The block steps must be positive.")
+      DEBUG_ASSERT(!extents[i] || offsets[i] + (extents[i] - 1) * steps[i] < Dimensions_[i], "The block exceeds the view along dimension ", i, ".")
+      offset    += offsets[i] * Strides_[i];
+      strides[i] = steps[i] * Strides_[i];
+   }
+   return MultiArrayView(Data_ + offset, extents, strides);
+}
+
+template<typename T, size_t Rank>
+MultiArrayView<T, Rank>
+MultiArrayView<T, Rank>::Permute(const MultiIndex& axes) const
+{
+   MultiIndex dimensions, strides;
+   StaticArray<bool, Rank> is_used(false);
+   FOR(i, Rank)
+   {
+      DEBUG_ASSERT(axes[i] < Rank && !is_used[axes[i]], "The axes must be a permutation of [0, ", Rank - 1, "].")
+      is_used[axes[i]] = true;
+      dimensions[i] = Dimensions_[axes[i]];
+      strides[i]    = Strides_[axes[i]];
+   }
+   return MultiArrayView(Data_, dimensions, strides);
+}
+
+template<typename T, size_t Rank>
+MultiArrayView<T, Rank>
+MultiArrayView<T, Rank>::Transpose() const
+{
+   MultiIndex axes;
+   FOR(i, Rank) axes[i] = Rank - 1 - i;
+   return Permute(axes);
+}
+
+template<typename T, size_t Rank>
+template<size_t NewRank>
+MultiArrayView<T, NewRank>
+MultiArrayView<T, Rank>::Reshape(const StaticArray<size_t, NewRank>& dimensions) const
+{
+   ASSERT(isContiguous(), "Only contiguous views can be reshaped.")
+   ASSERT(Product(dimensions.begin(), dimensions.end()) == size(), "The reshaped view must have ", size(), " entries.")
+   return MultiArrayView<T, NewRank>(Data_, dimensions);
+}
+
+template<typename T, size_t Rank>
+bool
+MultiArrayView<T, Rank>::isContiguous() const
+{
+   size_t stride(1);
+   FOR(i, Rank)
+   {
+      if(Dimensions_[i] > 1 && Strides_[i] != stride) return false;
+      stride *= Dimensions_[i];
+   }
+   return true;
+}
+
+/***************************************************************************************************************************************************************
+* Multi-dimensional Array View Iterator Class
+***************************************************************************************************************************************************************/
+template<typename T, size_t Rank>
+MultiArrayView<T, Rank>::Iterator::Iterator(const MultiArrayView& view, const size_t index)
+   : Data_(view.Data_)
+{
+   std::copy(view.Dimensions_.begin(), view.Dimensions_.end(), Dimensions_.begin());
+   std::copy(view.Strides_.begin(), view.Strides_.end(), Strides_.begin());
+   Seek(index);
+}
+
+template<typename T, size_t Rank>
+typename MultiArrayView<T, Rank>::Iterator&
+MultiArrayView<T, Rank>::Iterator::operator++() noexcept
+{
+   ++Index_;
+   FOR(i, Rank)
+   {
+      Offset_ += Strides_[i];
+      if(++MultiIndex_[i] < Dimensions_[i] || i == Rank - 1) break;
+
+      // Carry over to the next dimension.
+      Offset_ -= Strides_[i] * Dimensions_[i];
+      MultiIndex_[i] = 0;
+   }
+   return *this;
+}
+
+template<typename T, size_t Rank>
+void
+MultiArrayView<T, Rank>::Iterator::Seek(const size_t index) noexcept
+{
+   Index_  = index;
+   Offset_ = 0;
+   MultiIndex_.fill(0);
+   if(index >= Product(Dimensions_.begin(), Dimensions_.end())) return; // Past-the-end iterators are never dereferenced.
+
+   size_t remainder(index);
+   FOR(i, Rank)
+   {
+      MultiIndex_[i] = remainder % Dimensions_[i];
+      remainder     /= Dimensions_[i];
+      Offset_       += MultiIndex_[i] * Strides_[i];
+   }
+}
+
+}
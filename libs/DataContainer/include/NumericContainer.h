@@ -17,6 +17,7 @@
 #include "../../../include/Global.h"
 #include "../../../include/Concepts.h"
 #include "../../../include/Random.h"
+#include "Expression.h"
 
 namespace aprn {
 namespace detail {
@@ -31,15 +32,15 @@ protected:
   constexpr NumericContainer() {}
 
 public:
-  /** Scalar arithmetic operator overloads. */
-  constexpr D operator+(const std::convertible_to<T> auto scalar) const;
+  /** Expression evaluation. */
+  template<class E>
+  constexpr D& operator=(const Expression<T, E>& expression);
 
-  constexpr D operator-(const std::convertible_to<T> auto scalar) const;
-
-  constexpr D operator*(const std::convertible_to<T> auto scalar) const;
-
-  constexpr D operator/(const std::convertible_to<T> auto scalar) const;
+  /** Expression evaluation with an execution policy, e.g. x.Assign<Par>(a + b * 2.0), which splits the entries of large containers between threads. */
+  template<ExecutionPolicy P, class E>
+  D& Assign(const Expression<T, E>& expression);
 
+  /** Scalar compound assignment operator overloads. */
   constexpr D& operator+=(const std::convertible_to<T> auto scalar);
 
   constexpr D& operator-=(const std::convertible_to<T> auto scalar);
@@ -48,19 +49,7 @@ public:
 
   constexpr D& operator/=(const std::convertible_to<T> auto scalar);
 
-  /** Entry-wise binary arithmetic operator overloads. */
-  template<class D2>
-  constexpr D operator+(const NumericContainer<T, D2>& container) const;
-
-  template<class D2>
-  constexpr D operator-(const NumericContainer<T, D2>& container) const;
-
-  template<class D2>
-  constexpr D operator*(const NumericContainer<T, D2>& container) const;
-
-  template<class D2>
-  constexpr D operator/(const NumericContainer<T, D2>& container) const;
-
+  /** Entry-wise compound assignment operator overloads. */
   template<class D2>
   constexpr D& operator+=(const NumericContainer<T, D2>& container);
 
@@ -73,8 +62,17 @@ public:
   template<class D2>
   constexpr D& operator/=(const NumericContainer<T, D2>& container);
 
-  /** Entry-wise unary operator overloads. */
-  constexpr D operator-() const;
+  template<class E>
+  constexpr D& operator+=(const Expression<T, E>& expression);
+
+  template<class E>
+  constexpr D& operator-=(const Expression<T, E>& expression);
+
+  template<class E>
+  constexpr D& operator*=(const Expression<T, E>& expression);
+
+  template<class E>
+  constexpr D& operator/=(const Expression<T, E>& expression);
 
   /** Entry randomisation. */
   void Randomise();
@@ -93,11 +91,6 @@ private:
 };
 
 }//detail
-
-/** Stand-alone Operator overloads. */
-template<Arithmetic T, class D>
-constexpr D operator*(const std::convertible_to<T> auto scalar, const detail::NumericContainer<T, D>& container);
-
 }//aprn
 
 #include "NumericContainer.tpp"
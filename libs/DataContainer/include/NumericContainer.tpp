@@ -17,49 +17,51 @@
 namespace aprn {
 namespace detail {
 
-/** Scalar arithmetic operator overloads. */
+/** Expression evaluation. */
 template<Arithmetic T, class D>
-constexpr D
-NumericContainer<T, D>::operator+(const std::convertible_to<T> auto scalar) const
+template<class E>
+constexpr D&
+NumericContainer<T, D>::operator=(const Expression<T, E>& expression)
 {
-  D out(Derived());
-  FOR_EACH(entry, out) entry += scalar;
-  return out;
-}
+  const auto& expr = expression.Derived();
+  if constexpr(requires(D& derived) { derived.resize(size_t{}); }) Derived().resize(expr.size());
+  DEBUG_ASSERT(Derived().size() == expr.size(), "The container size ", Derived().size(), " must equal the expression size ", expr.size(), ".")
 
-template<Arithmetic T, class D>
-constexpr D
-NumericContainer<T, D>::operator-(const std::convertible_to<T> auto scalar) const
-{
-  D out(Derived());
-  FOR_EACH(entry, out) entry -= scalar;
-  return out;
-}
+  if constexpr(simd::Vectorisable<D>) if(EvaluateSimd(expr, Derived().data())) return Derived();
 
-template<Arithmetic T, class D>
-constexpr D
-NumericContainer<T, D>::operator*(const std::convertible_to<T> auto scalar) const
-{
-  D out(Derived());
-  FOR_EACH(entry, out) entry *= scalar;
-  return out;
+  size_t i{};
+  FOR_EACH(entry, Derived()) entry = expr[i++];
+  return Derived();
 }
 
 template<Arithmetic T, class D>
-constexpr D
-NumericContainer<T, D>::operator/(const std::convertible_to<T> auto scalar) const
+template<ExecutionPolicy P, class E>
+D&
+NumericContainer<T, D>::Assign(const Expression<T, E>& expression)
 {
-  DEBUG_ASSERT(!isEqual(scalar, Zero), "Cannot divide by zero.")
-  D out(Derived());
-  FOR_EACH(entry, out) entry /= scalar;
-  return out;
+  const auto& expr = expression.Derived();
+  if constexpr(isTypeSame<P, Seq>()) return *this = expression;
+  else
+  {
+    static_assert(std::random_access_iterator<decltype(Derived().begin())>, "Parallel evaluation requires random-access containers.");
+    if(!isParallel(expr.size())) return *this = expression;
+
+    if constexpr(requires(D& derived) { derived.resize(size_t{}); }) Derived().resize(expr.size());
+    DEBUG_ASSERT(Derived().size() == expr.size(), "The container size ", Derived().size(), " must equal the expression size ", expr.size(), ".")
+
+    const auto first = Derived().begin();
+    ParallelFor(expr.size(), [first, &expr](const size_t i){ first[i] = expr[i]; });
+    return Derived();
+  }
 }
 
+/** Scalar compound assignment operator overloads. */
 template<Arithmetic T, class D>
 constexpr D&
 NumericContainer<T, D>::operator+=(const std::convertible_to<T> auto scalar)
 {
-  FOR_EACH(entry, Derived()) entry += scalar;
+  if constexpr(simd::Vectorisable<D>) simd::AddScalar(Derived().data(), static_cast<T>(scalar), Derived().data(), Derived().size());
+  else FOR_EACH(entry, Derived()) entry += scalar;
   return Derived();
 }
 
@@ -67,7 +69,8 @@ template<Arithmetic T, class D>
 constexpr D&
 NumericContainer<T, D>::operator-=(const std::convertible_to<T> auto scalar)
 {
-  FOR_EACH(entry, Derived()) entry -= scalar;
+  if constexpr(simd::Vectorisable<D>) simd::SubtractScalar(Derived().data(), static_cast<T>(scalar), Derived().data(), Derived().size());
+  else FOR_EACH(entry, Derived()) entry -= scalar;
   return Derived();
 }
 
@@ -75,7 +78,8 @@ template<Arithmetic T, class D>
 constexpr D&
 NumericContainer<T, D>::operator*=(const std::convertible_to<T> auto scalar)
 {
-  FOR_EACH(entry, Derived()) entry *= scalar;
+  if constexpr(simd::Vectorisable<D>) simd::MultiplyScalar(Derived().data(), static_cast<T>(scalar), Derived().data(), Derived().size());
+  else FOR_EACH(entry, Derived()) entry *= scalar;
   return Derived();
 }
 
@@ -84,101 +88,129 @@ constexpr D&
 NumericContainer<T, D>::operator/=(const std::convertible_to<T> auto scalar)
 {
   DEBUG_ASSERT(!isEqual(scalar, Zero), "Cannot divide by zero.")
-  FOR_EACH(entry, Derived()) entry /= scalar;
+  if constexpr(simd::Vectorisable<D>) simd::DivideScalar(Derived().data(), static_cast<T>(scalar), Derived().data(), Derived().size());
+  else FOR_EACH(entry, Derived()) entry /= scalar;
   return Derived();
 }
 
-/** Entry-wise binary arithmetic operator overloads. */
+/** Entry-wise compound assignment operator overloads. */
 template<Arithmetic T, class D>
 template<class D2>
-constexpr D
-NumericContainer<T, D>::operator+(const NumericContainer<T, D2>& container) const
+constexpr D&
+NumericContainer<T, D>::operator+=(const NumericContainer<T, D2>& container)
 {
-  D out(Derived());
-  FOR(i, out.size()) out[i] += container.Derived()[i];
-  return out;
+  DEBUG_ASSERT(Derived().size() == container.Derived().size(), "The container sizes ", Derived().size(), " and ", container.Derived().size(), " must be equal.")
+  if constexpr(simd::Vectorisable<D> && simd::SimdContiguous<D2>) simd::Add(Derived().data(), container.Derived().data(), Derived().data(), Derived().size());
+  else
+  {
+    auto other = container.Derived().begin();
+    FOR_EACH(entry, Derived()) entry += *other++;
+  }
+  return Derived();
 }
 
 template<Arithmetic T, class D>
 template<class D2>
-constexpr D
-NumericContainer<T, D>::operator-(const NumericContainer<T, D2>& container) const
+constexpr D&
+NumericContainer<T, D>::operator-=(const NumericContainer<T, D2>& container)
 {
-  D out(Derived());
-  FOR(i, out.size()) out[i] -= container.Derived()[i];
-  return out;
+  DEBUG_ASSERT(Derived().size() == container.Derived().size(), "The container sizes ", Derived().size(), " and ", container.Derived().size(), " must be equal.")
+  if constexpr(simd::Vectorisable<D> && simd::SimdContiguous<D2>) simd::Subtract(Derived().data(), container.Derived().data(), Derived().data(), Derived().size());
+  else
+  {
+    auto other = container.Derived().begin();
+    FOR_EACH(entry, Derived()) entry -= *other++;
+  }
+  return Derived();
 }
 
 template<Arithmetic T, class D>
 template<class D2>
-constexpr D
-NumericContainer<T, D>::operator*(const NumericContainer<T, D2>& container) const
+constexpr D&
+NumericContainer<T, D>::operator*=(const NumericContainer<T, D2>& container)
 {
-  D out(Derived());
-  FOR(i, out.size()) out[i] *= container.Derived()[i];
-  return out;
+  DEBUG_ASSERT(Derived().size() == container.Derived().size(), "The container sizes ", Derived().size(), " and ", container.Derived().size(), " must be equal.")
+  if constexpr(simd::Vectorisable<D> && simd::SimdContiguous<D2>) simd::Multiply(Derived().data(), container.Derived().data(), Derived().data(), Derived().size());
+  else
+  {
+    auto other = container.Derived().begin();
+    FOR_EACH(entry, Derived()) entry *= *other++;
+  }
+  return Derived();
 }
 
 template<Arithmetic T, class D>
 template<class D2>
-constexpr D
-NumericContainer<T, D>::operator/(const NumericContainer<T, D2>& container) const
+constexpr D&
+NumericContainer<T, D>::operator/=(const NumericContainer<T, D2>& container)
 {
-  D out(Derived());
-
-  FOR(i, out.size())
+  DEBUG_ASSERT(Derived().size() == container.Derived().size(), "The container sizes ", Derived().size(), " and ", container.Derived().size(), " must be equal.")
+  if constexpr(simd::Vectorisable<D> && simd::SimdContiguous<D2>)
+  {
+    const size_t n = Derived().size();
+    DEBUG_ASSERT(!n || !isEqual(static_cast<Real>(simd::MinAbs(container.Derived().data(), n)), Zero), "Cannot divide by zero.")
+    simd::Divide(Derived().data(), container.Derived().data(), Derived().data(), n);
+  }
+  else
   {
-    DEBUG_ASSERT(!isEqual(container.Derived()[i], Zero), "Cannot divide by zero.")
-    out[i] /= container.Derived()[i];
+    auto other = container.Derived().begin();
+    FOR_EACH(entry, Derived()) entry = CheckedDivides{}(entry, *other++);
   }
-  return out;
+  return Derived();
 }
 
 template<Arithmetic T, class D>
-template<class D2>
+template<class E>
 constexpr D&
-NumericContainer<T, D>::operator+=(const NumericContainer<T, D2>& container)
+NumericContainer<T, D>::operator+=(const Expression<T, E>& expression)
 {
-  FOR(i, Derived().size()) Derived()[i] += container.Derived()[i];
+  const auto& expr = expression.Derived();
+  DEBUG_ASSERT(Derived().size() == expr.size(), "The container size ", Derived().size(), " must equal the expression size ", expr.size(), ".")
+  if constexpr(simd::Vectorisable<D>) if(AccumulateSimd(expr, Derived().data(), static_cast<T>(One))) return Derived();
+
+  size_t i{};
+  FOR_EACH(entry, Derived()) entry += expr[i++];
   return Derived();
 }
 
 template<Arithmetic T, class D>
-template<class D2>
+template<class E>
 constexpr D&
-NumericContainer<T, D>::operator-=(const NumericContainer<T, D2>& container)
+NumericContainer<T, D>::operator-=(const Expression<T, E>& expression)
 {
-  FOR(i, Derived().size()) Derived()[i] -= container.Derived()[i];
+  const auto& expr = expression.Derived();
+  DEBUG_ASSERT(Derived().size() == expr.size(), "The container size ", Derived().size(), " must equal the expression size ", expr.size(), ".")
+  if constexpr(simd::Vectorisable<D>) if(AccumulateSimd(expr, Derived().data(), static_cast<T>(-One))) return Derived();
+
+  size_t i{};
+  FOR_EACH(entry, Derived()) entry -= expr[i++];
   return Derived();
 }
 
 template<Arithmetic T, class D>
-template<class D2>
+template<class E>
 constexpr D&
-NumericContainer<T, D>::operator*=(const NumericContainer<T, D2>& container)
+NumericContainer<T, D>::operator*=(const Expression<T, E>& expression)
 {
-  FOR(i, Derived().size()) Derived()[i] *= container.Derived()[i];
+  const auto& expr = expression.Derived();
+  DEBUG_ASSERT(Derived().size() == expr.size(), "The container size ", Derived().size(), " must equal the expression size ", expr.size(), ".")
+  size_t i{};
+  FOR_EACH(entry, Derived()) entry *= expr[i++];
   return Derived();
 }
 
 template<Arithmetic T, class D>
-template<class D2>
+template<class E>
 constexpr D&
-NumericContainer<T, D>::operator/=(const NumericContainer<T, D2>& container)
+NumericContainer<T, D>::operator/=(const Expression<T, E>& expression)
 {
-  FOR(i, Derived().size())
-  {
-    DEBUG_ASSERT(!isEqual(container.Derived()[i], Zero), "Cannot divide by zero.")
-    Derived()[i] /= container.Derived()[i];
-  }
+  const auto& expr = expression.Derived();
+  DEBUG_ASSERT(Derived().size() == expr.size(), "The container size ", Derived().size(), " must equal the expression size ", expr.size(), ".")
+  size_t i{};
+  FOR_EACH(entry, Derived()) entry = CheckedDivides{}(entry, expr[i++]);
   return Derived();
 }
 
-/** Entry-wise unary operator overloads. */
-template<Arithmetic T, class D>
-constexpr D
-NumericContainer<T, D>::operator-() const { return -1 * Derived(); }
-
 /** Entry randomisation. */
 template<Arithmetic T, class D>
 void NumericContainer<T, D>::Randomise() { FOR_EACH(entry, Derived()) entry = Randomiser(); }
@@ -186,11 +218,5 @@ void NumericContainer<T, D>::Randomise() { FOR_EACH(entry, Derived()) entry = Ra
 template<Arithmetic T, class D>
 void NumericContainer<T, D>::ResetRandomiser(const T min, const T max) { Randomiser.Reset(min, max); }
 
-}//Detail
-
-/** Stand-alone Operator overloads. */
-template<Arithmetic T, class D>
-constexpr D
-operator*(const std::convertible_to<T> auto scalar, const detail::NumericContainer<T, D>& container) { return container.Derived() * scalar; }
-
-}//aprn
\ No newline at end of file
+}//detail
+}//aprn
@@ -0,0 +1,174 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+#include "../../../include/Global.h"
+
+#include <algorithm>
+#include <bit>
+
+#if defined(__x86_64__) && defined(__SSE2__)
+#define APRN_SIMD_SSE2
+#include <immintrin.h>
+#if defined(__GNUC__) && !defined(__clang__)
+#define APRN_SIMD_AVX
+#endif
+#endif
+
+namespace aprn {
+namespace simd {
+
+/***************************************************************************************************************************************************************
+* SIMD Instruction Set Levels
+***************************************************************************************************************************************************************/
+enum class SimdLevel
+{
+   Scalar,
+   SSE2,
+   AVX2,
+   AVX512
+};
+
+/** Highest instruction set level supported by both the compiler and the host CPU. */
+inline SimdLevel DetectSimdLevel();
+
+/** Instruction set level currently used by the kernels below. Defaults to the detected level. */
+inline SimdLevel ActiveSimdLevel();
+
+/** Override the instruction set level, e.g. to benchmark kernels against each other. Cannot exceed the detected level. */
+inline void SetSimdLevel(const SimdLevel level);
+
+/***************************************************************************************************************************************************************
+* Kernels over Contiguous Arrays
+***************************************************************************************************************************************************************/
+
+/** Entry types with kernels at every level: double, e.g. for solvers, and float, e.g. for geometry fed to the GPU, which packs twice as many lanes per
+ *  register and halves the memory traffic. */
+template<typename S>
+concept SimdScalar = isTypeSame<S, double>() || isTypeSame<S, float>();
+
+/** Containers storing SIMD scalar entries contiguously, whose entries can be passed to the kernels below. */
+template<class C>
+concept SimdContiguous = requires(const C& container)
+{
+   { container.data() } -> std::convertible_to<const void*>;
+   { container.size() } -> std::convertible_to<size_t>;
+   requires SimdScalar<std::remove_cvref_t<decltype(*container.data())>>;
+};
+
+/** Run-time sized containers, for which the kernels are used in place of plain loops. Fixed-size containers are typically small and left to the compiler. */
+template<class C>
+concept Vectorisable = SimdContiguous<C> && requires(C& container) { container.resize(size_t{}); };
+
+/** Entry type of a SIMD-contiguous container. */
+template<SimdContiguous C>
+using SimdScalarType = std::remove_cvref_t<decltype(*std::declval<const C&>().data())>;
+
+/** Entry-wise binary operations, out[i] = a[i] op b[i]. The output may alias either input. */
+template<SimdScalar S>
+inline void Add(const S* a, const S* b, S* out, const size_t n);
+
+template<SimdScalar S>
+inline void Subtract(const S* a, const S* b, S* out, const size_t n);
+
+template<SimdScalar S>
+inline void Multiply(const S* a, const S* b, S* out, const size_t n);
+
+template<SimdScalar S>
+inline void Divide(const S* a, const S* b, S* out, const size_t n);
+
+/** Entry-wise scalar operations, out[i] = a[i] op s. The output may alias the input. */
+template<SimdScalar S>
+inline void AddScalar(const S* a, const S s, S* out, const size_t n);
+
+template<SimdScalar S>
+inline void SubtractScalar(const S* a, const S s, S* out, const size_t n);
+
+template<SimdScalar S>
+inline void MultiplyScalar(const S* a, const S s, S* out, const size_t n);
+
+template<SimdScalar S>
+inline void DivideScalar(const S* a, const S s, S* out, const size_t n);
+
+/** Scaled accumulation, y[i] += alpha * x[i]. */
+template<SimdScalar S>
+inline void Axpy(const S alpha, const S* x, S* y, const size_t n);
+
+/** Reductions. Min, Max, MinAbs, and MaxAbs require n > 0. */
+template<SimdScalar S>
+inline S Dot(const S* a, const S* b, const size_t n);
+
+template<SimdScalar S>
+inline S Sum(const S* a, const size_t n);
+
+template<SimdScalar S>
+inline S SumAbs(const S* a, const size_t n);
+
+template<SimdScalar S>
+inline S MinAbs(const S* a, const size_t n);
+
+template<SimdScalar S>
+inline S MaxAbs(const S* a, const size_t n);
+
+template<SimdScalar S>
+inline S Min(const S* a, const size_t n);
+
+template<SimdScalar S>
+inline S Max(const S* a, const size_t n);
+
+/***************************************************************************************************************************************************************
+* Matrix Multiplication Micro-kernel
+***************************************************************************************************************************************************************/
+
+/** Rows of the register tile of the active level, which is two packed registers tall, and its columns, which are the same at every level. */
+template<SimdScalar S = Real>
+inline size_t GemmTileRows();
+
+constexpr size_t GemmTileColumns = 6;
+
+/** Product of a packed panel of A, holding k columns of GemmTileRows() entries, and a packed panel of B, holding k rows of GemmTileColumns entries, written
+ *  column-major to a GemmTileRows() x GemmTileColumns tile. The panels are packed by the caller, e.g. the blocked matrix products in LinearAlgebra. */
+template<SimdScalar S>
+inline void GemmTile(const size_t k, const S* a, const S* b, S* tile);
+
+/***************************************************************************************************************************************************************
+* Kernels over Structure-of-Arrays 3D Vectors
+***************************************************************************************************************************************************************/
+
+/** 3D vectors stored as three contiguous coordinate arrays, e.g. the fields of an SoAArray<Real, Real, Real>. */
+template<typename T>
+struct Vectors3
+{
+   T* X;
+   T* Y;
+   T* Z;
+};
+
+/** Cross products, out[i] = a[i] x b[i]. The output may alias either input. */
+template<SimdScalar S>
+inline void Cross(const Vectors3<const S>& a, const Vectors3<const S>& b, const Vectors3<S>& out, const size_t n);
+
+/** Normalisations, out[i] = v[i] / |v[i]|, and cosines of the angles between pairs of vectors, clamped to [-1, 1]. Rather than failing, vectors of magnitude
+ *  less than the tolerance are flagged as degenerate, and given a zero normalisation, or a unit cosine. Both return the number of degenerate entries. */
+template<SimdScalar S>
+inline size_t Normalise(const Vectors3<const S>& v, const Vectors3<S>& out, Bool* degenerate, const size_t n, const S tolerance);
+
+template<SimdScalar S>
+inline size_t CosAngle(const Vectors3<const S>& a, const Vectors3<const S>& b, S* out, Bool* degenerate, const size_t n, const S tolerance);
+
+}//simd
+}//aprn
+
+#include "Simd.tpp"
@@ -0,0 +1,521 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+namespace aprn {
+namespace simd {
+
+/***************************************************************************************************************************************************************
+* Scalar Fallback
+***************************************************************************************************************************************************************/
+namespace scalar {
+
+/** The scalar operations are shared by both entry types. */
+template<typename S> inline S Load(const S* p) { return *p; }
+template<typename S> inline void Store(S* p, const S x) { *p = x; }
+template<typename S> inline S Broadcast(const S s) { return s; }
+template<typename S> inline S PAdd(const S x, const S y) { return x + y; }
+template<typename S> inline S PSub(const S x, const S y) { return x - y; }
+template<typename S> inline S PMul(const S x, const S y) { return x * y; }
+template<typename S> inline S PDiv(const S x, const S y) { return x / y; }
+template<typename S> inline S PFma(const S x, const S y, const S z) { return x * y + z; }
+template<typename S> inline S PAbs(const S x) { return std::abs(x); }
+template<typename S> inline S PMin(const S x, const S y) { return std::min(x, y); }
+template<typename S> inline S PMax(const S x, const S y) { return std::max(x, y); }
+template<typename S> inline S PSqrt(const S x) { return std::sqrt(x); }
+template<typename S> inline unsigned LessMask(const S x, const S y) { return x < y; }
+template<typename S> inline S ReduceAdd(const S x) { return x; }
+template<typename S> inline S ReduceMin(const S x) { return x; }
+template<typename S> inline S ReduceMax(const S x) { return x; }
+
+namespace f64 {
+
+using Scalar = double;
+using Pack   = double;
+constexpr size_t Width = 1;
+
+#include "SimdKernels.tpp"
+
+}//f64
+
+namespace f32 {
+
+using Scalar = float;
+using Pack   = float;
+constexpr size_t Width = 1;
+
+#include "SimdKernels.tpp"
+
+}//f32
+}//scalar
+
+/***************************************************************************************************************************************************************
+* SSE2 Kernels (baseline on x86-64)
+***************************************************************************************************************************************************************/
+#ifdef APRN_SIMD_SSE2
+namespace sse2 {
+namespace f64 {
+
+using Scalar = double;
+using Pack   = __m128d;
+constexpr size_t Width = 2;
+
+inline Pack Load(const Scalar* p) { return _mm_loadu_pd(p); }
+inline void Store(Scalar* p, const Pack x) { _mm_storeu_pd(p, x); }
+inline Pack Broadcast(const Scalar s) { return _mm_set1_pd(s); }
+inline Pack PAdd(const Pack x, const Pack y) { return _mm_add_pd(x, y); }
+inline Pack PSub(const Pack x, const Pack y) { return _mm_sub_pd(x, y); }
+inline Pack PMul(const Pack x, const Pack y) { return _mm_mul_pd(x, y); }
+inline Pack PDiv(const Pack x, const Pack y) { return _mm_div_pd(x, y); }
+inline Pack PFma(const Pack x, const Pack y, const Pack z) { return _mm_add_pd(_mm_mul_pd(x, y), z); }
+inline Pack PAbs(const Pack x) { return _mm_andnot_pd(_mm_set1_pd(-0.0), x); }
+inline Pack PMin(const Pack x, const Pack y) { return _mm_min_pd(x, y); }
+inline Pack PMax(const Pack x, const Pack y) { return _mm_max_pd(x, y); }
+inline Pack PSqrt(const Pack x) { return _mm_sqrt_pd(x); }
+inline unsigned LessMask(const Pack x, const Pack y) { return static_cast<unsigned>(_mm_movemask_pd(_mm_cmplt_pd(x, y))); }
+inline Scalar ReduceAdd(const Pack x) { return _mm_cvtsd_f64(_mm_add_sd(x, _mm_unpackhi_pd(x, x))); }
+inline Scalar ReduceMin(const Pack x) { return _mm_cvtsd_f64(_mm_min_sd(x, _mm_unpackhi_pd(x, x))); }
+inline Scalar ReduceMax(const Pack x) { return _mm_cvtsd_f64(_mm_max_sd(x, _mm_unpackhi_pd(x, x))); }
+
+#include "SimdKernels.tpp"
+
+}//f64
+
+namespace f32 {
+
+using Scalar = float;
+using Pack   = __m128;
+constexpr size_t Width = 4;
+
+/** Horizontal reductions fold the upper half onto the lower half, then the second lane onto the first. */
+inline __m128 FoldPairs(const __m128 x) { return _mm_movehl_ps(x, x); }
+inline __m128 FoldLanes(const __m128 x) { return _mm_shuffle_ps(x, x, 1); }
+
+inline Pack Load(const Scalar* p) { return _mm_loadu_ps(p); }
+inline void Store(Scalar* p, const Pack x) { _mm_storeu_ps(p, x); }
+inline Pack Broadcast(const Scalar s) { return _mm_set1_ps(s); }
+inline Pack PAdd(const Pack x, const Pack y) { return _mm_add_ps(x, y); }
+inline Pack PSub(const Pack x, const Pack y) { return _mm_sub_ps(x, y); }
+inline Pack PMul(const Pack x, const Pack y) { return _mm_mul_ps(x, y); }
+inline Pack PDiv(const Pack x, const Pack y) { return _mm_div_ps(x, y); }
+inline Pack PFma(const Pack x, const Pack y, const Pack z) { return _mm_add_ps(_mm_mul_ps(x, y), z); }
+inline Pack PAbs(const Pack x) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), x); }
+inline Pack PMin(const Pack x, const Pack y) { return _mm_min_ps(x, y); }
+inline Pack PMax(const Pack x, const Pack y) { return _mm_max_ps(x, y); }
+inline Pack PSqrt(const Pack x) { return _mm_sqrt_ps(x); }
+inline unsigned LessMask(const Pack x, const Pack y) { return static_cast<unsigned>(_mm_movemask_ps(_mm_cmplt_ps(x, y))); }
+
+inline Scalar
+ReduceAdd(const Pack x)
+{
+   const __m128 y = _mm_add_ps(x, FoldPairs(x));
+   return _mm_cvtss_f32(_mm_add_ss(y, FoldLanes(y)));
+}
+
+inline Scalar
+ReduceMin(const Pack x)
+{
+   const __m128 y = _mm_min_ps(x, FoldPairs(x));
+   return _mm_cvtss_f32(_mm_min_ss(y, FoldLanes(y)));
+}
+
+inline Scalar
+ReduceMax(const Pack x)
+{
+   const __m128 y = _mm_max_ps(x, FoldPairs(x));
+   return _mm_cvtss_f32(_mm_max_ss(y, FoldLanes(y)));
+}
+
+#include "SimdKernels.tpp"
+
+}//f32
+}//sse2
+#endif
+
+/***************************************************************************************************************************************************************
+* AVX2/FMA and AVX-512 Kernels (compiled for their target regardless of the global flags, and only called if the host CPU supports them)
+***************************************************************************************************************************************************************/
+#ifdef APRN_SIMD_AVX
+#pragma GCC push_options
+#pragma GCC target("avx2,fma")
+namespace avx2 {
+namespace f64 {
+
+using Scalar = double;
+using Pack   = __m256d;
+constexpr size_t Width = 4;
+
+inline Pack Load(const Scalar* p) { return _mm256_loadu_pd(p); }
+inline void Store(Scalar* p, const Pack x) { _mm256_storeu_pd(p, x); }
+inline Pack Broadcast(const Scalar s) { return _mm256_set1_pd(s); }
+inline Pack PAdd(const Pack x, const Pack y) { return _mm256_add_pd(x, y); }
+inline Pack PSub(const Pack x, const Pack y) { return _mm256_sub_pd(x, y); }
+inline Pack PMul(const Pack x, const Pack y) { return _mm256_mul_pd(x, y); }
+inline Pack PDiv(const Pack x, const Pack y) { return _mm256_div_pd(x, y); }
+inline Pack PFma(const Pack x, const Pack y, const Pack z) { return _mm256_fmadd_pd(x, y, z); }
+inline Pack PAbs(const Pack x) { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), x); }
+inline Pack PMin(const Pack x, const Pack y) { return _mm256_min_pd(x, y); }
+inline Pack PMax(const Pack x, const Pack y) { return _mm256_max_pd(x, y); }
+inline Pack PSqrt(const Pack x) { return _mm256_sqrt_pd(x); }
+inline unsigned LessMask(const Pack x, const Pack y) { return static_cast<unsigned>(_mm256_movemask_pd(_mm256_cmp_pd(x, y, _CMP_LT_OQ))); }
+
+inline Scalar
+ReduceAdd(const Pack x)
+{
+   const __m128d y = _mm_add_pd(_mm256_castpd256_pd128(x), _mm256_extractf128_pd(x, 1));
+   return _mm_cvtsd_f64(_mm_add_sd(y, _mm_unpackhi_pd(y, y)));
+}
+
+inline Scalar
+ReduceMin(const Pack x)
+{
+   const __m128d y = _mm_min_pd(_mm256_castpd256_pd128(x), _mm256_extractf128_pd(x, 1));
+   return _mm_cvtsd_f64(_mm_min_sd(y, _mm_unpackhi_pd(y, y)));
+}
+
+inline Scalar
+ReduceMax(const Pack x)
+{
+   const __m128d y = _mm_max_pd(_mm256_castpd256_pd128(x), _mm256_extractf128_pd(x, 1));
+   return _mm_cvtsd_f64(_mm_max_sd(y, _mm_unpackhi_pd(y, y)));
+}
+
+#include "SimdKernels.tpp"
+
+}//f64
+
+namespace f32 {
+
+using Scalar = float;
+using Pack   = __m256;
+constexpr size_t Width = 8;
+
+inline Pack Load(const Scalar* p) { return _mm256_loadu_ps(p); }
+inline void Store(Scalar* p, const Pack x) { _mm256_storeu_ps(p, x); }
+inline Pack Broadcast(const Scalar s) { return _mm256_set1_ps(s); }
+inline Pack PAdd(const Pack x, const Pack y) { return _mm256_add_ps(x, y); }
+inline Pack PSub(const Pack x, const Pack y) { return _mm256_sub_ps(x, y); }
+inline Pack PMul(const Pack x, const Pack y) { return _mm256_mul_ps(x, y); }
+inline Pack PDiv(const Pack x, const Pack y) { return _mm256_div_ps(x, y); }
+inline Pack PFma(const Pack x, const Pack y, const Pack z) { return _mm256_fmadd_ps(x, y, z); }
+inline Pack PAbs(const Pack x) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), x); }
+inline Pack PMin(const Pack x, const Pack y) { return _mm256_min_ps(x, y); }
+inline Pack PMax(const Pack x, const Pack y) { return _mm256_max_ps(x, y); }
+inline Pack PSqrt(const Pack x) { return _mm256_sqrt_ps(x); }
+inline unsigned LessMask(const Pack x, const Pack y) { return static_cast<unsigned>(_mm256_movemask_ps(_mm256_cmp_ps(x, y, _CMP_LT_OQ))); }
+
+/** The 256-bit register is folded onto its lower 128-bit half, then reduced as in SSE. */
+inline Scalar ReduceAdd(const Pack x) { return sse2::f32::ReduceAdd(_mm_add_ps(_mm256_castps256_ps128(x), _mm256_extractf128_ps(x, 1))); }
+inline Scalar ReduceMin(const Pack x) { return sse2::f32::ReduceMin(_mm_min_ps(_mm256_castps256_ps128(x), _mm256_extractf128_ps(x, 1))); }
+inline Scalar ReduceMax(const Pack x) { return sse2::f32::ReduceMax(_mm_max_ps(_mm256_castps256_ps128(x), _mm256_extractf128_ps(x, 1))); }
+
+#include "SimdKernels.tpp"
+
+}//f32
+}//avx2
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("avx512f")
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"       // Spurious warnings from the _mm256_undefined_pd() placeholders in GCC's AVX-512 headers.
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+namespace avx512 {
+namespace f64 {
+
+using Scalar = double;
+using Pack   = __m512d;
+constexpr size_t Width = 8;
+
+inline Pack Load(const Scalar* p) { return _mm512_loadu_pd(p); }
+inline void Store(Scalar* p, const Pack x) { _mm512_storeu_pd(p, x); }
+inline Pack Broadcast(const Scalar s) { return _mm512_set1_pd(s); }
+inline Pack PAdd(const Pack x, const Pack y) { return _mm512_add_pd(x, y); }
+inline Pack PSub(const Pack x, const Pack y) { return _mm512_sub_pd(x, y); }
+inline Pack PMul(const Pack x, const Pack y) { return _mm512_mul_pd(x, y); }
+inline Pack PDiv(const Pack x, const Pack y) { return _mm512_div_pd(x, y); }
+inline Pack PFma(const Pack x, const Pack y, const Pack z) { return _mm512_fmadd_pd(x, y, z); }
+inline Pack PAbs(const Pack x) { return _mm512_abs_pd(x); }
+inline Pack PMin(const Pack x, const Pack y) { return _mm512_min_pd(x, y); }
+inline Pack PMax(const Pack x, const Pack y) { return _mm512_max_pd(x, y); }
+inline Pack PSqrt(const Pack x) { return _mm512_sqrt_pd(x); }
+inline unsigned LessMask(const Pack x, const Pack y) { return _mm512_cmp_pd_mask(x, y, _CMP_LT_OQ); }
+inline Scalar ReduceAdd(const Pack x) { return _mm512_reduce_add_pd(x); }
+inline Scalar ReduceMin(const Pack x) { return _mm512_reduce_min_pd(x); }
+inline Scalar ReduceMax(const Pack x) { return _mm512_reduce_max_pd(x); }
+
+#include "SimdKernels.tpp"
+
+}//f64
+
+namespace f32 {
+
+using Scalar = float;
+using Pack   = __m512;
+constexpr size_t Width = 16;
+
+inline Pack Load(const Scalar* p) { return _mm512_loadu_ps(p); }
+inline void Store(Scalar* p, const Pack x) { _mm512_storeu_ps(p, x); }
+inline Pack Broadcast(const Scalar s) { return _mm512_set1_ps(s); }
+inline Pack PAdd(const Pack x, const Pack y) { return _mm512_add_ps(x, y); }
+inline Pack PSub(const Pack x, const Pack y) { return _mm512_sub_ps(x, y); }
+inline Pack PMul(const Pack x, const Pack y) { return _mm512_mul_ps(x, y); }
+inline Pack PDiv(const Pack x, const Pack y) { return _mm512_div_ps(x, y); }
+inline Pack PFma(const Pack x, const Pack y, const Pack z) { return _mm512_fmadd_ps(x, y, z); }
+inline Pack PAbs(const Pack x) { return _mm512_abs_ps(x); }
+inline Pack PMin(const Pack x, const Pack y) { return _mm512_min_ps(x, y); }
+inline Pack PMax(const Pack x, const Pack y) { return _mm512_max_ps(x, y); }
+inline Pack PSqrt(const Pack x) { return _mm512_sqrt_ps(x); }
+inline unsigned LessMask(const Pack x, const Pack y) { return _mm512_cmp_ps_mask(x, y, _CMP_LT_OQ); }
+inline Scalar ReduceAdd(const Pack x) { return _mm512_reduce_add_ps(x); }
+inline Scalar ReduceMin(const Pack x) { return _mm512_reduce_min_ps(x); }
+inline Scalar ReduceMax(const Pack x) { return _mm512_reduce_max_ps(x); }
+
+#include "SimdKernels.tpp"
+
+}//f32
+}//avx512
+#pragma GCC diagnostic pop
+#pragma GCC pop_options
+#endif
+
+/***************************************************************************************************************************************************************
+* Runtime Kernel Dispatch
+***************************************************************************************************************************************************************/
+namespace detail {
+
+/** Table of kernels for a single instruction set level and entry type. */
+template<typename S>
+struct KernelTable
+{
+   void (*Add)(const S*, const S*, S*, size_t);
+   void (*Subtract)(const S*, const S*, S*, size_t);
+   void (*Multiply)(const S*, const S*, S*, size_t);
+   void (*Divide)(const S*, const S*, S*, size_t);
+   void (*AddScalar)(const S*, S, S*, size_t);
+   void (*SubtractScalar)(const S*, S, S*, size_t);
+   void (*MultiplyScalar)(const S*, S, S*, size_t);
+   void (*DivideScalar)(const S*, S, S*, size_t);
+   void (*Axpy)(S, const S*, S*, size_t);
+   S (*Dot)(const S*, const S*, size_t);
+   S (*Sum)(const S*, size_t);
+   S (*SumAbs)(const S*, size_t);
+   S (*MinAbs)(const S*, size_t);
+   S (*MaxAbs)(const S*, size_t);
+   S (*Min)(const S*, size_t);
+   S (*Max)(const S*, size_t);
+   void (*GemmTile)(size_t, const S*, const S*, S*);
+   size_t GemmTileRows;
+   void (*Cross)(const Vectors3<const S>&, const Vectors3<const S>&, const Vectors3<S>&, size_t);
+   size_t (*Normalise)(const Vectors3<const S>&, const Vectors3<S>&, Bool*, size_t, S);
+   size_t (*CosAngle)(const Vectors3<const S>&, const Vectors3<const S>&, S*, Bool*, size_t, S);
+};
+
+#define APRN_SIMD_KERNEL_TABLE(isa) KernelTable<S>{isa::Add, isa::Subtract, isa::Multiply, isa::Divide, isa::AddScalar, isa::SubtractScalar, isa::MultiplyScalar, \
+                                                   isa::DivideScalar, isa::Axpy, isa::Dot, isa::Sum, isa::SumAbs, isa::MinAbs, isa::MaxAbs, isa::Min, isa::Max, \
+                                                   isa::GemmTile, isa::TileRows, isa::Cross, isa::Normalise, isa::CosAngle}
+
+template<typename S>
+KernelTable<S>
+MakeKernelTable(const SimdLevel level)
+{
+   if constexpr(isTypeSame<S, float>())
+   {
+      switch(level)
+      {
+#ifdef APRN_SIMD_AVX
+         case SimdLevel::AVX512: return APRN_SIMD_KERNEL_TABLE(avx512::f32);
+         case SimdLevel::AVX2:   return APRN_SIMD_KERNEL_TABLE(avx2::f32);
+#endif
+#ifdef APRN_SIMD_SSE2
+         case SimdLevel::SSE2:   return APRN_SIMD_KERNEL_TABLE(sse2::f32);
+#endif
+         default:                return APRN_SIMD_KERNEL_TABLE(scalar::f32);
+      }
+   }
+   else
+   {
+      switch(level)
+      {
+#ifdef APRN_SIMD_AVX
+         case SimdLevel::AVX512: return APRN_SIMD_KERNEL_TABLE(avx512::f64);
+         case SimdLevel::AVX2:   return APRN_SIMD_KERNEL_TABLE(avx2::f64);
+#endif
+#ifdef APRN_SIMD_SSE2
+         case SimdLevel::SSE2:   return APRN_SIMD_KERNEL_TABLE(sse2::f64);
+#endif
+         default:                return APRN_SIMD_KERNEL_TABLE(scalar::f64);
+      }
+   }
+}
+
+#undef APRN_SIMD_KERNEL_TABLE
+
+struct ActiveKernelTable
+{
+   SimdLevel           Level{DetectSimdLevel()};
+   KernelTable<double> Double{MakeKernelTable<double>(Level)};
+   KernelTable<float>  Float{MakeKernelTable<float>(Level)};
+};
+
+/** Kernel tables of the active instruction set level, selected once on first use. */
+inline ActiveKernelTable&
+ActiveKernelTables()
+{
+   static ActiveKernelTable active;
+   return active;
+}
+
+/** Kernels of the active instruction set level for a given entry type. */
+template<SimdScalar S>
+inline const KernelTable<S>&
+ActiveKernels()
+{
+   if constexpr(isTypeSame<S, float>()) return ActiveKernelTables().Float;
+   else return ActiveKernelTables().Double;
+}
+
+}//detail
+
+inline SimdLevel
+DetectSimdLevel()
+{
+#ifdef APRN_SIMD_AVX
+   __builtin_cpu_init();
+   if(__builtin_cpu_supports("avx512f")) return SimdLevel::AVX512;
+   if(__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) return SimdLevel::AVX2;
+#endif
+#ifdef APRN_SIMD_SSE2
+   return SimdLevel::SSE2;
+#else
+   return SimdLevel::Scalar;
+#endif
+}
+
+inline SimdLevel ActiveSimdLevel() { return detail::ActiveKernelTables().Level; }
+
+inline void
+SetSimdLevel(const SimdLevel level)
+{
+   ASSERT(level <= DetectSimdLevel(), "The requested SIMD level is not supported on this machine.")
+   detail::ActiveKernelTables() = {level, detail::MakeKernelTable<double>(level), detail::MakeKernelTable<float>(level)};
+}
+
+/***************************************************************************************************************************************************************
+* Kernels over Contiguous Arrays
+***************************************************************************************************************************************************************/
+template<SimdScalar S>
+inline void Add(const S* a, const S* b, S* out, const size_t n) { detail::ActiveKernels<S>().Add(a, b, out, n); }
+
+template<SimdScalar S>
+inline void Subtract(const S* a, const S* b, S* out, const size_t n) { detail::ActiveKernels<S>().Subtract(a, b, out, n); }
+
+template<SimdScalar S>
+inline void Multiply(const S* a, const S* b, S* out, const size_t n) { detail::ActiveKernels<S>().Multiply(a, b, out, n); }
+
+template<SimdScalar S>
+inline void Divide(const S* a, const S* b, S* out, const size_t n) { detail::ActiveKernels<S>().Divide(a, b, out, n); }
+
+template<SimdScalar S>
+inline void AddScalar(const S* a, const S s, S* out, const size_t n) { detail::ActiveKernels<S>().AddScalar(a, s, out, n); }
+
+template<SimdScalar S>
+inline void SubtractScalar(const S* a, const S s, S* out, const size_t n) { detail::ActiveKernels<S>().SubtractScalar(a, s, out, n); }
+
+template<SimdScalar S>
+inline void MultiplyScalar(const S* a, const S s, S* out, const size_t n) { detail::ActiveKernels<S>().MultiplyScalar(a, s, out, n); }
+
+template<SimdScalar S>
+inline void DivideScalar(const S* a, const S s, S* out, const size_t n) { detail::ActiveKernels<S>().DivideScalar(a, s, out, n); }
+
+template<SimdScalar S>
+inline void Axpy(const S alpha, const S* x, S* y, const size_t n) { detail::ActiveKernels<S>().Axpy(alpha, x, y, n); }
+
+template<SimdScalar S>
+inline S Dot(const S* a, const S* b, const size_t n) { return detail::ActiveKernels<S>().Dot(a, b, n); }
+
+template<SimdScalar S>
+inline S Sum(const S* a, const size_t n) { return detail::ActiveKernels<S>().Sum(a, n); }
+
+template<SimdScalar S>
+inline S SumAbs(const S* a, const size_t n) { return detail::ActiveKernels<S>().SumAbs(a, n); }
+
+template<SimdScalar S>
+inline S
+MinAbs(const S* a, const size_t n)
+{
+   DEBUG_ASSERT(n, "Cannot compute the minimum of an empty range.")
+   return detail::ActiveKernels<S>().MinAbs(a, n);
+}
+
+template<SimdScalar S>
+inline S
+MaxAbs(const S* a, const size_t n)
+{
+   DEBUG_ASSERT(n, "Cannot compute the maximum of an empty range.")
+   return detail::ActiveKernels<S>().MaxAbs(a, n);
+}
+
+template<SimdScalar S>
+inline S
+Min(const S* a, const size_t n)
+{
+   DEBUG_ASSERT(n, "Cannot compute the minimum of an empty range.")
+   return detail::ActiveKernels<S>().Min(a, n);
+}
+
+template<SimdScalar S>
+inline S
+Max(const S* a, const size_t n)
+{
+   DEBUG_ASSERT(n, "Cannot compute the maximum of an empty range.")
+   return detail::ActiveKernels<S>().Max(a, n);
+}
+
+/***************************************************************************************************************************************************************
+* Matrix Multiplication Micro-kernel
+***************************************************************************************************************************************************************/
+template<SimdScalar S>
+inline size_t GemmTileRows() { return detail::ActiveKernels<S>().GemmTileRows; }
+
+template<SimdScalar S>
+inline void GemmTile(const size_t k, const S* a, const S* b, S* tile) { detail::ActiveKernels<S>().GemmTile(k, a, b, tile); }
+
+/***************************************************************************************************************************************************************
+* Kernels over Structure-of-Arrays 3D Vectors
+***************************************************************************************************************************************************************/
+template<SimdScalar S>
+inline void
+Cross(const Vectors3<const S>& a, const Vectors3<const S>& b, const Vectors3<S>& out, const size_t n)
+{
+   detail::ActiveKernels<S>().Cross(a, b, out, n);
+}
+
+template<SimdScalar S>
+inline size_t
+Normalise(const Vectors3<const S>& v, const Vectors3<S>& out, Bool* degenerate, const size_t n, const S tolerance)
+{
+   return detail::ActiveKernels<S>().Normalise(v, out, degenerate, n, tolerance);
+}
+
+template<SimdScalar S>
+inline size_t
+CosAngle(const Vectors3<const S>& a, const Vectors3<const S>& b, S* out, Bool* degenerate, const size_t n, const S tolerance)
+{
+   return detail::ActiveKernels<S>().CosAngle(a, b, out, degenerate, n, tolerance);
+}
+
+}//simd
+}//aprn
@@ -0,0 +1,392 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+/** Kernel bodies shared by all instruction set levels and entry types. This file is deliberately included once per level and entry type (hence no include
+ *  guard), inside a namespace that defines the entry type Scalar, the packed register type Pack, its lane count Width, and the Load/Store/Broadcast/PAdd/PSub/
+ *  PMul/PDiv/PFma/PAbs/PMin/PMax/PSqrt/LessMask/Reduce* operations. */
+
+/***************************************************************************************************************************************************************
+* Entry-wise Kernels
+***************************************************************************************************************************************************************/
+inline void
+Add(const Scalar* a, const Scalar* b, Scalar* out, const size_t n)
+{
+   size_t i = 0;
+   for(; i + Width <= n; i += Width) Store(out + i, PAdd(Load(a + i), Load(b + i)));
+   for(; i < n; ++i) out[i] = a[i] + b[i];
+}
+
+inline void
+Subtract(const Scalar* a, const Scalar* b, Scalar* out, const size_t n)
+{
+   size_t i = 0;
+   for(; i + Width <= n; i += Width) Store(out + i, PSub(Load(a + i), Load(b + i)));
+   for(; i < n; ++i) out[i] = a[i] - b[i];
+}
+
+inline void
+Multiply(const Scalar* a, const Scalar* b, Scalar* out, const size_t n)
+{
+   size_t i = 0;
+   for(; i + Width <= n; i += Width) Store(out + i, PMul(Load(a + i), Load(b + i)));
+   for(; i < n; ++i) out[i] = a[i] * b[i];
+}
+
+inline void
+Divide(const Scalar* a, const Scalar* b, Scalar* out, const size_t n)
+{
+   size_t i = 0;
+   for(; i + Width <= n; i += Width) Store(out + i, PDiv(Load(a + i), Load(b + i)));
+   for(; i < n; ++i) out[i] = a[i] / b[i];
+}
+
+inline void
+AddScalar(const Scalar* a, const Scalar s, Scalar* out, const size_t n)
+{
+   const Pack scalar = Broadcast(s);
+   size_t i = 0;
+   for(; i + Width <= n; i += Width) Store(out + i, PAdd(Load(a + i), scalar));
+   for(; i < n; ++i) out[i] = a[i] + s;
+}
+
+inline void
+SubtractScalar(const Scalar* a, const Scalar s, Scalar* out, const size_t n)
+{
+   const Pack scalar = Broadcast(s);
+   size_t i = 0;
+   for(; i + Width <= n; i += Width) Store(out + i, PSub(Load(a + i), scalar));
+   for(; i < n; ++i) out[i] = a[i] - s;
+}
+
+inline void
+MultiplyScalar(const Scalar* a, const Scalar s, Scalar* out, const size_t n)
+{
+   const Pack scalar = Broadcast(s);
+   size_t i = 0;
+   for(; i + Width <= n; i += Width) Store(out + i, PMul(Load(a + i), scalar));
+   for(; i < n; ++i) out[i] = a[i] * s;
+}
+
+inline void
+DivideScalar(const Scalar* a, const Scalar s, Scalar* out, const size_t n)
+{
+   const Pack scalar = Broadcast(s);
+   size_t i = 0;
+   for(; i + Width <= n; i += Width) Store(out + i, PDiv(Load(a + i), scalar));
+   for(; i < n; ++i) out[i] = a[i] / s;
+}
+
+inline void
+Axpy(const Scalar alpha, const Scalar* x, Scalar* y, const size_t n)
+{
+   const Pack scalar = Broadcast(alpha);
+   size_t i = 0;
+   for(; i + Width <= n; i += Width) Store(y + i, PFma(scalar, Load(x + i), Load(y + i)));
+   for(; i < n; ++i) y[i] += alpha * x[i];
+}
+
+/***************************************************************************************************************************************************************
+* Reduction Kernels
+***************************************************************************************************************************************************************/
+
+/** Reductions use four independent accumulators to hide the latency of the dependent add/min/max chains. */
+inline Scalar
+Dot(const Scalar* a, const Scalar* b, const size_t n)
+{
+   Pack acc0 = Broadcast(Scalar{}), acc1 = acc0, acc2 = acc0, acc3 = acc0;
+   size_t i = 0;
+   for(; i + 4 * Width <= n; i += 4 * Width)
+   {
+      acc0 = PFma(Load(a + i            ), Load(b + i            ), acc0);
+      acc1 = PFma(Load(a + i +     Width), Load(b + i +     Width), acc1);
+      acc2 = PFma(Load(a + i + 2 * Width), Load(b + i + 2 * Width), acc2);
+      acc3 = PFma(Load(a + i + 3 * Width), Load(b + i + 3 * Width), acc3);
+   }
+   for(; i + Width <= n; i += Width) acc0 = PFma(Load(a + i), Load(b + i), acc0);
+
+   Scalar result = ReduceAdd(PAdd(PAdd(acc0, acc1), PAdd(acc2, acc3)));
+   for(; i < n; ++i) result += a[i] * b[i];
+   return result;
+}
+
+inline Scalar
+Sum(const Scalar* a, const size_t n)
+{
+   Pack acc0 = Broadcast(Scalar{}), acc1 = acc0, acc2 = acc0, acc3 = acc0;
+   size_t i = 0;
+   for(; i + 4 * Width <= n; i += 4 * Width)
+   {
+      acc0 = PAdd(Load(a + i            ), acc0);
+      acc1 = PAdd(Load(a + i +     Width), acc1);
+      acc2 = PAdd(Load(a + i + 2 * Width), acc2);
+      acc3 = PAdd(Load(a + i + 3 * Width), acc3);
+   }
+   for(; i + Width <= n; i += Width) acc0 = PAdd(Load(a + i), acc0);
+
+   Scalar result = ReduceAdd(PAdd(PAdd(acc0, acc1), PAdd(acc2, acc3)));
+   for(; i < n; ++i) result += a[i];
+   return result;
+}
+
+inline Scalar
+SumAbs(const Scalar* a, const size_t n)
+{
+   Pack acc0 = Broadcast(Scalar{}), acc1 = acc0, acc2 = acc0, acc3 = acc0;
+   size_t i = 0;
+   for(; i + 4 * Width <= n; i += 4 * Width)
+   {
+      acc0 = PAdd(PAbs(Load(a + i            )), acc0);
+      acc1 = PAdd(PAbs(Load(a + i +     Width)), acc1);
+      acc2 = PAdd(PAbs(Load(a + i + 2 * Width)), acc2);
+      acc3 = PAdd(PAbs(Load(a + i + 3 * Width)), acc3);
+   }
+   for(; i + Width <= n; i += Width) acc0 = PAdd(PAbs(Load(a + i)), acc0);
+
+   Scalar result = ReduceAdd(PAdd(PAdd(acc0, acc1), PAdd(acc2, acc3)));
+   for(; i < n; ++i) result += std::abs(a[i]);
+   return result;
+}
+
+inline Scalar
+MaxAbs(const Scalar* a, const size_t n)
+{
+   Pack acc0 = Broadcast(Scalar{}), acc1 = acc0, acc2 = acc0, acc3 = acc0;
+   size_t i = 0;
+   for(; i + 4 * Width <= n; i += 4 * Width)
+   {
+      acc0 = PMax(PAbs(Load(a + i            )), acc0);
+      acc1 = PMax(PAbs(Load(a + i +     Width)), acc1);
+      acc2 = PMax(PAbs(Load(a + i + 2 * Width)), acc2);
+      acc3 = PMax(PAbs(Load(a + i + 3 * Width)), acc3);
+   }
+   for(; i + Width <= n; i += Width) acc0 = PMax(PAbs(Load(a + i)), acc0);
+
+   Scalar result = ReduceMax(PMax(PMax(acc0, acc1), PMax(acc2, acc3)));
+   for(; i < n; ++i) result = std::max(result, std::abs(a[i]));
+   return result;
+}
+
+inline Scalar
+MinAbs(const Scalar* a, const size_t n)
+{
+   Pack acc0 = PAbs(Broadcast(a[0])), acc1 = acc0, acc2 = acc0, acc3 = acc0;
+   size_t i = 0;
+   for(; i + 4 * Width <= n; i += 4 * Width)
+   {
+      acc0 = PMin(PAbs(Load(a + i            )), acc0);
+      acc1 = PMin(PAbs(Load(a + i +     Width)), acc1);
+      acc2 = PMin(PAbs(Load(a + i + 2 * Width)), acc2);
+      acc3 = PMin(PAbs(Load(a + i + 3 * Width)), acc3);
+   }
+   for(; i + Width <= n; i += Width) acc0 = PMin(PAbs(Load(a + i)), acc0);
+
+   Scalar result = ReduceMin(PMin(PMin(acc0, acc1), PMin(acc2, acc3)));
+   for(; i < n; ++i) result = std::min(result, std::abs(a[i]));
+   return result;
+}
+
+inline Scalar
+Min(const Scalar* a, const size_t n)
+{
+   Pack acc0 = Broadcast(a[0]), acc1 = acc0, acc2 = acc0, acc3 = acc0;
+   size_t i = 0;
+   for(; i + 4 * Width <= n; i += 4 * Width)
+   {
+      acc0 = PMin(Load(a + i            ), acc0);
+      acc1 = PMin(Load(a + i +     Width), acc1);
+      acc2 = PMin(Load(a + i + 2 * Width), acc2);
+      acc3 = PMin(Load(a + i + 3 * Width), acc3);
+   }
+   for(; i + Width <= n; i += Width) acc0 = PMin(Load(a + i), acc0);
+
+   Scalar result = ReduceMin(PMin(PMin(acc0, acc1), PMin(acc2, acc3)));
+   for(; i < n; ++i) result = std::min(result, a[i]);
+   return result;
+}
+
+inline Scalar
+Max(const Scalar* a, const size_t n)
+{
+   Pack acc0 = Broadcast(a[0]), acc1 = acc0, acc2 = acc0, acc3 = acc0;
+   size_t i = 0;
+   for(; i + 4 * Width <= n; i += 4 * Width)
+   {
+      acc0 = PMax(Load(a + i            ), acc0);
+      acc1 = PMax(Load(a + i +     Width), acc1);
+      acc2 = PMax(Load(a + i + 2 * Width), acc2);
+      acc3 = PMax(Load(a + i + 3 * Width), acc3);
+   }
+   for(; i + Width <= n; i += Width) acc0 = PMax(Load(a + i), acc0);
+
+   Scalar result = ReduceMax(PMax(PMax(acc0, acc1), PMax(acc2, acc3)));
+   for(; i < n; ++i) result = std::max(result, a[i]);
+   return result;
+}
+
+/***************************************************************************************************************************************************************
+* Matrix Multiplication Micro-kernel
+***************************************************************************************************************************************************************/
+
+/** Register tile of the micro-kernel, two packed registers tall and six columns wide, whose twelve accumulators and three operands fit in sixteen registers. */
+constexpr size_t TileRows    = 2 * Width;
+constexpr size_t TileColumns = 6;
+
+/** Product of a packed panel of A, holding k columns of TileRows entries, and a packed panel of B, holding k rows of TileColumns entries, written column-major
+ *  to a TileRows x TileColumns tile. */
+inline void
+GemmTile(const size_t k, const Scalar* a, const Scalar* b, Scalar* tile)
+{
+   Pack c00 = Broadcast(Scalar{}), c01 = c00, c02 = c00, c03 = c00, c04 = c00, c05 = c00;
+   Pack c10 = c00, c11 = c00, c12 = c00, c13 = c00, c14 = c00, c15 = c00;
+   for(size_t p = 0; p < k; ++p, a += TileRows, b += TileColumns)
+   {
+      const Pack a0 = Load(a);
+      const Pack a1 = Load(a + Width);
+      Pack bj = Broadcast(b[0]);
+      c00 = PFma(a0, bj, c00);
+      c10 = PFma(a1, bj, c10);
+      bj  = Broadcast(b[1]);
+      c01 = PFma(a0, bj, c01);
+      c11 = PFma(a1, bj, c11);
+      bj  = Broadcast(b[2]);
+      c02 = PFma(a0, bj, c02);
+      c12 = PFma(a1, bj, c12);
+      bj  = Broadcast(b[3]);
+      c03 = PFma(a0, bj, c03);
+      c13 = PFma(a1, bj, c13);
+      bj  = Broadcast(b[4]);
+      c04 = PFma(a0, bj, c04);
+      c14 = PFma(a1, bj, c14);
+      bj  = Broadcast(b[5]);
+      c05 = PFma(a0, bj, c05);
+      c15 = PFma(a1, bj, c15);
+   }
+   Store(tile                       , c00);
+   Store(tile + Width               , c10);
+   Store(tile +     TileRows        , c01);
+   Store(tile +     TileRows + Width, c11);
+   Store(tile + 2 * TileRows        , c02);
+   Store(tile + 2 * TileRows + Width, c12);
+   Store(tile + 3 * TileRows        , c03);
+   Store(tile + 3 * TileRows + Width, c13);
+   Store(tile + 4 * TileRows        , c04);
+   Store(tile + 4 * TileRows + Width, c14);
+   Store(tile + 5 * TileRows        , c05);
+   Store(tile + 5 * TileRows + Width, c15);
+}
+
+/***************************************************************************************************************************************************************
+* Structure-of-Arrays 3D Vector Kernels
+***************************************************************************************************************************************************************/
+inline void
+Cross(const Vectors3<const Scalar>& a, const Vectors3<const Scalar>& b, const Vectors3<Scalar>& out, const size_t n)
+{
+   size_t i = 0;
+   for(; i + Width <= n; i += Width)
+   {
+      const Pack ax = Load(a.X + i), ay = Load(a.Y + i), az = Load(a.Z + i);
+      const Pack bx = Load(b.X + i), by = Load(b.Y + i), bz = Load(b.Z + i);
+      Store(out.X + i, PSub(PMul(ay, bz), PMul(az, by)));
+      Store(out.Y + i, PSub(PMul(az, bx), PMul(ax, bz)));
+      Store(out.Z + i, PSub(PMul(ax, by), PMul(ay, bx)));
+   }
+   for(; i < n; ++i)
+   {
+      const Scalar ax = a.X[i], ay = a.Y[i], az = a.Z[i];
+      const Scalar bx = b.X[i], by = b.Y[i], bz = b.Z[i];
+      out.X[i] = ay * bz - az * by;
+      out.Y[i] = az * bx - ax * bz;
+      out.Z[i] = ax * by - ay * bx;
+   }
+}
+
+/** Degenerate lanes are rare, so they are detected with a lane mask and patched up after the packed stores. */
+inline size_t
+Normalise(const Vectors3<const Scalar>& v, const Vectors3<Scalar>& out, Bool* degenerate, const size_t n, const Scalar tolerance)
+{
+   const Scalar tolerance2 = tolerance * tolerance;
+   const Pack packed_tolerance2 = Broadcast(tolerance2);
+   const Pack one = Broadcast(Scalar{1});
+   size_t n_degenerate{};
+   size_t i = 0;
+   for(; i + Width <= n; i += Width)
+   {
+      const Pack x = Load(v.X + i), y = Load(v.Y + i), z = Load(v.Z + i);
+      const Pack magnitude2 = PFma(x, x, PFma(y, y, PMul(z, z)));
+      const Pack scale = PDiv(one, PSqrt(magnitude2));
+      Store(out.X + i, PMul(x, scale));
+      Store(out.Y + i, PMul(y, scale));
+      Store(out.Z + i, PMul(z, scale));
+
+      const unsigned mask = LessMask(magnitude2, packed_tolerance2);
+      FOR(lane, Width) degenerate[i + lane] = (mask >> lane) & 1u;
+      if(mask)
+      {
+         FOR(lane, Width) if((mask >> lane) & 1u) out.X[i + lane] = out.Y[i + lane] = out.Z[i + lane] = Scalar{};
+         n_degenerate += static_cast<size_t>(std::popcount(mask));
+      }
+   }
+   for(; i < n; ++i)
+   {
+      const Scalar x = v.X[i], y = v.Y[i], z = v.Z[i];
+      const Scalar magnitude2 = x * x + y * y + z * z;
+      const bool isDegenerate = magnitude2 < tolerance2;
+      const Scalar scale = isDegenerate ? Scalar{} : Scalar{1} / std::sqrt(magnitude2);
+      out.X[i] = x * scale;
+      out.Y[i] = y * scale;
+      out.Z[i] = z * scale;
+      degenerate[i] = isDegenerate;
+      n_degenerate += isDegenerate;
+   }
+   return n_degenerate;
+}
+
+inline size_t
+CosAngle(const Vectors3<const Scalar>& a, const Vectors3<const Scalar>& b, Scalar* out, Bool* degenerate, const size_t n, const Scalar tolerance)
+{
+   const Scalar tolerance2 = tolerance * tolerance;
+   const Pack packed_tolerance2 = Broadcast(tolerance2);
+   const Pack one = Broadcast(Scalar{1}), minus_one = Broadcast(-Scalar{1});
+   size_t n_degenerate{};
+   size_t i = 0;
+   for(; i + Width <= n; i += Width)
+   {
+      const Pack ax = Load(a.X + i), ay = Load(a.Y + i), az = Load(a.Z + i);
+      const Pack bx = Load(b.X + i), by = Load(b.Y + i), bz = Load(b.Z + i);
+      const Pack ab = PFma(ax, bx, PFma(ay, by, PMul(az, bz)));
+      const Pack aa = PFma(ax, ax, PFma(ay, ay, PMul(az, az)));
+      const Pack bb = PFma(bx, bx, PFma(by, by, PMul(bz, bz)));
+      Store(out + i, PMax(minus_one, PMin(one, PDiv(ab, PSqrt(PMul(aa, bb))))));
+
+      const unsigned mask = LessMask(aa, packed_tolerance2) | LessMask(bb, packed_tolerance2);
+      FOR(lane, Width) degenerate[i + lane] = (mask >> lane) & 1u;
+      if(mask)
+      {
+         FOR(lane, Width) if((mask >> lane) & 1u) out[i + lane] = Scalar{1};
+         n_degenerate += static_cast<size_t>(std::popcount(mask));
+      }
+   }
+   for(; i < n; ++i)
+   {
+      const Scalar ax = a.X[i], ay = a.Y[i], az = a.Z[i];
+      const Scalar bx = b.X[i], by = b.Y[i], bz = b.Z[i];
+      const Scalar aa = ax * ax + ay * ay + az * az;
+      const Scalar bb = bx * bx + by * by + bz * bz;
+      const bool isDegenerate = aa < tolerance2 || bb < tolerance2;
+      out[i] = isDegenerate ? Scalar{1} : std::clamp((ax * bx + ay * by + az * bz) / std::sqrt(aa * bb), -Scalar{1}, Scalar{1});
+      degenerate[i] = isDegenerate;
+      n_degenerate += isDegenerate;
+   }
+   return n_degenerate;
+}
@@ -0,0 +1,172 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+
+#pragma once
+
+#include "../../../include/Global.h"
+#include "Array.h"
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+
+namespace aprn {
+
+/***************************************************************************************************************************************************************
+* Small Array Class
+***************************************************************************************************************************************************************/
+
+/** Dynamic array storing up to N entries inline, and spilling to the heap beyond that. Suited to short arrays of a usually known bound, e.g. the children of a
+ *  tree node, or the attributes of a vertex layout, whose per-instance heap allocations would otherwise dominate construction and copy costs. */
+template<typename T, size_t N>
+class SmallArray : public Array<T, SmallArray<T, N>>
+{
+   static_assert(N > 0, "The inline capacity of a small array must be non-zero.");
+
+   using Base = Array<T, SmallArray<T, N>>;
+
+ public:
+   using value_type      = T;
+   using size_type       = size_t;
+   using difference_type = std::ptrdiff_t;
+   using reference       = T&;
+   using const_reference = const T&;
+   using pointer         = T*;
+   using const_pointer   = const T*;
+   using iterator        = T*;
+   using const_iterator  = const T*;
+
+   SmallArray() noexcept;
+
+   explicit SmallArray(const size_t size);
+
+   SmallArray(const size_t size, const std::convertible_to<T> auto& value);
+
+   template<std::convertible_to<T> T2>
+   SmallArray(const std::initializer_list<T2>& list);
+
+   template<std::input_iterator It>
+   SmallArray(It first, It last);
+
+   SmallArray(const SmallArray& other);
+
+   SmallArray(SmallArray&& other) noexcept(std::is_nothrow_move_constructible_v<T>);
+
+   ~SmallArray();
+
+   SmallArray& operator=(const SmallArray& other);
+
+   SmallArray& operator=(SmallArray&& other) noexcept(std::is_nothrow_move_constructible_v<T>);
+
+   /** Array Interface */
+   void Append(const T& value);
+
+   void Append(T&& value);
+
+   void Append(const SmallArray& other);
+
+   void Append(SmallArray&& other);
+
+   template<class It>
+   void Append(It first, It last, const bool move_all = false);
+
+   /** Clear the array and release any heap storage, returning to the inline buffer. */
+   void Erase();
+
+   /** Element Access */
+   inline T* data() noexcept { return Data_; }
+
+   inline const T* data() const noexcept { return Data_; }
+
+   inline T& front() { return (*this)[0]; }
+
+   inline const T& front() const { return (*this)[0]; }
+
+   inline T& back() { return (*this)[Size_ - 1]; }
+
+   inline const T& back() const { return (*this)[Size_ - 1]; }
+
+   /** Iterators */
+   inline iterator begin() noexcept { return Data_; }
+
+   inline const_iterator begin() const noexcept { return Data_; }
+
+   inline const_iterator cbegin() const noexcept { return Data_; }
+
+   inline iterator end() noexcept { return Data_ + Size_; }
+
+   inline const_iterator end() const noexcept { return Data_ + Size_; }
+
+   inline const_iterator cend() const noexcept { return Data_ + Size_; }
+
+   /** Capacity */
+   inline bool empty() const noexcept { return !Size_; }
+
+   inline size_t size() const noexcept { return Size_; }
+
+   inline size_t capacity() const noexcept { return Capacity_; }
+
+   /** Whether the entries are stored in the inline buffer, i.e. no heap allocation has been made. */
+   inline bool isInline() const noexcept { return Data_ == InlineData(); }
+
+   static constexpr size_t InlineCapacity() noexcept { return N; }
+
+   void reserve(const size_t capacity);
+
+   /** Modifiers */
+   void clear() noexcept;
+
+   void push_back(const T& value);
+
+   void push_back(T&& value);
+
+   template<class... Args>
+   T& emplace_back(Args&&... args);
+
+   void pop_back();
+
+   /** Resize, value-initialising any new entries as std::vector does. */
+   void resize(const size_t size);
+
+   void resize(const size_t size, const T& value);
+
+   using Base::operator[];
+   using Base::operator=;
+
+ private:
+   inline T* InlineData() noexcept { return std::launder(reinterpret_cast<T*>(Buffer_)); }
+
+   inline const T* InlineData() const noexcept { return std::launder(reinterpret_cast<const T*>(Buffer_)); }
+
+   /** Move the entries to a heap buffer of at least the given capacity. */
+   void Grow(const size_t min_capacity);
+
+   /** Release the heap buffer, if any, and return to the empty inline buffer. Assumes the entries are already destroyed. */
+   void Release() noexcept;
+
+   /** Take over the entries of another array, leaving it empty. Assumes this array is empty and inline. */
+   void Steal(SmallArray& other) noexcept(std::is_nothrow_move_constructible_v<T>);
+
+   alignas(T) std::byte Buffer_[N * sizeof(T)];
+   T*                   Data_;
+   size_t               Size_{};
+   size_t               Capacity_{N};
+};
+
+}
+
+#include "SmallArray.tpp"
@@ -0,0 +1,259 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+
+#pragma once
+
+namespace aprn {
+
+/***************************************************************************************************************************************************************
+* Small Array Class
+***************************************************************************************************************************************************************/
+template<typename T, size_t N>
+SmallArray<T, N>::SmallArray() noexcept
+   : Data_(InlineData()) {}
+
+template<typename T, size_t N>
+SmallArray<T, N>::SmallArray(const size_t size)
+   : SmallArray(size, DynamicInitValue<T>()) {}
+
+template<typename T, size_t N>
+SmallArray<T, N>::SmallArray(const size_t size, const std::convertible_to<T> auto& value)
+   : SmallArray()
+{
+   resize(size, static_cast<T>(value));
+}
+
+template<typename T, size_t N>
+template<std::convertible_to<T> T2>
+SmallArray<T, N>::SmallArray(const std::initializer_list<T2>& list)
+   : SmallArray(list.begin(), list.end()) {}
+
+template<typename T, size_t N>
+template<std::input_iterator It>
+SmallArray<T, N>::SmallArray(It first, It last)
+   : SmallArray()
+{
+   Append(first, last);
+}
+
+template<typename T, size_t N>
+SmallArray<T, N>::SmallArray(const SmallArray& other)
+   : SmallArray()
+{
+   Append(other);
+}
+
+template<typename T, size_t N>
+SmallArray<T, N>::SmallArray(SmallArray&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+   : SmallArray()
+{
+   Steal(other);
+}
+
+template<typename T, size_t N>
+SmallArray<T, N>::~SmallArray()
+{
+   clear();
+   Release();
+}
+
+template<typename T, size_t N>
+SmallArray<T, N>&
+SmallArray<T, N>::operator=(const SmallArray& other)
+{
+   if(this != &other)
+   {
+      clear();
+      Append(other);
+   }
+   return *this;
+}
+
+template<typename T, size_t N>
+SmallArray<T, N>&
+SmallArray<T, N>::operator=(SmallArray&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+{
+   if(this != &other)
+   {
+      clear();
+      Release();
+      Steal(other);
+   }
+   return *this;
+}
+
+/** Array Interface */
+template<typename T, size_t N>
+void
+SmallArray<T, N>::Append(const T& value) { push_back(value); }
+
+template<typename T, size_t N>
+void
+SmallArray<T, N>::Append(T&& value) { push_back(std::move(value)); }
+
+template<typename T, size_t N>
+void
+SmallArray<T, N>::Append(const SmallArray& other)
+{
+   if(&other != this) { Append(other.cbegin(), other.cend(), false); return; }
+
+   // Growing would free the entries being copied, so reserve first and then copy the original entries by index.
+   const size_t size = Size_;
+   reserve(2 * size);
+   FOR(i, size) emplace_back(Data_[i]);
+}
+
+template<typename T, size_t N>
+void
+SmallArray<T, N>::Append(SmallArray&& other)
+{
+   if(&other != this) Append(other.begin(), other.end(), true);
+   else Append(static_cast<const SmallArray&>(other));
+}
+
+template<typename T, size_t N>
+template<class It>
+void
+SmallArray<T, N>::Append(It first, It last, const bool move_all)
+{
+   if constexpr(std::forward_iterator<It>) reserve(Size_ + static_cast<size_t>(std::distance(first, last)));
+
+   if(!move_all) for(; first != last; ++first) emplace_back(*first);
+   else          for(; first != last; ++first) emplace_back(std::move(*first));
+}
+
+template<typename T, size_t N>
+void
+SmallArray<T, N>::Erase()
+{
+   clear();
+   Release();
+}
+
+/** Capacity */
+template<typename T, size_t N>
+void
+SmallArray<T, N>::reserve(const size_t capacity) { if(capacity > Capacity_) Grow(capacity); }
+
+/** Modifiers */
+template<typename T, size_t N>
+void
+SmallArray<T, N>::clear() noexcept
+{
+   std::destroy_n(Data_, Size_);
+   Size_ = 0;
+}
+
+template<typename T, size_t N>
+void
+SmallArray<T, N>::push_back(const T& value) { emplace_back(value); }
+
+template<typename T, size_t N>
+void
+SmallArray<T, N>::push_back(T&& value) { emplace_back(std::move(value)); }
+
+template<typename T, size_t N>
+template<class... Args>
+T&
+SmallArray<T, N>::emplace_back(Args&&... args)
+{
+   if(Size_ == Capacity_)
+   {
+      // Construct the entry before growing, as the arguments may refer to existing entries.
+      T value(std::forward<Args>(args)...);
+      Grow(2 * Capacity_);
+      return *std::construct_at(Data_ + Size_++, std::move(value));
+   }
+   return *std::construct_at(Data_ + Size_++, std::forward<Args>(args)...);
+}
+
+template<typename T, size_t N>
+void
+SmallArray<T, N>::pop_back()
+{
+   DEBUG_ASSERT(Size_, "Cannot pop an entry from an empty array.")
+   std::destroy_at(Data_ + --Size_);
+}
+
+template<typename T, size_t N>
+void
+SmallArray<T, N>::resize(const size_t size) { resize(size, T{}); }
+
+template<typename T, size_t N>
+void
+SmallArray<T, N>::resize(const size_t size, const T& value)
+{
+   if(size < Size_)
+   {
+      std::destroy(Data_ + size, Data_ + Size_);
+      Size_ = size;
+   }
+   else
+   {
+      reserve(size);
+      std::uninitialized_fill(Data_ + Size_, Data_ + size, value);
+      Size_ = size;
+   }
+}
+
+/** Storage Management */
+template<typename T, size_t N>
+void
+SmallArray<T, N>::Grow(const size_t min_capacity)
+{
+   const size_t capacity = Max(min_capacity, 2 * Capacity_);
+   T* data = std::allocator<T>().allocate(capacity);
+
+   std::uninitialized_move_n(Data_, Size_, data);
+   std::destroy_n(Data_, Size_);
+   if(!isInline()) std::allocator<T>().deallocate(Data_, Capacity_);
+
+   Data_     = data;
+   Capacity_ = capacity;
+}
+
+template<typename T, size_t N>
+void
+SmallArray<T, N>::Release() noexcept
+{
+   DEBUG_ASSERT(!Size_, "The entries must be destroyed before releasing the storage.")
+   if(!isInline()) std::allocator<T>().deallocate(Data_, Capacity_);
+   Data_     = InlineData();
+   Capacity_ = N;
+}
+
+template<typename T, size_t N>
+void
+SmallArray<T, N>::Steal(SmallArray& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+{
+   if(other.isInline())
+   {
+      std::uninitialized_move_n(other.Data_, other.Size_, Data_);
+      Size_ = other.Size_;
+      other.clear();
+   }
+   else
+   {
+      // Take over the heap buffer, and return the other array to its inline buffer.
+      Data_     = other.Data_;
+      Size_     = other.Size_;
+      Capacity_ = other.Capacity_;
+      other.Data_     = other.InlineData();
+      other.Size_     = 0;
+      other.Capacity_ = N;
+   }
+}
+
+}
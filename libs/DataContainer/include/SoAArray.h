@@ -0,0 +1,169 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+
+#pragma once
+
+#include "../../../include/Global.h"
+#include "Allocator.h"
+#include "Array.h"
+
+#include <iterator>
+#include <tuple>
+#include <utility>
+
+namespace aprn {
+
+/***************************************************************************************************************************************************************
+* Structure-of-Arrays Class
+***************************************************************************************************************************************************************/
+
+/** Array of records stored as a structure of arrays, with one cache-line aligned array per field. Loops touching only some of the fields then stream only those
+ *  arrays, and loops over a single field can be vectorised. Entries are accessed as tuples of references to their fields, e.g. auto [position, normal] = soa[i],
+ *  and iterators zip over all the fields. Individual fields are accessed as whole arrays with Field<I>(). */
+template<typename... Fields>
+class SoAArray
+{
+   static_assert(sizeof...(Fields) > 0, "A structure of arrays must have at least one field.");
+   static_assert(!(isTypeSame<Fields, bool>() || ...), "Boolean fields are not stored contiguously, use char instead.");
+
+   template<bool isConst>
+   class Iterator;
+
+ public:
+   template<size_t I>
+   using FieldType = std::tuple_element_t<I, std::tuple<Fields...>>;
+
+   template<typename F>
+   using FieldArray = AlignedDArray<F>;
+
+   using value_type      = std::tuple<Fields...>;
+   using size_type       = size_t;
+   using difference_type = std::ptrdiff_t;
+   using reference       = std::tuple<Fields&...>;
+   using const_reference = std::tuple<const Fields&...>;
+   using iterator        = Iterator<false>;
+   using const_iterator  = Iterator<true>;
+
+   SoAArray() = default;
+
+   explicit SoAArray(const size_t size);
+
+   /** Size and Index Range-checking */
+   void IndexBoundCheck(const size_t index) const;
+
+   /** Field Access */
+   template<size_t I>
+   inline FieldArray<FieldType<I>>& Field() noexcept { return std::get<I>(Arrays_); }
+
+   template<size_t I>
+   inline const FieldArray<FieldType<I>>& Field() const noexcept { return std::get<I>(Arrays_); }
+
+   /** Entry Access */
+   reference operator[](const size_t index);
+
+   const_reference operator[](const size_t index) const;
+
+   /** Iterators */
+   iterator begin() noexcept;
+
+   const_iterator begin() const noexcept;
+
+   inline const_iterator cbegin() const noexcept { return begin(); }
+
+   iterator end() noexcept;
+
+   const_iterator end() const noexcept;
+
+   inline const_iterator cend() const noexcept { return end(); }
+
+   /** Capacity */
+   inline bool empty() const noexcept { return std::get<0>(Arrays_).empty(); }
+
+   inline size_t size() const noexcept { return std::get<0>(Arrays_).size(); }
+
+   void reserve(const size_t capacity);
+
+   /** Modifiers */
+   void clear() noexcept;
+
+   void resize(const size_t size);
+
+   void push_back(const Fields&... fields);
+
+   void pop_back();
+
+ private:
+   std::tuple<FieldArray<Fields>...> Arrays_;
+};
+
+/***************************************************************************************************************************************************************
+* Structure-of-Arrays Iterator Class
+***************************************************************************************************************************************************************/
+
+/** Random-access zip iterator over the fields of a structure of arrays, dereferencing to a tuple of references. As a proxy iterator, it supports iteration and
+ *  indexing, but not algorithms which swap entries. */
+template<typename... Fields>
+template<bool isConst>
+class SoAArray<Fields...>::Iterator
+{
+   using Pointers = std::conditional_t<isConst, std::tuple<const Fields*...>, std::tuple<Fields*...>>;
+
+ public:
+   using iterator_category = std::random_access_iterator_tag;
+   using value_type        = std::tuple<Fields...>;
+   using difference_type   = std::ptrdiff_t;
+   using reference         = std::conditional_t<isConst, std::tuple<const Fields&...>, std::tuple<Fields&...>>;
+   using pointer           = void;
+
+   Iterator() = default;
+
+   Iterator(const Pointers& data, const size_t index) noexcept : Data_(data), Index_(index) {}
+
+   inline reference operator*() const noexcept { return std::apply([this](auto*... data){ return reference(data[Index_]...); }, Data_); }
+
+   inline reference operator[](const difference_type n) const noexcept { return *(*this + n); }
+
+   inline Iterator& operator++() noexcept { ++Index_; return *this; }
+
+   inline Iterator operator++(int) noexcept { return Iterator(Data_, Index_++); }
+
+   inline Iterator& operator--() noexcept { --Index_; return *this; }
+
+   inline Iterator operator--(int) noexcept { return Iterator(Data_, Index_--); }
+
+   inline Iterator& operator+=(const difference_type n) noexcept { Index_ += n; return *this; }
+
+   inline Iterator& operator-=(const difference_type n) noexcept { Index_ -= n; return *this; }
+
+   friend inline Iterator operator+(Iterator it, const difference_type n) noexcept { return it += n; }
+
+   friend inline Iterator operator+(const difference_type n, Iterator it) noexcept { return it += n; }
+
+   friend inline Iterator operator-(Iterator it, const difference_type n) noexcept { return it -= n; }
+
+   friend inline difference_type operator-(const Iterator& a, const Iterator& b) noexcept { return static_cast<difference_type>(a.Index_ - b.Index_); }
+
+   friend inline bool operator==(const Iterator& a, const Iterator& b) noexcept { return a.Index_ == b.Index_; }
+
+   friend inline auto operator<=>(const Iterator& a, const Iterator& b) noexcept { return a.Index_ <=> b.Index_; }
+
+ private:
+   Pointers Data_{};
+   size_t   Index_{};
+};
+
+}
+
+#include "SoAArray.tpp"
@@ -0,0 +1,98 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+
+#pragma once
+
+namespace aprn {
+
+/***************************************************************************************************************************************************************
+* Structure-of-Arrays Class
+***************************************************************************************************************************************************************/
+template<typename... Fields>
+SoAArray<Fields...>::SoAArray(const size_t size) { resize(size); }
+
+/** Size and Index Range-checking */
+template<typename... Fields>
+void
+SoAArray<Fields...>::IndexBoundCheck(const size_t index) const
+{
+   DEBUG_ASSERT(!empty(), "The array has not yet been sized.")
+   DEBUG_ASSERT(isBounded(index, size_t(0), size()), "The array index ", index, " must be in the range [0, ", size() - 1, "].")
+}
+
+/** Entry Access */
+template<typename... Fields>
+typename SoAArray<Fields...>::reference
+SoAArray<Fields...>::operator[](const size_t index)
+{
+   IndexBoundCheck(index);
+   return std::apply([index](auto&... arrays){ return reference(*(arrays.data() + index)...); }, Arrays_);
+}
+
+template<typename... Fields>
+typename SoAArray<Fields...>::const_reference
+SoAArray<Fields...>::operator[](const size_t index) const
+{
+   IndexBoundCheck(index);
+   return std::apply([index](const auto&... arrays){ return const_reference(*(arrays.data() + index)...); }, Arrays_);
+}
+
+/** Iterators */
+template<typename... Fields>
+typename SoAArray<Fields...>::iterator
+SoAArray<Fields...>::begin() noexcept { return iterator(std::apply([](auto&... arrays){ return std::tuple(arrays.data()...); }, Arrays_), 0); }
+
+template<typename... Fields>
+typename SoAArray<Fields...>::const_iterator
+SoAArray<Fields...>::begin() const noexcept { return const_iterator(std::apply([](const auto&... arrays){ return std::tuple(arrays.data()...); }, Arrays_), 0); }
+
+template<typename... Fields>
+typename SoAArray<Fields...>::iterator
+SoAArray<Fields...>::end() noexcept { return begin() + size(); }
+
+template<typename... Fields>
+typename SoAArray<Fields...>::const_iterator
+SoAArray<Fields...>::end() const noexcept { return begin() + size(); }
+
+/** Capacity */
+template<typename... Fields>
+void
+SoAArray<Fields...>::reserve(const size_t capacity) { std::apply([capacity](auto&... arrays){ (arrays.reserve(capacity), ...); }, Arrays_); }
+
+/** Modifiers */
+template<typename... Fields>
+void
+SoAArray<Fields...>::clear() noexcept { std::apply([](auto&... arrays){ (arrays.clear(), ...); }, Arrays_); }
+
+template<typename... Fields>
+void
+SoAArray<Fields...>::resize(const size_t size) { std::apply([size](auto&... arrays){ (arrays.resize(size), ...); }, Arrays_); }
+
+template<typename... Fields>
+void
+SoAArray<Fields...>::push_back(const Fields&... fields)
+{
+   std::apply([&](auto&... arrays){ (arrays.push_back(fields), ...); }, Arrays_);
+}
+
+template<typename... Fields>
+void
+SoAArray<Fields...>::pop_back()
+{
+   DEBUG_ASSERT(!empty(), "Cannot pop an entry from an empty array.")
+   std::apply([](auto&... arrays){ (arrays.pop_back(), ...); }, Arrays_);
+}
+
+}
@@ -15,6 +15,8 @@
 #include <gtest/gtest.h>
 #include "../../../include/Random.h"
 #include "../include/Array.h"
+#include "../include/SmallArray.h"
+#include "../include/SoAArray.h"
 
 #ifdef DEBUG_MODE
 
@@ -122,6 +124,147 @@ TEST_F(ArrayTest, AssignmentOperator)
   }
 }
 
+TEST_F(ArrayTest, AlignedAllocator)
+{
+  AlignedDArray<Real> aligned_array(ContainerSize, One);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(aligned_array.data()) % CacheLineSize, 0);
+
+  // Test re-allocation on growth.
+  FOR(i, 10 * ContainerSize) aligned_array.push_back(Two);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(aligned_array.data()) % CacheLineSize, 0);
+  EXPECT_EQ(aligned_array.front(), One);
+  EXPECT_EQ(aligned_array.back(), Two);
+}
+
+TEST_F(ArrayTest, ArenaAllocator)
+{
+  MemoryArena arena(1024);
+  const ArenaAllocator<int> allocator(arena);
+  size_t system_allocation_count{};
+
+  // Emulate several frames, each of which builds transient arrays.
+  FOR(frame, 5)
+  {
+    arena.Reset();
+
+    ArenaDArray<int> int_array({1, 2, 3}, allocator);
+    ArenaDArray<Real> real_array(ContainerSize, Two, allocator);
+    FOR(i, ContainerSize) int_array.Append(static_cast<int>(i));
+
+    EXPECT_EQ(int_array.size(), ContainerSize + 3);
+    EXPECT_EQ(int_array[2], 3);
+    EXPECT_EQ(int_array.back(), static_cast<int>(ContainerSize - 1));
+    FOR_EACH(entry, real_array) EXPECT_EQ(entry, Two);
+    EXPECT_LE(arena.BytesUsed(), arena.Capacity());
+
+    // Once the blocks have been coalesced after the first frame, no further system allocations are made.
+    if(frame == 1) system_allocation_count = arena.SystemAllocationCount();
+    if(frame > 1) { EXPECT_EQ(arena.SystemAllocationCount(), system_allocation_count); }
+  }
+}
+
+TEST_F(ArrayTest, SmallArray)
+{
+  // Entries are stored inline up to the inline capacity.
+  SmallArray<int, 4> small_array{1, 2, 3};
+  EXPECT_TRUE(small_array.isInline());
+  EXPECT_EQ(small_array.size(), 3);
+  EXPECT_EQ(small_array[2], 3);
+
+  small_array.Append(4);
+  EXPECT_TRUE(small_array.isInline());
+
+  // Entries spill to the heap beyond the inline capacity.
+  FOR(i, ContainerSize) small_array.Append(static_cast<int>(i));
+  EXPECT_FALSE(small_array.isInline());
+  EXPECT_EQ(small_array.size(), ContainerSize + 4);
+  EXPECT_EQ(small_array[3], 4);
+  EXPECT_EQ(small_array.back(), static_cast<int>(ContainerSize - 1));
+
+  // Appending an array to itself copies its original entries, whether it grows from inline or from heap storage.
+  SmallArray<int, 4> self_array{1, 2, 3};
+  self_array.Append(self_array);
+  self_array.Append(self_array);
+  EXPECT_EQ(self_array.size(), 12);
+  FOR(i, 12) EXPECT_EQ(self_array[i], static_cast<int>(i % 3 + 1));
+
+  // Copy and move between inline and heap storage.
+  SmallArray<int, 4> copied_array(small_array);
+  EXPECT_TRUE(copied_array == small_array);
+
+  SmallArray<int, 4> moved_array(std::move(copied_array));
+  EXPECT_TRUE(moved_array == small_array);
+  EXPECT_TRUE(copied_array.empty() && copied_array.isInline());
+
+  // Assignment keeps any heap storage, which is only released by an erase.
+  moved_array = {5, 6};
+  EXPECT_EQ(moved_array.size(), 2);
+  EXPECT_EQ(moved_array[1], 6);
+  moved_array.Erase();
+  EXPECT_TRUE(moved_array.isInline());
+
+  moved_array = {7, 8};
+  small_array = std::move(moved_array);
+  EXPECT_TRUE(small_array.isInline());
+  EXPECT_EQ(small_array.front(), 7);
+
+  // Non-trivial entries are constructed and destroyed correctly.
+  const auto shared = std::make_shared<int>(1);
+  {
+    SmallArray<std::shared_ptr<int>, 2> shared_array;
+    FOR(i, 5) shared_array.push_back(shared);
+    EXPECT_EQ(shared.use_count(), 6);
+    shared_array.pop_back();
+    shared_array.resize(2);
+    EXPECT_EQ(shared.use_count(), 3);
+  }
+  EXPECT_EQ(shared.use_count(), 1);
+}
+
+TEST_F(ArrayTest, SoAArray)
+{
+  SoAArray<Real, int, char> soa_array(ContainerSize);
+  EXPECT_EQ(soa_array.size(), ContainerSize);
+
+  // Entries are tuples of references into the field arrays.
+  FOR(i, ContainerSize)
+  {
+    auto [real, integer, boolean] = soa_array[i];
+    real    = static_cast<Real>(i);
+    integer = static_cast<int>(2 * i);
+    boolean = static_cast<char>(i % 2);
+  }
+  soa_array.push_back(Half, -1, 1);
+  EXPECT_EQ(soa_array.size(), ContainerSize + 1);
+
+  // Fields are contiguous, cache-line aligned arrays.
+  const auto& reals = soa_array.Field<0>();
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(reals.data()) % CacheLineSize, 0);
+  EXPECT_EQ(reals[3], static_cast<Real>(3));
+  EXPECT_EQ(soa_array.Field<1>().back(), -1);
+
+  // Zip iteration visits the fields of each entry together.
+  size_t index{};
+  for(const auto& [real, integer, boolean] : std::as_const(soa_array))
+  {
+    if(index < ContainerSize)
+    {
+      EXPECT_EQ(real, static_cast<Real>(index));
+      EXPECT_EQ(integer, static_cast<int>(2 * index));
+      EXPECT_EQ(boolean, static_cast<char>(index % 2));
+    }
+    ++index;
+  }
+  EXPECT_EQ(index, ContainerSize + 1);
+
+  for(auto [real, integer, boolean] : soa_array) real *= Two;
+  EXPECT_EQ(std::get<0>(soa_array.begin()[5]), static_cast<Real>(10));
+  EXPECT_EQ(soa_array.end() - soa_array.begin(), static_cast<std::ptrdiff_t>(ContainerSize + 1));
+
+  soa_array.pop_back();
+  EXPECT_EQ(soa_array.Field<2>().size(), ContainerSize);
+}
+
 }
 
 #endif
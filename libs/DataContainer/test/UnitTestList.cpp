@@ -0,0 +1,110 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+
+#include <gtest/gtest.h>
+#include "../include/Array.h"
+#include "../include/List.h"
+
+#include <algorithm>
+#include <memory>
+
+#ifdef DEBUG_MODE
+
+namespace aprn {
+
+/***************************************************************************************************************************************************************
+* List Test Fixture
+***************************************************************************************************************************************************************/
+class ListTest : public testing::Test
+{
+ public:
+   static constexpr size_t ListSize = 5000; // Spans several chunks.
+
+   List<int> IntList;
+
+   void SetUp() override { FOR(i, ListSize) IntList.push_back(static_cast<int>(i)); }
+};
+
+/***************************************************************************************************************************************************************
+* List Tests
+***************************************************************************************************************************************************************/
+TEST_F(ListTest, Indexing)
+{
+   EXPECT_EQ(IntList.size(), ListSize);
+   FOR(i, ListSize) EXPECT_EQ(IntList[i], static_cast<int>(i));
+   EXPECT_EQ(IntList.front(), 0);
+   EXPECT_EQ(IntList.back(), static_cast<int>(ListSize - 1));
+
+   int expected{};
+   FOR_EACH(entry, IntList) EXPECT_EQ(entry, expected++);
+   EXPECT_TRUE(std::is_sorted(IntList.begin(), IntList.end()));
+}
+
+TEST_F(ListTest, InsertionAndErasure)
+{
+   // References to entries remain valid across insertion and erasure elsewhere.
+   int& middle = IntList[ListSize / 2];
+   int* last   = &IntList.back();
+
+   IntList.insert(IntList.begin() + ListSize / 2, -1);
+   IntList.push_front(-2);
+   IntList.erase(IntList.begin() + 1, IntList.begin() + 11);
+   IntList.pop_back();
+
+   EXPECT_EQ(IntList.size(), ListSize - 9);
+   EXPECT_EQ(IntList[0], -2);
+   EXPECT_EQ(IntList[1], 10);
+   EXPECT_EQ(IntList[ListSize / 2 - 9], -1);
+   EXPECT_EQ(&IntList[ListSize / 2 - 8], &middle);
+   EXPECT_EQ(middle, static_cast<int>(ListSize / 2));
+   EXPECT_EQ(IntList.back(), static_cast<int>(ListSize - 2));
+
+   // Freed slots are reused, without affecting the order.
+   IntList.push_back(42);
+   EXPECT_EQ(&IntList.back(), last);
+   EXPECT_EQ(IntList.back(), 42);
+}
+
+TEST_F(ListTest, Assignment)
+{
+   int& first = IntList[0];
+   IntList = {3, 2, 1};
+   EXPECT_EQ(IntList.size(), 3);
+   EXPECT_EQ(&IntList[0], &first);
+   EXPECT_EQ(IntList[2], 1);
+
+   IntList = 7;
+   FOR_EACH(entry, IntList) EXPECT_EQ(entry, 7);
+
+   List<int> copied_list(IntList);
+   List<int> moved_list(std::move(IntList));
+   EXPECT_TRUE(std::equal(copied_list.begin(), copied_list.end(), moved_list.begin(), moved_list.end()));
+   EXPECT_TRUE(IntList.empty());
+
+   // Non-trivial entries are constructed and destroyed correctly.
+   const auto shared = std::make_shared<int>(1);
+   {
+      List<std::shared_ptr<int>> shared_list(3, shared);
+      shared_list.emplace(shared_list.begin() + 1, shared);
+      EXPECT_EQ(shared.use_count(), 5);
+      shared_list.erase(shared_list.begin());
+      EXPECT_EQ(shared.use_count(), 4);
+   }
+   EXPECT_EQ(shared.use_count(), 1);
+}
+
+}
+
+#endif
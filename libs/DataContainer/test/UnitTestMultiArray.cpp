@@ -0,0 +1,161 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+
+#include <gtest/gtest.h>
+#include "../include/Array.h"
+#include "../include/MultiArray.h"
+
+#ifdef DEBUG_MODE
+
+namespace aprn {
+
+/***************************************************************************************************************************************************************
+* Multi-dimensional Array View Test Fixture
+***************************************************************************************************************************************************************/
+class MultiArrayViewTest : public testing::Test
+{
+ public:
+   static constexpr size_t nRows = 4;
+   static constexpr size_t nColumns = 3;
+
+   DynamicMultiArray<Real> Grid;
+
+   MultiArrayViewTest() : Grid(nRows, nColumns) {}
+
+   void SetUp() override { FOR(i, nRows) FOR(j, nColumns) Grid(i, j) = static_cast<Real>(10 * i + j); }
+};
+
+/***************************************************************************************************************************************************************
+* Multi-dimensional Array View Tests
+***************************************************************************************************************************************************************/
+TEST_F(MultiArrayViewTest, Slicing)
+{
+   static_assert(std::random_access_iterator<MultiArrayView<Real, 2>::iterator>);
+
+   const auto view = Grid.View<2>();
+   EXPECT_TRUE(view.isContiguous());
+   EXPECT_EQ(view.size(), nRows * nColumns);
+   FOR(i, nRows) FOR(j, nColumns) EXPECT_EQ(view(i, j), Grid(i, j));
+
+   // Rows, columns, and transposes alias the grid entries.
+   const auto row = view.Row(2);
+   const auto column = view.Column(1);
+   const auto transpose = view.Transpose();
+   EXPECT_FALSE(row.isContiguous());
+   EXPECT_FALSE(transpose.isContiguous());
+   FOR(j, nColumns) EXPECT_EQ(&row(j), &Grid(2, j));
+   FOR(i, nRows) EXPECT_EQ(&column(i), &Grid(i, 1));
+   FOR(i, nRows) FOR(j, nColumns) EXPECT_EQ(&transpose(j, i), &Grid(i, j));
+
+   // Sub-blocks, with and without steps.
+   const auto block = view.Block({1, 1}, {2, 2});
+   const auto strided_block = view.Block({0, 0}, {2, 2}, {2, 2});
+   FOR(i, 2) FOR(j, 2) EXPECT_EQ(block(i, j), Grid(i + 1, j + 1));
+   FOR(i, 2) FOR(j, 2) EXPECT_EQ(strided_block(i, j), Grid(2 * i, 2 * j));
+
+   // Reshaping preserves the column-major entry order.
+   const auto flat = view.Reshape(SArray<size_t, 1>{nRows * nColumns});
+   size_t index{};
+   FOR(j, nColumns) FOR(i, nRows) EXPECT_EQ(flat(index++), Grid(i, j));
+}
+
+TEST_F(MultiArrayViewTest, Iteration)
+{
+   // Iteration follows the column-major order of the viewed dimensions.
+   const auto transpose = Grid.View<2>().Transpose();
+   auto entry = transpose.begin();
+   FOR(i, nRows) FOR(j, nColumns) EXPECT_EQ(*entry++, Grid(i, j));
+   EXPECT_EQ(entry, transpose.end());
+
+   // Random access agrees with increments.
+   const auto block = Grid.View<2>().Block({1, 0}, {3, 2});
+   const DynamicArray<Real> block_entries(block.begin(), block.end());
+   FOR(i, block_entries.size()) EXPECT_EQ(block.begin()[i], block_entries[i]);
+   EXPECT_EQ(block.end() - block.begin(), 6);
+   EXPECT_EQ(*(block.end() - 1), Grid(3, 1));
+
+   // Linear entry access agrees with the iterators.
+   const auto strided_block = Grid.View<2>().Transpose().Block({0, 1}, {2, 2}, {2, 2});
+   auto strided_entry = strided_block.begin();
+   FOR(i, strided_block.size()) EXPECT_EQ(strided_block[i], *strided_entry++);
+   EXPECT_EQ(Grid.View<2>().Row(2)[2], Grid(2, 2));
+}
+
+TEST_F(MultiArrayViewTest, Arithmetic)
+{
+   auto view = Grid.View<2>();
+
+   // Compound assignment and expressions between views write through to the grid.
+   view.Row(0) += view.Row(1);
+   FOR(j, nColumns) EXPECT_EQ(Grid(0, j), static_cast<Real>(10 + 2 * j));
+
+   view.Column(2) = view.Column(0) * Two - view.Column(1);
+   FOR(i, nRows) EXPECT_EQ(Grid(i, 2), Two * Grid(i, 0) - Grid(i, 1));
+
+   view.Block({2, 0}, {2, 2}) = Zero;
+   EXPECT_EQ(Grid(3, 1), Zero);
+   EXPECT_EQ(Grid(3, 2), static_cast<Real>(2 * 30 - 31)); // Outside the block.
+
+   // Assigning views copies the entries, whereas copying views aliases them.
+   const MultiArrayView<const Real, 1> first_row = view.Row(0);
+   view.Row(3) = first_row;
+   FOR(j, nColumns) EXPECT_EQ(Grid(3, j), Grid(0, j));
+}
+
+
+/***************************************************************************************************************************************************************
+* Multi-dimensional Array Layout Tests
+***************************************************************************************************************************************************************/
+template<class Layout, size_t... dims>
+void CheckLayout()
+{
+   // The linear index is a bijection onto [0, size), inverted by the multi-index.
+   DynamicMultiArray<Real, Layout> multi_array(dims...);
+   DynamicArray<size_t> visit_count(multi_array.size(), 0);
+   FOR(index, multi_array.size())
+   {
+      const auto multi_index = multi_array.ComputeMultiIndex(index);
+      std::array<size_t, sizeof...(dims)> indices;
+      std::copy(multi_index.begin(), multi_index.end(), indices.begin());
+      const size_t linear_index = std::apply([&](auto... i){ return multi_array.ComputeLinearIndex(i...); }, indices);
+      EXPECT_EQ(linear_index, index);
+      ++visit_count[linear_index];
+   }
+   FOR_EACH(count, visit_count) EXPECT_EQ(count, 1);
+}
+
+TEST(MultiArrayLayoutTest, Layouts)
+{
+   // Static arrays resolve the linear index at compile time.
+   static_assert(StaticMultiArray<Real, 3, 4>().ComputeLinearIndex(1, 2) == 7);
+   static_assert(BasicStaticMultiArray<Real, RowMajor, 3, 4>().ComputeLinearIndex(1, 2) == 6);
+   static_assert(BasicStaticMultiArray<Real, Tiled<2>, 4, 4>().ComputeLinearIndex(1, 2) == 9);
+
+   CheckLayout<ColumnMajor, 4, 3>();
+   CheckLayout<RowMajor, 4, 3>();
+   CheckLayout<ColumnMajor, 4, 3, 2>();
+   CheckLayout<RowMajor, 4, 3, 2>();
+   CheckLayout<Tiled<2>, 8, 4>();
+   CheckLayout<Tiled<2>, 4, 8, 2>();
+
+   // Views of row-major arrays alias the same entries as the array itself.
+   DynamicMultiArray<Real, RowMajor> row_major(4, 3);
+   const auto view = row_major.View<2>();
+   FOR(i, 4) FOR(j, 3) EXPECT_EQ(&view(i, j), &row_major(i, j));
+   EXPECT_EQ(&row_major(1, 0), &row_major(0, 2) + 1);
+}
+}
+
+#endif
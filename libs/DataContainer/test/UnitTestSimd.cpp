@@ -0,0 +1,238 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include "../../../include/Random.h"
+#include "../include/Array.h"
+#include "../include/Simd.h"
+
+#ifdef DEBUG_MODE
+
+namespace aprn {
+
+/***************************************************************************************************************************************************************
+* SIMD Kernel Test Fixture
+***************************************************************************************************************************************************************/
+class SimdTest : public testing::Test
+{
+ public:
+   Random<Real> RandomReal;
+   DynamicArray<Real> A, B, Out;
+
+   /** Sizes covering empty/short ranges and the remainder loops of every instruction set level. */
+   const StaticArray<size_t, 10> Sizes{0, 1, 3, 7, 8, 15, 16, 33, 64, 1001};
+
+   SimdTest() : RandomReal(-Ten, Ten) {}
+
+   void Initialise(const size_t size)
+   {
+      A.resize(size);
+      B.resize(size);
+      Out.resize(size);
+      FOR_EACH(entry, A) entry = RandomReal();
+      FOR_EACH(entry, B) entry = RandomReal();
+   }
+
+   void TearDown() override { simd::SetSimdLevel(simd::DetectSimdLevel()); }
+
+   /** Run a test for every instruction set level supported by this machine. */
+   template<class F>
+   void ForEachSimdLevel(F test)
+   {
+      for(int level = 0; level <= static_cast<int>(simd::DetectSimdLevel()); ++level)
+      {
+         simd::SetSimdLevel(static_cast<simd::SimdLevel>(level));
+         FOR_EACH(size, Sizes)
+         {
+            Initialise(size);
+            test(size);
+         }
+      }
+   }
+};
+
+/***************************************************************************************************************************************************************
+* Test Entry-wise Kernels
+***************************************************************************************************************************************************************/
+TEST_F(SimdTest, EntryWise)
+{
+   ForEachSimdLevel([this](const size_t n)
+   {
+      simd::Add(A.data(), B.data(), Out.data(), n);
+      FOR(i, n) EXPECT_EQ(Out[i], A[i] + B[i]);
+
+      simd::Subtract(A.data(), B.data(), Out.data(), n);
+      FOR(i, n) EXPECT_EQ(Out[i], A[i] - B[i]);
+
+      simd::Multiply(A.data(), B.data(), Out.data(), n);
+      FOR(i, n) EXPECT_EQ(Out[i], A[i] * B[i]);
+
+      simd::Divide(A.data(), B.data(), Out.data(), n);
+      FOR(i, n) EXPECT_EQ(Out[i], A[i] / B[i]);
+   });
+}
+
+TEST_F(SimdTest, Scalar)
+{
+   const Real scalar = RandomReal();
+   ForEachSimdLevel([this, scalar](const size_t n)
+   {
+      simd::AddScalar(A.data(), scalar, Out.data(), n);
+      FOR(i, n) EXPECT_EQ(Out[i], A[i] + scalar);
+
+      simd::SubtractScalar(A.data(), scalar, Out.data(), n);
+      FOR(i, n) EXPECT_EQ(Out[i], A[i] - scalar);
+
+      simd::MultiplyScalar(A.data(), scalar, Out.data(), n);
+      FOR(i, n) EXPECT_EQ(Out[i], A[i] * scalar);
+
+      simd::DivideScalar(A.data(), scalar, Out.data(), n);
+      FOR(i, n) EXPECT_EQ(Out[i], A[i] / scalar);
+
+      // Test in-place evaluation.
+      Out = A;
+      simd::AddScalar(Out.data(), scalar, Out.data(), n);
+      FOR(i, n) EXPECT_EQ(Out[i], A[i] + scalar);
+   });
+}
+
+TEST_F(SimdTest, Axpy)
+{
+   const Real alpha = RandomReal();
+   ForEachSimdLevel([this, alpha](const size_t n)
+   {
+      Out = B;
+      simd::Axpy(alpha, A.data(), Out.data(), n);
+      FOR(i, n) EXPECT_NEAR(Out[i], B[i] + alpha * A[i], Small * (One + std::abs(B[i]) + std::abs(alpha * A[i]))); // Kernels may fuse the multiply-add.
+   });
+}
+
+/***************************************************************************************************************************************************************
+* Test Reduction Kernels
+***************************************************************************************************************************************************************/
+TEST_F(SimdTest, Reductions)
+{
+   ForEachSimdLevel([this](const size_t n)
+   {
+      // Kernels sum in a different order, so results are compared relative to the sum of absolute terms.
+      Real dot{}, dot_abs{}, sum{}, sum_abs{};
+      FOR(i, n)
+      {
+         dot     += A[i] * B[i];
+         dot_abs += std::abs(A[i] * B[i]);
+         sum     += A[i];
+         sum_abs += std::abs(A[i]);
+      }
+      EXPECT_NEAR(simd::Dot(A.data(), B.data(), n), dot, TenSmall * (One + dot_abs));
+      EXPECT_NEAR(simd::Sum(A.data(), n), sum, TenSmall * (One + sum_abs));
+      EXPECT_NEAR(simd::SumAbs(A.data(), n), sum_abs, TenSmall * (One + sum_abs));
+
+      if(!n) return;
+      EXPECT_EQ(simd::Min(A.data(), n), *std::min_element(A.begin(), A.end()));
+      EXPECT_EQ(simd::Max(A.data(), n), *std::max_element(A.begin(), A.end()));
+      EXPECT_EQ(simd::MinAbs(A.data(), n), std::abs(*std::min_element(A.begin(), A.end(), [](Real a, Real b){ return std::abs(a) < std::abs(b); })));
+      EXPECT_EQ(simd::MaxAbs(A.data(), n), std::abs(*std::max_element(A.begin(), A.end(), [](Real a, Real b){ return std::abs(a) < std::abs(b); })));
+   });
+}
+
+
+/***************************************************************************************************************************************************************
+* Test Matrix Multiplication Micro-kernel
+***************************************************************************************************************************************************************/
+TEST_F(SimdTest, GemmTile)
+{
+   ForEachSimdLevel([this](const size_t k)
+   {
+      const size_t m = simd::GemmTileRows();
+      const size_t n = simd::GemmTileColumns;
+      DynamicArray<Real> a(k * m), b(k * n), tile(m * n);
+      FOR_EACH(entry, a) entry = RandomReal();
+      FOR_EACH(entry, b) entry = RandomReal();
+
+      simd::GemmTile(k, a.data(), b.data(), tile.data());
+      FOR(i, m) FOR(j, n)
+      {
+         Real expected{}, expected_abs{};
+         FOR(p, k)
+         {
+            expected     += a[p * m + i] * b[p * n + j];
+            expected_abs += std::abs(a[p * m + i] * b[p * n + j]);
+         }
+         EXPECT_NEAR(tile[i + j * m], expected, TenSmall * (One + expected_abs));
+      }
+   });
+}
+/***************************************************************************************************************************************************************
+* Test Single-precision Kernels
+***************************************************************************************************************************************************************/
+TEST_F(SimdTest, SinglePrecision)
+{
+   ForEachSimdLevel([this](const size_t n)
+   {
+      DynamicArray<float> a(n), b(n), out(n);
+      FOR(i, n)
+      {
+         a[i] = static_cast<float>(A[i]);
+         b[i] = static_cast<float>(B[i]);
+      }
+
+      simd::Add(a.data(), b.data(), out.data(), n);
+      FOR(i, n) EXPECT_EQ(out[i], a[i] + b[i]);
+
+      simd::MultiplyScalar(a.data(), 3.0f, out.data(), n);
+      FOR(i, n) EXPECT_EQ(out[i], a[i] * 3.0f);
+
+      // Single-precision sums are compared to the double-precision sums of the rounded entries.
+      Real dot{}, dot_abs{};
+      FOR(i, n)
+      {
+         dot     += static_cast<Real>(a[i]) * static_cast<Real>(b[i]);
+         dot_abs += std::abs(static_cast<Real>(a[i]) * static_cast<Real>(b[i]));
+      }
+      EXPECT_NEAR(simd::Dot(a.data(), b.data(), n), dot, 1.0e-5 * (One + dot_abs));
+      if(n)
+      {
+         EXPECT_EQ(simd::Min(a.data(), n), *std::min_element(a.begin(), a.end()));
+         EXPECT_EQ(simd::Max(a.data(), n), *std::max_element(a.begin(), a.end()));
+      }
+
+      // Structure-of-arrays kernels, with every fifth vector zero. The cross product with the normalised vector is orthogonal to both.
+      DynamicArray<float> x(n), y(n), z(n), cx(n), cy(n), cz(n);
+      DynamicArray<Bool> degenerate(n);
+      FOR(i, n)
+      {
+         x[i] = i % 5 ? a[i] : 0.0f;
+         y[i] = i % 5 ? b[i] : 0.0f;
+         z[i] = i % 5 ? a[i] - b[i] : 0.0f;
+      }
+      const simd::Vectors3<float> v{x.data(), y.data(), z.data()};
+      const simd::Vectors3<const float> normalised{x.data(), y.data(), z.data()};
+      EXPECT_EQ(simd::Normalise(normalised, v, degenerate.data(), n, 1.0e-6f), (n + 4) / 5);
+      FOR(i, n)
+      {
+         EXPECT_EQ(static_cast<bool>(degenerate[i]), i % 5 == 0);
+         if(i % 5) EXPECT_NEAR(x[i] * x[i] + y[i] * y[i] + z[i] * z[i], 1.0f, 1.0e-5f);
+      }
+
+      simd::Cross(simd::Vectors3<const float>{a.data(), b.data(), b.data()}, normalised, simd::Vectors3<float>{cx.data(), cy.data(), cz.data()}, n);
+      FOR(i, n)
+      {
+         EXPECT_NEAR(cx[i] * x[i] + cy[i] * y[i] + cz[i] * z[i], 0.0f, 1.0e-4f * (1.0f + std::abs(a[i]) + std::abs(b[i])));
+         EXPECT_NEAR(cx[i] * a[i] + cy[i] * b[i] + cz[i] * b[i], 0.0f, 1.0e-4f * (1.0f + a[i] * a[i] + b[i] * b[i]));
+      }
+   });
+}
+}
+
+#endif
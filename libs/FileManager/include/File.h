@@ -16,6 +16,7 @@
 
 #include "../../../include/Global.h"
 #include "DataContainer/include/Array.h"
+#include "DataContainer/include/SmallArray.h"
 #include "FileSystem.h"
 
 #include <fstream>
@@ -82,7 +83,7 @@ class BaseFile
    using FileStream = std::basic_fstream<ConditionalType<char, wchar_t>>;
    Path                 Path_;
    FileStream           Stream_;
-   DArray<Mode>         Modes_;
+   SmallArray<Mode, 4>  Modes_;
    mutable Option<bool> Readable_;
    mutable Option<bool> Writable_;
 };
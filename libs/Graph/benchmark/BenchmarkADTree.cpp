@@ -0,0 +1,99 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#include "../../../include/Global.h"
+#include "../../Benchmark/include/Benchmark.h"
+#include "../../../include/Random.h"
+#include "../include/ADTree.h"
+
+#include <string>
+
+using namespace aprn;
+using namespace aprn::graph;
+
+/***************************************************************************************************************************************************************
+* Times alternating digital trees over 10^5 and 10^6 small boxes, as glyph quads in 2D and triangle bounds in 3D: their construction, 10^5 picking and
+* collision queries, and moving a tenth of the boxes by removal and reinsertion. Picking by a linear scan over the boxes is timed for comparison.
+***************************************************************************************************************************************************************/
+template<size_t D>
+void
+BenchmarkTree(Benchmark& benchmark, const size_t n, size_t& checksum)
+{
+   const size_t n_queries = 100000;
+   const std::string name = std::to_string(D) + "D 1e" + std::to_string(static_cast<size_t>(std::round(std::log10(n))));
+   Random<Real> position(-One, One);
+   // Boxes of sides about the mean spacing of n points, so that each query box overlaps a few of them.
+   Random<Real> side(Zero, Two * std::pow(static_cast<Real>(n), -One / static_cast<Real>(D)));
+
+   DArray<SVectorR<D>> mins(n), maxs(n), points(n_queries);
+   FOR(i, n) FOR(d, D)
+   {
+      mins[i][d] = position();
+      maxs[i][d] = mins[i][d] + side();
+   }
+   FOR(i, n_queries) FOR(d, D) points[i][d] = position();
+
+   SVectorR<D> domain_min, domain_max;
+   FOR(d, D)
+   {
+      domain_min[d] = -One;
+      domain_max[d] = One;
+   }
+   ADTreeR<D> tree(domain_min, domain_max);
+   tree.reserve(n);
+   DArray<size_t> ids(n);
+
+   benchmark.StartTimer("Insert " + name);
+   FOR(i, n) ids[i] = tree.Insert(mins[i], maxs[i]);
+   benchmark.StopTimer("Insert " + name);
+
+   benchmark.StartTimer("Pick " + name);
+   FOR(i, n_queries) checksum += tree.Containing(points[i]).size();
+   benchmark.StopTimer("Pick " + name);
+
+   benchmark.StartTimer("Collide " + name);
+   FOR(i, n_queries) tree.ForEachOverlapping(mins[i], maxs[i], [&](const size_t id){ checksum += id; });
+   benchmark.StopTimer("Collide " + name);
+
+   benchmark.StartTimer("Move " + name);
+   for(size_t i = 0; i < n; i += 10)
+   {
+      tree.Remove(ids[i]);
+      ids[i] = tree.Insert(maxs[i], maxs[i] + (maxs[i] - mins[i]));
+   }
+   benchmark.StopTimer("Move " + name);
+
+   // A linear scan over a thousandth of the picking queries.
+   benchmark.StartTimer("Scan pick " + name);
+   FOR(i, n_queries / 1000) FOR(j, n)
+   {
+      bool inside{true};
+      FOR(d, D) inside &= mins[j][d] <= points[i][d] && points[i][d] <= maxs[j][d];
+      checksum += inside;
+   }
+   benchmark.StopTimer("Scan pick " + name);
+}
+
+int main()
+{
+   Benchmark benchmark;
+   size_t checksum{};
+   for(size_t n = 100000; n <= 1000000; n *= 10)
+   {
+      BenchmarkTree<2>(benchmark, n, checksum);
+      BenchmarkTree<3>(benchmark, n, checksum);
+   }
+   Print("Checksum:", checksum);
+   benchmark.PrintResults();
+}
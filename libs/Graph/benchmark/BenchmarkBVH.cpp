@@ -0,0 +1,101 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#include "../../../include/Global.h"
+#include "../../Benchmark/include/Benchmark.h"
+#include "../../../include/Random.h"
+#include "../include/BVH.h"
+
+#include <string>
+
+using namespace aprn;
+using namespace aprn::graph;
+
+/***************************************************************************************************************************************************************
+* Times rebuilding and refitting a BVH over a wavy square grid of about 2 * 10^6 triangles, or of 2 m^2 triangles if m is given by the first argument, whose
+* vertices are rotated as by a model matrix in each of ten frames, and batches of 10^5 ray casts, closest point and frustum queries after each update.
+***************************************************************************************************************************************************************/
+int main(int argc, char* argv[])
+{
+   const size_t m = argc > 1 ? std::stoul(argv[1]) : 1000;
+   const size_t n_frames = 10;
+   const size_t n_queries = 100000;
+   Benchmark benchmark;
+   Random<Real> random(-One, One);
+   size_t checksum{};
+
+   // Grid over [-1, 1]^2, with each cell split into two triangles.
+   DArray<SVectorR3> grid(m * m);
+   FOR(i, m) FOR(j, m)
+   {
+      const Real x = Real(2 * i) / Real(m - 1) - One, y = Real(2 * j) / Real(m - 1) - One;
+      grid[i * m + j] = {x, y, 0.1 * std::sin(8.0 * x) * std::cos(8.0 * y)};
+   }
+   DArray<std::uint32_t> indices;
+   indices.reserve(6 * (m - 1) * (m - 1));
+   FOR(i, m - 1) FOR(j, m - 1)
+   {
+      const auto v = static_cast<std::uint32_t>(i * m + j), w = static_cast<std::uint32_t>(m);
+      for(const std::uint32_t k : {v, v + w, v + w + 1, v, v + w + 1, v + 1}) indices.push_back(k);
+   }
+
+   // Rays cast down onto the grid from above, e.g. picked from the cursor, and points near the grid.
+   DArray<SVectorR3> origins(n_queries), points(n_queries);
+   FOR(i, n_queries)
+   {
+      origins[i] = {random(), random(), One};
+      points[i]  = {random(), random(), 0.2 * random()};
+   }
+   const SVectorR3 down{Zero, Zero, -One};
+
+   BVHR rebuilt, refitted(grid, indices);
+   DArray<SVectorR3> vertices(grid.size());
+   FOR(frame, n_frames)
+   {
+      // Rotate the grid about the z-axis.
+      const Real angle = 0.1 * Real(frame + 1);
+      FOR(i, grid.size()) vertices[i] = {std::cos(angle) * grid[i][0] - std::sin(angle) * grid[i][1],
+                                         std::sin(angle) * grid[i][0] + std::cos(angle) * grid[i][1], grid[i][2]};
+
+      benchmark.StartTimer("Rebuild");
+      rebuilt.Build(vertices, indices);
+      benchmark.StopTimer("Rebuild");
+
+      benchmark.StartTimer("Refit");
+      refitted.Refit(vertices);
+      benchmark.StopTimer("Refit");
+
+      for(const auto& [bvh, name] : {std::pair<const BVHR*, std::string>{&rebuilt, " rebuilt"}, {&refitted, " refitted"}})
+      {
+         benchmark.StartTimer("Ray casts" + name);
+         FOR(i, n_queries) if(const auto hit = bvh->Intersect(origins[i], down)) checksum += hit->Triangle;
+         benchmark.StopTimer("Ray casts" + name);
+
+         benchmark.StartTimer("Closest points" + name);
+         FOR(i, n_queries) checksum += bvh->Closest(points[i])->Triangle;
+         benchmark.StopTimer("Closest points" + name);
+
+         // A frustum-like box around the centre of the grid, holding about a hundredth of it.
+         const std::array<SVectorR4, 6> planes{SVectorR4{One, Zero, Zero, 0.1}, SVectorR4{-One, Zero, Zero, 0.1}, SVectorR4{Zero, One, Zero, 0.1},
+                                               SVectorR4{Zero, -One, Zero, 0.1}, SVectorR4{Zero, Zero, One, One}, SVectorR4{Zero, Zero, -One, One}};
+         benchmark.StartTimer("Frustum" + name);
+         checksum += bvh->FrustumSearch(planes).size();
+         benchmark.StopTimer("Frustum" + name);
+      }
+   }
+
+   Print("Triangles:", indices.size() / 3, "Nodes:", rebuilt.NodeCount(), "Levels:", rebuilt.LevelCount());
+   Print("Checksum:", checksum);
+   benchmark.PrintResults();
+}
@@ -0,0 +1,86 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#include "../../../include/Global.h"
+#include "../../Benchmark/include/Benchmark.h"
+#include "../include/GraphAlgorithms.h"
+
+#include <random>
+#include <string>
+
+using namespace aprn;
+using namespace aprn::graph;
+
+/***************************************************************************************************************************************************************
+* Times the graph kernels on an R-MAT graph of 2^20 vertices and 10^7 edges, or of 2^scale vertices and 10 edges per vertex if given the scale by the first
+* argument: the generation of the edges, the construction of the directed and undirected graphs, breadth-first search and shortest paths from a few sources,
+* with random integer weights in [1, 255], connected components and PageRank.
+***************************************************************************************************************************************************************/
+int main(int argc, char* argv[])
+{
+   const size_t scale = argc > 1 ? std::stoul(argv[1]) : 20;
+   const size_t n = size_t{1} << scale;
+   Benchmark benchmark;
+   Real checksum{};
+
+   benchmark.StartTimer("R-MAT edges");
+   auto edges = RMatEdges(scale, 10);
+   benchmark.StopTimer("R-MAT edges");
+
+   std::mt19937 generator(0);
+   std::uniform_int_distribution<int> distribution(1, 255);
+   FOR_EACH(edge, edges) edge.Weight = static_cast<Real>(distribution(generator));
+
+   benchmark.StartTimer("Build directed");
+   const Graph<Real> graph(n, edges);
+   benchmark.StopTimer("Build directed");
+
+   benchmark.StartTimer("Build undirected");
+   const Graph<Real> undirected(n, edges, false);
+   benchmark.StopTimer("Build undirected");
+
+   // Sources with out-edges, so that the searches reach most of the graph.
+   std::vector<Vertex> sources;
+   for(Vertex v = 0; sources.size() < 4; ++v) if(graph.OutDegree(v)) sources.push_back(v);
+
+   FOR_EACH_CONST(source, sources)
+   {
+      benchmark.StartTimer("BFS");
+      const auto tree = BreadthFirstSearch(graph, source);
+      benchmark.StopTimer("BFS");
+      checksum += tree.Depths[n / 2];
+
+      benchmark.StartTimer("BFS undirected");
+      const auto undirected_tree = BreadthFirstSearch(undirected, source);
+      benchmark.StopTimer("BFS undirected");
+      checksum += undirected_tree.Depths[n / 2];
+
+      benchmark.StartTimer("Delta-stepping");
+      const auto distances = ShortestPaths(graph, source);
+      benchmark.StopTimer("Delta-stepping");
+      checksum += distances[source];
+   }
+
+   benchmark.StartTimer("Components");
+   checksum += ConnectedComponents(graph)[n / 2];
+   benchmark.StopTimer("Components");
+
+   benchmark.StartTimer("PageRank");
+   checksum += PageRank(graph)[n / 2];
+   benchmark.StopTimer("PageRank");
+
+   Print("Edges:", graph.EdgeCount());
+   Print("Checksum:", checksum);
+   benchmark.PrintResults();
+}
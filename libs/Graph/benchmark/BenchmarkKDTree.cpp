@@ -0,0 +1,79 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#include "../../../include/Global.h"
+#include "../../Benchmark/include/Benchmark.h"
+#include "../../../include/Random.h"
+#include "../include/KDTree.h"
+
+#include <string>
+
+using namespace aprn;
+using namespace aprn::graph;
+
+/***************************************************************************************************************************************************************
+* Times the construction of KD-trees over 10^6 random 3D points and up, and batches of 10^5 nearest neighbour, radius and box queries, which find about ten
+* points each. The largest size is 10^6 by default, and up to 10^8 if given as a power of ten by the first argument, e.g. "BenchmarkKDTree 8", which needs
+* about 10 GB of memory.
+***************************************************************************************************************************************************************/
+int main(int argc, char* argv[])
+{
+   const size_t max_exponent = argc > 1 ? std::stoul(argv[1]) : 6;
+   const size_t n_queries = 100000;
+   Benchmark benchmark;
+   Random<Real> random(-One, One);
+   size_t checksum{};
+
+   DArray<SVectorR3> queries(n_queries);
+   FOR(i, n_queries) queries[i] = {random(), random(), random()};
+
+   for(size_t exponent = 6, n = 1000000; exponent <= max_exponent; ++exponent, n *= 10)
+   {
+      DArray<SVectorR3> points(n);
+      FOR(i, n) points[i] = {random(), random(), random()};
+      const std::string size = " 1e" + std::to_string(exponent);
+
+      benchmark.StartTimer("Build" + size);
+      const KDTreeR3 tree(points);
+      benchmark.StopTimer("Build" + size);
+
+      benchmark.StartTimer("Nearest" + size);
+      checksum += tree.Nearest(queries)[n_queries / 2];
+      benchmark.StopTimer("Nearest" + size);
+
+      benchmark.StartTimer("10-NN" + size);
+      checksum += tree.NearestNeighbours(queries, 10)[n_queries / 2];
+      benchmark.StopTimer("10-NN" + size);
+
+      // Radii and boxes enclosing about ten points, out of a density of n / 8 points per unit volume.
+      const Real radius = std::cbrt(Real(10 * 6) / (Pi * static_cast<Real>(n)));
+      benchmark.StartTimer("Radius" + size);
+      checksum += tree.RadiusSearch(queries, radius)[n_queries / 2].size();
+      benchmark.StopTimer("Radius" + size);
+
+      const Real half_width = std::cbrt(Real(10) / static_cast<Real>(n));
+      DArray<SVectorR3> mins(n_queries), maxs(n_queries);
+      FOR(i, n_queries)
+      {
+         mins[i] = queries[i] - SVectorR3{half_width, half_width, half_width};
+         maxs[i] = queries[i] + SVectorR3{half_width, half_width, half_width};
+      }
+      benchmark.StartTimer("Box" + size);
+      checksum += tree.BoxSearch(mins, maxs)[n_queries / 2].size();
+      benchmark.StopTimer("Box" + size);
+   }
+
+   Print("Checksum:", checksum);
+   benchmark.PrintResults();
+}
@@ -0,0 +1,107 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#include "../../../include/Global.h"
+#include "../../Benchmark/include/Benchmark.h"
+#include "../../../include/Random.h"
+#include "../include/Tree.h"
+
+#include <memory>
+#include <string>
+
+using namespace aprn;
+using namespace aprn::graph;
+
+/** Node with reference-counted links, as the trees were stored before the node arena, with a weak parent link so that the benchmark does not leak. */
+struct SharedNode
+{
+   Real Data;
+   size_t Depth;
+   std::weak_ptr<SharedNode> Parent;
+   SmallArray<std::shared_ptr<SharedNode>, 4> Children;
+};
+
+/***************************************************************************************************************************************************************
+* Times the construction and traversal of random recursive trees of 10^6 nodes and up, where each node is the child of a uniformly random earlier node, in
+* the node arena and with reference-counted nodes. The largest size is 10^7 by default, or a power of ten given by the first argument.
+***************************************************************************************************************************************************************/
+int main(int argc, char* argv[])
+{
+   const size_t max_exponent = argc > 1 ? std::stoul(argv[1]) : 7;
+   Benchmark benchmark;
+   Real checksum{};
+
+   for(size_t exponent = 6, n = 1000000; exponent <= max_exponent; ++exponent, n *= 10)
+   {
+      const std::string size = " 1e" + std::to_string(exponent);
+      DArray<NodeHandle> parents(n);
+      FOR(i, 1, n) parents[i] = static_cast<NodeHandle>(Random<size_t>(0, i - 1)());
+      {
+         benchmark.StartTimer("Arena build" + size);
+         Tree<Real> tree;
+         tree.reserve(n);
+         tree.AddRoot(Zero);
+         FOR(i, 1, n) tree.AddChild(parents[i], static_cast<Real>(i));
+         benchmark.StopTimer("Arena build" + size);
+
+         const auto sum = [&](const auto& traversal, const std::string& name)
+         {
+            benchmark.StartTimer(name + size);
+            Real total{};
+            for(const NodeHandle node : traversal) total += tree[node].Data;
+            benchmark.StopTimer(name + size);
+            checksum += total;
+         };
+         sum(tree.DepthFirst(), "Arena DFS");
+         sum(tree.BreadthFirst(), "Arena BFS");
+
+         benchmark.StartTimer("Arena compact" + size);
+         tree.Compact();
+         benchmark.StopTimer("Arena compact" + size);
+         sum(tree.DepthFirst(), "Compact DFS");
+      }
+      {
+         benchmark.StartTimer("Shared build" + size);
+         std::vector<std::shared_ptr<SharedNode>> nodes(n);
+         nodes[0] = std::make_shared<SharedNode>();
+         nodes[0]->Data = Zero;
+         nodes[0]->Depth = 0;
+         FOR(i, 1, n)
+         {
+            nodes[i] = std::make_shared<SharedNode>();
+            nodes[i]->Data = static_cast<Real>(i);
+            nodes[i]->Depth = nodes[parents[i]]->Depth + 1;
+            nodes[i]->Parent = nodes[parents[i]];
+            nodes[parents[i]]->Children.push_back(nodes[i]);
+         }
+         benchmark.StopTimer("Shared build" + size);
+
+         benchmark.StartTimer("Shared DFS" + size);
+         Real total{};
+         std::vector<std::shared_ptr<SharedNode>> stack{nodes[0]};
+         while(!stack.empty())
+         {
+            const auto node = stack.back();
+            stack.pop_back();
+            total += node->Data;
+            for(auto it = node->Children.end(); it != node->Children.begin();) stack.push_back(*--it);
+         }
+         benchmark.StopTimer("Shared DFS" + size);
+         checksum += total;
+      }
+   }
+
+   Print("Checksum:", checksum);
+   benchmark.PrintResults();
+}
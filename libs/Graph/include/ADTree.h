@@ -16,27 +16,120 @@
 
 #include "../../../include/Global.h"
 #include "../../DataContainer/include/Array.h"
-#include "Tree.h"
+#include "../../DataContainer/include/SmallArray.h"
+#include "../../LinearAlgebra/include/Vector.h"
+
+#include <array>
+#include <cstdint>
+#include <limits>
 
 namespace aprn::graph {
 
 /***************************************************************************************************************************************************************
-* Alternating Digital Tree Node Data
+* Alternating Digital Tree Node
 ***************************************************************************************************************************************************************/
+
+/** Node of an alternating digital tree, holding one box as a 2D-dimensional key, its minimum followed by its maximum. The nodes of a subtree lie in a region of
+ *  key space, which is halved at each level along the next key dimension: keys less than the split value go to the first child, and the others to the second.
+ *  Nodes refer to each other by their index in the node pool. */
+template<size_t D, typename T>
 struct ADTreeNode
 {
+   using Index = std::uint32_t;
 
+   std::array<T, 2 * D> Key;
+   T                    Split;
+   std::array<Index, 2> Children;
+   Index                Parent;
+   std::uint8_t         Dimension;
 };
 
 /***************************************************************************************************************************************************************
 * Alternating Digital Tree Class Definition
 ***************************************************************************************************************************************************************/
-class ADTree : public Tree<ADTreeNode>
+
+/** Alternating digital tree (Bonet & Peraire) indexing D-dimensional axis-aligned boxes, e.g. mesh triangles, glyph quads or curve segments, for overlap and
+ *  containment queries. Each box is a point in 2D dimensions, so that box queries are range queries in key space. The split values are the midpoints of the
+ *  node regions, which start as the given domain, so that the shape of the tree depends on the distribution of the boxes but not on their insertion order.
+ *  Boxes outside the domain are still found, but unbalance the tree. The nodes are stored in a pool, where each box keeps the node index it was inserted at
+ *  as its id until it is removed, after which the id is reused. */
+template<size_t D, typename T = Real>
+class ADTree
 {
+   static_assert(D > 0 && 2 * D <= 255, "The dimension must be in [1, 127].");
+
  public:
-   ADTree() = default;
+   using Point = SVector<T, D>;
+   using Node  = ADTreeNode<D, T>;
+   using Index = typename Node::Index;
+
+   ADTree(const Point& domain_min, const Point& domain_max);
+
+   /** Insert a box, returning its id. */
+   size_t Insert(const Point& min, const Point& max);
+
+   /** Remove the box of a given id. */
+   void Remove(const size_t id);
+
+   /** Remove all the boxes, keeping the node pool. */
+   void clear();
+
+   void reserve(const size_t n) { Nodes_.reserve(n); }
+
+   /** Ids of the boxes overlapping a closed box. */
+   DArray<size_t> Overlapping(const Point& min, const Point& max) const;
+
+   /** Ids of the boxes contained in a closed box. */
+   DArray<size_t> Contained(const Point& min, const Point& max) const;
+
+   /** Ids of the boxes containing a closed box, or a point, e.g. for picking. */
+   DArray<size_t> Containing(const Point& min, const Point& max) const;
+
+   DArray<size_t> Containing(const Point& point) const { return Containing(point, point); }
+
+   /** Apply a function to the id of each box overlapping a closed box, without allocating, e.g. for collision tests. */
+   template<class F>
+   void ForEachOverlapping(const Point& min, const Point& max, F&& function) const;
+
+   /** Whether an id refers to a box in the tree, and the bounds of the box. */
+   inline bool isItem(const size_t id) const { return id < Nodes_.size() && Nodes_[id].Parent != FreeIndex; }
+
+   Point Min(const size_t id) const;
+
+   Point Max(const size_t id) const;
+
+   /** Number of boxes, and depth of the deepest node. */
+   inline size_t size() const { return Size_; }
+
+   size_t Depth() const;
 
  private:
+   using Key = std::array<T, 2 * D>;
+
+   static constexpr Index NullIndex = std::numeric_limits<Index>::max();
+   static constexpr Index FreeIndex = NullIndex - 1;
+
+   /** Apply a function to each node whose key lies in the closed range [lower, upper]. */
+   template<class F>
+   void Search(const Key& lower, const Key& upper, F&& function) const;
+
+   DArray<size_t> Collect(const Key& lower, const Key& upper) const;
+
+   /** Unlink a node from its parent, or from the root. */
+   void Unlink(const Index node);
+
+   Key            DomainMin_;
+   Key            DomainMax_;
+   DArray<Node>   Nodes_;
+   DArray<Index>  FreeNodes_;
+   Index          Root_{NullIndex};
+   size_t         Size_{};
 };
 
+template<size_t D> using ADTreeR = ADTree<D, Real>;
+using ADTreeR2 = ADTreeR<2>;
+using ADTreeR3 = ADTreeR<3>;
+
 }
+
+#include "ADTree.tpp"
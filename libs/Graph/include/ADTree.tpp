@@ -0,0 +1,267 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+namespace aprn::graph {
+
+/***************************************************************************************************************************************************************
+* Alternating Digital Tree Modifiers
+***************************************************************************************************************************************************************/
+template<size_t D, typename T>
+ADTree<D, T>::ADTree(const Point& domain_min, const Point& domain_max)
+{
+   FOR(i, D)
+   {
+      DEBUG_ASSERT(domain_min[i] < domain_max[i], "The domain minimum ", domain_min[i], " must be less than the maximum ", domain_max[i], ".")
+      DomainMin_[i] = DomainMin_[D + i] = domain_min[i];
+      DomainMax_[i] = DomainMax_[D + i] = domain_max[i];
+   }
+}
+
+template<size_t D, typename T>
+size_t
+ADTree<D, T>::Insert(const Point& min, const Point& max)
+{
+   Key key;
+   FOR(i, D)
+   {
+      DEBUG_ASSERT(min[i] <= max[i], "The box minimum ", min[i], " must not exceed the maximum ", max[i], ".")
+      key[i]     = min[i];
+      key[D + i] = max[i];
+   }
+
+   // Descend to the first free child slot on the side of the key, halving the region along the way, so that the new node splits the remaining region.
+   Key lower = DomainMin_;
+   Key upper = DomainMax_;
+   Index parent{NullIndex};
+   size_t side{};
+   size_t dim{};
+   for(Index node = Root_; node != NullIndex; node = Nodes_[parent].Children[side])
+   {
+      parent = node;
+      side = key[dim] >= Nodes_[node].Split;
+      (side ? lower : upper)[dim] = Nodes_[node].Split;
+      dim = (dim + 1) % (2 * D);
+   }
+
+   Index id;
+   if(FreeNodes_.empty())
+   {
+      ASSERT(Nodes_.size() < FreeIndex, "An alternating digital tree holds at most ", FreeIndex, " boxes.")
+      id = static_cast<Index>(Nodes_.size());
+      Nodes_.emplace_back();
+   }
+   else
+   {
+      id = FreeNodes_.back();
+      FreeNodes_.pop_back();
+   }
+   Nodes_[id] = {key, (lower[dim] + upper[dim]) / 2, {NullIndex, NullIndex}, parent, static_cast<std::uint8_t>(dim)};
+   (parent == NullIndex ? Root_ : Nodes_[parent].Children[side]) = id;
+   ++Size_;
+   return id;
+}
+
+template<size_t D, typename T>
+void
+ADTree<D, T>::Remove(const size_t id)
+{
+   ASSERT(isItem(id), "There is no box of id ", id, " in the tree.")
+
+   // Replace the node by a leaf of its subtree, which lies in the region of the node, and takes over its position, split and children. The ids of the other
+   // boxes are unchanged.
+   const auto node = static_cast<Index>(id);
+   Index leaf = node;
+   while(true)
+   {
+      const auto& children = Nodes_[leaf].Children;
+      if(children[0] != NullIndex)      leaf = children[0];
+      else if(children[1] != NullIndex) leaf = children[1];
+      else break;
+   }
+   Unlink(leaf);
+   if(leaf != node)
+   {
+      Node& replacement = Nodes_[leaf];
+      const Node& removed = Nodes_[node];
+      replacement.Split     = removed.Split;
+      replacement.Children  = removed.Children;
+      replacement.Parent    = removed.Parent;
+      replacement.Dimension = removed.Dimension;
+      FOR(i, 2) if(removed.Children[i] != NullIndex) Nodes_[removed.Children[i]].Parent = leaf;
+      if(removed.Parent == NullIndex) Root_ = leaf;
+      else
+      {
+         auto& children = Nodes_[removed.Parent].Children;
+         children[children[1] == node] = leaf;
+      }
+   }
+   Nodes_[node].Parent = FreeIndex;
+   FreeNodes_.push_back(node);
+   --Size_;
+}
+
+template<size_t D, typename T>
+void
+ADTree<D, T>::clear()
+{
+   Nodes_.clear();
+   FreeNodes_.clear();
+   Root_ = NullIndex;
+   Size_ = 0;
+}
+
+template<size_t D, typename T>
+void
+ADTree<D, T>::Unlink(const Index node)
+{
+   const Index parent = Nodes_[node].Parent;
+   if(parent == NullIndex) Root_ = NullIndex;
+   else
+   {
+      auto& children = Nodes_[parent].Children;
+      children[children[1] == node] = NullIndex;
+   }
+}
+
+/***************************************************************************************************************************************************************
+* Alternating Digital Tree Queries
+***************************************************************************************************************************************************************/
+template<size_t D, typename T>
+DArray<size_t>
+ADTree<D, T>::Overlapping(const Point& min, const Point& max) const
+{
+   DArray<size_t> ids;
+   ForEachOverlapping(min, max, [&](const size_t id){ ids.push_back(id); });
+   return ids;
+}
+
+template<size_t D, typename T>
+DArray<size_t>
+ADTree<D, T>::Contained(const Point& min, const Point& max) const
+{
+   Key lower, upper;
+   FOR(i, D)
+   {
+      lower[i] = lower[D + i] = min[i];
+      upper[i] = upper[D + i] = max[i];
+   }
+   return Collect(lower, upper);
+}
+
+template<size_t D, typename T>
+DArray<size_t>
+ADTree<D, T>::Containing(const Point& min, const Point& max) const
+{
+   Key lower, upper;
+   FOR(i, D)
+   {
+      lower[i]     = std::numeric_limits<T>::lowest();
+      upper[i]     = min[i];
+      lower[D + i] = max[i];
+      upper[D + i] = std::numeric_limits<T>::max();
+   }
+   return Collect(lower, upper);
+}
+
+template<size_t D, typename T>
+template<class F>
+void
+ADTree<D, T>::ForEachOverlapping(const Point& min, const Point& max, F&& function) const
+{
+   // A box overlaps [min, max] if its minimum is at most max, and its maximum at least min.
+   Key lower, upper;
+   FOR(i, D)
+   {
+      lower[i]     = std::numeric_limits<T>::lowest();
+      upper[i]     = max[i];
+      lower[D + i] = min[i];
+      upper[D + i] = std::numeric_limits<T>::max();
+   }
+   Search(lower, upper, std::forward<F>(function));
+}
+
+template<size_t D, typename T>
+typename ADTree<D, T>::Point
+ADTree<D, T>::Min(const size_t id) const
+{
+   DEBUG_ASSERT(isItem(id), "There is no box of id ", id, " in the tree.")
+   Point min;
+   FOR(i, D) min[i] = Nodes_[id].Key[i];
+   return min;
+}
+
+template<size_t D, typename T>
+typename ADTree<D, T>::Point
+ADTree<D, T>::Max(const size_t id) const
+{
+   DEBUG_ASSERT(isItem(id), "There is no box of id ", id, " in the tree.")
+   Point max;
+   FOR(i, D) max[i] = Nodes_[id].Key[D + i];
+   return max;
+}
+
+template<size_t D, typename T>
+size_t
+ADTree<D, T>::Depth() const
+{
+   size_t depth{};
+   FOR(i, Nodes_.size())
+   {
+      if(Nodes_[i].Parent == FreeIndex) continue;
+      size_t node_depth{};
+      for(Index node = static_cast<Index>(i); Nodes_[node].Parent != NullIndex; node = Nodes_[node].Parent) ++node_depth;
+      depth = aprn::Max(depth, node_depth);
+   }
+   return depth;
+}
+
+// Each visit tests the box of the node, and pushes the children whose half of the region can hold keys in the range. The tests on the ancestors of a node
+// already exclude the parts of its region outside the range.
+template<size_t D, typename T>
+template<class F>
+void
+ADTree<D, T>::Search(const Key& lower, const Key& upper, F&& function) const
+{
+   if(Root_ == NullIndex) return;
+
+   SmallArray<Index, 64> stack;
+   stack.push_back(Root_);
+   while(!stack.empty())
+   {
+      const Index index = stack.back();
+      stack.pop_back();
+      const Node& node = Nodes_[index];
+
+      bool inside{true};
+      FOR(i, 2 * D) inside &= lower[i] <= node.Key[i] && node.Key[i] <= upper[i];
+      if(inside) function(static_cast<size_t>(index));
+
+      const size_t dim = node.Dimension;
+      if(node.Children[1] != NullIndex && upper[dim] >= node.Split) stack.push_back(node.Children[1]);
+      if(node.Children[0] != NullIndex && lower[dim] <  node.Split) stack.push_back(node.Children[0]);
+   }
+}
+
+template<size_t D, typename T>
+DArray<size_t>
+ADTree<D, T>::Collect(const Key& lower, const Key& upper) const
+{
+   DArray<size_t> ids;
+   Search(lower, upper, [&](const size_t id){ ids.push_back(id); });
+   return ids;
+}
+
+}
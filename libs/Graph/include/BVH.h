@@ -0,0 +1,171 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+#include "../../../include/Global.h"
+#include "../../DataContainer/include/Array.h"
+#include "../../DataContainer/include/SmallArray.h"
+#include "../../LinearAlgebra/include/Vector.h"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace aprn::graph {
+
+/** Number of bins along each axis in which the surface area heuristic is evaluated, and maximum number of triangles in a leaf. */
+constexpr size_t BVHBinCount = 16;
+constexpr size_t BVHLeafSize = 8;
+
+/** Number of triangles of a node from which its bins are filled in parallel, rather than alongside the other nodes of its level. */
+constexpr size_t BVHParallelNodeSize = size_t{1} << 15;
+
+/***************************************************************************************************************************************************************
+* BVH Query Results
+***************************************************************************************************************************************************************/
+
+/** Nearest intersection of a ray with a triangle, at origin + Distance * direction, with barycentric coordinates (1 - U - V, U, V). */
+template<typename T>
+struct RayHit
+{
+   size_t Triangle;
+   T      Distance;
+   T      U;
+   T      V;
+};
+
+/** Closest point to a query on a triangle, at a given distance from the query. */
+template<typename T>
+struct ClosestPoint
+{
+   size_t        Triangle;
+   SVector<T, 3> Point;
+   T             Distance;
+};
+
+/***************************************************************************************************************************************************************
+* BVH Class Definition
+***************************************************************************************************************************************************************/
+
+/** Bounding volume hierarchy of axis-aligned boxes over the triangles of a mesh, for ray casts, closest point and frustum queries. Nodes are split with the
+ *  surface area heuristic, evaluated over the centroids binned along each axis, level by level: the nodes of a level are split in parallel, except for large
+ *  nodes, whose bins are filled in parallel. The nodes of a level are stored contiguously, with the two children of a node next to each other, so that Refit
+ *  updates the boxes of moved vertices level by level, bottom up, without changing the tree. Refitting suits deforming meshes whose triangles stay close to
+ *  each other, e.g. meshes moved by a model matrix, whereas meshes whose triangles move apart degrade the tree, and are to be rebuilt. Queries return the
+ *  indices of the triangles in the index array the hierarchy was built from, where triangle i has the vertices indices[3i, 3i + 1, 3i + 2]. */
+template<typename T = Real>
+class BVH
+{
+ public:
+   using Point = SVector<T, 3>;
+   using Plane = SVector<T, 4>;
+
+   BVH() = default;
+
+   BVH(const DArray<Point>& vertices, const DArray<std::uint32_t>& indices);
+
+   /** Build the hierarchy, in O(n log n) time, copying the vertices and the triangles. */
+   void Build(const DArray<Point>& vertices, const DArray<std::uint32_t>& indices);
+
+   /** Update the boxes to moved vertices, in O(n) time, keeping the tree. The vertices must be those of the mesh the hierarchy was built from. */
+   void Refit(const DArray<Point>& vertices);
+
+   /** Nearest intersection of a ray with the triangles, no further than a maximum distance, in units of the direction, which need not be normalised. */
+   Option<RayHit<T>> Intersect(const Point& origin, const Point& direction, const T max_distance = InfFloat<T>) const;
+
+   /** Closest point on the triangles to a query point, no further than a maximum distance. */
+   Option<ClosestPoint<T>> Closest(const Point& query, const T max_distance = InfFloat<T>) const;
+
+   /** Indices of the triangles whose bounding boxes are not entirely outside a convex volume, e.g. a view frustum, bounded by planes (a, b, c, d) facing its
+    *  interior, a x + b y + c z + d >= 0. Subtrees entirely inside the volume are added without testing their triangles. */
+   template<size_t N>
+   DArray<size_t> FrustumSearch(const std::array<Plane, N>& planes) const;
+
+   /** Number of triangles, nodes, and levels. */
+   inline size_t size() const { return Triangles_.size(); }
+
+   inline size_t NodeCount() const { return Nodes_.size(); }
+
+   inline size_t LevelCount() const { return LevelOffsets_.size() ? LevelOffsets_.size() - 1 : 0; }
+
+ private:
+   using Coordinates = std::array<T, 3>;
+   using Triangle    = std::array<std::uint32_t, 3>;
+
+   struct Box
+   {
+      Coordinates Min{InfFloat<T>, InfFloat<T>, InfFloat<T>};
+      Coordinates Max{-InfFloat<T>, -InfFloat<T>, -InfFloat<T>};
+
+      void Expand(const Coordinates& point);
+
+      void Expand(const Box& box);
+
+      T HalfArea() const;
+   };
+
+   /** Node bounding a box, holding either the triangles [Index, Index + Count) in leaf order, or two children Index and Index + 1 if Count is zero. */
+   struct Node
+   {
+      Box           Bounds;
+      std::uint32_t Index;
+      std::uint32_t Count;
+   };
+
+   /** Number of triangles in each bin of their centroids along each axis, and the bounds of their boxes. */
+   struct Bins
+   {
+      std::array<std::array<size_t, BVHBinCount>, 3> Counts{};
+      std::array<std::array<Box, BVHBinCount>, 3>    Bounds;
+   };
+
+   /** Triangle with its bounds, which are partitioned in place of its index, so that the nodes are split streaming through contiguous memory. */
+   struct Reference
+   {
+      Box           Bounds;
+      std::uint32_t Triangle;
+
+      T Centroid(const size_t d) const { return (Bounds.Min[d] + Bounds.Max[d]) / T{2}; }
+   };
+
+   /** Split the triangles [begin, end) of a node, and return the split position, or end if the node is a leaf. */
+   size_t SplitNode(const size_t node, const size_t begin, const size_t end, DArray<Reference>& references, const bool is_parallel);
+
+   Box TriangleBounds(const Triangle& triangle) const;
+
+   /** Distance along a ray, with inverse direction components, to the entry of a box, or infinity if it misses the box before a maximum distance. */
+   static T RayEntry(const Box& box, const Coordinates& origin, const Coordinates& inverse_direction, const T max_distance);
+
+   static T SquaredDistance(const Box& box, const Coordinates& point);
+
+   /** Position of a box relative to a convex volume: -1 if it is entirely outside, 1 if it is entirely inside, and 0 otherwise. */
+   template<size_t N>
+   static int Classify(const Box& box, const std::array<Plane, N>& planes);
+
+   static Coordinates ToCoordinates(const Point& point);
+
+   DArray<Node>          Nodes_;
+   DArray<size_t>        LevelOffsets_;  // The nodes of level l are [LevelOffsets_[l], LevelOffsets_[l + 1]).
+   DArray<Coordinates>   Vertices_;
+   DArray<Triangle>      LeafTriangles_; // Vertex indices of the triangles in leaf order.
+   DArray<std::uint32_t> Triangles_;     // Indices of the triangles in leaf order.
+};
+
+using BVHR = BVH<Real>;
+using BVHF = BVH<float>;
+
+}
+
+#include "BVH.tpp"
@@ -0,0 +1,573 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+namespace aprn::graph {
+namespace detail {
+
+/***************************************************************************************************************************************************************
+* Triangle Geometry
+***************************************************************************************************************************************************************/
+template<typename T>
+std::array<T, 3>
+Subtract3(const std::array<T, 3>& a, const std::array<T, 3>& b) { return {a[0] - b[0], a[1] - b[1], a[2] - b[2]}; }
+
+template<typename T>
+std::array<T, 3>
+Cross3(const std::array<T, 3>& a, const std::array<T, 3>& b) { return {a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0]}; }
+
+template<typename T>
+T
+Dot3(const std::array<T, 3>& a, const std::array<T, 3>& b) { return a[0] * b[0] + a[1] * b[1] + a[2] * b[2]; }
+
+/** Point a + s (b - a) + t (c - a). */
+template<typename T>
+std::array<T, 3>
+TrianglePoint(const std::array<T, 3>& a, const std::array<T, 3>& b, const std::array<T, 3>& c, const T s, const T t)
+{
+   std::array<T, 3> point;
+   FOR(d, 3) point[d] = a[d] + s * (b[d] - a[d]) + t * (c[d] - a[d]);
+   return point;
+}
+
+/** Möller-Trumbore intersection of a ray with a triangle (a, b, c), returning the distance along the ray and the barycentric coordinates of b and c, if the
+ *  ray hits the triangle within [0, max_distance]. */
+template<typename T>
+Option<std::array<T, 3>>
+IntersectTriangle(const std::array<T, 3>& origin, const std::array<T, 3>& direction, const std::array<T, 3>& a, const std::array<T, 3>& b,
+                  const std::array<T, 3>& c, const T max_distance)
+{
+   const auto ab = Subtract3(b, a);
+   const auto ac = Subtract3(c, a);
+   const auto p  = Cross3(direction, ac);
+   const T determinant = Dot3(ab, p);
+   if(determinant == T{}) return {};
+
+   const T inverse = T{1} / determinant;
+   const auto ao = Subtract3(origin, a);
+   const T u = Dot3(ao, p) * inverse;
+   if(u < T{} || u > T{1}) return {};
+
+   const auto q = Cross3(ao, ab);
+   const T v = Dot3(direction, q) * inverse;
+   if(v < T{} || u + v > T{1}) return {};
+
+   const T distance = Dot3(ac, q) * inverse;
+   if(distance < T{} || distance > max_distance) return {};
+   return std::array<T, 3>{distance, u, v};
+}
+
+/** Closest point to a query on a triangle (a, b, c), found from the Voronoi region of the triangle containing the query. */
+template<typename T>
+std::array<T, 3>
+ClosestTrianglePoint(const std::array<T, 3>& query, const std::array<T, 3>& a, const std::array<T, 3>& b, const std::array<T, 3>& c)
+{
+   const auto ab = Subtract3(b, a);
+   const auto ac = Subtract3(c, a);
+   const auto ap = Subtract3(query, a);
+   const T d1 = Dot3(ab, ap);
+   const T d2 = Dot3(ac, ap);
+   if(d1 <= T{} && d2 <= T{}) return a;
+
+   const auto bp = Subtract3(query, b);
+   const T d3 = Dot3(ab, bp);
+   const T d4 = Dot3(ac, bp);
+   if(d3 >= T{} && d4 <= d3) return b;
+
+   const T vc = d1 * d4 - d3 * d2;
+   if(vc <= T{} && d1 >= T{} && d3 <= T{}) return TrianglePoint(a, b, c, d1 / (d1 - d3), T{});
+
+   const auto cp = Subtract3(query, c);
+   const T d5 = Dot3(ab, cp);
+   const T d6 = Dot3(ac, cp);
+   if(d6 >= T{} && d5 <= d6) return c;
+
+   const T vb = d5 * d2 - d1 * d6;
+   if(vb <= T{} && d2 >= T{} && d6 <= T{}) return TrianglePoint(a, b, c, T{}, d2 / (d2 - d6));
+
+   const T va = d3 * d6 - d5 * d4;
+   if(va <= T{} && d4 - d3 >= T{} && d5 - d6 >= T{})
+   {
+      const T t = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+      return TrianglePoint(a, b, c, T{1} - t, t);
+   }
+
+   // The query projects into the interior of the triangle.
+   const T denominator = T{1} / (va + vb + vc);
+   return TrianglePoint(a, b, c, vb * denominator, vc * denominator);
+}
+
+}//detail
+
+/***************************************************************************************************************************************************************
+* BVH Construction
+***************************************************************************************************************************************************************/
+template<typename T>
+BVH<T>::BVH(const DArray<Point>& vertices, const DArray<std::uint32_t>& indices) { Build(vertices, indices); }
+
+template<typename T>
+void
+BVH<T>::Build(const DArray<Point>& vertices, const DArray<std::uint32_t>& indices)
+{
+   ASSERT(indices.size() % 3 == 0, "The number of triangle vertex indices ", indices.size(), " must be a multiple of three.")
+   ASSERT(indices.size() / 3 < std::numeric_limits<std::uint32_t>::max(), "The number of triangles ", indices.size() / 3, " exceeds the BVH limit.")
+
+   const size_t n = indices.size() / 3;
+   Vertices_.resize(vertices.size());
+   ParallelFor(vertices.size(), [&](const size_t i){ Vertices_[i] = ToCoordinates(vertices[i]); });
+
+   // Bound each triangle, where the centre of its box is taken as its centroid.
+   DArray<Reference> references;
+   references.resize(n);
+   ParallelFor(n, [&](const size_t t)
+   {
+      const Triangle triangle{indices[3 * t], indices[3 * t + 1], indices[3 * t + 2]};
+      FOR(k, 3) DEBUG_ASSERT(triangle[k] < vertices.size(), "The vertex index ", triangle[k], " of triangle ", t, " is out of range.")
+      references[t] = {TriangleBounds(triangle), static_cast<std::uint32_t>(t)};
+   });
+
+   Nodes_.clear();
+   LevelOffsets_.clear();
+   if(n)
+   {
+      // Split the nodes level by level, where the nodes of a level hold disjoint ranges of the triangles. Large nodes are split one at a time, each filling its
+      // bins in parallel, and the remaining nodes are split in parallel. The children of the split nodes then make up the next level.
+      struct Task
+      {
+         size_t Node;
+         size_t Begin;
+         size_t End;
+      };
+
+      std::vector<Task> tasks{{0, 0, n}};
+      std::vector<size_t> splits;
+      Nodes_.reserve(2 * n);
+      Nodes_.resize(1);
+      LevelOffsets_.push_back(0);
+      while(!tasks.empty())
+      {
+         const auto isLarge = [&](const Task& task){ return task.End - task.Begin >= BVHParallelNodeSize && isParallel(task.End - task.Begin); };
+         splits.resize(tasks.size());
+         FOR(i, tasks.size()) if(isLarge(tasks[i])) splits[i] = SplitNode(tasks[i].Node, tasks[i].Begin, tasks[i].End, references, true);
+         ParallelFor(tasks.size(), [&](const size_t i)
+         {
+            if(!isLarge(tasks[i])) splits[i] = SplitNode(tasks[i].Node, tasks[i].Begin, tasks[i].End, references, false);
+         }, n / tasks.size() + 1);
+
+         LevelOffsets_.push_back(Nodes_.size());
+         std::vector<Task> children;
+         FOR(i, tasks.size())
+         {
+            const auto [node, begin, end] = tasks[i];
+            if(splits[i] == end)
+            {
+               Nodes_[node].Index = static_cast<std::uint32_t>(begin);
+               Nodes_[node].Count = static_cast<std::uint32_t>(end - begin);
+               continue;
+            }
+            const size_t child = Nodes_.size();
+            Nodes_[node].Index = static_cast<std::uint32_t>(child);
+            Nodes_[node].Count = 0;
+            Nodes_.resize(child + 2);
+            children.push_back({child, begin, splits[i]});
+            children.push_back({child + 1, splits[i], end});
+         }
+         tasks = std::move(children);
+      }
+   }
+
+   // Store the triangles, and their vertex indices, in leaf order.
+   Triangles_.resize(n);
+   LeafTriangles_.resize(n);
+   ParallelFor(n, [&](const size_t i)
+   {
+      const size_t t = Triangles_[i] = references[i].Triangle;
+      LeafTriangles_[i] = {indices[3 * t], indices[3 * t + 1], indices[3 * t + 2]};
+   });
+}
+
+template<typename T>
+void
+BVH<T>::Refit(const DArray<Point>& vertices)
+{
+   ASSERT(vertices.size() == Vertices_.size(), "The number of vertices ", vertices.size(), " differs from the ", Vertices_.size(), " the BVH was built from.")
+
+   ParallelFor(vertices.size(), [&](const size_t i){ Vertices_[i] = ToCoordinates(vertices[i]); });
+
+   // Refit the levels bottom up, where the children of the nodes of a level are in the levels below it.
+   for(size_t level = LevelCount(); level-- > 0;)
+   {
+      const size_t first = LevelOffsets_[level];
+      const size_t count = LevelOffsets_[level + 1] - first;
+      ParallelFor(count, [&](const size_t i)
+      {
+         Node& node = Nodes_[first + i];
+         Box bounds;
+         if(node.Count) FOR(j, node.Index, node.Index + node.Count) bounds.Expand(TriangleBounds(LeafTriangles_[j]));
+         else
+         {
+            bounds = Nodes_[node.Index].Bounds;
+            bounds.Expand(Nodes_[node.Index + 1].Bounds);
+         }
+         node.Bounds = bounds;
+      }, size() / count + 1);
+   }
+}
+
+template<typename T>
+size_t
+BVH<T>::SplitNode(const size_t node, const size_t begin, const size_t end, DArray<Reference>& references, const bool is_parallel)
+{
+   // Reduce the triangles of the node in blocks, which are reduced in parallel if the node is large.
+   const size_t count = end - begin;
+   const size_t n_blocks = is_parallel ? 4 * nThreads() : 1;
+   const auto reduce = [&](const auto& identity, auto&& term, auto&& operation)
+   {
+      const auto block_term = [&](const size_t block)
+      {
+         auto result = identity;
+         FOR(i, begin + count * block / n_blocks, begin + count * (block + 1) / n_blocks) term(result, references[i]);
+         return result;
+      };
+      return is_parallel ? ParallelReduce(n_blocks, identity, block_term, operation, count / n_blocks) : block_term(0);
+   };
+
+   // Bound the node, and the centroids of its triangles.
+   const auto [node_bounds, centroid_bounds] = reduce(std::pair<Box, Box>{}, [](std::pair<Box, Box>& result, const Reference& reference)
+   {
+      result.first.Expand(reference.Bounds);
+      result.second.Expand(Coordinates{reference.Centroid(0), reference.Centroid(1), reference.Centroid(2)});
+   }, [](std::pair<Box, Box> a, const std::pair<Box, Box>& b)
+   {
+      a.first.Expand(b.first);
+      a.second.Expand(b.second);
+      return a;
+   });
+   Nodes_[node].Bounds = node_bounds;
+   if(count == 1) return end;
+
+   // Bin the centroids along each axis, where axes along which the centroids coincide are not binned.
+   Coordinates scales;
+   FOR(d, 3)
+   {
+      const T extent = centroid_bounds.Max[d] - centroid_bounds.Min[d];
+      scales[d] = extent > T{} ? static_cast<T>(BVHBinCount) / extent : T{};
+   }
+   const auto bin = [&](const Reference& reference, const size_t d)
+   {
+      return std::min(BVHBinCount - 1, static_cast<size_t>((reference.Centroid(d) - centroid_bounds.Min[d]) * scales[d]));
+   };
+   const Bins bins = reduce(Bins{}, [&](Bins& result, const Reference& reference)
+   {
+      FOR(d, 3) if(scales[d] > T{})
+      {
+         const size_t k = bin(reference, d);
+         ++result.Counts[d][k];
+         result.Bounds[d][k].Expand(reference.Bounds);
+      }
+   }, [](Bins a, const Bins& b)
+   {
+      FOR(d, 3) FOR(k, BVHBinCount)
+      {
+         a.Counts[d][k] += b.Counts[d][k];
+         a.Bounds[d][k].Expand(b.Bounds[d][k]);
+      }
+      return a;
+   });
+
+   // Evaluate the surface area heuristic at each bin boundary, sweeping the bins from the right, and then from the left.
+   T best_cost = InfFloat<T>;
+   size_t best_axis{}, best_bin{};
+   FOR(d, 3) if(scales[d] > T{})
+   {
+      std::array<T, BVHBinCount> right_costs{};
+      Box right;
+      size_t right_count{};
+      for(size_t k = BVHBinCount - 1; k > 0; --k)
+      {
+         if(bins.Counts[d][k])
+         {
+            right.Expand(bins.Bounds[d][k]);
+            right_count += bins.Counts[d][k];
+         }
+         if(right_count) right_costs[k] = right.HalfArea() * static_cast<T>(right_count);
+      }
+
+      // Splits at empty bins are skipped, as they cost the same as the split at the preceding non-empty bin.
+      Box left;
+      size_t left_count{};
+      FOR(k, 1, BVHBinCount)
+      {
+         if(!bins.Counts[d][k - 1]) continue;
+         left.Expand(bins.Bounds[d][k - 1]);
+         left_count += bins.Counts[d][k - 1];
+         if(left_count == count) break;
+
+         const T cost = left.HalfArea() * static_cast<T>(left_count) + right_costs[k];
+         if(cost < best_cost)
+         {
+            best_cost = cost;
+            best_axis = d;
+            best_bin  = k;
+         }
+      }
+   }
+
+   // Keep the node as a leaf if it is small, and splitting it costs a traversal step more than intersecting its triangles. Split nodes whose centroids all
+   // coincide at their median.
+   const T area = node_bounds.HalfArea();
+   if(count <= BVHLeafSize && (best_cost == InfFloat<T> || area + best_cost >= area * static_cast<T>(count))) return end;
+   if(best_cost == InfFloat<T>) return begin + count / 2;
+
+   const auto middle = std::partition(references.begin() + begin, references.begin() + end, [&](const Reference& reference)
+   {
+      return bin(reference, best_axis) < best_bin;
+   });
+   return static_cast<size_t>(middle - references.begin());
+}
+
+/***************************************************************************************************************************************************************
+* BVH Queries
+***************************************************************************************************************************************************************/
+template<typename T>
+Option<RayHit<T>>
+BVH<T>::Intersect(const Point& origin, const Point& direction, const T max_distance) const
+{
+   if(Nodes_.empty()) return {};
+
+   const Coordinates ray_origin    = ToCoordinates(origin);
+   const Coordinates ray_direction = ToCoordinates(direction);
+   Coordinates inverse_direction;
+   FOR(d, 3) inverse_direction[d] = T{1} / ray_direction[d];
+
+   // Visit the nodes nearest first, pruning those entered beyond the nearest hit so far.
+   Option<RayHit<T>> hit;
+   T distance = max_distance;
+   SmallArray<std::pair<std::uint32_t, T>, 64> stack;
+   const T root_entry = RayEntry(Nodes_[0].Bounds, ray_origin, inverse_direction, distance);
+   if(root_entry < InfFloat<T>) stack.push_back({0, root_entry});
+   while(!stack.empty())
+   {
+      const auto [index, entry] = stack.back();
+      stack.pop_back();
+      if(entry > distance) continue;
+
+      const Node& node = Nodes_[index];
+      if(node.Count)
+      {
+         FOR(j, node.Index, node.Index + node.Count)
+         {
+            const auto& [a, b, c] = LeafTriangles_[j];
+            if(const auto result = detail::IntersectTriangle(ray_origin, ray_direction, Vertices_[a], Vertices_[b], Vertices_[c], distance))
+            {
+               distance = (*result)[0];
+               hit = RayHit<T>{Triangles_[j], (*result)[0], (*result)[1], (*result)[2]};
+            }
+         }
+         continue;
+      }
+
+      const T left  = RayEntry(Nodes_[node.Index].Bounds, ray_origin, inverse_direction, distance);
+      const T right = RayEntry(Nodes_[node.Index + 1].Bounds, ray_origin, inverse_direction, distance);
+      const bool is_left_near = left <= right;
+      const std::pair<std::uint32_t, T> near{is_left_near ? node.Index : node.Index + 1, is_left_near ? left : right};
+      const std::pair<std::uint32_t, T> far{is_left_near ? node.Index + 1 : node.Index, is_left_near ? right : left};
+      if(far.second < InfFloat<T>) stack.push_back(far);
+      if(near.second < InfFloat<T>) stack.push_back(near);
+   }
+   return hit;
+}
+
+template<typename T>
+Option<ClosestPoint<T>>
+BVH<T>::Closest(const Point& query, const T max_distance) const
+{
+   if(Nodes_.empty()) return {};
+
+   // Visit the nodes nearest first, pruning those further than the closest point so far.
+   const Coordinates point = ToCoordinates(query);
+   Option<ClosestPoint<T>> closest;
+   T squared_distance = max_distance * max_distance;
+   SmallArray<std::pair<std::uint32_t, T>, 64> stack;
+   const T root_bound = SquaredDistance(Nodes_[0].Bounds, point);
+   if(root_bound <= squared_distance) stack.push_back({0, root_bound});
+   while(!stack.empty())
+   {
+      const auto [index, bound] = stack.back();
+      stack.pop_back();
+      if(bound > squared_distance) continue;
+
+      const Node& node = Nodes_[index];
+      if(node.Count)
+      {
+         FOR(j, node.Index, node.Index + node.Count)
+         {
+            const auto& [a, b, c] = LeafTriangles_[j];
+            const Coordinates candidate = detail::ClosestTrianglePoint(point, Vertices_[a], Vertices_[b], Vertices_[c]);
+            const auto difference = detail::Subtract3(candidate, point);
+            const T candidate_distance = detail::Dot3(difference, difference);
+            if(candidate_distance > squared_distance || (closest && candidate_distance == squared_distance)) continue;
+
+            squared_distance = candidate_distance;
+            closest = ClosestPoint<T>{Triangles_[j], Point{candidate[0], candidate[1], candidate[2]}, T{}};
+         }
+         continue;
+      }
+
+      const T left  = SquaredDistance(Nodes_[node.Index].Bounds, point);
+      const T right = SquaredDistance(Nodes_[node.Index + 1].Bounds, point);
+      const bool is_left_near = left <= right;
+      const std::pair<std::uint32_t, T> near{is_left_near ? node.Index : node.Index + 1, is_left_near ? left : right};
+      const std::pair<std::uint32_t, T> far{is_left_near ? node.Index + 1 : node.Index, is_left_near ? right : left};
+      if(far.second <= squared_distance) stack.push_back(far);
+      if(near.second <= squared_distance) stack.push_back(near);
+   }
+   if(closest) closest->Distance = std::sqrt(squared_distance);
+   return closest;
+}
+
+template<typename T>
+template<size_t N>
+DArray<size_t>
+BVH<T>::FrustumSearch(const std::array<Plane, N>& planes) const
+{
+   DArray<size_t> triangles;
+   if(Nodes_.empty()) return triangles;
+
+   // Visit the nodes with a flag of whether they are known to be inside the volume, in which case their descendants are not tested.
+   SmallArray<std::pair<std::uint32_t, bool>, 64> stack;
+   stack.push_back({0, false});
+   while(!stack.empty())
+   {
+      const auto [index, is_inside] = stack.back();
+      stack.pop_back();
+
+      const Node& node = Nodes_[index];
+      const int position = is_inside ? 1 : Classify(node.Bounds, planes);
+      if(position < 0) continue;
+
+      if(node.Count)
+      {
+         FOR(j, node.Index, node.Index + node.Count)
+            if(position > 0 || Classify(TriangleBounds(LeafTriangles_[j]), planes) >= 0) triangles.push_back(Triangles_[j]);
+         continue;
+      }
+      stack.push_back({node.Index + 1, position > 0});
+      stack.push_back({node.Index, position > 0});
+   }
+   return triangles;
+}
+
+/***************************************************************************************************************************************************************
+* BVH Geometry
+***************************************************************************************************************************************************************/
+template<typename T>
+void
+BVH<T>::Box::Expand(const Coordinates& point)
+{
+   FOR(d, 3)
+   {
+      Min[d] = std::min(Min[d], point[d]);
+      Max[d] = std::max(Max[d], point[d]);
+   }
+}
+
+template<typename T>
+void
+BVH<T>::Box::Expand(const Box& box)
+{
+   FOR(d, 3)
+   {
+      Min[d] = std::min(Min[d], box.Min[d]);
+      Max[d] = std::max(Max[d], box.Max[d]);
+   }
+}
+
+template<typename T>
+T
+BVH<T>::Box::HalfArea() const
+{
+   const Coordinates extent = detail::Subtract3(Max, Min);
+   return extent[0] * extent[1] + extent[1] * extent[2] + extent[2] * extent[0];
+}
+
+template<typename T>
+typename BVH<T>::Box
+BVH<T>::TriangleBounds(const Triangle& triangle) const
+{
+   Box box;
+   FOR(k, 3) box.Expand(Vertices_[triangle[k]]);
+   return box;
+}
+
+template<typename T>
+T
+BVH<T>::RayEntry(const Box& box, const Coordinates& origin, const Coordinates& inverse_direction, const T max_distance)
+{
+   T entry{}, exit = max_distance;
+   FOR(d, 3)
+   {
+      const T near = (box.Min[d] - origin[d]) * inverse_direction[d];
+      const T far  = (box.Max[d] - origin[d]) * inverse_direction[d];
+      entry = std::max(entry, std::min(near, far));
+      exit  = std::min(exit, std::max(near, far));
+   }
+   return entry <= exit ? entry : InfFloat<T>;
+}
+
+template<typename T>
+T
+BVH<T>::SquaredDistance(const Box& box, const Coordinates& point)
+{
+   T distance{};
+   FOR(d, 3)
+   {
+      const T excess = std::max({box.Min[d] - point[d], point[d] - box.Max[d], T{}});
+      distance += excess * excess;
+   }
+   return distance;
+}
+
+template<typename T>
+template<size_t N>
+int
+BVH<T>::Classify(const Box& box, const std::array<Plane, N>& planes)
+{
+   // Test the box corner furthest along the normal of each plane, which is outside only if the box is, and the nearest corner, which is inside only if the
+   // box is.
+   int position = 1;
+   FOR_EACH_CONST(plane, planes)
+   {
+      T furthest = plane[3], nearest = plane[3];
+      FOR(d, 3)
+      {
+         furthest += plane[d] * (plane[d] >= T{} ? box.Max[d] : box.Min[d]);
+         nearest  += plane[d] * (plane[d] >= T{} ? box.Min[d] : box.Max[d]);
+      }
+      if(furthest < T{}) return -1;
+      if(nearest < T{}) position = 0;
+   }
+   return position;
+}
+
+template<typename T>
+typename BVH<T>::Coordinates
+BVH<T>::ToCoordinates(const Point& point) { return {point[0], point[1], point[2]}; }
+
+}
@@ -17,35 +17,88 @@
 #include "../../../include/Global.h"
 #include "../../DataContainer/include/Array.h"
 
-#include <memory>
+#include <cstdint>
+#include <limits>
+#include <span>
 
 namespace aprn::graph {
 
-//template<template<class> class node_type, class T>
-//struct Edge
-//{
-//   SArray2<std::shared_ptr<node_type<T>>> Nodes;
-//};
-//
-//template<class T>
-//struct Node
-//{
-//   T Data;
-//   DynamicArray<std::shared_ptr<Node<T>>> Nodes;
-//   DynamicArray<std::shared_ptr<Edge<Node, T>>> Edges;
-//};
-//
-//template<template<class> class node_type, class T>
-//class Graph
-//{
-// public:
-//   Graph();
-//
-//   ~Graph();
-//
-// private:
-//   DynamicArray<node_type<T>> Nodes;
-//   DynamicArray<Edge<node_type, T>> Edges;
-//};
+/***************************************************************************************************************************************************************
+* Graph Vertices and Edges
+***************************************************************************************************************************************************************/
+
+/** Vertex of a graph, which is its index in [0, n), and the vertex of no vertex, e.g. the parent of an unreached vertex. */
+using Vertex = std::uint32_t;
+
+constexpr Vertex NullVertex = std::numeric_limits<Vertex>::max();
+
+/** Edge from a source to a target vertex, of unit weight unless given. */
+template<typename W = Real>
+struct Edge
+{
+   Vertex Source;
+   Vertex Target;
+   W      Weight{1};
+};
+
+/***************************************************************************************************************************************************************
+* Compressed Sparse Row Graph Class Definition
+***************************************************************************************************************************************************************/
+
+/** Static weighted graph in compressed sparse row format: the out-neighbours of vertex v are OutNeighbours(v), stored contiguously and sorted, with their
+ *  edge weights in OutWeights(v). Directed graphs also store their transpose, for traversals pulling from the in-neighbours, and undirected graphs store each
+ *  edge in both directions, so that their in-neighbours are their out-neighbours. */
+template<typename W = Real>
+class Graph
+{
+ public:
+   Graph() = default;
+
+   /** Build from a list of edges among the vertices [0, n), sorting the edges by source and target with a parallel argsort. Simple graphs drop self-loops and
+    *  keep one edge, of least weight, between each ordered pair of vertices. */
+   Graph(const size_t n_vertices, const DArray<Edge<W>>& edges, const bool is_directed = true, const bool is_simple = false);
+
+   /** Neighbours of a vertex, and the weights of the edges to the out-neighbours. */
+   inline std::span<const Vertex> OutNeighbours(const Vertex v) const { return {OutTargets_.data() + OutOffsets_[v], OutDegree(v)}; }
+
+   inline std::span<const W> OutWeights(const Vertex v) const { return {OutWeights_.data() + OutOffsets_[v], OutDegree(v)}; }
+
+   inline std::span<const Vertex> InNeighbours(const Vertex v) const
+   {
+      return isDirected_ ? std::span<const Vertex>(InSources_.data() + InOffsets_[v], InDegree(v)) : OutNeighbours(v);
+   }
+
+   inline size_t OutDegree(const Vertex v) const { return OutOffsets_[v + 1] - OutOffsets_[v]; }
+
+   inline size_t InDegree(const Vertex v) const { return isDirected_ ? InOffsets_[v + 1] - InOffsets_[v] : OutDegree(v); }
+
+   /** Number of vertices, and of stored edges, which count each undirected edge twice. */
+   inline size_t VertexCount() const { return OutOffsets_.size() - 1; }
+
+   inline size_t EdgeCount() const { return OutTargets_.size(); }
+
+   inline bool isDirected() const { return isDirected_; }
+
+ private:
+   DArray<size_t> OutOffsets_{0};
+   DArray<Vertex> OutTargets_;
+   DArray<W>      OutWeights_;
+   DArray<size_t> InOffsets_{0};
+   DArray<Vertex> InSources_;
+   bool           isDirected_{true};
+};
+
+/***************************************************************************************************************************************************************
+* Graph Generators
+***************************************************************************************************************************************************************/
+
+/** Edges of a recursive-matrix (R-MAT) graph on 2^scale vertices, with edge_factor edges per vertex, of unit weight. Each edge falls into the quadrants of the
+ *  adjacency matrix with probabilities a, b, c and 1 - a - b - c, recursively, which yields the skewed degrees of real-world graphs. The defaults are those of
+ *  Graph500, and the vertices are randomly relabelled, so that the high-degree vertices are not clustered. The edges only depend on the seed. */
+template<typename W = Real>
+DArray<Edge<W>> RMatEdges(const size_t scale, const size_t edge_factor = 16, const Real a = 0.57, const Real b = 0.19, const Real c = 0.19,
+                          const std::uint64_t seed = 0);
 
 }
+
+#include "Graph.tpp"
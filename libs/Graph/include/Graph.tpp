@@ -0,0 +1,179 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+#include "../../Sort/include/ParallelSort.h"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace aprn::graph {
+namespace detail {
+
+/***************************************************************************************************************************************************************
+* Graph Construction Helpers
+***************************************************************************************************************************************************************/
+
+/** Number of blocks into which the parallel graph kernels split their vertex or edge ranges, each block being processed by one thread. */
+inline size_t
+nGraphBlocks(const size_t n) { return isParallel(n) ? nThreads() : 1; }
+
+/** Arc from a row vertex to a column vertex, packed into a radix key ordered by row, and then by column. */
+inline std::uint64_t
+PackArc(const Vertex row, const Vertex column) { return std::uint64_t{row} << 32 | column; }
+
+inline Vertex
+ArcRow(const std::uint64_t arc) { return static_cast<Vertex>(arc >> 32); }
+
+inline Vertex
+ArcColumn(const std::uint64_t arc) { return static_cast<Vertex>(arc); }
+
+/** Compress packed arcs into sorted rows of the vertices [0, n): the columns of row v are adjacent[offsets[v] ... offsets[v + 1]). The arcs are radix sorted
+ *  in place, or argsorted if they carry weights, which follow them. Simple rows drop the diagonal, and keep one of the equal arcs, with their least weight. */
+template<typename W>
+void
+CompressRows(const size_t n, DArray<std::uint64_t>& arcs, const DArray<W>* weights, const bool is_simple, DArray<size_t>& offsets, DArray<Vertex>& adjacent,
+             DArray<W>* adjacent_weights)
+{
+   const size_t m = arcs.size();
+   DArray<size_t> permutation;
+   if(weights)
+   {
+      permutation = ArgSort<Par>(arcs);
+      DArray<std::uint64_t> sorted_arcs(m);
+      ParallelFor(m, [&](const size_t i){ sorted_arcs[i] = arcs[permutation[i]]; });
+      arcs = std::move(sorted_arcs);
+   }
+   else RadixSort<Par>(arcs.begin(), arcs.end());
+
+   const auto isKept = [&](const size_t i)
+   {
+      return !is_simple || (ArcRow(arcs[i]) != ArcColumn(arcs[i]) && (!i || arcs[i - 1] != arcs[i]));
+   };
+
+   // Count the kept arcs of each block of the sorted arcs, and then write them from the offset of their block.
+   const size_t n_blocks = nGraphBlocks(m);
+   const auto block_begin = [m, n_blocks](const size_t block){ return m * block / n_blocks; };
+   DArray<size_t> block_offsets(n_blocks + 1, 0);
+   ParallelFor(n_blocks, [&](const size_t block)
+   {
+      FOR(i, block_begin(block), block_begin(block + 1)) block_offsets[block + 1] += isKept(i);
+   }, m / n_blocks);
+   std::partial_sum(block_offsets.begin(), block_offsets.end(), block_offsets.begin());
+
+   const size_t n_kept = block_offsets[n_blocks];
+   DArray<Vertex> rows(n_kept);
+   adjacent.resize(n_kept);
+   if(weights) adjacent_weights->resize(n_kept);
+   ParallelFor(n_blocks, [&](const size_t block)
+   {
+      size_t k = block_offsets[block];
+      FOR(i, block_begin(block), block_begin(block + 1)) if(isKept(i))
+      {
+         rows[k]     = ArcRow(arcs[i]);
+         adjacent[k] = ArcColumn(arcs[i]);
+         if(weights)
+         {
+            W weight = (*weights)[permutation[i]];
+            if(is_simple) for(size_t j = i + 1; j < m && arcs[j] == arcs[i]; ++j) weight = std::min(weight, (*weights)[permutation[j]]);
+            (*adjacent_weights)[k] = weight;
+         }
+         ++k;
+      }
+   }, m / n_blocks);
+
+   offsets.resize(n + 1);
+   ParallelFor(n + 1, [&](const size_t v){ offsets[v] = static_cast<size_t>(std::lower_bound(rows.begin(), rows.end(), v) - rows.begin()); });
+}
+
+}//detail
+
+/***************************************************************************************************************************************************************
+* Compressed Sparse Row Graph Construction
+***************************************************************************************************************************************************************/
+template<typename W>
+Graph<W>::Graph(const size_t n_vertices, const DArray<Edge<W>>& edges, const bool is_directed, const bool is_simple)
+   : isDirected_(is_directed)
+{
+   ASSERT(n_vertices < NullVertex, "A graph holds fewer than ", NullVertex, " vertices.")
+
+   // Undirected edges are stored in both directions.
+   const size_t m = edges.size();
+   const size_t n_arcs = is_directed ? m : 2 * m;
+   DArray<std::uint64_t> arcs(n_arcs);
+   DArray<W> weights(n_arcs);
+   ParallelFor(m, [&](const size_t i)
+   {
+      const auto& edge = edges[i];
+      DEBUG_ASSERT(edge.Source < n_vertices && edge.Target < n_vertices, "The edge (", edge.Source, ", ", edge.Target, ") is out of range.")
+      arcs[i] = detail::PackArc(edge.Source, edge.Target);
+      weights[i] = edge.Weight;
+      if(is_directed) return;
+      arcs[m + i] = detail::PackArc(edge.Target, edge.Source);
+      weights[m + i] = edge.Weight;
+   });
+   detail::CompressRows(n_vertices, arcs, &weights, is_simple, OutOffsets_, OutTargets_, &OutWeights_);
+   if(!is_directed) return;
+
+   // The transpose of the compressed graph, which is simple if the graph is, and needs no weights.
+   arcs.resize(EdgeCount());
+   ParallelFor(n_vertices, [&](const size_t v)
+   {
+      FOR(i, OutOffsets_[v], OutOffsets_[v + 1]) arcs[i] = detail::PackArc(OutTargets_[i], static_cast<Vertex>(v));
+   }, EdgeCount() / (n_vertices + 1) + 1);
+   detail::CompressRows(n_vertices, arcs, static_cast<const DArray<W>*>(nullptr), false, InOffsets_, InSources_, static_cast<DArray<W>*>(nullptr));
+}
+
+/***************************************************************************************************************************************************************
+* Graph Generators
+***************************************************************************************************************************************************************/
+template<typename W>
+DArray<Edge<W>>
+RMatEdges(const size_t scale, const size_t edge_factor, const Real a, const Real b, const Real c, const std::uint64_t seed)
+{
+   ASSERT(scale < 32, "The scale ", scale, " of an R-MAT graph must be less than 32.")
+   ASSERT(a >= Zero && b >= Zero && c >= Zero && a + b + c <= One, "The R-MAT quadrant probabilities must be non-negative, with a sum of at most one.")
+
+   const size_t n = size_t{1} << scale;
+   const size_t m = n * edge_factor;
+   std::vector<Vertex> labels(n);
+   std::iota(labels.begin(), labels.end(), Vertex{});
+   std::shuffle(labels.begin(), labels.end(), std::mt19937_64(seed));
+
+   // Generate the edges in chunks, each from its own generator, so that they do not depend on the number of threads.
+   constexpr size_t chunk_size = size_t{1} << 16;
+   DArray<Edge<W>> edges;
+   edges.resize(m);
+   ParallelFor((m + chunk_size - 1) / chunk_size, [&](const size_t chunk)
+   {
+      std::mt19937_64 generator(seed + chunk + 1);
+      FOR(i, chunk * chunk_size, std::min(m, (chunk + 1) * chunk_size))
+      {
+         Vertex source{}, target{};
+         FOR(bit, scale)
+         {
+            const Real p = static_cast<Real>(generator() >> 11) * 0x1.0p-53;
+            source |= static_cast<Vertex>(p >= a + b) << bit;
+            target |= static_cast<Vertex>((p >= a && p < a + b) || p >= a + b + c) << bit;
+         }
+         edges[i] = {labels[source], labels[target], W{1}};
+      }
+   }, chunk_size * scale);
+   return edges;
+}
+
+}
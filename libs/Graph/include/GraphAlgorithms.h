@@ -0,0 +1,71 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+#include "../../../include/Global.h"
+#include "../../DataContainer/include/Array.h"
+#include "Graph.h"
+
+namespace aprn::graph {
+
+/***************************************************************************************************************************************************************
+* Breadth-first Search
+***************************************************************************************************************************************************************/
+
+/** Breadth-first search tree: the parent and depth of each vertex, which are the null vertex for unreached vertices. The source is its own parent. */
+struct BreadthFirstTree
+{
+   DArray<Vertex> Parents;
+   DArray<Vertex> Depths;
+};
+
+/** Direction-optimising parallel breadth-first search (Beamer et al.). Small frontiers push to their out-neighbours, claiming them by compare-and-swap, while
+ *  large frontiers are pulled from by the unreached vertices, each stopping at its first in-neighbour in the frontier. The search switches to pulling once the
+ *  out-edges of the frontier exceed 1 / alpha of the edges left to check, and back to pushing once the frontier shrinks below 1 / beta of the vertices. */
+template<typename W>
+BreadthFirstTree BreadthFirstSearch(const Graph<W>& graph, const Vertex source, const size_t alpha = 15, const size_t beta = 18);
+
+/***************************************************************************************************************************************************************
+* Shortest Paths
+***************************************************************************************************************************************************************/
+
+/** Distances from a source to each vertex, or the maximum of W for unreached vertices, by parallel delta-stepping (Meyer & Sanders), for non-negative weights.
+ *  The vertices are processed in buckets of distances of width delta, where the vertices of a bucket are relaxed in parallel until the bucket stays empty.
+ *  The default width is the mean edge weight. */
+template<typename W>
+DArray<W> ShortestPaths(const Graph<W>& graph, const Vertex source, W delta = W{});
+
+/***************************************************************************************************************************************************************
+* Connected Components
+***************************************************************************************************************************************************************/
+
+/** Label of the connected component of each vertex, ignoring edge directions, by the Afforest algorithm (Sutton et al.), a sampling variant of
+ *  Shiloach-Vishkin. Components are trees of labels linked by compare-and-swap and compressed in parallel. The first few neighbours of each vertex are linked
+ *  first, which already joins most of the largest component, whose vertices then skip their remaining neighbours. Each label is a vertex of its component. */
+template<typename W>
+DArray<Vertex> ConnectedComponents(const Graph<W>& graph, const size_t neighbour_rounds = 2);
+
+/***************************************************************************************************************************************************************
+* PageRank
+***************************************************************************************************************************************************************/
+
+/** PageRank of each vertex, ignoring the edge weights, by parallel power iterations pulling from the in-neighbours, until the L1 change in the ranks falls
+ *  below the tolerance. The ranks of dangling vertices, without out-edges, are spread over all vertices, so that the ranks sum to one. */
+template<typename W>
+DArray<Real> PageRank(const Graph<W>& graph, const Real damping = 0.85, const Real tolerance = 1.0e-4, const size_t max_iterations = 100);
+
+}
+
+#include "GraphAlgorithms.tpp"
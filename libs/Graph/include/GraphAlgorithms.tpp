@@ -0,0 +1,398 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace aprn::graph {
+namespace detail {
+
+/***************************************************************************************************************************************************************
+* Frontier Helpers
+***************************************************************************************************************************************************************/
+
+/** Concatenate the vertices gathered by each block. */
+inline void
+ConcatenateBlocks(const std::vector<std::vector<Vertex>>& blocks, std::vector<Vertex>& vertices)
+{
+   vertices.clear();
+   FOR_EACH_CONST(block, blocks) vertices.insert(vertices.end(), block.begin(), block.end());
+}
+
+/** Frontier as a queue of vertices, and as a map flagging each vertex in it. */
+inline void
+QueueToBitmap(const std::vector<Vertex>& queue, DArray<std::uint8_t>& bitmap)
+{
+   ParallelFor(bitmap.size(), [&](const size_t v){ bitmap[v] = 0; });
+   ParallelFor(queue.size(), [&](const size_t i){ bitmap[queue[i]] = 1; });
+}
+
+inline void
+BitmapToQueue(const DArray<std::uint8_t>& bitmap, std::vector<Vertex>& queue)
+{
+   const size_t n = bitmap.size();
+   const size_t n_blocks = nGraphBlocks(n);
+   std::vector<std::vector<Vertex>> blocks(n_blocks);
+   ParallelFor(n_blocks, [&](const size_t block)
+   {
+      FOR(v, n * block / n_blocks, n * (block + 1) / n_blocks) if(bitmap[v]) blocks[block].push_back(static_cast<Vertex>(v));
+   }, n / n_blocks);
+   ConcatenateBlocks(blocks, queue);
+}
+
+/***************************************************************************************************************************************************************
+* Breadth-first Search Steps
+***************************************************************************************************************************************************************/
+
+/** Push from each frontier vertex to its unreached out-neighbours, which are claimed by the first compare-and-swap of their parent. Returns the number of
+ *  out-edges of the next frontier. */
+template<typename W>
+size_t
+TopDownStep(const Graph<W>& graph, const std::vector<Vertex>& frontier, std::vector<Vertex>& next, BreadthFirstTree& tree, const Vertex depth,
+            const size_t frontier_edges)
+{
+   const size_t n = frontier.size();
+   const size_t n_blocks = nGraphBlocks(frontier_edges);
+   std::vector<std::vector<Vertex>> blocks(n_blocks);
+   DArray<size_t> next_edges(n_blocks, 0);
+   ParallelFor(n_blocks, [&](const size_t block)
+   {
+      FOR(i, n * block / n_blocks, n * (block + 1) / n_blocks)
+      {
+         const Vertex u = frontier[i];
+         for(const Vertex v : graph.OutNeighbours(u))
+         {
+            std::atomic_ref<Vertex> parent(tree.Parents[v]);
+            Vertex unreached = NullVertex;
+            if(parent.load(std::memory_order_relaxed) != NullVertex || !parent.compare_exchange_strong(unreached, u, std::memory_order_relaxed)) continue;
+
+            tree.Depths[v] = depth + 1;
+            blocks[block].push_back(v);
+            next_edges[block] += graph.OutDegree(v);
+         }
+      }
+   }, frontier_edges / n_blocks);
+   ConcatenateBlocks(blocks, next);
+   return std::accumulate(next_edges.begin(), next_edges.end(), size_t{});
+}
+
+/** Pull from the frontier to each unreached vertex, which stops at its first in-neighbour in the frontier. Each vertex is written by its own block only.
+ *  Returns the number of vertices reached. */
+template<typename W>
+size_t
+BottomUpStep(const Graph<W>& graph, const DArray<std::uint8_t>& frontier, DArray<std::uint8_t>& next, BreadthFirstTree& tree, const Vertex depth)
+{
+   const size_t n = graph.VertexCount();
+   const size_t n_blocks = nGraphBlocks(graph.EdgeCount());
+   DArray<size_t> reached(n_blocks, 0);
+   ParallelFor(n_blocks, [&](const size_t block)
+   {
+      FOR(v, n * block / n_blocks, n * (block + 1) / n_blocks)
+      {
+         next[v] = 0;
+         if(tree.Parents[v] != NullVertex) continue;
+
+         for(const Vertex u : graph.InNeighbours(static_cast<Vertex>(v))) if(frontier[u])
+         {
+            tree.Parents[v] = u;
+            tree.Depths[v] = depth + 1;
+            next[v] = 1;
+            ++reached[block];
+            break;
+         }
+      }
+   }, graph.EdgeCount() / n_blocks);
+   return std::accumulate(reached.begin(), reached.end(), size_t{});
+}
+
+/***************************************************************************************************************************************************************
+* Connected Component Helpers
+***************************************************************************************************************************************************************/
+
+/** Join the components of two vertices, by hooking the larger of their labels onto the smaller one. */
+inline void
+LinkComponents(const Vertex u, const Vertex v, DArray<Vertex>& labels)
+{
+   const auto label = [&](const Vertex w){ return std::atomic_ref<Vertex>(labels[w]).load(std::memory_order_relaxed); };
+   Vertex u_label = label(u);
+   Vertex v_label = label(v);
+   while(u_label != v_label)
+   {
+      const Vertex high = std::max(u_label, v_label);
+      const Vertex low  = std::min(u_label, v_label);
+      Vertex high_label = label(high);
+      if(high_label == low) break;
+      if(high_label == high && std::atomic_ref<Vertex>(labels[high]).compare_exchange_strong(high_label, low, std::memory_order_relaxed)) break;
+
+      u_label = label(label(high));
+      v_label = label(low);
+   }
+}
+
+/** Point each label directly at the root of its tree. */
+inline void
+CompressComponents(DArray<Vertex>& labels)
+{
+   ParallelFor(labels.size(), [&](const size_t v)
+   {
+      std::atomic_ref<Vertex> label(labels[v]);
+      Vertex root = label.load(std::memory_order_relaxed);
+      for(Vertex parent; root != (parent = std::atomic_ref<Vertex>(labels[root]).load(std::memory_order_relaxed));) root = parent;
+      label.store(root, std::memory_order_relaxed);
+   });
+}
+
+/** Most frequent label of a fixed random sample of vertices, which is likely the label of the largest component. */
+inline Vertex
+FrequentLabel(const DArray<Vertex>& labels, const size_t n_samples = 1024)
+{
+   std::mt19937 generator(0);
+   std::uniform_int_distribution<size_t> distribution(0, labels.size() - 1);
+   std::vector<Vertex> samples(n_samples);
+   FOR_EACH(sample, samples) sample = labels[distribution(generator)];
+   std::sort(samples.begin(), samples.end());
+
+   Vertex label = samples[0];
+   size_t count{}, max_count{};
+   FOR(i, n_samples)
+   {
+      count = i && samples[i] == samples[i - 1] ? count + 1 : 1;
+      if(count > max_count)
+      {
+         max_count = count;
+         label = samples[i];
+      }
+   }
+   return label;
+}
+
+}//detail
+
+/***************************************************************************************************************************************************************
+* Breadth-first Search
+***************************************************************************************************************************************************************/
+template<typename W>
+BreadthFirstTree
+BreadthFirstSearch(const Graph<W>& graph, const Vertex source, const size_t alpha, const size_t beta)
+{
+   const size_t n = graph.VertexCount();
+   ASSERT(source < n, "The source ", source, " is not a vertex of the graph.")
+
+   BreadthFirstTree tree{DArray<Vertex>(n, NullVertex), DArray<Vertex>(n, NullVertex)};
+   tree.Parents[source] = source;
+   tree.Depths[source] = 0;
+
+   std::vector<Vertex> frontier{source}, next;
+   DArray<std::uint8_t> bitmap, next_bitmap;
+   size_t edges_to_check = graph.EdgeCount();
+   size_t frontier_edges = graph.OutDegree(source);
+   Vertex depth{};
+   while(!frontier.empty())
+   {
+      if(frontier_edges > edges_to_check / alpha)
+      {
+         // Pull while the frontier grows, or stays large.
+         bitmap.resize(n);
+         next_bitmap.resize(n);
+         detail::QueueToBitmap(frontier, bitmap);
+         size_t reached = frontier.size(), previous;
+         do
+         {
+            previous = reached;
+            reached = detail::BottomUpStep(graph, bitmap, next_bitmap, tree, depth++);
+            std::swap(bitmap, next_bitmap);
+         }
+         while(reached >= previous || reached > n / beta);
+         detail::BitmapToQueue(bitmap, frontier);
+         frontier_edges = 1;
+      }
+      else
+      {
+         edges_to_check -= frontier_edges;
+         frontier_edges = detail::TopDownStep(graph, frontier, next, tree, depth++, frontier_edges);
+         std::swap(frontier, next);
+      }
+   }
+   return tree;
+}
+
+/***************************************************************************************************************************************************************
+* Shortest Paths
+***************************************************************************************************************************************************************/
+template<typename W>
+DArray<W>
+ShortestPaths(const Graph<W>& graph, const Vertex source, W delta)
+{
+   const size_t n = graph.VertexCount();
+   const size_t m = graph.EdgeCount();
+   ASSERT(source < n, "The source ", source, " is not a vertex of the graph.")
+
+   if(!(delta > W{}))
+   {
+      const W total = ParallelReduce(n, W{}, [&](const size_t v)
+      {
+         const auto weights = graph.OutWeights(static_cast<Vertex>(v));
+         return std::accumulate(weights.begin(), weights.end(), W{});
+      }, std::plus<>(), m / n + 1);
+      delta = m && total > W{} ? total / static_cast<W>(m) : W{1};
+      if constexpr(std::integral<W>) delta = Max(delta, W{1});
+   }
+
+   DArray<W> distances(n, std::numeric_limits<W>::max());
+   distances[source] = W{};
+
+   // Each block gathers the vertices whose distance it lowers into its own bins, one per bucket, from which the next frontier is collected.
+   const size_t max_blocks = nThreads();
+   std::vector<std::vector<std::vector<Vertex>>> bins(max_blocks);
+   std::vector<Vertex> frontier{source};
+   size_t bucket{};
+   while(true)
+   {
+      const size_t size = frontier.size();
+      const size_t cost = size * (m / n + 1);
+      const size_t n_blocks = std::min(detail::nGraphBlocks(cost), max_blocks);
+      ParallelFor(n_blocks, [&](const size_t block)
+      {
+         auto& block_bins = bins[block];
+         FOR(i, size * block / n_blocks, size * (block + 1) / n_blocks)
+         {
+            // Skip the vertices settled in an earlier bucket, after they were added to this one.
+            const Vertex u = frontier[i];
+            const W u_distance = std::atomic_ref<W>(distances[u]).load(std::memory_order_relaxed);
+            if(u_distance < delta * static_cast<W>(bucket)) continue;
+
+            const auto neighbours = graph.OutNeighbours(u);
+            const auto weights = graph.OutWeights(u);
+            FOR(j, neighbours.size())
+            {
+               const W distance = u_distance + weights[j];
+               std::atomic_ref<W> v_distance(distances[neighbours[j]]);
+               W old_distance = v_distance.load(std::memory_order_relaxed);
+               while(distance < old_distance)
+               {
+                  if(!v_distance.compare_exchange_weak(old_distance, distance, std::memory_order_relaxed)) continue;
+
+                  const auto distance_bucket = static_cast<size_t>(distance / delta);
+                  if(block_bins.size() <= distance_bucket) block_bins.resize(distance_bucket + 1);
+                  block_bins[distance_bucket].push_back(neighbours[j]);
+                  break;
+               }
+            }
+         }
+      }, cost / n_blocks);
+
+      // Move on to the first non-empty bucket, which may be the current one.
+      size_t next_bucket = std::numeric_limits<size_t>::max();
+      FOR_EACH_CONST(block_bins, bins) FOR(b, bucket, std::min(block_bins.size(), next_bucket)) if(!block_bins[b].empty())
+      {
+         next_bucket = b;
+         break;
+      }
+      if(next_bucket == std::numeric_limits<size_t>::max()) break;
+
+      bucket = next_bucket;
+      frontier.clear();
+      FOR_EACH(block_bins, bins) if(bucket < block_bins.size())
+      {
+         frontier.insert(frontier.end(), block_bins[bucket].begin(), block_bins[bucket].end());
+         block_bins[bucket].clear();
+      }
+   }
+   return distances;
+}
+
+/***************************************************************************************************************************************************************
+* Connected Components
+***************************************************************************************************************************************************************/
+template<typename W>
+DArray<Vertex>
+ConnectedComponents(const Graph<W>& graph, const size_t neighbour_rounds)
+{
+   const size_t n = graph.VertexCount();
+   DArray<Vertex> labels(n);
+   std::iota(labels.begin(), labels.end(), Vertex{});
+   if(!n) return labels;
+
+   const size_t cost = graph.EdgeCount() / n + 1;
+   FOR(round, neighbour_rounds)
+   {
+      ParallelFor(n, [&](const size_t v)
+      {
+         const auto neighbours = graph.OutNeighbours(static_cast<Vertex>(v));
+         if(round < neighbours.size()) detail::LinkComponents(static_cast<Vertex>(v), neighbours[round], labels);
+      });
+      detail::CompressComponents(labels);
+   }
+
+   // Link the remaining neighbours of the vertices outside the largest component, and all in-neighbours of directed graphs, which covers each edge into or
+   // out of the vertices outside the largest component.
+   const Vertex largest = detail::FrequentLabel(labels);
+   ParallelFor(n, [&](const size_t v)
+   {
+      if(std::atomic_ref<Vertex>(labels[v]).load(std::memory_order_relaxed) == largest) return;
+
+      const auto vertex = static_cast<Vertex>(v);
+      const auto neighbours = graph.OutNeighbours(vertex);
+      FOR(j, neighbour_rounds, neighbours.size()) detail::LinkComponents(vertex, neighbours[j], labels);
+      if(graph.isDirected()) for(const Vertex u : graph.InNeighbours(vertex)) detail::LinkComponents(vertex, u, labels);
+   }, cost);
+   detail::CompressComponents(labels);
+   return labels;
+}
+
+/***************************************************************************************************************************************************************
+* PageRank
+***************************************************************************************************************************************************************/
+template<typename W>
+DArray<Real>
+PageRank(const Graph<W>& graph, const Real damping, const Real tolerance, const size_t max_iterations)
+{
+   const size_t n = graph.VertexCount();
+   if(!n) return {};
+
+   const auto size = static_cast<Real>(n);
+   DArray<Real> ranks(n, One / size), next_ranks(n), contributions(n);
+   const size_t cost = graph.EdgeCount() / n + 1;
+   FOR(iteration, max_iterations)
+   {
+      const Real dangling = ParallelReduce(n, Zero, [&](const size_t v){ return graph.OutDegree(static_cast<Vertex>(v)) ? Zero : ranks[v]; }, std::plus<>());
+      ParallelFor(n, [&](const size_t v)
+      {
+         const size_t degree = graph.OutDegree(static_cast<Vertex>(v));
+         contributions[v] = degree ? ranks[v] / static_cast<Real>(degree) : Zero;
+      });
+
+      const Real base = (One - damping + damping * dangling) / size;
+      ParallelFor(n, [&](const size_t v)
+      {
+         Real sum{};
+         for(const Vertex u : graph.InNeighbours(static_cast<Vertex>(v))) sum += contributions[u];
+         next_ranks[v] = base + damping * sum;
+      }, cost);
+
+      const Real change = ParallelReduce(n, Zero, [&](const size_t v){ return std::abs(next_ranks[v] - ranks[v]); }, std::plus<>());
+      std::swap(ranks, next_ranks);
+      if(change < tolerance) break;
+   }
+   return ranks;
+}
+
+}
@@ -14,6 +14,119 @@
 
 #pragma once
 
-namespace aprn {
+#include "../../../include/Global.h"
+#include "../../DataContainer/include/Allocator.h"
+#include "../../DataContainer/include/Array.h"
+#include "../../LinearAlgebra/include/Vector.h"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace aprn::graph {
+
+/** Maximum number of points in a leaf bucket of a KD-tree. */
+constexpr size_t KDTreeLeafSize = 16;
+
+/***************************************************************************************************************************************************************
+* KD-tree Class Definition
+***************************************************************************************************************************************************************/
+
+/** Static KD-tree over D-dimensional points, for nearest neighbour, radius and box queries. The tree is a complete binary tree in an implicit array layout:
+ *  node i has children 2i + 1 and 2i + 2, and only the split dimension and value of each internal node are stored. Each node splits its points in half at the
+ *  median of its widest dimension, so that the leaves hold at most KDTreeLeafSize points. The points are copied in leaf order into one coordinate array per
+ *  dimension, so that the leaf buckets are scanned with SIMD loops. Queries return the indices of the points in the array the tree was built from. */
+template<size_t D, typename T = Real>
+class KDTree
+{
+   static_assert(D > 0 && D <= 255, "The dimension must be in [1, 255].");
+
+ public:
+   using Point = SVector<T, D>;
+
+   KDTree() = default;
+
+   explicit KDTree(const DArray<Point>& points);
+
+   /** Build the tree, in O(n log n) time, splitting the nodes of each level in parallel. */
+   void Build(const DArray<Point>& points);
+
+   /** Index of the nearest point to a query point. The tree must not be empty. */
+   size_t Nearest(const Point& query) const;
+
+   /** Indices of the k nearest points to a query point, nearest first, or of all the points if there are fewer than k. */
+   DArray<size_t> NearestNeighbours(const Point& query, const size_t k) const;
+
+   /** Indices of the points within a radius of a query point, inclusive, in no particular order. */
+   DArray<size_t> RadiusSearch(const Point& query, const T radius) const;
+
+   /** Indices of the points in a closed axis-aligned box, in no particular order. */
+   DArray<size_t> BoxSearch(const Point& min, const Point& max) const;
+
+   /** Batched queries, run in parallel over the queries. The nearest neighbours of the i-th query are stored from entry i * min(k, size()) on. */
+   DArray<size_t> Nearest(const DArray<Point>& queries) const;
+
+   DArray<size_t> NearestNeighbours(const DArray<Point>& queries, const size_t k) const;
+
+   DArray<DArray<size_t>> RadiusSearch(const DArray<Point>& queries, const T radius) const;
+
+   DArray<DArray<size_t>> BoxSearch(const DArray<Point>& mins, const DArray<Point>& maxs) const;
+
+   /** Number of points, and depth of the tree, whose leaves are at the given depth. */
+   inline size_t size() const { return Indices_.size(); }
+
+   inline size_t Depth() const { return Depth_; }
+
+ private:
+   using Coordinates = std::array<T, D>;
+
+   /** Candidate neighbour, ordered by distance, and then by index to break ties. */
+   struct Neighbour
+   {
+      T      SquaredDistance;
+      size_t Index;
+
+      bool operator<(const Neighbour& other) const
+      {
+         return SquaredDistance < other.SquaredDistance || (SquaredDistance == other.SquaredDistance && Index < other.Index);
+      }
+   };
+
+   /** Node to visit, and a lower bound on the squared distance from the query to its points. */
+   struct NodeBound
+   {
+      size_t Node;
+      T      Bound;
+   };
+
+   /** Search the k nearest neighbours, leaving them in a max-heap. */
+   void SearchNearest(const Coordinates& query, const size_t k, std::vector<Neighbour>& heap) const;
+
+   void SearchRadius(const Coordinates& query, const T squared_radius, DArray<size_t>& indices) const;
+
+   void SearchBox(const Coordinates& min, const Coordinates& max, DArray<size_t>& indices) const;
+
+   /** Squared distances from a query to the points of a leaf. */
+   void LeafDistances(const size_t leaf, const Coordinates& query, T* distances) const;
+
+   inline size_t LeafCount() const { return size_t{1} << Depth_; }
+
+   inline bool isLeaf(const size_t node) const { return node >= LeafCount() - 1; }
+
+   static Coordinates ToCoordinates(const Point& point);
+
+   size_t                             Depth_{};
+   DArray<T>                          SplitValues_;
+   DArray<std::uint8_t>               SplitDimensions_;
+   DArray<size_t>                     LeafOffsets_{0, 0};
+   std::array<AlignedDArray<T>, D>    Coordinates_;
+   DArray<size_t>                     Indices_;
+};
+
+template<size_t D> using KDTreeR = KDTree<D, Real>;
+using KDTreeR2 = KDTreeR<2>;
+using KDTreeR3 = KDTreeR<3>;
 
 }
+
+#include "KDTree.tpp"
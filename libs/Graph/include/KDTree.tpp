@@ -0,0 +1,338 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <utility>
+
+namespace aprn::graph {
+
+/***************************************************************************************************************************************************************
+* KD-tree Construction
+***************************************************************************************************************************************************************/
+template<size_t D, typename T>
+KDTree<D, T>::KDTree(const DArray<Point>& points) { Build(points); }
+
+template<size_t D, typename T>
+void
+KDTree<D, T>::Build(const DArray<Point>& points)
+{
+   struct Entry
+   {
+      Coordinates Point;
+      size_t      Index;
+   };
+
+   const size_t n = points.size();
+   std::vector<Entry> entries(n);
+   ParallelFor(n, [&](const size_t i){ entries[i] = {ToCoordinates(points[i]), i}; });
+
+   // Pick the shallowest depth at which the halved ranges fit into the leaf buckets.
+   Depth_ = 0;
+   while(n && ((n - 1) >> Depth_) + 1 > KDTreeLeafSize) ++Depth_;
+   const size_t n_leaves = LeafCount();
+   SplitValues_.resize(n_leaves - 1);
+   SplitDimensions_.resize(n_leaves - 1);
+
+   // Split the nodes level by level, where the nodes of a level hold disjoint ranges, and are split in parallel. Node i holds [begins[i], ends[i]).
+   std::vector<size_t> begins(2 * n_leaves - 1), ends(2 * n_leaves - 1);
+   begins[0] = 0;
+   ends[0] = n;
+   FOR(level, Depth_)
+   {
+      const size_t first = (size_t{1} << level) - 1;
+      ParallelFor(size_t{1} << level, [&](const size_t i)
+      {
+         const size_t node  = first + i;
+         const size_t begin = begins[node];
+         const size_t end   = ends[node];
+         const size_t mid   = begin + (end - begin) / 2;
+
+         Coordinates min = entries[begin].Point;
+         Coordinates max = min;
+         FOR(j, begin + 1, end) FOR(d, D)
+         {
+            min[d] = std::min(min[d], entries[j].Point[d]);
+            max[d] = std::max(max[d], entries[j].Point[d]);
+         }
+         size_t dim{};
+         FOR(d, 1, D) if(max[d] - min[d] > max[dim] - min[dim]) dim = d;
+
+         std::nth_element(entries.begin() + begin, entries.begin() + mid, entries.begin() + end,
+                          [dim](const Entry& a, const Entry& b){ return a.Point[dim] < b.Point[dim]; });
+         SplitDimensions_[node] = static_cast<std::uint8_t>(dim);
+         SplitValues_[node] = entries[mid].Point[dim];
+
+         begins[2 * node + 1] = begin;
+         ends[2 * node + 1]   = mid;
+         begins[2 * node + 2] = mid;
+         ends[2 * node + 2]   = end;
+      }, n >> level);
+   }
+
+   // Store the leaf ranges, and the points in leaf order, one coordinate array per dimension.
+   LeafOffsets_.resize(n_leaves + 1);
+   FOR(i, n_leaves) LeafOffsets_[i] = begins[n_leaves - 1 + i];
+   LeafOffsets_[n_leaves] = n;
+   FOR(d, D) Coordinates_[d].resize(n);
+   Indices_.resize(n);
+   ParallelFor(n, [&](const size_t i)
+   {
+      FOR(d, D) Coordinates_[d][i] = entries[i].Point[d];
+      Indices_[i] = entries[i].Index;
+   }, D);
+}
+
+/***************************************************************************************************************************************************************
+* KD-tree Queries
+***************************************************************************************************************************************************************/
+template<size_t D, typename T>
+size_t
+KDTree<D, T>::Nearest(const Point& query) const
+{
+   ASSERT(size(), "Cannot find the nearest point in an empty KD-tree.")
+
+   std::vector<Neighbour> heap;
+   SearchNearest(ToCoordinates(query), 1, heap);
+   return heap.front().Index;
+}
+
+template<size_t D, typename T>
+DArray<size_t>
+KDTree<D, T>::NearestNeighbours(const Point& query, const size_t k) const
+{
+   std::vector<Neighbour> heap;
+   SearchNearest(ToCoordinates(query), k, heap);
+   std::sort_heap(heap.begin(), heap.end());
+
+   DArray<size_t> indices(heap.size());
+   FOR(i, heap.size()) indices[i] = heap[i].Index;
+   return indices;
+}
+
+template<size_t D, typename T>
+DArray<size_t>
+KDTree<D, T>::RadiusSearch(const Point& query, const T radius) const
+{
+   DArray<size_t> indices;
+   SearchRadius(ToCoordinates(query), radius * radius, indices);
+   return indices;
+}
+
+template<size_t D, typename T>
+DArray<size_t>
+KDTree<D, T>::BoxSearch(const Point& min, const Point& max) const
+{
+   DArray<size_t> indices;
+   SearchBox(ToCoordinates(min), ToCoordinates(max), indices);
+   return indices;
+}
+
+/***************************************************************************************************************************************************************
+* KD-tree Batched Queries
+***************************************************************************************************************************************************************/
+template<size_t D, typename T>
+DArray<size_t>
+KDTree<D, T>::Nearest(const DArray<Point>& queries) const { return NearestNeighbours(queries, 1); }
+
+template<size_t D, typename T>
+DArray<size_t>
+KDTree<D, T>::NearestNeighbours(const DArray<Point>& queries, const size_t k) const
+{
+   const size_t n_neighbours = std::min(k, size());
+   DArray<size_t> indices(queries.size() * n_neighbours);
+   ParallelFor(queries.size(), [&](const size_t i)
+   {
+      std::vector<Neighbour> heap;
+      SearchNearest(ToCoordinates(queries[i]), n_neighbours, heap);
+      std::sort_heap(heap.begin(), heap.end());
+      FOR(j, n_neighbours) indices[i * n_neighbours + j] = heap[j].Index;
+   }, (Depth_ + 1) * KDTreeLeafSize);
+   return indices;
+}
+
+template<size_t D, typename T>
+DArray<DArray<size_t>>
+KDTree<D, T>::RadiusSearch(const DArray<Point>& queries, const T radius) const
+{
+   DArray<DArray<size_t>> indices;
+   indices.resize(queries.size());
+   ParallelFor(queries.size(), [&](const size_t i){ SearchRadius(ToCoordinates(queries[i]), radius * radius, indices[i]); }, (Depth_ + 1) * KDTreeLeafSize);
+   return indices;
+}
+
+template<size_t D, typename T>
+DArray<DArray<size_t>>
+KDTree<D, T>::BoxSearch(const DArray<Point>& mins, const DArray<Point>& maxs) const
+{
+   ASSERT(mins.size() == maxs.size(), "The numbers of box minima ", mins.size(), " and maxima ", maxs.size(), " must be equal.")
+
+   DArray<DArray<size_t>> indices;
+   indices.resize(mins.size());
+   ParallelFor(mins.size(), [&](const size_t i){ SearchBox(ToCoordinates(mins[i]), ToCoordinates(maxs[i]), indices[i]); }, (Depth_ + 1) * KDTreeLeafSize);
+   return indices;
+}
+
+/***************************************************************************************************************************************************************
+* KD-tree Traversals
+***************************************************************************************************************************************************************/
+
+// The traversals keep the nodes to visit on a stack, on which each visit replaces a node by at most two children, so that it never holds more than one node
+// per level. Nearest neighbour and radius searches visit the child on the side of the query first, and bound the distance to the other child by the distance
+// to the split plane, or by the bound of the parent if it is larger.
+template<size_t D, typename T>
+void
+KDTree<D, T>::SearchNearest(const Coordinates& query, const size_t k, std::vector<Neighbour>& heap) const
+{
+   heap.clear();
+   if(!k) return;
+   heap.reserve(k);
+
+   std::array<NodeBound, 65> stack;
+   std::array<T, KDTreeLeafSize> distances;
+   size_t top{1};
+   stack[0] = {0, T{}};
+   while(top)
+   {
+      const auto [node, bound] = stack[--top];
+      if(heap.size() == k && bound > heap.front().SquaredDistance) continue;
+
+      if(isLeaf(node))
+      {
+         const size_t leaf  = node + 1 - LeafCount();
+         const size_t begin = LeafOffsets_[leaf];
+         LeafDistances(leaf, query, distances.data());
+         FOR(i, LeafOffsets_[leaf + 1] - begin)
+         {
+            const Neighbour candidate{distances[i], Indices_[begin + i]};
+            if(heap.size() < k)
+            {
+               heap.push_back(candidate);
+               std::push_heap(heap.begin(), heap.end());
+            }
+            else if(candidate < heap.front())
+            {
+               std::pop_heap(heap.begin(), heap.end());
+               heap.back() = candidate;
+               std::push_heap(heap.begin(), heap.end());
+            }
+         }
+         continue;
+      }
+      const T offset = query[SplitDimensions_[node]] - SplitValues_[node];
+      const size_t near = 2 * node + 1 + (offset >= T{});
+      stack[top++] = {4 * node + 3 - near, std::max(bound, offset * offset)};
+      stack[top++] = {near, bound};
+   }
+}
+
+template<size_t D, typename T>
+void
+KDTree<D, T>::SearchRadius(const Coordinates& query, const T squared_radius, DArray<size_t>& indices) const
+{
+   indices.clear();
+   std::array<NodeBound, 65> stack;
+   std::array<T, KDTreeLeafSize> distances;
+   size_t top{1};
+   stack[0] = {0, T{}};
+   while(top)
+   {
+      const auto [node, bound] = stack[--top];
+      if(bound > squared_radius) continue;
+
+      if(isLeaf(node))
+      {
+         const size_t leaf  = node + 1 - LeafCount();
+         const size_t begin = LeafOffsets_[leaf];
+         LeafDistances(leaf, query, distances.data());
+         FOR(i, LeafOffsets_[leaf + 1] - begin) if(distances[i] <= squared_radius) indices.push_back(Indices_[begin + i]);
+         continue;
+      }
+      const T offset = query[SplitDimensions_[node]] - SplitValues_[node];
+      const size_t near = 2 * node + 1 + (offset >= T{});
+      stack[top++] = {4 * node + 3 - near, std::max(bound, offset * offset)};
+      stack[top++] = {near, bound};
+   }
+}
+
+template<size_t D, typename T>
+void
+KDTree<D, T>::SearchBox(const Coordinates& min, const Coordinates& max, DArray<size_t>& indices) const
+{
+   indices.clear();
+   std::array<size_t, 65> stack;
+   std::array<bool, KDTreeLeafSize> inside;
+   size_t top{1};
+   stack[0] = 0;
+   while(top)
+   {
+      const size_t node = stack[--top];
+      if(isLeaf(node))
+      {
+         const size_t leaf  = node + 1 - LeafCount();
+         const size_t begin = LeafOffsets_[leaf];
+         const size_t count = LeafOffsets_[leaf + 1] - begin;
+         std::fill_n(inside.begin(), count, true);
+         FOR(d, D)
+         {
+            const T* x = Coordinates_[d].data() + begin;
+            const T lower = min[d];
+            const T upper = max[d];
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+            for(size_t i = 0; i < count; ++i) inside[i] &= lower <= x[i] && x[i] <= upper;
+         }
+         FOR(i, count) if(inside[i]) indices.push_back(Indices_[begin + i]);
+         continue;
+      }
+      const size_t dim = SplitDimensions_[node];
+      if(max[dim] >= SplitValues_[node]) stack[top++] = 2 * node + 2;
+      if(min[dim] <= SplitValues_[node]) stack[top++] = 2 * node + 1;
+   }
+}
+
+template<size_t D, typename T>
+void
+KDTree<D, T>::LeafDistances(const size_t leaf, const Coordinates& query, T* distances) const
+{
+   const size_t begin = LeafOffsets_[leaf];
+   const size_t count = LeafOffsets_[leaf + 1] - begin;
+   std::fill_n(distances, count, T{});
+   FOR(d, D)
+   {
+      const T* x = Coordinates_[d].data() + begin;
+      const T q = query[d];
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+      for(size_t i = 0; i < count; ++i)
+      {
+         const T offset = x[i] - q;
+         distances[i] += offset * offset;
+      }
+   }
+}
+
+template<size_t D, typename T>
+typename KDTree<D, T>::Coordinates
+KDTree<D, T>::ToCoordinates(const Point& point)
+{
+   Coordinates coordinates;
+   FOR(d, D) coordinates[d] = point[d];
+   return coordinates;
+}
+
+}
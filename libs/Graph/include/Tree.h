@@ -16,8 +16,12 @@
 
 #include "../../../include/Global.h"
 #include "../../DataContainer/include/Array.h"
+#include "../../DataContainer/include/SmallArray.h"
 
-#include <memory>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <vector>
 
 namespace aprn::graph {
 
@@ -25,38 +29,165 @@ namespace aprn::graph {
 * Generic Tree Node Class Definitions
 ***************************************************************************************************************************************************************/
 
-/** Node abstract base class */
+/** Handle of a node, which is its index in the node arena of its tree, and the handle of no node. */
+using NodeHandle = std::uint32_t;
+
+constexpr NodeHandle NullNode = std::numeric_limits<NodeHandle>::max();
+
+/** Node base class */
 template<class T>
 struct Node
 {
    T Data;
-   size_t Depth;
-   std::shared_ptr<Node<T>> Parent;
+   std::uint32_t Depth;
+   NodeHandle Parent;
 
  protected:
    Node() = default;
 };
 
-/** Static node class (known number of children) */
+/** Static node class (known number of children, some of which may be null) */
 template<class T, size_t N>
-struct StaticNode final : public Node<T> { StaticArray<std::shared_ptr<Node<T>>, N> Children; };
+struct StaticNode final : public Node<T> { StaticArray<NodeHandle, N> Children; };
 
-/** Dynamic node class (unknown number of children) */
+/** Dynamic node class (unknown number of children, stored inline up to a typical branching factor) */
 template<class T>
-struct DynamicNode final : public Node<T> { DynamicArray<std::shared_ptr<Node<T>>> Children; };
+struct DynamicNode final : public Node<T> { SmallArray<NodeHandle, 4> Children; };
 
 /***************************************************************************************************************************************************************
 * Generic Tree Class Definition
 ***************************************************************************************************************************************************************/
-template<class T>
+
+/** Tree of nodes stored contiguously in an arena, and referring to each other by 32-bit handles, so that there is one allocation per growth of the arena
+ *  rather than per node, and no reference counting. Removed nodes are recycled through a free list. Nodes added in depth-first order are traversed in memory
+ *  order, and any tree is rearranged so by Compact(). */
+template<class T, class N = DynamicNode<T>>
 class Tree
 {
  public:
+   class DepthFirstIterator;
+   class BreadthFirstIterator;
+
+   /** Range of the nodes of a subtree, in a given traversal order. */
+   template<class It>
+   struct Traversal
+   {
+      It first;
+
+      It begin() const { return first; }
+
+      std::default_sentinel_t end() const { return {}; }
+   };
+
    Tree() = default;
 
+   /** Add the root, which must not exist yet. */
+   NodeHandle AddRoot(const T& data);
+
+   /** Add a child to a node, after its last child, or in its first null slot for static nodes, or in a given slot. */
+   NodeHandle AddChild(const NodeHandle parent, const T& data);
+
+   NodeHandle AddChild(const NodeHandle parent, const size_t slot, const T& data) requires requires(N node) { node.Children.fill(NullNode); };
+
+   /** Remove a node and its subtree, whose handles are recycled by later additions. */
+   void Remove(const NodeHandle node);
+
+   /** Rearrange the nodes in depth-first order, and release the removed ones. Returns the new handle of each old handle, or the null handle for removed
+    *  nodes. */
+   DArray<NodeHandle> Compact();
+
+   void clear();
+
+   void reserve(const size_t n) { Nodes_.reserve(n); }
+
+   /** Traversals of the subtree of a node, or of the whole tree, e.g. for(const NodeHandle node : tree.DepthFirst()) ... */
+   Traversal<DepthFirstIterator> DepthFirst(const NodeHandle node) const { return {DepthFirstIterator(*this, node)}; }
+
+   Traversal<DepthFirstIterator> DepthFirst() const { return DepthFirst(Root_); }
+
+   Traversal<BreadthFirstIterator> BreadthFirst(const NodeHandle node) const { return {BreadthFirstIterator(*this, node)}; }
+
+   Traversal<BreadthFirstIterator> BreadthFirst() const { return BreadthFirst(Root_); }
+
+   /** Node access */
+   inline N& operator[](const NodeHandle node) { DEBUG_ASSERT(isNode(node), "There is no node of handle ", node, ".") return Nodes_[node]; }
+
+   inline const N& operator[](const NodeHandle node) const { DEBUG_ASSERT(isNode(node), "There is no node of handle ", node, ".") return Nodes_[node]; }
+
+   inline bool isNode(const NodeHandle node) const { return node < Nodes_.size() && Nodes_[node].Parent != FreeNode; }
+
+   inline NodeHandle Root() const { return Root_; }
+
+   inline size_t size() const { return Nodes_.size() - FreeNodes_.size(); }
+
+   inline bool empty() const { return Root_ == NullNode; }
+
  private:
-   std::shared_ptr<Node<T>> Root;
-   DynamicArray<std::shared_ptr<Node<T>>> Nodes;
+   /** Parent of the nodes in the free list. */
+   static constexpr NodeHandle FreeNode = NullNode - 1;
+
+   NodeHandle Allocate(const T& data, const NodeHandle parent);
+
+   DArray<N>          Nodes_;
+   DArray<NodeHandle> FreeNodes_;
+   NodeHandle         Root_{NullNode};
+};
+
+/***************************************************************************************************************************************************************
+* Tree Iterators
+***************************************************************************************************************************************************************/
+
+/** Pre-order depth-first iterator, keeping the nodes still to visit on a stack. */
+template<class T, class N>
+class Tree<T, N>::DepthFirstIterator
+{
+ public:
+   using value_type      = NodeHandle;
+   using difference_type = std::ptrdiff_t;
+
+   DepthFirstIterator() = default;
+
+   DepthFirstIterator(const Tree& tree, const NodeHandle node);
+
+   inline NodeHandle operator*() const { return Stack_.back(); }
+
+   DepthFirstIterator& operator++();
+
+   DepthFirstIterator operator++(int) { auto it = *this; ++*this; return it; }
+
+   inline bool operator==(std::default_sentinel_t) const { return Stack_.empty(); }
+
+ private:
+   const Tree*             Tree_{};
+   std::vector<NodeHandle> Stack_;
+};
+
+/** Breadth-first iterator, keeping the nodes still to visit in a queue. */
+template<class T, class N>
+class Tree<T, N>::BreadthFirstIterator
+{
+ public:
+   using value_type      = NodeHandle;
+   using difference_type = std::ptrdiff_t;
+
+   BreadthFirstIterator() = default;
+
+   BreadthFirstIterator(const Tree& tree, const NodeHandle node);
+
+   inline NodeHandle operator*() const { return Queue_[Front_]; }
+
+   BreadthFirstIterator& operator++();
+
+   BreadthFirstIterator operator++(int) { auto it = *this; ++*this; return it; }
+
+   inline bool operator==(std::default_sentinel_t) const { return Front_ == Queue_.size(); }
+
+ private:
+   const Tree*             Tree_{};
+   std::vector<NodeHandle> Queue_;
+   size_t                  Front_{};
 };
 
 }
+
+#include "Tree.tpp"
@@ -0,0 +1,197 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+
+namespace aprn::graph {
+
+/***************************************************************************************************************************************************************
+* Tree Modifiers
+***************************************************************************************************************************************************************/
+template<class T, class N>
+NodeHandle
+Tree<T, N>::AddRoot(const T& data)
+{
+   ASSERT(Root_ == NullNode, "The tree already has a root.")
+   Root_ = Allocate(data, NullNode);
+   return Root_;
+}
+
+template<class T, class N>
+NodeHandle
+Tree<T, N>::AddChild(const NodeHandle parent, const T& data)
+{
+   DEBUG_ASSERT(isNode(parent), "There is no node of handle ", parent, ".")
+   if constexpr(requires(N node) { node.Children.fill(NullNode); })
+   {
+      const auto& children = Nodes_[parent].Children;
+      const size_t slot = std::find(children.begin(), children.end(), NullNode) - children.begin();
+      ASSERT(slot < children.size(), "The node ", parent, " has no free child slot.")
+      return AddChild(parent, slot, data);
+   }
+   else
+   {
+      const NodeHandle child = Allocate(data, parent);
+      Nodes_[parent].Children.push_back(child);
+      return child;
+   }
+}
+
+template<class T, class N>
+NodeHandle
+Tree<T, N>::AddChild(const NodeHandle parent, const size_t slot, const T& data) requires requires(N node) { node.Children.fill(NullNode); }
+{
+   DEBUG_ASSERT(isNode(parent), "There is no node of handle ", parent, ".")
+   ASSERT(Nodes_[parent].Children[slot] == NullNode, "The child slot ", slot, " of node ", parent, " is taken.")
+   const NodeHandle child = Allocate(data, parent);
+   Nodes_[parent].Children[slot] = child;
+   return child;
+}
+
+template<class T, class N>
+void
+Tree<T, N>::Remove(const NodeHandle node)
+{
+   ASSERT(isNode(node), "There is no node of handle ", node, ".")
+
+   const NodeHandle parent = Nodes_[node].Parent;
+   if(parent == NullNode) Root_ = NullNode;
+   else
+   {
+      auto& children = Nodes_[parent].Children;
+      if constexpr(requires { children.fill(NullNode); }) *std::find(children.begin(), children.end(), node) = NullNode;
+      else
+      {
+         std::remove(children.begin(), children.end(), node);
+         children.pop_back();
+      }
+   }
+
+   // Collect the subtree before freeing any of it, since the traversal reads the children of the freed nodes.
+   const size_t first_free = FreeNodes_.size();
+   for(const NodeHandle descendant : DepthFirst(node)) FreeNodes_.push_back(descendant);
+   FOR(i, first_free, FreeNodes_.size())
+   {
+      N& freed = Nodes_[FreeNodes_[i]];
+      freed.Parent = FreeNode;
+      if constexpr(requires { freed.Children.Erase(); }) freed.Children.Erase();
+   }
+}
+
+template<class T, class N>
+DArray<NodeHandle>
+Tree<T, N>::Compact()
+{
+   // Number the nodes before moving any of them, since the traversal reads the children of the moved nodes.
+   DArray<NodeHandle> handles(Nodes_.size(), NullNode);
+   DArray<NodeHandle> order;
+   order.reserve(size());
+   for(const NodeHandle node : DepthFirst())
+   {
+      handles[node] = static_cast<NodeHandle>(order.size());
+      order.push_back(node);
+   }
+   DArray<N> nodes;
+   nodes.reserve(order.size());
+   FOR_EACH_CONST(node, order) nodes.push_back(std::move(Nodes_[node]));
+   FOR_EACH(node, nodes)
+   {
+      if(node.Parent != NullNode) node.Parent = handles[node.Parent];
+      FOR_EACH(child, node.Children) if(child != NullNode) child = handles[child];
+   }
+   Nodes_ = std::move(nodes);
+   FreeNodes_.clear();
+   if(Root_ != NullNode) Root_ = 0;
+   return handles;
+}
+
+template<class T, class N>
+void
+Tree<T, N>::clear()
+{
+   Nodes_.clear();
+   FreeNodes_.clear();
+   Root_ = NullNode;
+}
+
+template<class T, class N>
+NodeHandle
+Tree<T, N>::Allocate(const T& data, const NodeHandle parent)
+{
+   NodeHandle node;
+   if(FreeNodes_.empty())
+   {
+      ASSERT(Nodes_.size() < FreeNode, "A tree holds at most ", FreeNode, " nodes.")
+      node = static_cast<NodeHandle>(Nodes_.size());
+      Nodes_.emplace_back();
+   }
+   else
+   {
+      node = FreeNodes_.back();
+      FreeNodes_.pop_back();
+   }
+   N& entry = Nodes_[node];
+   entry.Data   = data;
+   entry.Depth  = parent == NullNode ? 0 : Nodes_[parent].Depth + 1;
+   entry.Parent = parent;
+   if constexpr(requires { entry.Children.fill(NullNode); }) entry.Children.fill(NullNode);
+   return node;
+}
+
+/***************************************************************************************************************************************************************
+* Tree Iterators
+***************************************************************************************************************************************************************/
+template<class T, class N>
+Tree<T, N>::DepthFirstIterator::DepthFirstIterator(const Tree& tree, const NodeHandle node)
+   : Tree_(&tree)
+{
+   if(node != NullNode) Stack_.push_back(node);
+}
+
+template<class T, class N>
+typename Tree<T, N>::DepthFirstIterator&
+Tree<T, N>::DepthFirstIterator::operator++()
+{
+   // Push the children in reverse, so that the first child is visited next.
+   const auto& children = Tree_->Nodes_[Stack_.back()].Children;
+   Stack_.pop_back();
+   for(auto it = children.end(); it != children.begin();) if(*--it != NullNode) Stack_.push_back(*it);
+   return *this;
+}
+
+template<class T, class N>
+Tree<T, N>::BreadthFirstIterator::BreadthFirstIterator(const Tree& tree, const NodeHandle node)
+   : Tree_(&tree)
+{
+   if(node != NullNode) Queue_.push_back(node);
+}
+
+template<class T, class N>
+typename Tree<T, N>::BreadthFirstIterator&
+Tree<T, N>::BreadthFirstIterator::operator++()
+{
+   FOR_EACH_CONST(child, Tree_->Nodes_[Queue_[Front_++]].Children) if(child != NullNode) Queue_.push_back(child);
+
+   // Drop the visited half of the queue once it dominates, so that the queue stays proportional to the widest level rather than to the whole subtree.
+   if(Front_ >= 1024 && 2 * Front_ >= Queue_.size())
+   {
+      Queue_.erase(Queue_.begin(), Queue_.begin() + static_cast<std::ptrdiff_t>(Front_));
+      Front_ = 0;
+   }
+   return *this;
+}
+
+}
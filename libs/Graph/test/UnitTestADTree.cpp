@@ -0,0 +1,163 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "../../../include/Global.h"
+#include "../../../include/Random.h"
+#include "../include/ADTree.h"
+
+#include <algorithm>
+
+#ifdef DEBUG_MODE
+
+namespace aprn::graph {
+
+/***************************************************************************************************************************************************************
+* Alternating Digital Tree Test Fixture
+***************************************************************************************************************************************************************/
+class ADTreeTest : public testing::Test
+{
+ public:
+   static constexpr size_t n = 3000;
+   static constexpr size_t nQueries = 100;
+
+   ADTreeTest() : Tree(SVectorR3{-One, -One, -One}, SVectorR3{One, One, One}), Mins(n), Maxs(n), isInserted(n, false)
+   {
+      FOR(i, n) RandomBox(Mins[i], Maxs[i], 0.1);
+   }
+
+   /** Random box in the domain [-1, 1]^3, with sides of at most a given size. */
+   void RandomBox(SVectorR3& min, SVectorR3& max, const Real size)
+   {
+      FOR(d, 3)
+      {
+         const Real a = Position(), b = a + size * Side();
+         min[d] = a;
+         max[d] = b;
+      }
+   }
+
+   /** Ids of the inserted boxes satisfying a predicate, by brute force. */
+   template<class P>
+   DArray<size_t> Expected(P predicate) const
+   {
+      DArray<size_t> ids;
+      FOR(i, n) if(isInserted[i] && predicate(Mins[i], Maxs[i])) ids.push_back(Ids[i]);
+      std::sort(ids.begin(), ids.end());
+      return ids;
+   }
+
+   static DArray<size_t> Sorted(DArray<size_t> ids)
+   {
+      std::sort(ids.begin(), ids.end());
+      return ids;
+   }
+
+   /** Compare the overlap, containment and picking queries of random boxes and points against brute force. */
+   void CheckQueries()
+   {
+      FOR(q, nQueries)
+      {
+         SVectorR3 min, max;
+         RandomBox(min, max, 0.4);
+         EXPECT_EQ(Sorted(Tree.Overlapping(min, max)), Expected([&](const auto& a, const auto& b)
+         {
+            return a[0] <= max[0] && a[1] <= max[1] && a[2] <= max[2] && b[0] >= min[0] && b[1] >= min[1] && b[2] >= min[2];
+         }));
+         EXPECT_EQ(Sorted(Tree.Contained(min, max)), Expected([&](const auto& a, const auto& b)
+         {
+            return a[0] >= min[0] && a[1] >= min[1] && a[2] >= min[2] && b[0] <= max[0] && b[1] <= max[1] && b[2] <= max[2];
+         }));
+         const SVectorR3 point{Position(), Position(), Position()};
+         EXPECT_EQ(Sorted(Tree.Containing(point)), Expected([&](const auto& a, const auto& b)
+         {
+            return a[0] <= point[0] && a[1] <= point[1] && a[2] <= point[2] && b[0] >= point[0] && b[1] >= point[1] && b[2] >= point[2];
+         }));
+      }
+   }
+
+   ADTreeR3 Tree;
+   DArray<SVectorR3> Mins;
+   DArray<SVectorR3> Maxs;
+   DArray<size_t> Ids{DArray<size_t>(n)};
+   DArrayB isInserted;
+   Random<Real> Position{-One, One};
+   Random<Real> Side{Zero, One};
+};
+
+/***************************************************************************************************************************************************************
+* Test Queries
+***************************************************************************************************************************************************************/
+TEST_F(ADTreeTest, Queries)
+{
+   FOR(i, n)
+   {
+      Ids[i] = Tree.Insert(Mins[i], Maxs[i]);
+      isInserted[i] = true;
+   }
+   EXPECT_EQ(Tree.size(), n);
+   EXPECT_EQ(Tree.Min(Ids[7]), Mins[7]);
+   EXPECT_EQ(Tree.Max(Ids[7]), Maxs[7]);
+   EXPECT_LT(Tree.Depth(), 64);
+   CheckQueries();
+
+   // Boxes outside the domain are found as well.
+   const size_t outside = Tree.Insert(SVectorR3{2.0, 2.0, 2.0}, SVectorR3{3.0, 3.0, 3.0});
+   EXPECT_EQ(Tree.Containing(SVectorR3{2.5, 2.5, 2.5}), DArray<size_t>{outside});
+   Tree.Remove(outside);
+   EXPECT_EQ(Tree.Containing(SVectorR3{2.5, 2.5, 2.5}).size(), 0);
+}
+
+/***************************************************************************************************************************************************************
+* Test Insertion and Removal
+***************************************************************************************************************************************************************/
+TEST_F(ADTreeTest, InsertRemove)
+{
+   FOR(i, n)
+   {
+      Ids[i] = Tree.Insert(Mins[i], Maxs[i]);
+      isInserted[i] = true;
+   }
+
+   // Remove every other box, including inner nodes, whose positions are taken over by leaves, and keep the ids of the remaining boxes.
+   for(size_t i = 0; i < n; i += 2)
+   {
+      Tree.Remove(Ids[i]);
+      isInserted[i] = false;
+      EXPECT_EQ(Tree.isItem(Ids[i]), false);
+   }
+   EXPECT_EQ(Tree.size(), n / 2);
+   for(size_t i = 1; i < n; i += 2) EXPECT_EQ(Tree.Min(Ids[i]), Mins[i]);
+   CheckQueries();
+
+   // Reinsert the removed boxes, moved, which reuse the freed ids.
+   for(size_t i = 0; i < n; i += 2)
+   {
+      RandomBox(Mins[i], Maxs[i], 0.1);
+      Ids[i] = Tree.Insert(Mins[i], Maxs[i]);
+      isInserted[i] = true;
+      EXPECT_LT(Ids[i], n);
+   }
+   EXPECT_EQ(Tree.size(), n);
+   CheckQueries();
+
+   FOR(i, n) Tree.Remove(Ids[i]);
+   EXPECT_EQ(Tree.size(), 0);
+   EXPECT_EQ(Tree.Overlapping(SVectorR3{-One, -One, -One}, SVectorR3{One, One, One}).size(), 0);
+}
+
+}
+
+#endif
@@ -0,0 +1,216 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "../../../include/Global.h"
+#include "../../../include/Random.h"
+#include "../include/BVH.h"
+
+#include <algorithm>
+
+#ifdef DEBUG_MODE
+
+namespace aprn::graph {
+
+/***************************************************************************************************************************************************************
+* Bounding Volume Hierarchy Test Fixture
+***************************************************************************************************************************************************************/
+class BVHTest : public testing::Test
+{
+ public:
+   /** Force the parallel paths, which are split between more threads than there may be cores. */
+   BVHTest()
+      : Threshold(ParallelThreshold()), nThreads_(nThreads())
+   {
+      SetParallelThreshold(0);
+      SetThreads(4);
+   }
+
+   ~BVHTest() override
+   {
+      SetThreads(nThreads_);
+      SetParallelThreshold(Threshold);
+   }
+
+   /** Soup of small random triangles in the box [-1, 1]^3. */
+   void RandomTriangles(const size_t n)
+   {
+      Vertices.resize(3 * n);
+      Indices.resize(3 * n);
+      FOR(t, n)
+      {
+         const SVectorR3 centre{Position(), Position(), Position()};
+         FOR(k, 3)
+         {
+            FOR(d, 3) Vertices[3 * t + k][d] = centre[d] + 0.05 * Position();
+            Indices[3 * t + k] = static_cast<std::uint32_t>(3 * t + k);
+         }
+      }
+   }
+
+   std::array<Real, 3> Coordinates(const size_t vertex) const
+   {
+      return {Vertices[vertex][0], Vertices[vertex][1], Vertices[vertex][2]};
+   }
+
+   /** Compare ray casts, closest points and frustum searches from a number of random queries against brute force. */
+   void CheckQueries(const BVHR& bvh, const size_t n_queries) const
+   {
+      const size_t n = Indices.size() / 3;
+      Random<Real> position(-1.5, 1.5);
+      FOR(q, n_queries)
+      {
+         const SVectorR3 origin{position(), position(), position()};
+         const SVectorR3 target{position(), position(), position()};
+         const SVectorR3 direction{target[0] - origin[0], target[1] - origin[1], target[2] - origin[2]};
+
+         // Nearest ray hit.
+         Real expected_hit = InfFloat<>;
+         FOR(t, n)
+         {
+            const auto hit = detail::IntersectTriangle({origin[0], origin[1], origin[2]}, {direction[0], direction[1], direction[2]},
+                                                       Coordinates(Indices[3 * t]), Coordinates(Indices[3 * t + 1]), Coordinates(Indices[3 * t + 2]),
+                                                       InfFloat<>);
+            if(hit) expected_hit = std::min(expected_hit, (*hit)[0]);
+         }
+         const auto hit = bvh.Intersect(origin, direction);
+         EXPECT_EQ(hit.has_value(), expected_hit < InfFloat<>);
+         if(hit) EXPECT_DOUBLE_EQ(hit->Distance, expected_hit);
+
+         // Closest point.
+         Real expected_distance = InfFloat<>;
+         FOR(t, n)
+         {
+            const auto point = detail::ClosestTrianglePoint({origin[0], origin[1], origin[2]}, Coordinates(Indices[3 * t]), Coordinates(Indices[3 * t + 1]),
+                                                            Coordinates(Indices[3 * t + 2]));
+            const auto difference = detail::Subtract3(point, {origin[0], origin[1], origin[2]});
+            expected_distance = std::min(expected_distance, std::sqrt(detail::Dot3(difference, difference)));
+         }
+         const auto closest = bvh.Closest(origin);
+         ASSERT_TRUE(closest.has_value());
+         EXPECT_NEAR(closest->Distance, expected_distance, 1.0e-12);
+         EXPECT_FALSE(bvh.Closest(origin, 0.99 * expected_distance).has_value());
+
+         // Triangles whose boxes are not outside a random box tilted about a random centre.
+         std::array<SVectorR4, 6> planes;
+         FOR(d, 3)
+         {
+            const Real tilt = 0.2 * position();
+            SVectorR4 plane{};
+            plane[d] = One;
+            plane[(d + 1) % 3] = tilt;
+            plane[3] = 0.4 - plane[0] * origin[0] - plane[1] * origin[1] - plane[2] * origin[2];
+            planes[2 * d] = plane;
+            FOR(k, 3) plane[k] = -plane[k];
+            plane[3] = 0.4 - plane[0] * origin[0] - plane[1] * origin[1] - plane[2] * origin[2];
+            planes[2 * d + 1] = plane;
+         }
+         DArray<size_t> expected_triangles;
+         FOR(t, n)
+         {
+            const bool is_outside = std::any_of(planes.begin(), planes.end(), [&](const SVectorR4& plane)
+            {
+               Real furthest = plane[3];
+               FOR(d, 3)
+               {
+                  Real extreme = plane[d] >= Zero ? -InfFloat<> : InfFloat<>;
+                  FOR(k, 3)
+                  {
+                     const Real coordinate = Vertices[Indices[3 * t + k]][d];
+                     extreme = plane[d] >= Zero ? std::max(extreme, coordinate) : std::min(extreme, coordinate);
+                  }
+                  furthest += plane[d] * extreme;
+               }
+               return furthest < Zero;
+            });
+            if(!is_outside) expected_triangles.push_back(t);
+         }
+         auto triangles = bvh.FrustumSearch(planes);
+         std::sort(triangles.begin(), triangles.end());
+         EXPECT_EQ(triangles, expected_triangles);
+      }
+   }
+
+   size_t Threshold;
+   size_t nThreads_;
+   DArray<SVectorR3> Vertices;
+   DArray<std::uint32_t> Indices;
+   Random<Real> Position{-One, One};
+};
+
+/***************************************************************************************************************************************************************
+* Test Construction and Queries
+***************************************************************************************************************************************************************/
+TEST_F(BVHTest, Queries)
+{
+   // Large enough for the root to be split with parallel binning.
+   RandomTriangles(BVHParallelNodeSize + 1000);
+   const BVHR bvh(Vertices, Indices);
+   EXPECT_EQ(bvh.size(), Indices.size() / 3);
+   EXPECT_LT(bvh.NodeCount(), 2 * bvh.size());
+   EXPECT_LT(bvh.LevelCount(), 64);
+   CheckQueries(bvh, 10);
+
+   // Queries on an empty hierarchy find nothing.
+   const BVHR empty(DArray<SVectorR3>{}, DArray<std::uint32_t>{});
+   EXPECT_FALSE(empty.Intersect(SVectorR3{}, SVectorR3{One, Zero, Zero}).has_value());
+   EXPECT_FALSE(empty.Closest(SVectorR3{}).has_value());
+}
+
+TEST_F(BVHTest, SharedVertices)
+{
+   // A unit square in the z = 0 plane, made of two triangles sharing a diagonal, hit through the diagonal and at a corner.
+   Vertices = {SVectorR3{Zero, Zero, Zero}, SVectorR3{One, Zero, Zero}, SVectorR3{One, One, Zero}, SVectorR3{Zero, One, Zero}};
+   Indices  = {0, 1, 2, 0, 2, 3};
+   const BVHR bvh(Vertices, Indices);
+
+   const auto hit = bvh.Intersect(SVectorR3{0.5, 0.5, One}, SVectorR3{Zero, Zero, -2.0});
+   ASSERT_TRUE(hit.has_value());
+   EXPECT_DOUBLE_EQ(hit->Distance, 0.5);
+   EXPECT_FALSE(bvh.Intersect(SVectorR3{0.5, 0.5, One}, SVectorR3{Zero, Zero, -2.0}, 0.4).has_value());
+   EXPECT_FALSE(bvh.Intersect(SVectorR3{0.5, 0.5, One}, SVectorR3{Zero, Zero, One}).has_value());
+
+   const auto closest = bvh.Closest(SVectorR3{2.0, 2.0, One});
+   ASSERT_TRUE(closest.has_value());
+   EXPECT_DOUBLE_EQ(closest->Distance, std::sqrt(3.0));
+   EXPECT_EQ(closest->Point, (SVectorR3{One, One, Zero}));
+}
+
+/***************************************************************************************************************************************************************
+* Test Refitting
+***************************************************************************************************************************************************************/
+TEST_F(BVHTest, Refit)
+{
+   RandomTriangles(5000);
+   BVHR bvh(Vertices, Indices);
+   const size_t n_nodes = bvh.NodeCount();
+
+   // Rotate the mesh about the z-axis, and translate it, as a model matrix would, and refit the boxes to it.
+   const Real angle = 0.7;
+   FOR_EACH(vertex, Vertices)
+   {
+      const Real x = vertex[0], y = vertex[1];
+      vertex[0] = std::cos(angle) * x - std::sin(angle) * y + 0.3;
+      vertex[1] = std::sin(angle) * x + std::cos(angle) * y - 0.2;
+      vertex[2] += 0.1;
+   }
+   bvh.Refit(Vertices);
+   EXPECT_EQ(bvh.NodeCount(), n_nodes);
+   CheckQueries(bvh, 100);
+}
+
+}
+
+#endif
@@ -0,0 +1,251 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "../../../include/Global.h"
+#include "../include/GraphAlgorithms.h"
+
+#include <map>
+#include <queue>
+#include <random>
+
+#ifdef DEBUG_MODE
+
+namespace aprn::graph {
+
+/***************************************************************************************************************************************************************
+* Graph Test Fixture
+***************************************************************************************************************************************************************/
+class GraphTest : public testing::Test
+{
+ public:
+   static constexpr size_t Scale = 11;
+
+   /** Force the parallel paths on small graphs, which are split between more threads than there may be cores. */
+   GraphTest()
+      : Threshold(ParallelThreshold()), nThreads_(nThreads())
+   {
+      SetParallelThreshold(0);
+      SetThreads(4);
+   }
+
+   ~GraphTest() override
+   {
+      SetThreads(nThreads_);
+      SetParallelThreshold(Threshold);
+   }
+
+   static DArray<Edge<Real>> Edges(const std::initializer_list<Edge<Real>> edges) { return DArray<Edge<Real>>(edges.begin(), edges.end()); }
+
+   /** R-MAT edges with random integer weights in [1, 100]. */
+   static DArray<Edge<Real>> WeightedEdges()
+   {
+      auto edges = RMatEdges(Scale, 8);
+      std::mt19937 generator(1);
+      std::uniform_int_distribution<int> distribution(1, 100);
+      FOR_EACH(edge, edges) edge.Weight = static_cast<Real>(distribution(generator));
+      return edges;
+   }
+
+   /** Breadth-first depths, by a serial queue. */
+   static DArray<Vertex> SerialDepths(const Graph<Real>& graph, const Vertex source)
+   {
+      DArray<Vertex> depths(graph.VertexCount(), NullVertex);
+      std::queue<Vertex> queue;
+      queue.push(source);
+      depths[source] = 0;
+      while(!queue.empty())
+      {
+         const Vertex u = queue.front();
+         queue.pop();
+         for(const Vertex v : graph.OutNeighbours(u)) if(depths[v] == NullVertex)
+         {
+            depths[v] = depths[u] + 1;
+            queue.push(v);
+         }
+      }
+      return depths;
+   }
+
+   /** Shortest path distances, by Dijkstra's algorithm. */
+   static DArray<Real> SerialDistances(const Graph<Real>& graph, const Vertex source)
+   {
+      DArray<Real> distances(graph.VertexCount(), std::numeric_limits<Real>::max());
+      std::priority_queue<std::pair<Real, Vertex>, std::vector<std::pair<Real, Vertex>>, std::greater<>> queue;
+      distances[source] = Zero;
+      queue.push({Zero, source});
+      while(!queue.empty())
+      {
+         const auto [distance, u] = queue.top();
+         queue.pop();
+         if(distance > distances[u]) continue;
+
+         FOR(j, graph.OutDegree(u))
+         {
+            const Vertex v = graph.OutNeighbours(u)[j];
+            const Real v_distance = distance + graph.OutWeights(u)[j];
+            if(v_distance >= distances[v]) continue;
+            distances[v] = v_distance;
+            queue.push({v_distance, v});
+         }
+      }
+      return distances;
+   }
+
+ private:
+   size_t Threshold;
+   size_t nThreads_;
+};
+
+/***************************************************************************************************************************************************************
+* Test Construction
+***************************************************************************************************************************************************************/
+TEST_F(GraphTest, Construction)
+{
+   const auto edges = Edges({{2, 1, 3.0}, {0, 2, 1.0}, {2, 1, 2.0}, {1, 1, 1.0}, {0, 1, 5.0}, {3, 0, 1.0}});
+
+   const Graph<Real> multigraph(4, edges);
+   EXPECT_EQ(multigraph.VertexCount(), 4);
+   EXPECT_EQ(multigraph.EdgeCount(), 6);
+   EXPECT_EQ(DArray<Vertex>(multigraph.OutNeighbours(2).begin(), multigraph.OutNeighbours(2).end()), (DArray<Vertex>{1, 1}));
+   EXPECT_EQ(DArray<Vertex>(multigraph.InNeighbours(1).begin(), multigraph.InNeighbours(1).end()), (DArray<Vertex>{0, 1, 2, 2}));
+
+   // Simple graphs drop the self-loop and keep the lighter of the parallel edges.
+   const Graph<Real> graph(4, edges, true, true);
+   EXPECT_EQ(graph.EdgeCount(), 4);
+   EXPECT_EQ(DArray<Vertex>(graph.OutNeighbours(0).begin(), graph.OutNeighbours(0).end()), (DArray<Vertex>{1, 2}));
+   EXPECT_EQ(DArray<Real>(graph.OutWeights(0).begin(), graph.OutWeights(0).end()), (DArray<Real>{5.0, 1.0}));
+   EXPECT_EQ(graph.OutWeights(2)[0], 2.0);
+   EXPECT_EQ(graph.OutDegree(1), 0);
+   EXPECT_EQ(graph.InDegree(1), 2);
+
+   // Undirected graphs store both directions.
+   const Graph<Real> undirected(4, edges, false, true);
+   EXPECT_EQ(undirected.EdgeCount(), 8);
+   EXPECT_EQ(DArray<Vertex>(undirected.InNeighbours(0).begin(), undirected.InNeighbours(0).end()), (DArray<Vertex>{1, 2, 3}));
+
+   // R-MAT graphs only depend on the seed, and have skewed degrees.
+   const auto rmat = RMatEdges(Scale, 8);
+   EXPECT_EQ(rmat.size(), (size_t{1} << Scale) * 8);
+   EXPECT_EQ(rmat[100].Source, RMatEdges(Scale, 8)[100].Source);
+   const Graph<Real> rmat_graph(size_t{1} << Scale, rmat);
+   size_t max_degree{};
+   FOR(v, rmat_graph.VertexCount()) max_degree = Max(max_degree, rmat_graph.OutDegree(static_cast<Vertex>(v)));
+   EXPECT_GT(max_degree, 100);
+}
+
+/***************************************************************************************************************************************************************
+* Test Traversals
+***************************************************************************************************************************************************************/
+TEST_F(GraphTest, BreadthFirstSearch)
+{
+   for(const bool is_directed : {true, false})
+   {
+      const Graph<Real> graph(size_t{1} << Scale, RMatEdges(Scale, 8), is_directed);
+      // Pulling throughout, pushing throughout, and switching.
+      for(const size_t alpha : {size_t{1} << 30, size_t{1}, size_t{15}})
+      {
+         const Vertex source = graph.OutNeighbours(0).empty() ? 1 : 0;
+         const auto tree = BreadthFirstSearch(graph, source, alpha, 18);
+         EXPECT_EQ(tree.Depths, SerialDepths(graph, source));
+         FOR(v, graph.VertexCount()) if(tree.Parents[v] != NullVertex && v != source)
+         {
+            const auto in = graph.InNeighbours(static_cast<Vertex>(v));
+            EXPECT_NE(std::find(in.begin(), in.end(), tree.Parents[v]), in.end());
+            EXPECT_EQ(tree.Depths[tree.Parents[v]] + 1, tree.Depths[v]);
+         }
+      }
+   }
+}
+
+TEST_F(GraphTest, ShortestPaths)
+{
+   const Graph<Real> graph(size_t{1} << Scale, WeightedEdges());
+   const Vertex source = 1;
+   const auto expected = SerialDistances(graph, source);
+   EXPECT_EQ(ShortestPaths(graph, source), expected);
+   EXPECT_EQ(ShortestPaths(graph, source, 1.0), expected);
+   EXPECT_EQ(ShortestPaths(graph, source, 1000.0), expected);
+}
+
+/***************************************************************************************************************************************************************
+* Test Connected Components
+***************************************************************************************************************************************************************/
+TEST_F(GraphTest, ConnectedComponents)
+{
+   // A sparse R-MAT graph, which has many components, and two extra components of a path and a vertex.
+   const size_t n = size_t{1} << Scale;
+   auto edges = RMatEdges(Scale, 1);
+   FOR(v, n, n + 9) edges.push_back({static_cast<Vertex>(v + 1), static_cast<Vertex>(v)});
+
+   for(const bool is_directed : {true, false})
+   {
+      const Graph<Real> graph(n + 11, edges, is_directed);
+      const auto labels = ConnectedComponents(graph);
+
+      // Vertices have equal labels iff they are connected, which a search from each vertex on the undirected graph finds.
+      const Graph<Real> undirected(n + 11, edges, false);
+      DArray<Vertex> components(n + 11, NullVertex);
+      FOR(v, n + 11) if(components[v] == NullVertex)
+      {
+         const auto depths = SerialDepths(undirected, static_cast<Vertex>(v));
+         FOR(u, n + 11) if(depths[u] != NullVertex)
+         {
+            components[u] = static_cast<Vertex>(v);
+            EXPECT_EQ(labels[u], labels[v]);
+         }
+      }
+      std::map<Vertex, Vertex> component_of_label;
+      FOR(v, n + 11) EXPECT_EQ(component_of_label.emplace(labels[v], components[v]).first->second, components[v]);
+      EXPECT_EQ(labels[n + 10], n + 10);
+      EXPECT_EQ(labels[n + 3], labels[n + 9]);
+   }
+}
+
+/***************************************************************************************************************************************************************
+* Test PageRank
+***************************************************************************************************************************************************************/
+TEST_F(GraphTest, PageRank)
+{
+   // Ranks are uniform on a cycle.
+   const auto cycle = Edges({{0, 1}, {1, 2}, {2, 3}, {3, 0}});
+   FOR_EACH_CONST(rank, PageRank(Graph<Real>(4, cycle))) EXPECT_DOUBLE_EQ(rank, 0.25);
+
+   // Ranks sum to one with dangling vertices, and match serial power iterations.
+   const Graph<Real> graph(size_t{1} << Scale, RMatEdges(Scale, 4));
+   const auto ranks = PageRank(graph, 0.85, 1.0e-10);
+   EXPECT_NEAR(std::accumulate(ranks.begin(), ranks.end(), Zero), One, 1.0e-9);
+
+   const size_t n = graph.VertexCount();
+   DArray<Real> expected(n, One / static_cast<Real>(n));
+   FOR(iteration, 200)
+   {
+      DArray<Real> next(n, Zero);
+      Real dangling{};
+      FOR(u, n)
+      {
+         const auto neighbours = graph.OutNeighbours(static_cast<Vertex>(u));
+         if(neighbours.empty()) dangling += expected[u];
+         for(const Vertex v : neighbours) next[v] += 0.85 * expected[u] / static_cast<Real>(neighbours.size());
+      }
+      FOR(v, n) next[v] += (0.15 + 0.85 * dangling) / static_cast<Real>(n);
+      expected = next;
+   }
+   FOR(v, n) EXPECT_NEAR(ranks[v], expected[v], 1.0e-9);
+}
+
+}
+
+#endif
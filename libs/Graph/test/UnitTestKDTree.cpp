@@ -0,0 +1,179 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "../../../include/Global.h"
+#include "../../../include/Random.h"
+#include "../include/KDTree.h"
+
+#include <algorithm>
+
+#ifdef DEBUG_MODE
+
+namespace aprn::graph {
+
+/***************************************************************************************************************************************************************
+* KD-tree Test Fixture
+***************************************************************************************************************************************************************/
+class KDTreeTest : public testing::Test
+{
+ public:
+   static constexpr size_t n = 5000;
+   static constexpr size_t nQueries = 100;
+
+   /** Force the parallel paths on small trees and batches, which are split between more threads than there may be cores. */
+   KDTreeTest()
+      : Threshold(ParallelThreshold()), nThreads_(nThreads())
+   {
+      SetParallelThreshold(0);
+      SetThreads(4);
+   }
+
+   ~KDTreeTest() override
+   {
+      SetThreads(nThreads_);
+      SetParallelThreshold(Threshold);
+   }
+
+   /** Random points, rounded to a grid if a spacing is given, so that there are many equal coordinates and equidistant points. */
+   template<size_t D>
+   static DArray<SVectorR<D>> RandomPoints(const size_t count, const Real spacing = Zero)
+   {
+      Random<Real> random(-One, One);
+      DArray<SVectorR<D>> points(count);
+      FOR(i, count) FOR(d, D) points[i][d] = spacing > Zero ? spacing * std::round(random() / spacing) : random();
+      return points;
+   }
+
+   template<size_t D>
+   static Real SquaredDistance(const SVectorR<D>& a, const SVectorR<D>& b)
+   {
+      Real distance{};
+      FOR(d, D) distance += (a[d] - b[d]) * (a[d] - b[d]);
+      return distance;
+   }
+
+   /** Squared distances from a query to given points, sorted, which are unique even where the nearest neighbours are not. */
+   template<size_t D>
+   static std::vector<Real> SortedDistances(const DArray<SVectorR<D>>& points, const SVectorR<D>& query, const DArray<size_t>& indices)
+   {
+      std::vector<Real> distances(indices.size());
+      FOR(i, indices.size()) distances[i] = SquaredDistance(points[indices[i]], query);
+      std::sort(distances.begin(), distances.end());
+      return distances;
+   }
+
+   static DArray<size_t> Sorted(DArray<size_t> indices)
+   {
+      std::sort(indices.begin(), indices.end());
+      return indices;
+   }
+
+ private:
+   size_t Threshold;
+   size_t nThreads_;
+};
+
+/***************************************************************************************************************************************************************
+* Test Nearest Neighbours
+***************************************************************************************************************************************************************/
+TEST_F(KDTreeTest, NearestNeighbours)
+{
+   const size_t k = 10;
+   const auto check = [&](const auto& points)
+   {
+      const KDTreeR<3> tree(points);
+      EXPECT_EQ(tree.size(), points.size());
+      EXPECT_EQ(((points.size() - 1) >> tree.Depth()) < KDTreeLeafSize, true);
+
+      const auto queries = RandomPoints<3>(nQueries);
+      const auto batched = tree.NearestNeighbours(queries, k);
+      const auto nearest = tree.Nearest(queries);
+      FOR(i, nQueries)
+      {
+         DArray<size_t> all(points.size());
+         FOR(j, points.size()) all[j] = j;
+         auto expected = SortedDistances(points, queries[i], all);
+         expected.resize(k);
+
+         const auto neighbours = tree.NearestNeighbours(queries[i], k);
+         ASSERT_EQ(neighbours.size(), k);
+         EXPECT_EQ(SortedDistances(points, queries[i], neighbours), expected);
+         FOR(j, 1, k) EXPECT_LE(SquaredDistance(points[neighbours[j - 1]], queries[i]), SquaredDistance(points[neighbours[j]], queries[i]));
+         EXPECT_EQ(SquaredDistance(points[tree.Nearest(queries[i])], queries[i]), expected[0]);
+         EXPECT_EQ(nearest[i], tree.Nearest(queries[i]));
+         FOR(j, k) EXPECT_EQ(batched[i * k + j], neighbours[j]);
+      }
+   };
+   check(RandomPoints<3>(n));
+   check(RandomPoints<3>(n, 0.25));
+}
+
+TEST_F(KDTreeTest, SmallTrees)
+{
+   const KDTreeR<2> empty(DArray<SVectorR2>{});
+   EXPECT_EQ(empty.size(), 0);
+   EXPECT_EQ(empty.NearestNeighbours(SVectorR2{}, 3).size(), 0);
+   EXPECT_EQ(empty.RadiusSearch(SVectorR2{}, One).size(), 0);
+
+   const auto points = RandomPoints<2>(KDTreeLeafSize + 1);
+   const KDTreeR<2> tree(points);
+   EXPECT_EQ(tree.Depth(), 1);
+   EXPECT_EQ(Sorted(tree.NearestNeighbours(SVectorR2{}, 100)).size(), points.size());
+   EXPECT_EQ(tree.NearestNeighbours(DArray<SVectorR2>{SVectorR2{}}, 100).size(), points.size());
+   FOR(i, points.size()) EXPECT_EQ(tree.Nearest(points[i]), i);
+}
+
+/***************************************************************************************************************************************************************
+* Test Range Queries
+***************************************************************************************************************************************************************/
+TEST_F(KDTreeTest, RangeQueries)
+{
+   const auto points = RandomPoints<2>(n, 0.05);
+   const KDTreeR<2> tree(points);
+   const auto queries = RandomPoints<2>(nQueries);
+   const Real radius = 0.2;
+
+   DArray<SVectorR2> mins(nQueries), maxs(nQueries);
+   FOR(i, nQueries)
+   {
+      mins[i] = queries[i] - SVectorR2{0.1, 0.3};
+      maxs[i] = queries[i] + SVectorR2{0.2, 0.05};
+   }
+   const auto radius_batched = tree.RadiusSearch(queries, radius);
+   const auto box_batched = tree.BoxSearch(mins, maxs);
+
+   FOR(i, nQueries)
+   {
+      DArray<size_t> in_radius, in_box;
+      FOR(j, n)
+      {
+         if(SquaredDistance(points[j], queries[i]) <= radius * radius) in_radius.push_back(j);
+         if(points[j][0] >= mins[i][0] && points[j][0] <= maxs[i][0] && points[j][1] >= mins[i][1] && points[j][1] <= maxs[i][1]) in_box.push_back(j);
+      }
+      EXPECT_EQ(Sorted(tree.RadiusSearch(queries[i], radius)), in_radius);
+      EXPECT_EQ(Sorted(tree.BoxSearch(mins[i], maxs[i])), in_box);
+      EXPECT_EQ(Sorted(radius_batched[i]), in_radius);
+      EXPECT_EQ(Sorted(box_batched[i]), in_box);
+   }
+
+   // Boxes bounded by the grid lines include the points on them.
+   const auto on_grid = std::count_if(points.begin(), points.end(), [](const auto& p){ return std::abs(p[0]) <= 0.1 && std::abs(p[1]) <= 0.1; });
+   EXPECT_EQ(tree.BoxSearch(SVectorR2{-0.1, -0.1}, SVectorR2{0.1, 0.1}).size(), on_grid);
+}
+
+}
+
+#endif
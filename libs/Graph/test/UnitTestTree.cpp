@@ -0,0 +1,134 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "../../../include/Global.h"
+#include "../include/Tree.h"
+
+#ifdef DEBUG_MODE
+
+namespace aprn::graph {
+
+/***************************************************************************************************************************************************************
+* Tree Test Fixture
+***************************************************************************************************************************************************************/
+class TreeTest : public testing::Test
+{
+ public:
+   /** Tree of the digits 0-9:
+    *
+    *           0
+    *       /   |   \
+    *      1    2    3
+    *     / \   |   / | \ \
+    *    4   5  6  7  8  9 ... (node 3 has more children than fit inline)
+    */
+   TreeTest()
+   {
+      Handles.push_back(Tree_.AddRoot(0));
+      FOR(i, 1, 4) Handles.push_back(Tree_.AddChild(Handles[0], static_cast<int>(i)));
+      Handles.push_back(Tree_.AddChild(Handles[1], 4));
+      Handles.push_back(Tree_.AddChild(Handles[1], 5));
+      Handles.push_back(Tree_.AddChild(Handles[2], 6));
+      FOR(i, 7, 12) Handles.push_back(Tree_.AddChild(Handles[3], static_cast<int>(i)));
+   }
+
+   /** Data of the nodes in a traversal of a tree. */
+   template<class N, class R>
+   static DArray<int> Data(const Tree<int, N>& tree, const R& traversal)
+   {
+      DArray<int> data;
+      for(const NodeHandle node : traversal) data.push_back(tree[node].Data);
+      return data;
+   }
+
+   Tree<int> Tree_;
+   DArray<NodeHandle> Handles;
+};
+
+/***************************************************************************************************************************************************************
+* Test Traversals
+***************************************************************************************************************************************************************/
+TEST_F(TreeTest, Traversals)
+{
+   EXPECT_EQ(Tree_.size(), 12);
+   EXPECT_EQ(Tree_.Root(), Handles[0]);
+   EXPECT_EQ(Tree_[Handles[5]].Parent, Handles[1]);
+   EXPECT_EQ(Tree_[Handles[5]].Depth, 2);
+   EXPECT_EQ(Tree_[Handles[3]].Children.size(), 5);
+
+   EXPECT_EQ(Data(Tree_, Tree_.DepthFirst()), (DArray<int>{0, 1, 4, 5, 2, 6, 3, 7, 8, 9, 10, 11}));
+   EXPECT_EQ(Data(Tree_, Tree_.BreadthFirst()), (DArray<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11}));
+   EXPECT_EQ(Data(Tree_, Tree_.DepthFirst(Handles[1])), (DArray<int>{1, 4, 5}));
+   EXPECT_EQ(Data(Tree_, Tree_.BreadthFirst(Handles[3])), (DArray<int>{3, 7, 8, 9, 10, 11}));
+
+   const Tree<int> empty;
+   EXPECT_EQ(Data(empty, empty.DepthFirst()).size(), 0);
+}
+
+/***************************************************************************************************************************************************************
+* Test Removal and Compaction
+***************************************************************************************************************************************************************/
+TEST_F(TreeTest, RemoveCompact)
+{
+   Tree_.Remove(Handles[1]);
+   Tree_.Remove(Handles[9]);
+   EXPECT_EQ(Tree_.size(), 8);
+   EXPECT_EQ(Tree_.isNode(Handles[4]), false);
+   EXPECT_EQ(Data(Tree_, Tree_.DepthFirst()), (DArray<int>{0, 2, 6, 3, 7, 8, 10, 11}));
+
+   // The freed handles are reused.
+   const NodeHandle node = Tree_.AddChild(Handles[6], 12);
+   EXPECT_LT(node, 12);
+   EXPECT_EQ(Tree_[node].Depth, 3);
+   EXPECT_EQ(Data(Tree_, Tree_.DepthFirst()), (DArray<int>{0, 2, 6, 12, 3, 7, 8, 10, 11}));
+
+   // Compaction stores the nodes in depth-first order.
+   const auto handles = Tree_.Compact();
+   EXPECT_EQ(handles[Handles[1]], NullNode);
+   EXPECT_EQ(handles[node], 3);
+   NodeHandle expected{};
+   for(const NodeHandle n : Tree_.DepthFirst()) EXPECT_EQ(n, expected++);
+   EXPECT_EQ(Data(Tree_, Tree_.BreadthFirst()), (DArray<int>{0, 2, 3, 6, 7, 8, 10, 11, 12}));
+   EXPECT_EQ(Tree_[handles[Handles[11]]].Parent, handles[Handles[3]]);
+
+   Tree_.Remove(Tree_.Root());
+   EXPECT_EQ(Tree_.empty(), true);
+   EXPECT_EQ(Tree_.size(), 0);
+}
+
+/***************************************************************************************************************************************************************
+* Test Static Nodes
+***************************************************************************************************************************************************************/
+TEST_F(TreeTest, StaticNodes)
+{
+   Tree<int, StaticNode<int, 2>> tree;
+   const NodeHandle root  = tree.AddRoot(0);
+   const NodeHandle right = tree.AddChild(root, 1, 2);
+   const NodeHandle left  = tree.AddChild(root, 1);
+   tree.AddChild(right, 1, 4);
+   tree.AddChild(left, 3);
+
+   EXPECT_EQ(tree[root].Children[0], left);
+   EXPECT_EQ(Data(tree, tree.DepthFirst()), (DArray<int>{0, 1, 3, 2, 4}));
+   EXPECT_EQ(Data(tree, tree.BreadthFirst()), (DArray<int>{0, 1, 2, 3, 4}));
+   tree.Remove(left);
+   EXPECT_EQ(tree[root].Children[0], NullNode);
+   EXPECT_EQ(Data(tree, tree.DepthFirst()), (DArray<int>{0, 2, 4}));
+}
+
+}
+
+#endif
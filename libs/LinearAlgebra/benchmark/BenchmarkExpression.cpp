@@ -0,0 +1,62 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#include "../../../include/Global.h"
+#include "../../Benchmark/include/Benchmark.h"
+#include "../include/Vector.h"
+
+using namespace aprn;
+
+/***************************************************************************************************************************************************************
+* Compares the evaluation of a + b * 2 - c using eagerly evaluated temporaries, a fused expression, and a hand-written loop.
+***************************************************************************************************************************************************************/
+int main()
+{
+   constexpr size_t n_laps = 20;
+   Benchmark benchmark;
+
+   for(const size_t size : {std::size_t{1} << 10, std::size_t{1} << 16, std::size_t{1} << 22})
+   {
+      DVectorR a(size), b(size), c(size), result(size);
+      a.Randomise();
+      b.Randomise();
+      c.Randomise();
+
+      const std::string suffix = " n=" + ToString(size);
+      FOR(lap, n_laps)
+      {
+         // Eager evaluation, materialising each intermediate result as the previous operator overloads did.
+         benchmark.StartTimer("Temps" + suffix);
+         const DVectorR temp0 = b * Two;
+         const DVectorR temp1 = a + temp0;
+         result = temp1 - c;
+         benchmark.StopTimer("Temps" + suffix);
+
+         benchmark.StartTimer("Expr" + suffix);
+         result = a + b * Two - c;
+         benchmark.StopTimer("Expr" + suffix);
+
+         // Hand-written loop over raw pointers, bypassing the bounds-checked subscript operator.
+         benchmark.StartTimer("Loop" + suffix);
+         Real* const r_ptr = result.data();
+         const Real* const a_ptr = a.data();
+         const Real* const b_ptr = b.data();
+         const Real* const c_ptr = c.data();
+         FOR(i, size) r_ptr[i] = a_ptr[i] + b_ptr[i] * Two - c_ptr[i];
+         benchmark.StopTimer("Loop" + suffix);
+      }
+   }
+
+   benchmark.PrintResults();
+}
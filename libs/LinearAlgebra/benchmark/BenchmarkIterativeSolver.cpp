@@ -0,0 +1,64 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+
+#include "../../../include/Global.h"
+#include "../../Benchmark/include/Benchmark.h"
+#include "../include/IterativeSolver.h"
+
+using namespace aprn;
+
+/***************************************************************************************************************************************************************
+* Reports iterations to a relative residual of 10^-6 and time per iteration of each solver and preconditioner on a 3D Poisson problem with 10^6 unknowns,
+* and the time per iteration of CG on 10^7 unknowns, for which the iterations are capped.
+***************************************************************************************************************************************************************/
+namespace {
+
+template<class Solver>
+void
+Report(const std::string& name, const size_t n_unknowns, Solver&& solve)
+{
+   Timer timer;
+   timer.Start();
+   const SolverResult result = solve();
+   timer.Stop();
+   const Real time = timer.TotalLapTime(TimeUnit::MilliSecond);
+   Print(name, "| n =", n_unknowns, "| iterations:", result.nIterations, "| residual:", result.RelativeResidual, "| total (ms):", time, "| per iteration (ms):",
+         time / static_cast<Real>(Max(result.nIterations, size_t{1})));
+}
+
+}
+
+int main()
+{
+   for(const auto& [n, max_iterations] : {std::pair<size_t, size_t>{100, 5000}, {216, 50}})
+   {
+      const SparseMatrix<Real> matrix = PoissonMatrix(n, 3);
+      const size_t n_unknowns = matrix.nRows();
+      const auto poisson = [&](const DVectorR& x, DVectorR& y){ matrix.Multiply(x, y); };
+      const SolverSettings settings{1.0e-6, max_iterations, 30};
+      DVectorR b(n_unknowns, One), x;
+
+      Report("CG             ", n_unknowns, [&]{ x.clear(); return ConjugateGradient(poisson, b, x, settings); });
+      Report("CG Jacobi      ", n_unknowns, [&]{ x.clear(); return ConjugateGradient(poisson, b, x, settings, JacobiPreconditioner(matrix)); });
+      if(n_unknowns > 1000000) continue;
+
+      Report("CG SSOR        ", n_unknowns, [&]{ x.clear(); return ConjugateGradient(poisson, b, x, settings, SSORPreconditioner(matrix, 1.5)); });
+      Report("CG ILU(0)      ", n_unknowns, [&]{ x.clear(); return ConjugateGradient(poisson, b, x, settings, ILU0Preconditioner(matrix)); });
+      Report("BiCGSTAB       ", n_unknowns, [&]{ x.clear(); return BiCGSTAB(poisson, b, x, settings); });
+      Report("BiCGSTAB ILU(0)", n_unknowns, [&]{ x.clear(); return BiCGSTAB(poisson, b, x, settings, ILU0Preconditioner(matrix)); });
+      Report("GMRES(30)      ", n_unknowns, [&]{ x.clear(); return GMRES(poisson, b, x, settings); });
+      Report("GMRES(30) ILU0 ", n_unknowns, [&]{ x.clear(); return GMRES(poisson, b, x, settings, ILU0Preconditioner(matrix)); });
+   }
+}
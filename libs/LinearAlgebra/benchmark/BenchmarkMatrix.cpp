@@ -0,0 +1,105 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+
+#include "../../../include/Global.h"
+#include "../../Benchmark/include/Benchmark.h"
+#include "../include/MatrixOperations.h"
+
+using namespace aprn;
+
+/***************************************************************************************************************************************************************
+* Reports the GFLOP/s of square matrix products of sizes 4 to 4096, for the naive triple loop, the blocked Gemm, and Gemv. The number of laps is scaled to keep
+* the work per size roughly constant, and the naive loop is skipped for the largest sizes. Fixed-size 3x3 and 4x4 products are timed separately.
+***************************************************************************************************************************************************************/
+namespace {
+
+void
+NaiveProduct(const DynamicMatrix<Real>& a, const DynamicMatrix<Real>& b, DynamicMatrix<Real>& c)
+{
+   const size_t n = a.nRows();
+   const Real* a_data = a.View<2>().Data();
+   const Real* b_data = b.View<2>().Data();
+   Real* c_data = c.View<2>().Data();
+   FOR(i, n) FOR(j, n)
+   {
+      Real sum{};
+      FOR(p, n) sum += a_data[i + p * n] * b_data[p + j * n];
+      c_data[i + j * n] = sum;
+   }
+}
+
+template<class F>
+Real
+GigaFlops(const Real flops, const size_t n_laps, F&& product)
+{
+   Timer timer;
+   timer.Start();
+   FOR(lap, n_laps) product();
+   timer.Stop();
+   return flops * static_cast<Real>(n_laps) / timer.TotalLapTime(TimeUnit::NanoSecond);
+}
+
+}
+
+int main()
+{
+   constexpr size_t max_naive_size = 1024;
+   Real checksum{};
+
+   SetFormat(PrintFormat::Fixed);
+   SetPrecision(2);
+   Print("Size | Naive GFLOP/s | Gemm GFLOP/s | Gemv GFLOP/s");
+   for(size_t n = 4; n <= 4096; n *= 2)
+   {
+      DynamicMatrix<Real> a(n, n), b(n, n), c(n, n, Zero);
+      DVectorR x(n), y(n, Zero);
+      a.Randomise();
+      b.Randomise();
+      x.Randomise();
+
+      const auto product_flops = Two * static_cast<Real>(n * n * n);
+      const size_t n_laps = Max(size_t(1), (size_t(1) << 28) / (n * n * n));
+
+      const Real naive = n > max_naive_size ? Zero : GigaFlops(product_flops, n_laps, [&]{ NaiveProduct(a, b, c); });
+      checksum += c(0, 0);
+      const Real gemm = GigaFlops(product_flops, n_laps, [&]{ Gemm(One, std::as_const(a).View<2>(), std::as_const(b).View<2>(), Zero, c.View<2>()); });
+      checksum += c(0, 0);
+      const Real gemv = GigaFlops(Two * static_cast<Real>(n * n), (size_t(1) << 28) / (n * n), [&]{ Gemv(One, std::as_const(a).View<2>(), x.data(), Zero, y.data()); });
+      checksum += y[0];
+
+      Print(n, "|", naive, "|", gemm, "|", gemv);
+   }
+
+   // Fixed-size products, which are unrolled at compile time.
+   Benchmark benchmark;
+   constexpr size_t n_small = 1000000;
+   SMatrixR3 a3, b3;
+   SMatrixR4 a4, b4;
+   a3.Randomise();
+   a4.Randomise();
+   b3 = a3;
+   b4 = a4;
+
+   benchmark.StartTimer("3x3 Product");
+   FOR(i, n_small) b3 = MatrixProduct(a3, b3) * Half;
+   benchmark.StopTimer("3x3 Product");
+
+   benchmark.StartTimer("4x4 Product");
+   FOR(i, n_small) b4 = MatrixProduct(a4, b4) * Half;
+   benchmark.StopTimer("4x4 Product");
+
+   Print("Checksum:", checksum + b3(0, 0) + b4(0, 0));
+   benchmark.PrintResults();
+}
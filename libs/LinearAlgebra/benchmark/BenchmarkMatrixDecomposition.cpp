@@ -0,0 +1,96 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+
+#include "../../../include/Global.h"
+#include "../../Benchmark/include/Benchmark.h"
+#include "../include/MatrixDecomposition.h"
+
+using namespace aprn;
+
+/***************************************************************************************************************************************************************
+* Reports the GFLOP/s of the LU, Cholesky and QR decompositions of systems of size 1024 to 4096, and times solves with 1 and 64 right-hand sides using the
+* factors. The matrices are symmetric and diagonally dominant, hence positive definite.
+***************************************************************************************************************************************************************/
+namespace {
+
+template<class F>
+Real
+GigaFlops(const Real flops, F&& factorise)
+{
+   Timer timer;
+   timer.Start();
+   factorise();
+   timer.Stop();
+   return flops / timer.TotalLapTime(TimeUnit::NanoSecond);
+}
+
+template<class D>
+void
+TimeSolves(Benchmark& benchmark, const D& decomposition, const std::string& name, DynamicMatrix<Real>& rhs, const DVectorR& b, Real& checksum)
+{
+   constexpr size_t n_laps = 10;
+   FOR(lap, n_laps)
+   {
+      benchmark.StartTimer(name + " Solve");
+      const DVectorR x = decomposition.Solve(b);
+      benchmark.StopTimer(name + " Solve");
+      checksum += x[lap];
+
+      benchmark.StartTimer(name + " Solve x" + ToString(rhs.nColumns()));
+      decomposition.Solve(rhs.View<2>());
+      benchmark.StopTimer(name + " Solve x" + ToString(rhs.nColumns()));
+      checksum += rhs(lap, 0);
+   }
+}
+
+}
+
+int main()
+{
+   constexpr size_t n_rhs = 64;
+   Benchmark benchmark;
+   Random<Real> random(-One, One);
+   Real checksum{};
+
+   SetFormat(PrintFormat::Fixed);
+   SetPrecision(2);
+   Print("Size | LU GFLOP/s | Cholesky GFLOP/s | QR GFLOP/s");
+   for(size_t n = 1024; n <= 4096; n *= 2)
+   {
+      DynamicMatrix<Real> matrix(n, n), rhs(n, n_rhs);
+      FOR(j, n) FOR(i, j, n) matrix(i, j) = matrix(j, i) = i == j ? static_cast<Real>(n) : random();
+      FOR_EACH(entry, rhs) entry = random();
+      DVectorR b(n);
+      b.Randomise();
+
+      const auto size = static_cast<Real>(n);
+      const Real lu_flops = Two / Three * size * size * size;
+      std::unique_ptr<LUDecomposition> lu;
+      std::unique_ptr<CholeskyDecomposition> cholesky;
+      std::unique_ptr<QRDecomposition> qr;
+      const Real lu_rate       = GigaFlops(lu_flops, [&]{ lu = std::make_unique<LUDecomposition>(matrix); });
+      const Real cholesky_rate = GigaFlops(Half * lu_flops, [&]{ cholesky = std::make_unique<CholeskyDecomposition>(matrix); });
+      const Real qr_rate       = GigaFlops(Two * lu_flops, [&]{ qr = std::make_unique<QRDecomposition>(matrix); });
+      Print(n, "|", lu_rate, "|", cholesky_rate, "|", qr_rate);
+
+      const std::string suffix = " n=" + ToString(n);
+      TimeSolves(benchmark, *lu, "LU" + suffix, rhs, b, checksum);
+      TimeSolves(benchmark, *cholesky, "Cholesky" + suffix, rhs, b, checksum);
+      TimeSolves(benchmark, *qr, "QR" + suffix, rhs, b, checksum);
+   }
+
+   Print("Checksum:", checksum);
+   benchmark.PrintResults();
+}
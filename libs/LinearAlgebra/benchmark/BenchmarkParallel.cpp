@@ -0,0 +1,71 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+
+#include "../../../include/Global.h"
+#include "../../Benchmark/include/Benchmark.h"
+#include "../include/Vector.h"
+
+#include <cstdlib>
+
+using namespace aprn;
+
+/***************************************************************************************************************************************************************
+* Measures the scaling of the parallel reductions, clipping, and expression evaluation from one thread to all threads, on vectors of 10^3 entries up to
+* 10^max_exponent entries. The maximum exponent defaults to 8, and can be raised to 9 on machines with over 24 GB of memory.
+***************************************************************************************************************************************************************/
+int main(int argc, char* argv[])
+{
+   constexpr size_t n_laps = 5;
+   const size_t max_exponent = argc > 1 ? static_cast<size_t>(std::atoi(argv[1])) : 8;
+   const size_t max_threads = nThreads();
+   Benchmark benchmark;
+   Real checksum{};
+
+   for(size_t size = 1000, exponent = 3; exponent <= max_exponent; size *= 10, ++exponent)
+   {
+      DVectorR a(size), b(size), result(size);
+      a.Randomise();
+      b.Randomise();
+
+      for(size_t n_threads = 1; n_threads <= max_threads; n_threads *= 2)
+      {
+         SetThreads(n_threads);
+         const std::string suffix = " n=1e" + ToString(exponent) + " t=" + ToString(n_threads);
+         FOR(lap, n_laps)
+         {
+            benchmark.StartTimer("Sum" + suffix);
+            checksum += Sum<Par>(a.begin(), a.end());
+            benchmark.StopTimer("Sum" + suffix);
+
+            benchmark.StartTimer("MaxEntry" + suffix);
+            checksum += MaxEntry<Par>(a.begin(), a.end());
+            benchmark.StopTimer("MaxEntry" + suffix);
+
+            benchmark.StartTimer("BoundEntries" + suffix);
+            BoundEntries<Par>(b.begin(), b.end(), -Half, Half);
+            benchmark.StopTimer("BoundEntries" + suffix);
+
+            benchmark.StartTimer("Expr" + suffix);
+            result.Assign<Par>(a + b * Two);
+            benchmark.StopTimer("Expr" + suffix);
+            checksum += result[lap];
+         }
+      }
+      SetThreads(max_threads);
+   }
+
+   Print("Checksum:", checksum);
+   benchmark.PrintResults();
+}
@@ -0,0 +1,105 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#include "../../../include/Global.h"
+#include "../../Benchmark/include/Benchmark.h"
+#include "../include/MatrixOperations.h"
+
+#include <vector>
+
+using namespace aprn;
+
+/***************************************************************************************************************************************************************
+* Compares single and double precision throughput of the SIMD reductions, batched normalisations and matrix products, and reports the relative error of the
+* single-precision results against double precision.
+***************************************************************************************************************************************************************/
+template<typename T>
+struct PrecisionData
+{
+   std::vector<T>    A, B, X, Y, Z, Out;
+   DMatrix<T>        MatrixA, MatrixB, MatrixC;
+   std::vector<Bool> Degenerate;
+};
+
+template<typename T>
+PrecisionData<T>
+MakeData(const std::vector<Real>& a, const std::vector<Real>& b, const DMatrixR& matrix_a, const DMatrixR& matrix_b)
+{
+   const auto cast = [](const std::vector<Real>& from){ return std::vector<T>(from.begin(), from.end()); };
+   const size_t n = a.size();
+   return {cast(a), cast(b), cast(a), cast(b), std::vector<T>(a.rbegin(), a.rend()), std::vector<T>(n), MatrixCast<T>(matrix_a), MatrixCast<T>(matrix_b),
+           DMatrix<T>(matrix_a.Dimension(0), matrix_b.Dimension(1)), std::vector<Bool>(n)};
+}
+
+template<typename T>
+void
+RunPrecision(PrecisionData<T>& data, const std::string& label, Benchmark& benchmark, Real& dot)
+{
+   const size_t n = data.A.size();
+   constexpr size_t n_repeats = 20;
+
+   benchmark.StartTimer(label + " Dot");
+   FOR(i, n_repeats) dot = static_cast<Real>(simd::Dot(data.A.data(), data.B.data(), n));
+   benchmark.StopTimer(label + " Dot");
+
+   benchmark.StartTimer(label + " Axpy");
+   FOR(i, n_repeats) simd::Axpy(static_cast<T>(1e-3), data.A.data(), data.Out.data(), n);
+   benchmark.StopTimer(label + " Axpy");
+
+   const simd::Vectors3<const T> vectors{data.X.data(), data.Y.data(), data.Z.data()};
+   const simd::Vectors3<T> normalised{data.A.data(), data.B.data(), data.Out.data()};
+   benchmark.StartTimer(label + " Normalise");
+   FOR(i, n_repeats) simd::Normalise(vectors, normalised, data.Degenerate.data(), n, static_cast<T>(ZeroTolerance));
+   benchmark.StopTimer(label + " Normalise");
+
+   benchmark.StartTimer(label + " Gemm");
+   Gemm(T{1}, std::as_const(data.MatrixA).template View<2>(), std::as_const(data.MatrixB).template View<2>(), T{}, data.MatrixC.template View<2>());
+   benchmark.StopTimer(label + " Gemm");
+}
+
+int main()
+{
+   constexpr size_t n = 1 << 22;
+   constexpr size_t n_matrix = 768;
+   Benchmark benchmark;
+
+   Random<Real> random(-One, One);
+   std::vector<Real> a(n), b(n);
+   FOR(i, n)
+   {
+      a[i] = random();
+      b[i] = random();
+   }
+   DMatrixR matrix_a(n_matrix, n_matrix), matrix_b(n_matrix, n_matrix);
+   FOR_EACH(entry, matrix_a) entry = random();
+   FOR_EACH(entry, matrix_b) entry = random();
+
+   auto data_double = MakeData<double>(a, b, matrix_a, matrix_b);
+   auto data_float  = MakeData<float>(a, b, matrix_a, matrix_b);
+
+   Real dot_double{}, dot_float{};
+   RunPrecision(data_double, "Double", benchmark, dot_double);
+   RunPrecision(data_float, "Float", benchmark, dot_float);
+
+   // Errors relative to the double-precision results, for the reduction and the worst matrix product entry, the latter scaled by the entry magnitudes.
+   Real gemm_error{};
+   FOR(i, n_matrix) FOR(j, n_matrix)
+   {
+      const Real error = Abs(static_cast<Real>(data_float.MatrixC(i, j)) - data_double.MatrixC(i, j)) / std::sqrt(static_cast<Real>(n_matrix));
+      gemm_error = Max(gemm_error, error);
+   }
+   Print("Float dot relative error:", Abs(dot_float - dot_double) / Abs(dot_double));
+   Print("Float Gemm max scaled error:", gemm_error);
+   benchmark.PrintResults();
+}
@@ -0,0 +1,95 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+
+#include "../../../include/Global.h"
+#include "../../Benchmark/include/Benchmark.h"
+#include "../../DataContainer/include/MultiArray.h"
+#include "../include/SparseMatrix.h"
+
+using namespace aprn;
+
+/***************************************************************************************************************************************************************
+* Times assembly, format conversion, and sparse products of 2D and 3D Poisson matrices with 10^6 to 10^7 non-zeros. Matrix-vector products are compared
+* between formats and thread counts, and a matrix-matrix product with 8 right-hand sides against 8 matrix-vector products.
+***************************************************************************************************************************************************************/
+int main()
+{
+   constexpr size_t n_laps = 10;
+   constexpr size_t n_rhs = 8;
+   const size_t max_threads = nThreads();
+   Benchmark benchmark;
+   Real checksum{};
+
+   for(const auto& [n, n_dims] : {std::pair<size_t, size_t>{450, 2}, {1400, 2}, {55, 3}, {115, 3}})
+   {
+      benchmark.StartTimer("Assembly");
+      SparseMatrix<Real> matrix = PoissonMatrix(n, n_dims);
+      benchmark.StopTimer("Assembly");
+
+      const std::string suffix = " " + ToString(n_dims) + "D nnz=" + ToString(matrix.nNonZeros());
+      Print("Poisson matrix", suffix, "rows:", matrix.nRows());
+
+      DVectorR x(matrix.nColumns()), y(matrix.nRows());
+      x.Randomise();
+      DynamicMultiArray<Real, RowMajor> x_block(matrix.nColumns(), n_rhs), y_block(matrix.nRows(), n_rhs);
+      FOR_EACH(entry, x_block) entry = One;
+
+      FOR(lap, n_laps)
+      {
+         for(size_t n_threads = 1; n_threads <= max_threads; n_threads *= 2)
+         {
+            SetThreads(n_threads);
+            benchmark.StartTimer("CSR SpMV t=" + ToString(n_threads) + suffix);
+            matrix.Multiply(x, y);
+            benchmark.StopTimer("CSR SpMV t=" + ToString(n_threads) + suffix);
+            checksum += y[lap];
+         }
+         SetThreads(max_threads);
+
+         benchmark.StartTimer("CSR SpMM" + suffix);
+         matrix.Multiply(std::as_const(x_block).View<2>(), y_block.View<2>());
+         benchmark.StopTimer("CSR SpMM" + suffix);
+         checksum += y_block(lap, 0);
+
+         benchmark.StartTimer("CSR SpMV x" + ToString(n_rhs) + suffix);
+         FOR(rhs, n_rhs) matrix.Multiply(x, y);
+         benchmark.StopTimer("CSR SpMV x" + ToString(n_rhs) + suffix);
+      }
+
+      benchmark.StartTimer("CSR to CSC" + suffix);
+      matrix.Convert(SparseFormat::CSC);
+      benchmark.StopTimer("CSR to CSC" + suffix);
+
+      FOR(lap, n_laps)
+      {
+         benchmark.StartTimer("CSC SpMV" + suffix);
+         matrix.Multiply(x, y);
+         benchmark.StopTimer("CSC SpMV" + suffix);
+         checksum += y[lap];
+      }
+
+      matrix.Convert(SparseFormat::COO);
+      FOR(lap, n_laps)
+      {
+         benchmark.StartTimer("COO SpMV" + suffix);
+         matrix.Multiply(x, y);
+         benchmark.StopTimer("COO SpMV" + suffix);
+         checksum += y[lap];
+      }
+   }
+
+   Print("Checksum:", checksum);
+   benchmark.PrintResults();
+}
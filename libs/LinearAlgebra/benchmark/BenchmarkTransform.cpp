@@ -0,0 +1,77 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+
+#include "../../../include/Global.h"
+#include "../../Benchmark/include/Benchmark.h"
+#include "../include/MatrixOperations.h"
+
+#if __has_include(<glm/glm.hpp>)
+#define APRN_BENCHMARK_GLM
+#include <glm/glm.hpp>
+#endif
+
+using namespace aprn;
+
+/***************************************************************************************************************************************************************
+* Compares the batch throughput of 4x4 homogeneous transformations of points, and of 4x4 inversions, against GLM in double precision. The GLM timings are
+* skipped when GLM is unavailable.
+***************************************************************************************************************************************************************/
+int main()
+{
+   constexpr size_t n_points = 1 << 16;
+   constexpr size_t n_laps   = 100;
+   Benchmark benchmark;
+   Real checksum{};
+
+   const SMatrixR4 transform = AffineMatrix(RotationMatrix(0.3, SVectorR3{1.0, 2.0, 3.0}), SVectorR3{1.0, -1.0, 0.5});
+   std::vector<SVectorR4> points(n_points), transformed(n_points);
+   FOR_EACH(point, points)
+   {
+      point.Randomise();
+      point[3] = One;
+   }
+
+   benchmark.StartTimer("Transform");
+   FOR(lap, n_laps) FOR(i, n_points) transformed[i] = MatrixVectorProduct(transform, points[i]);
+   benchmark.StopTimer("Transform");
+   checksum += transformed.back()[0];
+
+   SMatrixR4 inverse = transform;
+   benchmark.StartTimer("Inverse");
+   FOR(lap, n_laps * n_points / 16) inverse = Inverse(inverse);
+   benchmark.StopTimer("Inverse");
+   checksum += inverse(0, 3);
+
+#ifdef APRN_BENCHMARK_GLM
+   glm::dmat4 glm_transform;
+   FOR(j, 4) FOR(i, 4) glm_transform[j][i] = transform(i, j);
+   std::vector<glm::dvec4> glm_points(n_points), glm_transformed(n_points);
+   FOR(i, n_points) glm_points[i] = glm::dvec4(points[i][0], points[i][1], points[i][2], points[i][3]);
+
+   benchmark.StartTimer("GLM Transform");
+   FOR(lap, n_laps) FOR(i, n_points) glm_transformed[i] = glm_transform * glm_points[i];
+   benchmark.StopTimer("GLM Transform");
+   checksum += glm_transformed.back()[0];
+
+   glm::dmat4 glm_inverse = glm_transform;
+   benchmark.StartTimer("GLM Inverse");
+   FOR(lap, n_laps * n_points / 16) glm_inverse = glm::inverse(glm_inverse);
+   benchmark.StopTimer("GLM Inverse");
+   checksum += glm_inverse[3][0];
+#endif
+
+   Print("Checksum:", checksum);
+   benchmark.PrintResults();
+}
@@ -0,0 +1,78 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+
+#include "../../../include/Global.h"
+#include "../../Benchmark/include/Benchmark.h"
+#include "../include/VectorOperations.h"
+
+#include <vector>
+
+using namespace aprn;
+
+/***************************************************************************************************************************************************************
+* Compares cross products, normalisations and angles computed one static vector at a time, against the batched SIMD kernels over structures of arrays.
+***************************************************************************************************************************************************************/
+int main()
+{
+   constexpr size_t n = 1 << 22;
+   Benchmark benchmark;
+   Real checksum{};
+
+   std::vector<SVectorR3> vectors0(n), vectors1(n), results(n);
+   std::vector<Real> angles(n);
+   SoAVectorsR3 soa_vectors0(n), soa_vectors1(n), soa_results(n);
+   DArrayF soa_angles(n);
+   DArrayB degenerate;
+   FOR(i, n)
+   {
+      vectors0[i].Randomise();
+      vectors1[i].Randomise();
+      soa_vectors0[i] = std::make_tuple(vectors0[i][0], vectors0[i][1], vectors0[i][2]);
+      soa_vectors1[i] = std::make_tuple(vectors1[i][0], vectors1[i][1], vectors1[i][2]);
+   }
+
+   benchmark.StartTimer("Cross Product");
+   FOR(i, n) results[i] = CrossProduct(vectors0[i], vectors1[i]);
+   benchmark.StopTimer("Cross Product");
+   checksum += results.back()[0];
+
+   benchmark.StartTimer("Batched Cross");
+   CrossProduct(soa_vectors0, soa_vectors1, soa_results);
+   benchmark.StopTimer("Batched Cross");
+   checksum += soa_results.Field<0>().back();
+
+   benchmark.StartTimer("Normalise");
+   FOR(i, n) results[i] = Normalise(vectors0[i]);
+   benchmark.StopTimer("Normalise");
+   checksum += results.back()[0];
+
+   benchmark.StartTimer("Batched Normalise");
+   checksum += static_cast<Real>(Normalise(soa_vectors0, soa_results, degenerate));
+   benchmark.StopTimer("Batched Normalise");
+   checksum += soa_results.Field<0>().back();
+
+   benchmark.StartTimer("Angle");
+   FOR(i, n) angles[i] = ComputeAngle(vectors0[i], vectors1[i]);
+   benchmark.StopTimer("Angle");
+   checksum += angles.back();
+
+   benchmark.StartTimer("Batched Angle");
+   checksum += static_cast<Real>(ComputeAngle(soa_vectors0, soa_vectors1, soa_angles, degenerate));
+   benchmark.StopTimer("Batched Angle");
+   checksum += soa_angles.back();
+
+   Print("Checksum:", checksum);
+   benchmark.PrintResults();
+}
@@ -0,0 +1,132 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+
+#pragma once
+
+#include "../../../include/Global.h"
+#include "../../../include/Parallel.h"
+#include "../../DataContainer/include/Array.h"
+#include "../../DataContainer/include/Simd.h"
+#include "Matrix.h"
+#include "SparseMatrix.h"
+#include "Vector.h"
+
+#include <cmath>
+#include <concepts>
+
+namespace aprn {
+
+/***************************************************************************************************************************************************************
+* Solver Settings and Results
+***************************************************************************************************************************************************************/
+
+/** Stopping criteria of the iterative solvers, which stop once the residual norm |b - A x| falls below Tolerance |b|. */
+struct SolverSettings
+{
+   Real   Tolerance{1.0e-8};
+   size_t MaxIterations{1000};
+   size_t Restart{30}; // Dimension of the Krylov subspace built by GMRES between restarts.
+};
+
+struct SolverResult
+{
+   size_t nIterations{};
+   Real   RelativeResidual{};
+   bool   isConverged{};
+};
+
+/** Linear operators are any callables computing y = A x, e.g. a lambda wrapping SparseMatrix::Multiply, or a matrix-free stencil. */
+template<class A>
+concept LinearOperator = std::invocable<A&, const DVectorR&, DVectorR&>;
+
+/***************************************************************************************************************************************************************
+* Preconditioners
+***************************************************************************************************************************************************************/
+
+/** Preconditioners apply an approximate inverse of A, z = M^-1 r, resizing z to the size of r. */
+template<class P>
+concept Preconditioner = requires(const P& preconditioner, const DVectorR& r, DVectorR& z) { preconditioner(r, z); };
+
+struct IdentityPreconditioner
+{
+   void operator()(const DVectorR& r, DVectorR& z) const { z = r; }
+};
+
+/** Diagonal scaling, z_i = r_i / A_ii, which is applied in parallel. The matrix must be in CSR format, as for the preconditioners below. */
+class JacobiPreconditioner
+{
+ public:
+   explicit JacobiPreconditioner(const SparseMatrix<Real>& matrix);
+
+   void operator()(const DVectorR& r, DVectorR& z) const;
+
+ private:
+   DVectorR InverseDiagonal_;
+};
+
+/** Symmetric successive over-relaxation, i.e. a forward and a backward Gauss-Seidel sweep with relaxation factor 0 < omega < 2, which preserves symmetry and
+ *  so can precondition CG. The sweeps are sequential. The matrix is referenced, not copied, so must outlive the preconditioner. */
+class SSORPreconditioner
+{
+ public:
+   explicit SSORPreconditioner(const SparseMatrix<Real>& matrix, const Real omega = One);
+
+   void operator()(const DVectorR& r, DVectorR& z) const;
+
+ private:
+   const SparseMatrix<Real>* Matrix_;
+   DArray<size_t>            DiagonalPositions_;
+   Real                      Omega_;
+};
+
+/** Incomplete LU factorisation with zero fill-in, A ~ L U, where L and U keep the sparsity pattern of A. The triangular solves are sequential. */
+class ILU0Preconditioner
+{
+ public:
+   explicit ILU0Preconditioner(const SparseMatrix<Real>& matrix);
+
+   void operator()(const DVectorR& r, DVectorR& z) const;
+
+ private:
+   using Index = SparseMatrix<Real>::Index;
+
+   DArray<size_t> Offsets_;
+   DArray<Index>  Indices_;
+   DArray<Real>   Values_; // Unit lower triangular L below the diagonal, and U on and above it.
+   DArray<size_t> DiagonalPositions_;
+};
+
+/***************************************************************************************************************************************************************
+* Krylov Subspace Solvers
+***************************************************************************************************************************************************************/
+
+/** Iterative solvers of A x = b, starting from the initial guess in x, or from zero if x is not sized as b. Vector updates are fused with the reductions that
+ *  follow them, and applied in cache-sized chunks split between threads, so that each iteration streams through the vectors as few times as possible. */
+
+/** Preconditioned conjugate gradient method, for symmetric positive-definite A and M. */
+template<LinearOperator A, Preconditioner P = IdentityPreconditioner>
+SolverResult ConjugateGradient(A&& matrix, const DVectorR& b, DVectorR& x, const SolverSettings& settings = {}, const P& preconditioner = {});
+
+/** Right-preconditioned stabilised bi-conjugate gradient method, for general A. Each iteration applies A and M twice. */
+template<LinearOperator A, Preconditioner P = IdentityPreconditioner>
+SolverResult BiCGSTAB(A&& matrix, const DVectorR& b, DVectorR& x, const SolverSettings& settings = {}, const P& preconditioner = {});
+
+/** Right-preconditioned GMRES, restarted every settings.Restart iterations, for general A. The basis is orthogonalised with modified Gram-Schmidt. */
+template<LinearOperator A, Preconditioner P = IdentityPreconditioner>
+SolverResult GMRES(A&& matrix, const DVectorR& b, DVectorR& x, const SolverSettings& settings = {}, const P& preconditioner = {});
+
+}
+
+#include "IterativeSolver.tpp"
@@ -0,0 +1,439 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <limits>
+
+namespace aprn {
+namespace detail {
+
+/***************************************************************************************************************************************************************
+* Chunked Vector Kernels
+***************************************************************************************************************************************************************/
+
+/** Number of entries per chunk, such that a chunk of each vector of a fused update stays in the L1/L2 cache for the reduction that follows. */
+constexpr size_t KrylovChunkSize = 4096;
+
+/** Apply a function to each chunk [first, last) of [0, n), split between threads. */
+template<class F>
+void
+ChunkedFor(const size_t n, F&& function)
+{
+   ParallelFor((n + KrylovChunkSize - 1) / KrylovChunkSize, [&](const size_t chunk)
+   {
+      const size_t first = chunk * KrylovChunkSize;
+      function(first, Min(first + KrylovChunkSize, n));
+   }, KrylovChunkSize);
+}
+
+/** Reduce the values returned by a function of each chunk [first, last) of [0, n), in an order only depending on the number of threads. */
+template<typename T, class F, class Op = std::plus<T>>
+T
+ChunkedReduce(const size_t n, const T& identity, F&& function, Op&& operation = {})
+{
+   return ParallelReduce((n + KrylovChunkSize - 1) / KrylovChunkSize, identity, [&](const size_t chunk)
+   {
+      const size_t first = chunk * KrylovChunkSize;
+      return function(first, Min(first + KrylovChunkSize, n));
+   }, std::forward<Op>(operation), KrylovChunkSize);
+}
+
+inline Real
+ParallelDot(const DVectorR& a, const DVectorR& b)
+{
+   return ChunkedReduce(a.size(), Zero, [&](const size_t first, const size_t last){ return simd::Dot(a.data() + first, b.data() + first, last - first); });
+}
+
+inline Real
+ParallelNorm(const DVectorR& a) { return std::sqrt(ParallelDot(a, a)); }
+
+/** Norm relative to which residuals are measured, |b|, or 1 if b = 0, in which case residuals are absolute. */
+inline Real
+ReferenceNorm(const DVectorR& b)
+{
+   const Real norm = ParallelNorm(b);
+   return norm == Zero ? One : norm;
+}
+
+/** Apply a preconditioner into z, or return r itself for the identity, which saves a copy per application. */
+template<class P>
+const DVectorR&
+Precondition(const P& preconditioner, const DVectorR& r, DVectorR& z)
+{
+   if constexpr(isTypeSame<P, IdentityPreconditioner>()) return r;
+   else
+   {
+      preconditioner(r, z);
+      return z;
+   }
+}
+
+/** Set r = b - A x, with a zero initial guess if x is not sized as b, and return |r|. */
+template<class A>
+Real
+InitialResidual(A& matrix, const DVectorR& b, DVectorR& x, DVectorR& r)
+{
+   if(x.size() != b.size()) x = DVectorR(b.size(), Zero);
+   matrix(x, r);
+   return std::sqrt(ChunkedReduce(b.size(), Zero, [&](const size_t first, const size_t last)
+   {
+      simd::Subtract(b.data() + first, r.data() + first, r.data() + first, last - first);
+      return simd::Dot(r.data() + first, r.data() + first, last - first);
+   }));
+}
+
+/** Position of the diagonal entry of each row of a CSR matrix. */
+inline DArray<size_t>
+DiagonalPositions(const SparseMatrix<Real>& matrix)
+{
+   ASSERT(matrix.Format() == SparseFormat::CSR, "Preconditioners require matrices in CSR format.")
+   ASSERT(matrix.nRows() == matrix.nColumns(), "Preconditioners require square matrices.")
+
+   const auto& offsets = matrix.Offsets();
+   const auto& indices = matrix.Indices();
+   DArray<size_t> positions;
+   positions.resize(matrix.nRows());
+   FOR(i, matrix.nRows())
+   {
+      const auto first = indices.begin() + static_cast<std::ptrdiff_t>(offsets[i]);
+      const auto last  = indices.begin() + static_cast<std::ptrdiff_t>(offsets[i + 1]);
+      const auto diagonal = std::lower_bound(first, last, i);
+      ASSERT(diagonal != last && *diagonal == i, "The diagonal entry of row ", i, " is missing.")
+      positions[i] = static_cast<size_t>(diagonal - indices.begin());
+   }
+   return positions;
+}
+
+}//detail
+
+/***************************************************************************************************************************************************************
+* Preconditioners
+***************************************************************************************************************************************************************/
+inline
+JacobiPreconditioner::JacobiPreconditioner(const SparseMatrix<Real>& matrix)
+   : InverseDiagonal_(matrix.nRows())
+{
+   const auto positions = detail::DiagonalPositions(matrix);
+   FOR(i, matrix.nRows())
+   {
+      const Real diagonal = matrix.Values()[positions[i]];
+      ASSERT(diagonal != Zero, "The diagonal entry of row ", i, " is zero.")
+      InverseDiagonal_[i] = One / diagonal;
+   }
+}
+
+inline void
+JacobiPreconditioner::operator()(const DVectorR& r, DVectorR& z) const
+{
+   z.resize(r.size());
+   detail::ChunkedFor(r.size(), [&](const size_t first, const size_t last)
+   {
+      simd::Multiply(InverseDiagonal_.data() + first, r.data() + first, z.data() + first, last - first);
+   });
+}
+
+inline
+SSORPreconditioner::SSORPreconditioner(const SparseMatrix<Real>& matrix, const Real omega)
+   : Matrix_(&matrix), DiagonalPositions_(detail::DiagonalPositions(matrix)), Omega_(omega)
+{
+   ASSERT(Zero < omega && omega < Two, "The SSOR relaxation factor ", omega, " must lie in (0, 2).")
+}
+
+inline void
+SSORPreconditioner::operator()(const DVectorR& r, DVectorR& z) const
+{
+   // M^-1 = (2 - omega) / omega (D / omega + U)^-1 (D / omega) (D / omega + L)^-1.
+   const size_t n = r.size();
+   const size_t* offsets = Matrix_->Offsets().data();
+   const auto* indices   = Matrix_->Indices().data();
+   const Real* values    = Matrix_->Values().data();
+   const size_t* diagonals = DiagonalPositions_.data();
+   z.resize(n);
+   Real* z_data = z.data();
+
+   FOR(i, n)
+   {
+      Real sum = r[i];
+      for(size_t k = offsets[i]; k < diagonals[i]; ++k) sum -= values[k] * z_data[indices[k]];
+      z_data[i] = Omega_ * sum / values[diagonals[i]];
+   }
+   for(size_t i = n; i-- > 0;)
+   {
+      Real sum{};
+      for(size_t k = diagonals[i] + 1; k < offsets[i + 1]; ++k) sum += values[k] * z_data[indices[k]];
+      z_data[i] -= Omega_ * sum / values[diagonals[i]];
+   }
+   if(Omega_ != One) simd::MultiplyScalar(z_data, (Two - Omega_) / Omega_, z_data, n);
+}
+
+inline
+ILU0Preconditioner::ILU0Preconditioner(const SparseMatrix<Real>& matrix)
+   : Offsets_(matrix.Offsets()), Indices_(matrix.Indices()), Values_(matrix.Values()), DiagonalPositions_(detail::DiagonalPositions(matrix))
+{
+   // Eliminate row by row, updating only the entries in the pattern of row i, which are located through a scatter of its column positions.
+   constexpr size_t none = std::numeric_limits<size_t>::max();
+   const size_t n = matrix.nRows();
+   DArray<size_t> positions;
+   positions.resize(n, none);
+   FOR(i, n)
+   {
+      FOR(k, Offsets_[i], Offsets_[i + 1]) positions[Indices_[k]] = k;
+      FOR(k, Offsets_[i], DiagonalPositions_[i])
+      {
+         const size_t c = Indices_[k];
+         Values_[k] /= Values_[DiagonalPositions_[c]];
+         FOR(l, DiagonalPositions_[c] + 1, Offsets_[c + 1])
+         {
+            const size_t position = positions[Indices_[l]];
+            if(position != none) Values_[position] -= Values_[k] * Values_[l];
+         }
+      }
+      ASSERT(Values_[DiagonalPositions_[i]] != Zero, "The incomplete LU factorisation has a zero pivot in row ", i, ".")
+      FOR(k, Offsets_[i], Offsets_[i + 1]) positions[Indices_[k]] = none;
+   }
+}
+
+inline void
+ILU0Preconditioner::operator()(const DVectorR& r, DVectorR& z) const
+{
+   const size_t n = r.size();
+   const size_t* offsets   = Offsets_.data();
+   const Index* indices    = Indices_.data();
+   const Real* values      = Values_.data();
+   const size_t* diagonals = DiagonalPositions_.data();
+   z.resize(n);
+   Real* z_data = z.data();
+
+   FOR(i, n)
+   {
+      Real sum = r[i];
+      for(size_t k = offsets[i]; k < diagonals[i]; ++k) sum -= values[k] * z_data[indices[k]];
+      z_data[i] = sum;
+   }
+   for(size_t i = n; i-- > 0;)
+   {
+      Real sum = z_data[i];
+      for(size_t k = diagonals[i] + 1; k < offsets[i + 1]; ++k) sum -= values[k] * z_data[indices[k]];
+      z_data[i] = sum / values[diagonals[i]];
+   }
+}
+
+/***************************************************************************************************************************************************************
+* Conjugate Gradient
+***************************************************************************************************************************************************************/
+template<LinearOperator A, Preconditioner P>
+SolverResult
+ConjugateGradient(A&& matrix, const DVectorR& b, DVectorR& x, const SolverSettings& settings, const P& preconditioner)
+{
+   const size_t n = b.size();
+   DVectorR r(n), z(n), p(n), q(n);
+   const Real b_norm = detail::ReferenceNorm(b);
+   const Real r_norm = detail::InitialResidual(matrix, b, x, r);
+   SolverResult result{0, r_norm / b_norm, false};
+
+   const DVectorR& z0 = detail::Precondition(preconditioner, r, z);
+   p = z0;
+   Real rz = detail::ParallelDot(r, z0);
+   while(result.RelativeResidual > settings.Tolerance && result.nIterations < settings.MaxIterations)
+   {
+      matrix(p, q);
+      const Real alpha = rz / detail::ParallelDot(p, q);
+
+      // x += alpha p and r -= alpha q, fused with |r|^2.
+      const Real rr = detail::ChunkedReduce(n, Zero, [&, alpha](const size_t first, const size_t last)
+      {
+         simd::Axpy( alpha, p.data() + first, x.data() + first, last - first);
+         simd::Axpy(-alpha, q.data() + first, r.data() + first, last - first);
+         return simd::Dot(r.data() + first, r.data() + first, last - first);
+      });
+      ++result.nIterations;
+      result.RelativeResidual = std::sqrt(rr) / b_norm;
+      if(result.RelativeResidual <= settings.Tolerance) break;
+
+      // p = z + beta p.
+      const DVectorR& z_k = detail::Precondition(preconditioner, r, z);
+      const Real rz_next = isTypeSame<P, IdentityPreconditioner>() ? rr : detail::ParallelDot(r, z_k);
+      const Real beta = rz_next / rz;
+      rz = rz_next;
+      detail::ChunkedFor(n, [&, beta](const size_t first, const size_t last)
+      {
+         simd::MultiplyScalar(p.data() + first, beta, p.data() + first, last - first);
+         simd::Add(z_k.data() + first, p.data() + first, p.data() + first, last - first);
+      });
+   }
+   result.isConverged = result.RelativeResidual <= settings.Tolerance;
+   return result;
+}
+
+/***************************************************************************************************************************************************************
+* BiCGSTAB
+***************************************************************************************************************************************************************/
+template<LinearOperator A, Preconditioner P>
+SolverResult
+BiCGSTAB(A&& matrix, const DVectorR& b, DVectorR& x, const SolverSettings& settings, const P& preconditioner)
+{
+   const size_t n = b.size();
+   DVectorR r(n), p(n, Zero), v(n, Zero), t(n), p_preconditioned(n), s_preconditioned(n);
+   const Real b_norm = detail::ReferenceNorm(b);
+   const Real r_norm = detail::InitialResidual(matrix, b, x, r);
+   SolverResult result{0, r_norm / b_norm, false};
+
+   const DVectorR r0 = r;
+   Real rho = One, alpha = One, omega = One;
+   while(result.RelativeResidual > settings.Tolerance && result.nIterations < settings.MaxIterations)
+   {
+      const Real rho_next = detail::ParallelDot(r0, r);
+      if(rho_next == Zero) break;
+
+      // p = r + beta (p - omega v).
+      const Real beta = (rho_next / rho) * (alpha / omega);
+      rho = rho_next;
+      detail::ChunkedFor(n, [&, beta, omega](const size_t first, const size_t last)
+      {
+         simd::Axpy(-omega, v.data() + first, p.data() + first, last - first);
+         simd::MultiplyScalar(p.data() + first, beta, p.data() + first, last - first);
+         simd::Add(r.data() + first, p.data() + first, p.data() + first, last - first);
+      });
+
+      const DVectorR& p_hat = detail::Precondition(preconditioner, p, p_preconditioned);
+      matrix(p_hat, v);
+      alpha = rho / detail::ParallelDot(r0, v);
+
+      // s = r - alpha v, stored in r, fused with |s|^2.
+      const Real ss = detail::ChunkedReduce(n, Zero, [&, alpha](const size_t first, const size_t last)
+      {
+         simd::Axpy(-alpha, v.data() + first, r.data() + first, last - first);
+         return simd::Dot(r.data() + first, r.data() + first, last - first);
+      });
+      ++result.nIterations;
+      if(std::sqrt(ss) / b_norm <= settings.Tolerance)
+      {
+         detail::ChunkedFor(n, [&, alpha](const size_t first, const size_t last){ simd::Axpy(alpha, p_hat.data() + first, x.data() + first, last - first); });
+         result.RelativeResidual = std::sqrt(ss) / b_norm;
+         break;
+      }
+
+      const DVectorR& s_hat = detail::Precondition(preconditioner, r, s_preconditioned);
+      matrix(s_hat, t);
+      const auto [ts, tt] = detail::ChunkedReduce(n, std::array<Real, 2>{}, [&](const size_t first, const size_t last)
+      {
+         return std::array<Real, 2>{simd::Dot(t.data() + first, r.data() + first, last - first), simd::Dot(t.data() + first, t.data() + first, last - first)};
+      }, [](const std::array<Real, 2>& a, const std::array<Real, 2>& b){ return std::array<Real, 2>{a[0] + b[0], a[1] + b[1]}; });
+      omega = tt == Zero ? Zero : ts / tt;
+
+      // x += alpha p_hat + omega s_hat, and r = s - omega t, fused with |r|^2. The update of x precedes that of r, which s_hat may alias.
+      const Real rr = detail::ChunkedReduce(n, Zero, [&, alpha, omega](const size_t first, const size_t last)
+      {
+         simd::Axpy(alpha, p_hat.data() + first, x.data() + first, last - first);
+         simd::Axpy(omega, s_hat.data() + first, x.data() + first, last - first);
+         simd::Axpy(-omega, t.data() + first, r.data() + first, last - first);
+         return simd::Dot(r.data() + first, r.data() + first, last - first);
+      });
+      result.RelativeResidual = std::sqrt(rr) / b_norm;
+      if(omega == Zero) break;
+   }
+   result.isConverged = result.RelativeResidual <= settings.Tolerance;
+   return result;
+}
+
+/***************************************************************************************************************************************************************
+* GMRES
+***************************************************************************************************************************************************************/
+template<LinearOperator A, Preconditioner P>
+SolverResult
+GMRES(A&& matrix, const DVectorR& b, DVectorR& x, const SolverSettings& settings, const P& preconditioner)
+{
+   const size_t n = b.size();
+   const size_t m = Max(settings.Restart, size_t{1});
+   DArray<DVectorR> basis(m + 1, DVectorR(n));
+   DynamicMatrix<Real> hessenberg(m + 1, m, Zero);
+   DVectorR cosines(m), sines(m), g(m + 1), w(n), z(n);
+   const Real b_norm = detail::ReferenceNorm(b);
+   SolverResult result;
+
+   while(true)
+   {
+      // Restart from the true residual, v_0 = r / |r|.
+      const Real r_norm = detail::InitialResidual(matrix, b, x, basis[0]);
+      result.RelativeResidual = r_norm / b_norm;
+      if(result.RelativeResidual <= settings.Tolerance || result.nIterations >= settings.MaxIterations) break;
+
+      detail::ChunkedFor(n, [&](const size_t first, const size_t last)
+      {
+         simd::MultiplyScalar(basis[0].data() + first, One / r_norm, basis[0].data() + first, last - first);
+      });
+      std::fill(g.begin(), g.end(), Zero);
+      g[0] = r_norm;
+
+      size_t k = 0;
+      while(k < m && result.nIterations < settings.MaxIterations)
+      {
+         matrix(detail::Precondition(preconditioner, basis[k], z), w);
+         FOR(i, k + 1)
+         {
+            const Real h = detail::ParallelDot(w, basis[i]);
+            hessenberg(i, k) = h;
+            detail::ChunkedFor(n, [&, h](const size_t first, const size_t last){ simd::Axpy(-h, basis[i].data() + first, w.data() + first, last - first); });
+         }
+         const Real h_next = detail::ParallelNorm(w);
+         hessenberg(k + 1, k) = h_next;
+         if(h_next != Zero)
+            detail::ChunkedFor(n, [&](const size_t first, const size_t last)
+            {
+               simd::MultiplyScalar(w.data() + first, One / h_next, basis[k + 1].data() + first, last - first);
+            });
+
+         // Apply the previous Givens rotations to the new column of H, then eliminate its subdiagonal entry.
+         FOR(i, k)
+         {
+            const Real h_i = hessenberg(i, k);
+            hessenberg(i, k)     =  cosines[i] * h_i + sines[i] * hessenberg(i + 1, k);
+            hessenberg(i + 1, k) = -sines[i] * h_i + cosines[i] * hessenberg(i + 1, k);
+         }
+         const Real radius = std::hypot(hessenberg(k, k), h_next);
+         cosines[k] = radius == Zero ? One : hessenberg(k, k) / radius;
+         sines[k]   = radius == Zero ? Zero : h_next / radius;
+         hessenberg(k, k) = radius;
+         hessenberg(k + 1, k) = Zero;
+         g[k + 1] = -sines[k] * g[k];
+         g[k]     =  cosines[k] * g[k];
+
+         ++k;
+         ++result.nIterations;
+         if(Abs(g[k]) <= settings.Tolerance * b_norm || h_next == Zero) break;
+      }
+
+      // x += M^-1 V y, where H y = g.
+      for(size_t i = k; i-- > 0;)
+      {
+         FOR(j, i + 1, k) g[i] -= hessenberg(i, j) * g[j];
+         g[i] /= hessenberg(i, i);
+      }
+      detail::ChunkedFor(n, [&](const size_t first, const size_t last)
+      {
+         std::fill(w.data() + first, w.data() + last, Zero);
+         FOR(i, k) simd::Axpy(g[i], basis[i].data() + first, w.data() + first, last - first);
+      });
+      const DVectorR& update = detail::Precondition(preconditioner, w, z);
+      detail::ChunkedFor(n, [&](const size_t first, const size_t last){ simd::Add(x.data() + first, update.data() + first, x.data() + first, last - first); });
+   }
+   result.isConverged = result.RelativeResidual <= settings.Tolerance;
+   return result;
+}
+
+}
@@ -24,12 +24,19 @@ namespace aprn {
 * Matrix Abstract Base Class
 ***************************************************************************************************************************************************************/
 template<typename T, class D>
-class Matrix : detail::NumericContainer<T, Matrix<T, D>>
+class Matrix : public detail::NumericContainer<T, D>
 {
 protected:
   constexpr Matrix() = default;
 
-private:
+public:
+  /** Matrix dimensions. */
+  constexpr size_t nRows() const { return Derived().Dimension(0); }
+
+  constexpr size_t nColumns() const { return Derived().Dimension(1); }
+
+  using detail::NumericContainer<T, D>::operator=;
+
   /** Derived Class Access */
   constexpr D& Derived() noexcept { return static_cast<D&>(*this); }
 
@@ -53,12 +60,23 @@ public:
   explicit constexpr StaticMatrix(const T& value)
     : BaseMultiArray(value) {}
 
+  /** Entries in column-major order. */
   explicit constexpr StaticMatrix(const std::initializer_list<T>& list)
-    : BaseMultiArray(list) {}
+    : StaticMatrix(list.begin(), list.end()) {}
 
-  template<class It>
+  template<std::forward_iterator It>
   constexpr StaticMatrix(const It first, const It last)
-    : BaseMultiArray(first, last) {}
+    : BaseMultiArray()
+  {
+    DEBUG_ASSERT(static_cast<size_t>(std::distance(first, last)) == M * N, "The number of entries must equal the matrix size ", M * N, ".")
+    std::copy(first, last, BaseMultiArray::begin());
+  }
+
+  template<class E>
+  constexpr StaticMatrix(const detail::Expression<T, E>& expression)
+    : BaseMultiArray() { *this = expression; }
+
+  using Matrix<T, StaticMatrix<T, M, N>>::operator=;
 
 private:
   friend Matrix<T, BaseMultiArray>;
@@ -76,23 +94,66 @@ class DynamicMatrix final : public DynamicMultiArray<T>,
 public:
   /** Constructors */
   DynamicMatrix()
-    : BaseMultiArray() {}
+    : BaseMultiArray(0, 0) {}
 
-  explicit DynamicMatrix(const size_t size)
-    : BaseMultiArray(size) {}
+  DynamicMatrix(const size_t n_rows, const size_t n_columns)
+    : BaseMultiArray(n_rows, n_columns) {}
 
-  DynamicMatrix(const size_t size, const T& value)
-    : BaseMultiArray(size, value) {}
+  DynamicMatrix(const size_t n_rows, const size_t n_columns, const T& value)
+    : BaseMultiArray(n_rows, n_columns) { std::fill(this->begin(), this->end(), value); }
 
   explicit DynamicMatrix(const std::initializer_list<T>& list)
     : BaseMultiArray(list) {}
 
-  template<class It>
+  template<std::input_iterator It>
   DynamicMatrix(const It first, const It last)
     : BaseMultiArray(first, last) {}
 
+  template<class E>
+  DynamicMatrix(const detail::Expression<T, E>& expression)
+    : BaseMultiArray() { *this = expression; }
+
+  using Matrix<T, DynamicMatrix<T>>::operator=;
+
 private:
   friend Matrix<T, BaseMultiArray>;
 };
 
+/***************************************************************************************************************************************************************
+* Matrix Aliases
+***************************************************************************************************************************************************************/
+template<typename T, size_t M, size_t N> using SMatrix = StaticMatrix<T, M, N>;
+
+/** Square Real matrices, e.g. for 2D/3D transformations. */
+using SMatrixR2 = SMatrix<Real, 2, 2>;
+using SMatrixR3 = SMatrix<Real, 3, 3>;
+using SMatrixR4 = SMatrix<Real, 4, 4>;
+
+template<typename T> using DMatrix = DynamicMatrix<T>;
+
+using DMatrixR = DMatrix<Real>;
+
+/***************************************************************************************************************************************************************
+* Matrix Precision Conversion
+***************************************************************************************************************************************************************/
+
+/** Convert entries to another scalar type, e.g. to solve a system assembled in single precision in double precision. */
+template<typename T2, typename T, size_t M, size_t N>
+constexpr SMatrix<T2, M, N>
+MatrixCast(const SMatrix<T, M, N>& from)
+{
+  SMatrix<T2, M, N> to;
+  std::transform(from.begin(), from.end(), to.begin(), [](const T entry){ return static_cast<T2>(entry); });
+  return to;
+}
+
+template<typename T2, typename T>
+DMatrix<T2>
+MatrixCast(const DMatrix<T>& from)
+{
+  DMatrix<T2> to(from.Dimension(0), from.Dimension(1));
+  std::transform(from.begin(), from.end(), to.begin(), [](const T entry){ return static_cast<T2>(entry); });
+  return to;
+}
+
 }
@@ -0,0 +1,107 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+
+#pragma once
+
+#include "../../../include/Global.h"
+#include "../../DataContainer/include/Array.h"
+#include "../../DataContainer/include/MultiArrayView.h"
+#include "Matrix.h"
+#include "MatrixOperations.h"
+#include "Vector.h"
+
+namespace aprn {
+
+/***************************************************************************************************************************************************************
+* Dense Matrix Decompositions
+***************************************************************************************************************************************************************/
+
+/** The decompositions below factorise a matrix once on construction, after which any number of systems may be solved with the factors. The factorisations
+ *  are blocked and right-looking: each panel of columns is factorised with level-2 operations, and the trailing matrix is updated with Gemm, which performs
+ *  almost all of the arithmetic. Right-hand sides are the columns of a strided view, and are solved for in place. */
+
+/** LU decomposition with partial pivoting, P A = L U, of a square matrix. */
+class LUDecomposition
+{
+ public:
+   explicit LUDecomposition(DynamicMatrix<Real> matrix);
+
+   /** Solve A X = B in place. */
+   void Solve(const MultiArrayView<Real, 2>& b) const;
+
+   DVectorR Solve(const DVectorR& b) const;
+
+   Real Determinant() const;
+
+   /** L, with an implicit unit diagonal, below the diagonal and U on and above it. */
+   inline const DynamicMatrix<Real>& Factors() const noexcept { return Factors_; }
+
+   /** Row i was swapped with row Pivots()[i] >= i when eliminating column i. */
+   inline const DArray<size_t>& Pivots() const noexcept { return Pivots_; }
+
+ private:
+   DynamicMatrix<Real> Factors_;
+   DArray<size_t>      Pivots_;
+};
+
+/** Cholesky decomposition, A = L L^T, of a symmetric positive-definite matrix, of which only the lower triangle is read. */
+class CholeskyDecomposition
+{
+ public:
+   explicit CholeskyDecomposition(DynamicMatrix<Real> matrix);
+
+   /** Solve A X = B in place. */
+   void Solve(const MultiArrayView<Real, 2>& b) const;
+
+   DVectorR Solve(const DVectorR& b) const;
+
+   /** L on and below the diagonal, and zeros above it. */
+   inline const DynamicMatrix<Real>& Factors() const noexcept { return Factors_; }
+
+ private:
+   DynamicMatrix<Real> Factors_;
+};
+
+/** Householder QR decomposition, A = Q R, of an m x n matrix with m >= n. Q is the product of n Householder reflections, which are applied in blocks using the
+ *  compact WY representation I - V T V^T. Solving gives the least-squares solution of an overdetermined system, e.g. when fitting curves. */
+class QRDecomposition
+{
+ public:
+   explicit QRDecomposition(DynamicMatrix<Real> matrix);
+
+   /** Overwrite B with Q B or Q^T B, where Q is m x m. */
+   void MultiplyQ(const MultiArrayView<Real, 2>& b) const;
+
+   void MultiplyQTranspose(const MultiArrayView<Real, 2>& b) const;
+
+   /** Least-squares solution of A X = B in place, which is returned in the first n rows of B. */
+   void Solve(const MultiArrayView<Real, 2>& b) const;
+
+   DVectorR Solve(const DVectorR& b) const;
+
+   /** R on and above the diagonal, and the Householder vectors, with implicit unit leading entries, below it. */
+   inline const DynamicMatrix<Real>& Factors() const noexcept { return Factors_; }
+
+ private:
+   /** Apply the block reflection of panel [k, k + w) to the rows [k, m) of B, or its transpose. */
+   void ApplyBlockReflector(const size_t k, const size_t w, const MultiArrayView<Real, 2>& b, const bool isTranspose) const;
+
+   DynamicMatrix<Real> Factors_;
+   DynamicMatrix<Real> BlockReflectors_; // Upper triangular T factor of each panel, stored in the panel's columns.
+};
+
+}
+
+#include "MatrixDecomposition.tpp"
@@ -0,0 +1,380 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+
+#pragma once
+
+namespace aprn {
+namespace detail {
+
+/***************************************************************************************************************************************************************
+* Blocked Triangular Solves
+***************************************************************************************************************************************************************/
+
+/** Width of the panels factorised with level-2 operations, which is also the depth of the trailing Gemm updates. */
+constexpr size_t DecompositionBlockSize = 128;
+
+/** Solve T x = b in place for a single column b with the given stride, where T is lower or upper triangular. */
+template<bool isLower, bool isUnit>
+void
+TriangularSolveColumn(const StridedMatrix<const Real>& t, Real* b, const size_t stride, const size_t n)
+{
+   const bool isContiguous = stride == 1 && t.RowStride == 1;
+   const auto solve_entry = [&](const size_t i, const size_t r_first, const size_t r_last)
+   {
+      if constexpr(!isUnit) b[i * stride] /= t(i, i);
+      const Real b_i = b[i * stride];
+      if(isContiguous) simd::Axpy(-b_i, &t(r_first, i), b + r_first, r_last - r_first);
+      else FOR(r, r_first, r_last) b[r * stride] -= t(r, i) * b_i;
+   };
+   if constexpr(isLower) FOR(i, n) solve_entry(i, i + 1, n);
+   else for(size_t i = n; i-- > 0;) solve_entry(i, 0, i);
+}
+
+/** Solve T X = B in place for columns [0, n_rhs) of a B with contiguous rows, updating whole rows at once with the SIMD kernels. */
+template<bool isLower, bool isUnit>
+void
+TriangularSolveRows(const StridedMatrix<const Real>& t, const StridedMatrix<Real>& b, const size_t n, const size_t n_rhs)
+{
+   const auto solve_row = [&](const size_t i, const size_t r_first, const size_t r_last)
+   {
+      Real* b_i = &b(i, 0);
+      if constexpr(!isUnit) simd::MultiplyScalar(b_i, One / t(i, i), b_i, n_rhs);
+      FOR(r, r_first, r_last) simd::Axpy(-t(r, i), b_i, &b(r, 0), n_rhs);
+   };
+   if constexpr(isLower) FOR(i, n) solve_row(i, i + 1, n);
+   else for(size_t i = n; i-- > 0;) solve_row(i, 0, i);
+}
+
+/** Solve T X = B in place. The diagonal blocks of T are solved column by column, or row by row when the rows of B are contiguous, e.g. for transposed views,
+ *  split between threads. The remaining rows of B are updated with Gemm. */
+template<bool isLower, bool isUnit>
+void
+TriangularSolve(const MultiArrayView<const Real, 2>& t, const MultiArrayView<Real, 2>& b)
+{
+   const size_t n = t.Dimensions()[0];
+   const size_t n_rhs = b.Dimensions()[1];
+   DEBUG_ASSERT(t.Dimensions()[1] == n && b.Dimensions()[0] == n, "The triangular system dimensions are incompatible.")
+
+   for(size_t k = 0; k < n; k += DecompositionBlockSize)
+   {
+      const size_t w = Min(DecompositionBlockSize, n - k);
+      const size_t i = isLower ? k : n - k - w;
+      const auto diagonal = MakeStridedMatrix(t.Block({i, i}, {w, w}));
+      const auto b_i = b.Block({i, size_t{}}, {w, n_rhs});
+      const auto b_strided = MakeStridedMatrix(b_i);
+      if(b_strided.ColumnStride == 1)
+      {
+         constexpr size_t chunk = 512;
+         ParallelFor((n_rhs + chunk - 1) / chunk, [&](const size_t c)
+         {
+            const size_t j = c * chunk;
+            TriangularSolveRows<isLower, isUnit>(diagonal, {&b_strided(0, j), b_strided.RowStride, 1}, w, Min(chunk, n_rhs - j));
+         }, chunk * w * w);
+      }
+      else ParallelFor(n_rhs, [&](const size_t j){ TriangularSolveColumn<isLower, isUnit>(diagonal, &b_strided(0, j), b_strided.RowStride, w); }, w * w);
+
+      if constexpr(isLower) Gemm<Real>(-One, t.Block({i + w, i}, {n - i - w, w}), b_i, One, b.Block({i + w, size_t{}}, {n - i - w, n_rhs}));
+      else                  Gemm<Real>(-One, t.Block({size_t{}, i}, {i, w}), b_i, One, b.Block({0, 0}, {i, n_rhs}));
+   }
+}
+
+}//detail
+
+/***************************************************************************************************************************************************************
+* LU Decomposition
+***************************************************************************************************************************************************************/
+inline
+LUDecomposition::LUDecomposition(DynamicMatrix<Real> matrix)
+   : Factors_(std::move(matrix))
+{
+   const size_t n = Factors_.nRows();
+   ASSERT(Factors_.nColumns() == n, "Only square matrices can be LU-decomposed, not ", n, "x", Factors_.nColumns(), " matrices.")
+   Pivots_.resize(n);
+
+   const auto a = Factors_.View<2>();
+   Real* data = a.Data();
+   for(size_t k = 0; k < n; k += detail::DecompositionBlockSize)
+   {
+      const size_t w = Min(detail::DecompositionBlockSize, n - k);
+
+      // Eliminate the panel columns, swapping entire rows.
+      FOR(j, k, k + w)
+      {
+         Real* column = data + j * n;
+         size_t pivot = j;
+         FOR(i, j + 1, n) if(Abs(column[i]) > Abs(column[pivot])) pivot = i;
+         ASSERT(column[pivot] != Zero, "The matrix is singular.")
+
+         Pivots_[j] = pivot;
+         if(pivot != j) FOR(c, n) std::swap(data[j + c * n], data[pivot + c * n]);
+
+         const Real inverse = One / column[j];
+         FOR(i, j + 1, n) column[i] *= inverse;
+         FOR(c, j + 1, k + w)
+         {
+            Real* update = data + c * n;
+            const Real u = update[j];
+            FOR(i, j + 1, n) update[i] -= column[i] * u;
+         }
+      }
+      if(k + w == n) break;
+
+      // Solve for the block row of U, and update the trailing matrix.
+      const size_t r = n - k - w;
+      const auto u12 = a.Block({k, k + w}, {w, r});
+      detail::TriangularSolve<true, true>(a.Block({k, k}, {w, w}), u12);
+      Gemm<Real>(-One, a.Block({k + w, k}, {r, w}), u12, One, a.Block({k + w, k + w}, {r, r}));
+   }
+}
+
+inline void
+LUDecomposition::Solve(const MultiArrayView<Real, 2>& b) const
+{
+   const size_t n = Factors_.nRows();
+   ASSERT(b.Dimensions()[0] == n, "The right-hand sides must have ", n, " rows.")
+
+   const auto b_strided = detail::MakeStridedMatrix(b);
+   FOR(i, n) if(Pivots_[i] != i) FOR(j, b.Dimensions()[1]) std::swap(b_strided(i, j), b_strided(Pivots_[i], j));
+   detail::TriangularSolve<true, true>(Factors_.View<2>(), b);
+   detail::TriangularSolve<false, false>(Factors_.View<2>(), b);
+}
+
+inline DVectorR
+LUDecomposition::Solve(const DVectorR& b) const
+{
+   DVectorR x(b);
+   Solve(MultiArrayView<Real, 2>(x.data(), {x.size(), size_t{1}}));
+   return x;
+}
+
+inline Real
+LUDecomposition::Determinant() const
+{
+   Real determinant = One;
+   FOR(i, Factors_.nRows()) determinant *= Pivots_[i] == i ? Factors_(i, i) : -Factors_(i, i);
+   return determinant;
+}
+
+/***************************************************************************************************************************************************************
+* Cholesky Decomposition
+***************************************************************************************************************************************************************/
+inline
+CholeskyDecomposition::CholeskyDecomposition(DynamicMatrix<Real> matrix)
+   : Factors_(std::move(matrix))
+{
+   const size_t n = Factors_.nRows();
+   ASSERT(Factors_.nColumns() == n, "Only square matrices can be Cholesky-decomposed, not ", n, "x", Factors_.nColumns(), " matrices.")
+
+   const auto a = Factors_.View<2>();
+   Real* data = a.Data();
+   for(size_t k = 0; k < n; k += detail::DecompositionBlockSize)
+   {
+      const size_t w = Min(detail::DecompositionBlockSize, n - k);
+
+      // Factorise the diagonal block.
+      FOR(j, k, k + w)
+      {
+         Real* column = data + j * n;
+         ASSERT(column[j] > Zero, "The matrix is not positive definite.")
+
+         column[j] = std::sqrt(column[j]);
+         const Real inverse = One / column[j];
+         FOR(i, j + 1, k + w) column[i] *= inverse;
+         FOR(c, j + 1, k + w)
+         {
+            Real* update = data + c * n;
+            const Real l = column[c];
+            FOR(i, c, k + w) update[i] -= column[i] * l;
+         }
+      }
+      if(k + w == n) break;
+
+      // Solve for the panel below the diagonal block, L21 = A21 L11^-T, as L11 L21^T = A21^T.
+      const size_t r = n - k - w;
+      detail::TriangularSolve<true, false>(a.Block({k, k}, {w, w}), a.Block({k + w, k}, {r, w}).Transpose());
+
+      // Update the lower triangle of the trailing matrix, one block column at a time.
+      for(size_t j = k + w; j < n; j += detail::DecompositionBlockSize)
+      {
+         const size_t w_j = Min(detail::DecompositionBlockSize, n - j);
+         Gemm<Real>(-One, a.Block({j, k}, {n - j, w}), a.Block({j, k}, {w_j, w}).Transpose(), One, a.Block({j, j}, {n - j, w_j}));
+      }
+   }
+   FOR(j, n) FOR(i, j) data[i + j * n] = Zero;
+}
+
+inline void
+CholeskyDecomposition::Solve(const MultiArrayView<Real, 2>& b) const
+{
+   const size_t n = Factors_.nRows();
+   ASSERT(b.Dimensions()[0] == n, "The right-hand sides must have ", n, " rows.")
+
+   detail::TriangularSolve<true, false>(Factors_.View<2>(), b);
+   detail::TriangularSolve<false, false>(Factors_.View<2>().Transpose(), b);
+}
+
+inline DVectorR
+CholeskyDecomposition::Solve(const DVectorR& b) const
+{
+   DVectorR x(b);
+   Solve(MultiArrayView<Real, 2>(x.data(), {x.size(), size_t{1}}));
+   return x;
+}
+
+/***************************************************************************************************************************************************************
+* QR Decomposition
+***************************************************************************************************************************************************************/
+inline
+QRDecomposition::QRDecomposition(DynamicMatrix<Real> matrix)
+   : Factors_(std::move(matrix)), BlockReflectors_(detail::DecompositionBlockSize, Factors_.nColumns(), Zero)
+{
+   const size_t m = Factors_.nRows();
+   const size_t n = Factors_.nColumns();
+   ASSERT(m >= n, "Only matrices with at least as many rows as columns can be QR-decomposed, not ", m, "x", n, " matrices.")
+
+   const auto a = Factors_.View<2>();
+   Real* data = a.Data();
+   Real* reflectors = BlockReflectors_.View<2>().Data();
+   const size_t t_stride = detail::DecompositionBlockSize;
+   for(size_t k = 0; k < n; k += detail::DecompositionBlockSize)
+   {
+      const size_t w = Min(detail::DecompositionBlockSize, n - k);
+      Real* t = reflectors + k * t_stride;
+
+      FOR(j, k, k + w)
+      {
+         // Householder reflection H = I - tau v v^T, with v = (1, x_1 / (x_0 - beta), ...), mapping column j onto beta e_0.
+         Real* x = data + j + j * m;
+         const size_t length = m - j;
+         const Real tail_norm = std::sqrt(simd::Dot(x + 1, x + 1, length - 1));
+         Real tau = Zero;
+         if(tail_norm != Zero)
+         {
+            const Real beta = x[0] > Zero ? -std::hypot(x[0], tail_norm) : std::hypot(x[0], tail_norm);
+            tau = (beta - x[0]) / beta;
+            simd::MultiplyScalar(x + 1, One / (x[0] - beta), x + 1, length - 1);
+            x[0] = beta;
+
+            // Reflect the remaining panel columns.
+            FOR(c, j + 1, k + w)
+            {
+               Real* y = data + j + c * m;
+               const Real scale = tau * (y[0] + simd::Dot(x + 1, y + 1, length - 1));
+               y[0] -= scale;
+               simd::Axpy(-scale, x + 1, y + 1, length - 1);
+            }
+         }
+
+         // Extend T, such that H_k ... H_j = I - V T V^T, with T(0:jj, jj) = -tau T(0:jj, 0:jj) V(:, 0:jj)^T v.
+         const size_t jj = j - k;
+         t[jj + jj * t_stride] = tau;
+         FOR(p, jj)
+         {
+            const Real* v_p = data + j + (k + p) * m;
+            t[p + jj * t_stride] = -tau * (v_p[0] + simd::Dot(v_p + 1, x + 1, length - 1));
+         }
+         FOR(p, jj)
+         {
+            Real sum{};
+            FOR(q, p, jj) sum += t[p + q * t_stride] * t[q + jj * t_stride];
+            t[p + jj * t_stride] = sum;
+         }
+      }
+      if(k + w < n) ApplyBlockReflector(k, w, a.Block({size_t{}, k + w}, {m, n - k - w}), true);
+   }
+}
+
+inline void
+QRDecomposition::ApplyBlockReflector(const size_t k, const size_t w, const MultiArrayView<Real, 2>& b, const bool isTranspose) const
+{
+   const size_t m = Factors_.nRows();
+   const size_t n_rhs = b.Dimensions()[1];
+   const auto b_k = b.Block({k, size_t{}}, {m - k, n_rhs});
+
+   // Unpack V, with its unit diagonal and zeros above it.
+   DynamicMatrix<Real> v(m - k, w, Zero);
+   const Real* factors = Factors_.View<2>().Data();
+   Real* v_data = v.View<2>().Data();
+   FOR(j, w)
+   {
+      const Real* householder = factors + (k + j) + (k + j) * m;
+      v_data[j + j * (m - k)] = One;
+      std::copy(householder + 1, householder + (m - k - j), v_data + (j + 1) + j * (m - k));
+   }
+
+   // B - V T^T V^T B or B - V T V^T B.
+   DynamicMatrix<Real> vb(w, n_rhs, Zero);
+   Gemm<Real>(One, std::as_const(v).View<2>().Transpose(), b_k, Zero, vb.View<2>());
+   const auto t = detail::MakeStridedMatrix(BlockReflectors_.View<2>().Block({size_t{}, k}, {w, w}));
+   const auto y = detail::MakeStridedMatrix(vb.View<2>());
+   FOR(j, n_rhs)
+   {
+      if(isTranspose)
+         for(size_t r = w; r-- > 0;)
+         {
+            Real sum{};
+            FOR(q, r + 1) sum += t(q, r) * y(q, j);
+            y(r, j) = sum;
+         }
+      else
+         FOR(r, w)
+         {
+            Real sum{};
+            FOR(q, r, w) sum += t(r, q) * y(q, j);
+            y(r, j) = sum;
+         }
+   }
+   Gemm<Real>(-One, std::as_const(v).View<2>(), std::as_const(vb).View<2>(), One, b_k);
+}
+
+inline void
+QRDecomposition::MultiplyQTranspose(const MultiArrayView<Real, 2>& b) const
+{
+   ASSERT(b.Dimensions()[0] == Factors_.nRows(), "The right-hand sides must have ", Factors_.nRows(), " rows.")
+
+   for(size_t k = 0; k < Factors_.nColumns(); k += detail::DecompositionBlockSize)
+      ApplyBlockReflector(k, Min(detail::DecompositionBlockSize, Factors_.nColumns() - k), b, true);
+}
+
+inline void
+QRDecomposition::MultiplyQ(const MultiArrayView<Real, 2>& b) const
+{
+   ASSERT(b.Dimensions()[0] == Factors_.nRows(), "The right-hand sides must have ", Factors_.nRows(), " rows.")
+
+   for(size_t end = Factors_.nColumns(); end > 0;)
+   {
+      const size_t k = (end - 1) / detail::DecompositionBlockSize * detail::DecompositionBlockSize;
+      ApplyBlockReflector(k, end - k, b, false);
+      end = k;
+   }
+}
+
+inline void
+QRDecomposition::Solve(const MultiArrayView<Real, 2>& b) const
+{
+   const size_t n = Factors_.nColumns();
+   MultiplyQTranspose(b);
+   detail::TriangularSolve<false, false>(Factors_.View<2>().Block({0, 0}, {n, n}), b.Block({0, 0}, {n, b.Dimensions()[1]}));
+}
+
+inline DVectorR
+QRDecomposition::Solve(const DVectorR& b) const
+{
+   DVectorR x(b);
+   Solve(MultiArrayView<Real, 2>(x.data(), {x.size(), size_t{1}}));
+   return DVectorR(x.begin(), x.begin() + static_cast<std::ptrdiff_t>(Factors_.nColumns()));
+}
+
+}
@@ -0,0 +1,106 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+
+#pragma once
+
+#include "../../../include/Global.h"
+#include "../../../include/Parallel.h"
+#include "../../DataContainer/include/Array.h"
+#include "../../DataContainer/include/MultiArrayView.h"
+#include "../../DataContainer/include/Simd.h"
+#include "Matrix.h"
+#include "Vector.h"
+#include "VectorOperations.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace aprn {
+
+/***************************************************************************************************************************************************************
+* General Matrix Products
+***************************************************************************************************************************************************************/
+
+/** General matrix-matrix product C = alpha A B + beta C, for matrices given as strided views of any layout. Large Real products are cache-blocked: panels of A
+ *  and B are packed contiguously, multiplied tile by tile with the SIMD micro-kernel, and the row blocks of C are split between threads. Other products use a
+ *  plain loop. C must not overlap A or B. */
+template<Arithmetic T>
+void Gemm(const T alpha, const MultiArrayView<const T, 2>& a, const MultiArrayView<const T, 2>& b, const T beta, const MultiArrayView<T, 2>& c);
+
+/** General matrix-vector product y = alpha A x + beta y, where x and y hold the number of columns and rows of A respectively. Real matrices with contiguous
+ *  columns or rows use the SIMD Axpy or Dot kernels. y must not overlap A or x. */
+template<Arithmetic T>
+void Gemv(const T alpha, const MultiArrayView<const T, 2>& a, const T* x, const T beta, T* y);
+
+/***************************************************************************************************************************************************************
+* Matrix Products
+***************************************************************************************************************************************************************/
+
+/** Products of static matrices with at most 64 multiply-adds, such as 3x3 and 4x4 transformations, are fully unrolled at compile time and usable in constant
+ *  expressions. Larger products use Gemm. */
+template<typename T, size_t M, size_t K, size_t N>
+constexpr StaticMatrix<T, M, N> MatrixProduct(const StaticMatrix<T, M, K>& a, const StaticMatrix<T, K, N>& b);
+
+template<typename T>
+DynamicMatrix<T> MatrixProduct(const DynamicMatrix<T>& a, const DynamicMatrix<T>& b);
+
+template<typename T, size_t M, size_t N>
+constexpr StaticVector<T, M> MatrixVectorProduct(const StaticMatrix<T, M, N>& a, const StaticVector<T, N>& x);
+
+template<typename T>
+DynamicVector<T> MatrixVectorProduct(const DynamicMatrix<T>& a, const DynamicVector<T>& x);
+
+/***************************************************************************************************************************************************************
+* Small Square Matrix Operations
+***************************************************************************************************************************************************************/
+
+/** Operations on static matrices, intended for 2D/3D transformations. They are written out entry by entry as straight-line code, which the compiler
+ *  vectorises, and are usable in constant expressions. */
+template<typename T, size_t N>
+constexpr StaticMatrix<T, N, N> IdentityMatrix();
+
+template<typename T, size_t M, size_t N>
+constexpr StaticMatrix<T, N, M> Transpose(const StaticMatrix<T, M, N>& a);
+
+/** Determinants and inverses in closed form, for matrices of size up to 4x4. */
+template<typename T, size_t N>
+constexpr T Determinant(const StaticMatrix<T, N, N>& a);
+
+template<typename T, size_t N>
+constexpr StaticMatrix<T, N, N> Inverse(const StaticMatrix<T, N, N>& a);
+
+/***************************************************************************************************************************************************************
+* Rotations and Affine Transformations
+***************************************************************************************************************************************************************/
+
+/** Right-handed rotation matrices, in 2D, and in 3D about an axis of any non-zero magnitude. The trigonometric builders are not constexpr, since std::cos and
+ *  std::sin are not usable in constant expressions. */
+inline SMatrixR2 RotationMatrix(const Real angle);
+
+inline SMatrixR3 RotationMatrix(const Real angle, const SVectorR3& axis);
+
+/** Quaternions are stored as {x, y, z, w}, the vector part followed by the scalar part, as in GLM. Rotations are given by unit quaternions. */
+inline SVectorR4 AxisAngleQuaternion(const Real angle, const SVectorR3& axis);
+
+constexpr SVectorR4 QuaternionProduct(const SVectorR4& q0, const SVectorR4& q1);
+
+constexpr SMatrixR3 RotationMatrix(const SVectorR4& quaternion);
+
+/** 4x4 homogeneous transformation applying a linear transformation followed by a translation. */
+constexpr SMatrixR4 AffineMatrix(const SMatrixR3& linear, const SVectorR3& translation = SVectorR3(Zero));
+
+}
+
+#include "MatrixOperations.tpp"
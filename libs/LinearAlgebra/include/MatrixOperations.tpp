@@ -0,0 +1,465 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+
+#pragma once
+
+namespace aprn {
+namespace detail {
+
+/***************************************************************************************************************************************************************
+* Blocked Matrix Multiplication
+***************************************************************************************************************************************************************/
+
+/** Block sizes of the packed panels: a KC x NC panel of B is sized for the last-level cache, and an MC x KC panel of A for the L2 cache of each thread. */
+constexpr size_t GemmBlockDepth   = 256;
+constexpr size_t GemmBlockRows    = 128;
+constexpr size_t GemmBlockColumns = 1536;
+
+/** Products with fewer multiply-adds than this are not worth packing. */
+constexpr size_t GemmBlockedThreshold = 4096;
+
+/** Strided matrix operand, whose entry (i, j) is data[i * row_stride + j * column_stride]. */
+template<typename T>
+struct StridedMatrix
+{
+   T*     Data;
+   size_t RowStride;
+   size_t ColumnStride;
+
+   constexpr T& operator()(const size_t i, const size_t j) const { return Data[i * RowStride + j * ColumnStride]; }
+};
+
+template<typename T>
+StridedMatrix<T>
+MakeStridedMatrix(const MultiArrayView<T, 2>& view) { return {view.Data(), view.Strides()[0], view.Strides()[1]}; }
+
+template<Arithmetic T>
+void
+GemmNaive(const T alpha, const StridedMatrix<const T>& a, const StridedMatrix<const T>& b, const StridedMatrix<T>& c, const size_t m, const size_t k,
+          const size_t n)
+{
+   FOR(j, n)
+      FOR(p, k)
+      {
+         const T scaled = alpha * b(p, j);
+         FOR(i, m) c(i, j) += a(i, p) * scaled;
+      }
+}
+
+/** Pack rows [0, mc) and columns [0, kc) of A into panels of tile_rows rows, each stored as kc consecutive columns, zero-padding the last panel. */
+template<simd::SimdScalar S>
+void
+PackPanelsA(const StridedMatrix<const S>& a, const size_t mc, const size_t kc, const size_t tile_rows, S* packed)
+{
+   for(size_t ir = 0; ir < mc; ir += tile_rows)
+   {
+      const size_t rows = Min(tile_rows, mc - ir);
+      FOR(p, kc)
+      {
+         const S* column = &a(ir, p);
+         if(a.RowStride == 1) std::copy(column, column + rows, packed);
+         else FOR(ii, rows) packed[ii] = column[ii * a.RowStride];
+         FOR(ii, rows, tile_rows) packed[ii] = S{};
+         packed += tile_rows;
+      }
+   }
+}
+
+/** Pack rows [0, kc) and columns [0, nc) of B into panels of GemmTileColumns columns, each stored as kc consecutive rows, zero-padding the last panel. */
+template<simd::SimdScalar S>
+void
+PackPanelsB(const StridedMatrix<const S>& b, const size_t kc, const size_t nc, S* packed)
+{
+   constexpr size_t tile_columns = simd::GemmTileColumns;
+   for(size_t jr = 0; jr < nc; jr += tile_columns)
+   {
+      const size_t columns = Min(tile_columns, nc - jr);
+      FOR(jj, tile_columns)
+      {
+         if(jj < columns) FOR(p, kc) packed[p * tile_columns + jj] = b(p, jr + jj);
+         else FOR(p, kc) packed[p * tile_columns + jj] = S{};
+      }
+      packed += kc * tile_columns;
+   }
+}
+
+template<simd::SimdScalar S>
+void
+GemmBlocked(const S alpha, const StridedMatrix<const S>& a, const StridedMatrix<const S>& b, const StridedMatrix<S>& c, const size_t m, const size_t k,
+            const size_t n)
+{
+   constexpr size_t tile_columns = simd::GemmTileColumns;
+   const size_t tile_rows = simd::GemmTileRows<S>();
+   const size_t n_blocks  = (m + GemmBlockRows - 1) / GemmBlockRows;
+
+   AlignedDArray<S> packed_b(GemmBlockDepth * ((Min(n, GemmBlockColumns) + tile_columns - 1) / tile_columns) * tile_columns);
+   for(size_t jc = 0; jc < n; jc += GemmBlockColumns)
+   {
+      const size_t nc = Min(GemmBlockColumns, n - jc);
+      for(size_t pc = 0; pc < k; pc += GemmBlockDepth)
+      {
+         const size_t kc = Min(GemmBlockDepth, k - pc);
+         PackPanelsB({b.Data + pc * b.RowStride + jc * b.ColumnStride, b.RowStride, b.ColumnStride}, kc, nc, packed_b.data());
+
+         // Each row block of C is updated by one thread, from its own packed panel of A and the shared packed panel of B.
+         ParallelFor(n_blocks, [&](const size_t block)
+         {
+            static thread_local AlignedDArray<S> packed_a;
+            static thread_local AlignedDArray<S> tile;
+
+            const size_t ic = block * GemmBlockRows;
+            const size_t mc = Min(GemmBlockRows, m - ic);
+            packed_a.resize(GemmBlockRows * GemmBlockDepth + tile_rows);
+            tile.resize(tile_rows * tile_columns);
+            PackPanelsA({a.Data + ic * a.RowStride + pc * a.ColumnStride, a.RowStride, a.ColumnStride}, mc, kc, tile_rows, packed_a.data());
+
+            for(size_t jr = 0; jr < nc; jr += tile_columns)
+            {
+               const size_t columns = Min(tile_columns, nc - jr);
+               for(size_t ir = 0; ir < mc; ir += tile_rows)
+               {
+                  const size_t rows = Min(tile_rows, mc - ir);
+                  simd::GemmTile(kc, packed_a.data() + ir * kc, packed_b.data() + jr * kc, tile.data());
+                  FOR(jj, columns)
+                  {
+                     S* column = &c(ic + ir, jc + jr + jj);
+                     const S* tile_column = tile.data() + jj * tile_rows;
+                     if(c.RowStride == 1) FOR(ii, rows) column[ii] += alpha * tile_column[ii];
+                     else FOR(ii, rows) column[ii * c.RowStride] += alpha * tile_column[ii];
+                  }
+               }
+            }
+         }, GemmBlockRows * nc * kc);
+      }
+   }
+}
+
+/***************************************************************************************************************************************************************
+* Unrolled Small Matrix Products
+***************************************************************************************************************************************************************/
+
+/** The products index the column-major entries directly, so that they reduce to straight-line code without bound checks. */
+template<size_t M, size_t K, class A, class B, size_t ...ps>
+constexpr auto
+UnrolledEntry(const A a, const B b, const size_t i, const size_t j, std::index_sequence<ps...>)
+{
+   return ((a[i + ps * M] * b[ps + j * K]) + ...);
+}
+
+template<typename T, size_t M, size_t K, size_t N, size_t ...ls>
+constexpr void
+UnrolledProduct(const StaticMatrix<T, M, K>& a, const StaticMatrix<T, K, N>& b, StaticMatrix<T, M, N>& c, std::index_sequence<ls...>)
+{
+   const auto c_entries = c.begin();
+   ((c_entries[ls] = UnrolledEntry<M, K>(a.begin(), b.begin(), ls % M, ls / M, std::make_index_sequence<K>{})), ...);
+}
+
+template<typename T, size_t M, size_t N, size_t ...is>
+constexpr void
+UnrolledVectorProduct(const StaticMatrix<T, M, N>& a, const StaticVector<T, N>& x, StaticVector<T, M>& y, std::index_sequence<is...>)
+{
+   ((y[is] = UnrolledEntry<M, N>(a.begin(), x.begin(), is, 0, std::make_index_sequence<N>{})), ...);
+}
+
+template<typename T, size_t M, size_t N, size_t ...ls>
+constexpr void
+UnrolledTranspose(const StaticMatrix<T, M, N>& a, StaticMatrix<T, N, M>& b, std::index_sequence<ls...>)
+{
+   const auto b_entries = b.begin();
+   ((b_entries[ls / M + (ls % M) * N] = a.begin()[ls]), ...);
+}
+
+/***************************************************************************************************************************************************************
+* Closed-form 4x4 Determinant and Inverse
+***************************************************************************************************************************************************************/
+
+/** The 2x2 minors of the first two rows, s, and of the last two rows, c, from which both the determinant and the adjugate are assembled by Laplace expansion. */
+template<typename T>
+struct Minors4
+{
+   T s[6];
+   T c[6];
+
+   template<class E>
+   constexpr explicit Minors4(const E m)
+      : s{m(0, 0) * m(1, 1) - m(1, 0) * m(0, 1), m(0, 0) * m(1, 2) - m(1, 0) * m(0, 2), m(0, 0) * m(1, 3) - m(1, 0) * m(0, 3),
+          m(0, 1) * m(1, 2) - m(1, 1) * m(0, 2), m(0, 1) * m(1, 3) - m(1, 1) * m(0, 3), m(0, 2) * m(1, 3) - m(1, 2) * m(0, 3)},
+        c{m(2, 0) * m(3, 1) - m(3, 0) * m(2, 1), m(2, 0) * m(3, 2) - m(3, 0) * m(2, 2), m(2, 0) * m(3, 3) - m(3, 0) * m(2, 3),
+          m(2, 1) * m(3, 2) - m(3, 1) * m(2, 2), m(2, 1) * m(3, 3) - m(3, 1) * m(2, 3), m(2, 2) * m(3, 3) - m(3, 2) * m(2, 3)} {}
+
+   constexpr T Determinant() const { return s[0] * c[5] - s[1] * c[4] + s[2] * c[3] + s[3] * c[2] - s[4] * c[1] + s[5] * c[0]; }
+};
+
+/** Unchecked column-major entry access to a static matrix. */
+template<size_t M, class It>
+constexpr auto
+EntryAccessor(const It entries) { return [entries](const size_t i, const size_t j){ return entries[i + j * M]; }; }
+
+}//detail
+
+/***************************************************************************************************************************************************************
+* General Matrix Products
+***************************************************************************************************************************************************************/
+template<Arithmetic T>
+void
+Gemm(const T alpha, const MultiArrayView<const T, 2>& a, const MultiArrayView<const T, 2>& b, const T beta, const MultiArrayView<T, 2>& c)
+{
+   const size_t m = a.Dimensions()[0];
+   const size_t k = a.Dimensions()[1];
+   const size_t n = b.Dimensions()[1];
+   ASSERT(b.Dimensions()[0] == k && c.Dimensions()[0] == m && c.Dimensions()[1] == n, "The matrix dimensions ", m, "x", k, ", ", b.Dimensions()[0], "x", n,
+          " and ", c.Dimensions()[0], "x", c.Dimensions()[1], " are incompatible.")
+
+   const auto c_strided = detail::MakeStridedMatrix(c);
+   if(beta == T{}) FOR(j, n) FOR(i, m) c_strided(i, j) = T{};
+   else if(beta != static_cast<T>(1)) FOR(j, n) FOR(i, m) c_strided(i, j) *= beta;
+   if(alpha == T{} || !k) return;
+
+   if constexpr(simd::SimdScalar<T>)
+      if(m * n * k >= detail::GemmBlockedThreshold)
+      {
+         detail::GemmBlocked(alpha, detail::MakeStridedMatrix(a), detail::MakeStridedMatrix(b), c_strided, m, k, n);
+         return;
+      }
+   detail::GemmNaive(alpha, detail::MakeStridedMatrix(a), detail::MakeStridedMatrix(b), c_strided, m, k, n);
+}
+
+template<Arithmetic T>
+void
+Gemv(const T alpha, const MultiArrayView<const T, 2>& a, const T* x, const T beta, T* y)
+{
+   const size_t m = a.Dimensions()[0];
+   const size_t n = a.Dimensions()[1];
+   const auto matrix = detail::MakeStridedMatrix(a);
+
+   if(beta == T{}) std::fill(y, y + m, T{});
+   else if(beta != static_cast<T>(1)) FOR(i, m) y[i] *= beta;
+   if(alpha == T{}) return;
+
+   if constexpr(simd::SimdScalar<T>)
+   {
+      // Contiguous columns are accumulated into y, whereas contiguous rows are each reduced to an entry of y, split between threads.
+      if(matrix.RowStride == 1)
+      {
+         FOR(j, n) simd::Axpy(alpha * x[j], &matrix(0, j), y, m);
+         return;
+      }
+      if(matrix.ColumnStride == 1)
+      {
+         ParallelFor(m, [&](const size_t i){ y[i] += alpha * simd::Dot(&matrix(i, 0), x, n); }, n);
+         return;
+      }
+   }
+   FOR(j, n)
+   {
+      const T scaled = alpha * x[j];
+      FOR(i, m) y[i] += matrix(i, j) * scaled;
+   }
+}
+
+/***************************************************************************************************************************************************************
+* Matrix Products
+***************************************************************************************************************************************************************/
+template<typename T, size_t M, size_t K, size_t N>
+constexpr StaticMatrix<T, M, N>
+MatrixProduct(const StaticMatrix<T, M, K>& a, const StaticMatrix<T, K, N>& b)
+{
+   StaticMatrix<T, M, N> c(T{});
+   if constexpr(M * K * N <= 64) detail::UnrolledProduct(a, b, c, std::make_index_sequence<M * N>{});
+   else if(std::is_constant_evaluated()) FOR(j, N) FOR(p, K) FOR(i, M) c(i, j) += a(i, p) * b(p, j);
+   else Gemm(static_cast<T>(1), a.template View<2>(), b.template View<2>(), T{}, c.template View<2>());
+   return c;
+}
+
+template<typename T>
+DynamicMatrix<T>
+MatrixProduct(const DynamicMatrix<T>& a, const DynamicMatrix<T>& b)
+{
+   DynamicMatrix<T> c(a.nRows(), b.nColumns(), T{});
+   Gemm(static_cast<T>(1), a.template View<2>(), b.template View<2>(), T{}, c.template View<2>());
+   return c;
+}
+
+template<typename T, size_t M, size_t N>
+constexpr StaticVector<T, M>
+MatrixVectorProduct(const StaticMatrix<T, M, N>& a, const StaticVector<T, N>& x)
+{
+   StaticVector<T, M> y(T{});
+   if constexpr(M * N <= 64) detail::UnrolledVectorProduct(a, x, y, std::make_index_sequence<M>{});
+   else if(std::is_constant_evaluated()) FOR(j, N) FOR(i, M) y[i] += a(i, j) * x[j];
+   else Gemv(static_cast<T>(1), a.template View<2>(), x.data(), T{}, y.data());
+   return y;
+}
+
+template<typename T>
+DynamicVector<T>
+MatrixVectorProduct(const DynamicMatrix<T>& a, const DynamicVector<T>& x)
+{
+   ASSERT(a.nColumns() == x.size(), "The matrix with ", a.nColumns(), " columns cannot multiply a vector of size ", x.size(), ".")
+
+   DynamicVector<T> y(a.nRows(), T{});
+   Gemv(static_cast<T>(1), a.template View<2>(), x.data(), T{}, y.data());
+   return y;
+}
+
+
+/***************************************************************************************************************************************************************
+* Small Square Matrix Operations
+***************************************************************************************************************************************************************/
+template<typename T, size_t N>
+constexpr StaticMatrix<T, N, N>
+IdentityMatrix()
+{
+   StaticMatrix<T, N, N> identity(T{});
+   FOR(i, N) identity.begin()[i * (N + 1)] = static_cast<T>(1);
+   return identity;
+}
+
+template<typename T, size_t M, size_t N>
+constexpr StaticMatrix<T, N, M>
+Transpose(const StaticMatrix<T, M, N>& a)
+{
+   StaticMatrix<T, N, M> transpose;
+   detail::UnrolledTranspose(a, transpose, std::make_index_sequence<M * N>{});
+   return transpose;
+}
+
+template<typename T, size_t N>
+constexpr T
+Determinant(const StaticMatrix<T, N, N>& a)
+{
+   STATIC_ASSERT(0 < N && N <= 4, "Determinants can currently only be computed for matrices of size up to 4x4.")
+
+   const auto m = detail::EntryAccessor<N>(a.begin());
+   if constexpr(N == 1) return m(0, 0);
+   else if constexpr(N == 2) return m(0, 0) * m(1, 1) - m(0, 1) * m(1, 0);
+   else if constexpr(N == 3) return m(0, 0) * (m(1, 1) * m(2, 2) - m(2, 1) * m(1, 2)) - m(0, 1) * (m(1, 0) * m(2, 2) - m(2, 0) * m(1, 2))
+                                    + m(0, 2) * (m(1, 0) * m(2, 1) - m(2, 0) * m(1, 1));
+   else return detail::Minors4<T>(m).Determinant();
+}
+
+template<typename T, size_t N>
+constexpr StaticMatrix<T, N, N>
+Inverse(const StaticMatrix<T, N, N>& a)
+{
+   STATIC_ASSERT(0 < N && N <= 4, "Inverses can currently only be computed for matrices of size up to 4x4.")
+
+   const auto m = detail::EntryAccessor<N>(a.begin());
+   StaticMatrix<T, N, N> inverse;
+   T det;
+   if constexpr(N == 1)
+   {
+      det = m(0, 0);
+      inverse = StaticMatrix<T, 1, 1>{static_cast<T>(1)};
+   }
+   else if constexpr(N == 2)
+   {
+      det = Determinant(a);
+      inverse = StaticMatrix<T, 2, 2>{m(1, 1), -m(1, 0), -m(0, 1), m(0, 0)};
+   }
+   else if constexpr(N == 3)
+   {
+      // The inverse is the adjugate, the transposed matrix of cofactors, divided by the determinant, expanded here along the first column.
+      const StaticMatrix<T, 3, 3> cofactors{m(1, 1) * m(2, 2) - m(2, 1) * m(1, 2), m(2, 1) * m(0, 2) - m(0, 1) * m(2, 2), m(0, 1) * m(1, 2) - m(1, 1) * m(0, 2),
+                                            m(2, 0) * m(1, 2) - m(1, 0) * m(2, 2), m(0, 0) * m(2, 2) - m(2, 0) * m(0, 2), m(1, 0) * m(0, 2) - m(0, 0) * m(1, 2),
+                                            m(1, 0) * m(2, 1) - m(2, 0) * m(1, 1), m(2, 0) * m(0, 1) - m(0, 0) * m(2, 1), m(0, 0) * m(1, 1) - m(1, 0) * m(0, 1)};
+      det = m(0, 0) * cofactors.begin()[0] + m(1, 0) * cofactors.begin()[1] + m(2, 0) * cofactors.begin()[2];
+      inverse = Transpose(cofactors);
+   }
+   else
+   {
+      const detail::Minors4<T> minors(m);
+      const auto& s = minors.s;
+      const auto& c = minors.c;
+      det = minors.Determinant();
+      inverse = StaticMatrix<T, 4, 4>{ m(1, 1) * c[5] - m(1, 2) * c[4] + m(1, 3) * c[3], -m(1, 0) * c[5] + m(1, 2) * c[2] - m(1, 3) * c[1],
+                                       m(1, 0) * c[4] - m(1, 1) * c[2] + m(1, 3) * c[0], -m(1, 0) * c[3] + m(1, 1) * c[1] - m(1, 2) * c[0],
+                                      -m(0, 1) * c[5] + m(0, 2) * c[4] - m(0, 3) * c[3],  m(0, 0) * c[5] - m(0, 2) * c[2] + m(0, 3) * c[1],
+                                      -m(0, 0) * c[4] + m(0, 1) * c[2] - m(0, 3) * c[0],  m(0, 0) * c[3] - m(0, 1) * c[1] + m(0, 2) * c[0],
+                                       m(3, 1) * s[5] - m(3, 2) * s[4] + m(3, 3) * s[3], -m(3, 0) * s[5] + m(3, 2) * s[2] - m(3, 3) * s[1],
+                                       m(3, 0) * s[4] - m(3, 1) * s[2] + m(3, 3) * s[0], -m(3, 0) * s[3] + m(3, 1) * s[1] - m(3, 2) * s[0],
+                                      -m(2, 1) * s[5] + m(2, 2) * s[4] - m(2, 3) * s[3],  m(2, 0) * s[5] - m(2, 2) * s[2] + m(2, 3) * s[1],
+                                      -m(2, 0) * s[4] + m(2, 1) * s[2] - m(2, 3) * s[0],  m(2, 0) * s[3] - m(2, 1) * s[1] + m(2, 2) * s[0]};
+   }
+   DEBUG_ASSERT(det != T{}, "Cannot invert a singular matrix.")
+   const T inverse_det = static_cast<T>(1) / det;
+   FOR_EACH(entry, inverse) entry *= inverse_det;
+   return inverse;
+}
+
+/***************************************************************************************************************************************************************
+* Rotations and Affine Transformations
+***************************************************************************************************************************************************************/
+inline SMatrixR2
+RotationMatrix(const Real angle)
+{
+   const Real cos = std::cos(angle);
+   const Real sin = std::sin(angle);
+   return SMatrixR2{cos, sin, -sin, cos};
+}
+
+inline SMatrixR3
+RotationMatrix(const Real angle, const SVectorR3& axis)
+{
+   const auto k = Normalise(axis);
+   const Real cos = std::cos(angle);
+   const Real sin = std::sin(angle);
+   const Real versine = One - cos;
+   return SMatrixR3{cos + versine * k[0] * k[0],        versine * k[0] * k[1] + sin * k[2], versine * k[0] * k[2] - sin * k[1],
+                    versine * k[0] * k[1] - sin * k[2], cos + versine * k[1] * k[1],        versine * k[1] * k[2] + sin * k[0],
+                    versine * k[0] * k[2] + sin * k[1], versine * k[1] * k[2] - sin * k[0], cos + versine * k[2] * k[2]};
+}
+
+inline SVectorR4
+AxisAngleQuaternion(const Real angle, const SVectorR3& axis)
+{
+   const auto k = Normalise(axis);
+   const Real sin = std::sin(Half * angle);
+   return SVectorR4{sin * k[0], sin * k[1], sin * k[2], std::cos(Half * angle)};
+}
+
+constexpr SVectorR4
+QuaternionProduct(const SVectorR4& q0, const SVectorR4& q1)
+{
+   return SVectorR4{q0[3] * q1[0] + q0[0] * q1[3] + q0[1] * q1[2] - q0[2] * q1[1],
+                    q0[3] * q1[1] - q0[0] * q1[2] + q0[1] * q1[3] + q0[2] * q1[0],
+                    q0[3] * q1[2] + q0[0] * q1[1] - q0[1] * q1[0] + q0[2] * q1[3],
+                    q0[3] * q1[3] - q0[0] * q1[0] - q0[1] * q1[1] - q0[2] * q1[2]};
+}
+
+constexpr SMatrixR3
+RotationMatrix(const SVectorR4& quaternion)
+{
+   // The squared magnitude is checked, as std::sqrt is not usable in constant expressions.
+   DEBUG_ASSERT(isEqual(InnerProduct(quaternion, quaternion), One), "Rotations are only given by unit quaternions.")
+
+   const Real x = quaternion[0], y = quaternion[1], z = quaternion[2], w = quaternion[3];
+   return SMatrixR3{One - Two * (y * y + z * z), Two * (x * y + z * w),       Two * (x * z - y * w),
+                    Two * (x * y - z * w),       One - Two * (x * x + z * z), Two * (y * z + x * w),
+                    Two * (x * z + y * w),       Two * (y * z - x * w),       One - Two * (x * x + y * y)};
+}
+
+constexpr SMatrixR4
+AffineMatrix(const SMatrixR3& linear, const SVectorR3& translation)
+{
+   SMatrixR4 affine(Zero);
+   const auto entries = affine.begin();
+   FOR(j, 3) FOR(i, 3) entries[i + 4 * j] = linear.begin()[i + 3 * j];
+   FOR(i, 3) entries[i + 12] = translation[i];
+   entries[15] = One;
+   return affine;
+}
+
+}
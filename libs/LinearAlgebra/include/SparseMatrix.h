@@ -0,0 +1,128 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+
+#pragma once
+
+#include "../../../include/Global.h"
+#include "../../../include/Parallel.h"
+#include "../../DataContainer/include/Array.h"
+#include "../../DataContainer/include/MultiArrayView.h"
+#include "Vector.h"
+
+#include <cstdint>
+
+namespace aprn {
+
+/***************************************************************************************************************************************************************
+* Sparse Matrix Class
+***************************************************************************************************************************************************************/
+
+/** Storage formats of sparse matrices. Coordinate (COO) storage is used for assembly, and compressed sparse row (CSR) or column (CSC) storage for arithmetic. */
+enum class SparseFormat { COO, CSR, CSC };
+
+/** Sparse matrix, assembled entry by entry in COO format, and compressed to CSR or CSC format for matrix-vector and matrix-matrix products. In the compressed
+ *  formats, the entries of major line i (a row in CSR, a column in CSC) are Values()[k] for k in [Offsets()[i], Offsets()[i + 1]), at minor index Indices()[k],
+ *  sorted by minor index and without duplicates. In COO format, the entries are unordered, with row indices RowIndices() and column indices Indices(). */
+template<Arithmetic T>
+class SparseMatrix
+{
+ public:
+   /** Minor indices are 32-bit, halving their memory traffic in the products, which are bound by memory bandwidth. */
+   using Index = uint32_t;
+
+   SparseMatrix() = default;
+
+   SparseMatrix(const size_t n_rows, const size_t n_columns);
+
+   /** Assembly, in COO format. Entries inserted more than once are summed on compression. */
+   void Insert(const size_t row, const size_t column, const T& value);
+
+   void Reserve(const size_t n_non_zeros);
+
+   /** Format conversion. Compressing a COO matrix sorts its entries and sums duplicates. */
+   void Convert(const SparseFormat format);
+
+   /** Transpose in place, by swapping the roles of rows and columns, which turns CSR storage into CSC storage and vice versa without moving any entries. */
+   void Transpose();
+
+   /** Entry access, returning zero for entries which are not stored. Entries are searched for, so this is not intended for bulk access. */
+   T operator()(const size_t row, const size_t column) const;
+
+   /** Sparse matrix-vector product y = A x. In CSR format, the rows are split between threads; the other formats scatter into y serially. */
+   void Multiply(const DVector<T>& x, DVector<T>& y) const;
+
+   /** Sparse matrix-dense matrix product Y = A X, for dense matrices of any strided layout, e.g. views of multi-dimensional arrays. */
+   void Multiply(const MultiArrayView<const T, 2>& x, const MultiArrayView<T, 2>& y) const;
+
+   friend DVector<T> operator*(const SparseMatrix& matrix, const DVector<T>& x)
+   {
+      DVector<T> y;
+      matrix.Multiply(x, y);
+      return y;
+   }
+
+   /** Properties */
+   inline size_t nRows() const noexcept { return nRows_; }
+
+   inline size_t nColumns() const noexcept { return nColumns_; }
+
+   inline size_t nNonZeros() const noexcept { return Values_.size(); }
+
+   inline SparseFormat Format() const noexcept { return Format_; }
+
+   /** Underlying arrays. */
+   inline const DArray<size_t>& Offsets() const noexcept { return Offsets_; }
+
+   inline const DArray<Index>& Indices() const noexcept { return Indices_; }
+
+   inline const DArray<Index>& RowIndices() const noexcept { return RowIndices_; }
+
+   inline const DArray<T>& Values() const noexcept { return Values_; }
+
+ private:
+   /** Number of major and minor lines of the current compressed format. */
+   inline size_t nMajor() const noexcept { return Format_ == SparseFormat::CSR ? nRows_ : nColumns_; }
+
+   inline size_t nMinor() const noexcept { return Format_ == SparseFormat::CSR ? nColumns_ : nRows_; }
+
+   void Compress(const SparseFormat format);
+
+   void Decompress();
+
+   /** Apply a function to each stored entry, as function(row, column, value), in any format. */
+   template<class F>
+   void ForEachEntry(F&& function) const;
+
+   size_t         nRows_{};
+   size_t         nColumns_{};
+   SparseFormat   Format_{SparseFormat::COO};
+   DArray<size_t> Offsets_;
+   DArray<Index>  Indices_;
+   DArray<Index>  RowIndices_;
+   DArray<T>      Values_;
+};
+
+/***************************************************************************************************************************************************************
+* Sparse Matrix Construction
+***************************************************************************************************************************************************************/
+
+/** Finite-difference Laplacian -∇² on a grid with n points along each of n_dims dimensions and Dirichlet boundaries, in CSR format. The (2 n_dims + 1)-point
+ *  stencil gives a symmetric positive-definite matrix with n^n_dims rows, which is the standard test matrix for sparse kernels and solvers. */
+template<Arithmetic T = Real>
+SparseMatrix<T> PoissonMatrix(const size_t n, const size_t n_dims);
+
+}
+
+#include "SparseMatrix.tpp"
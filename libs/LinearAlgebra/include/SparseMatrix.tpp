@@ -0,0 +1,298 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+
+#pragma once
+
+#include <algorithm>
+#include <utility>
+
+namespace aprn {
+
+/***************************************************************************************************************************************************************
+* Sparse Matrix Class
+***************************************************************************************************************************************************************/
+template<Arithmetic T>
+SparseMatrix<T>::SparseMatrix(const size_t n_rows, const size_t n_columns)
+   : nRows_(n_rows), nColumns_(n_columns)
+{
+   ASSERT(Max(n_rows, n_columns) <= std::numeric_limits<Index>::max(), "The sparse matrix dimensions ", n_rows, " x ", n_columns, " exceed the index range.")
+}
+
+/** Assembly */
+template<Arithmetic T>
+void
+SparseMatrix<T>::Insert(const size_t row, const size_t column, const T& value)
+{
+   DEBUG_ASSERT(Format_ == SparseFormat::COO, "Entries can only be inserted in COO format.")
+   DEBUG_ASSERT(row < nRows_ && column < nColumns_, "The entry (", row, ", ", column, ") lies outside the ", nRows_, " x ", nColumns_, " matrix.")
+   RowIndices_.push_back(static_cast<Index>(row));
+   Indices_.push_back(static_cast<Index>(column));
+   Values_.push_back(value);
+}
+
+template<Arithmetic T>
+void
+SparseMatrix<T>::Reserve(const size_t n_non_zeros)
+{
+   if(Format_ == SparseFormat::COO) RowIndices_.reserve(n_non_zeros);
+   Indices_.reserve(n_non_zeros);
+   Values_.reserve(n_non_zeros);
+}
+
+/** Format conversion */
+template<Arithmetic T>
+void
+SparseMatrix<T>::Convert(const SparseFormat format)
+{
+   if(format == Format_) return;
+   if(Format_ != SparseFormat::COO) Decompress();
+   if(format != SparseFormat::COO) Compress(format);
+}
+
+template<Arithmetic T>
+void
+SparseMatrix<T>::Transpose()
+{
+   std::swap(nRows_, nColumns_);
+   if(Format_ == SparseFormat::COO) std::swap(RowIndices_, Indices_);
+   else Format_ = Format_ == SparseFormat::CSR ? SparseFormat::CSC : SparseFormat::CSR;
+}
+
+/** Entry access */
+template<Arithmetic T>
+T
+SparseMatrix<T>::operator()(const size_t row, const size_t column) const
+{
+   DEBUG_ASSERT(row < nRows_ && column < nColumns_, "The entry (", row, ", ", column, ") lies outside the ", nRows_, " x ", nColumns_, " matrix.")
+
+   if(Format_ == SparseFormat::COO)
+   {
+      T sum{};
+      FOR(k, Values_.size()) if(RowIndices_[k] == row && Indices_[k] == column) sum += Values_[k];
+      return sum;
+   }
+
+   const auto [major, minor] = Format_ == SparseFormat::CSR ? std::pair(row, column) : std::pair(column, row);
+   const auto first = Indices_.begin() + Offsets_[major];
+   const auto last  = Indices_.begin() + Offsets_[major + 1];
+   const auto entry = std::lower_bound(first, last, minor);
+   return entry != last && *entry == minor ? Values_[entry - Indices_.begin()] : T{};
+}
+
+/** Products */
+template<Arithmetic T>
+void
+SparseMatrix<T>::Multiply(const DVector<T>& x, DVector<T>& y) const
+{
+   ASSERT(x.size() == nColumns_, "The vector size ", x.size(), " must equal the number of matrix columns ", nColumns_, ".")
+   DEBUG_ASSERT(&x != &y, "The product cannot be computed in place.")
+
+   y.resize(nRows_);
+   const T* x_data = x.data();
+   T* y_data = y.data();
+   if(Format_ == SparseFormat::CSR)
+   {
+      const size_t* offsets = Offsets_.data();
+      const Index* indices  = Indices_.data();
+      const T* values       = Values_.data();
+      ParallelFor(nRows_, [=](const size_t i)
+      {
+         T sum{};
+#ifdef _OPENMP
+#pragma omp simd reduction(+:sum)
+#endif
+         for(size_t k = offsets[i]; k < offsets[i + 1]; ++k) sum += values[k] * x_data[indices[k]];
+         y_data[i] = sum;
+      });
+   }
+   else
+   {
+      std::fill(y.begin(), y.end(), T{});
+      ForEachEntry([=](const size_t row, const size_t column, const T& value){ y_data[row] += value * x_data[column]; });
+   }
+}
+
+template<Arithmetic T>
+void
+SparseMatrix<T>::Multiply(const MultiArrayView<const T, 2>& x, const MultiArrayView<T, 2>& y) const
+{
+   const size_t n = x.Dimensions()[1];
+   ASSERT(x.Dimensions()[0] == nColumns_ && y.Dimensions()[0] == nRows_ && y.Dimensions()[1] == n, "The dense matrices of dimensions ", x.Dimensions()[0],
+          " x ", n, " and ", y.Dimensions()[0], " x ", y.Dimensions()[1], " are incompatible with the ", nRows_, " x ", nColumns_, " sparse matrix.")
+
+   const T* x_data = x.Data();
+   T* y_data = y.Data();
+   const auto [x_row_stride, x_column_stride] = std::pair(x.Strides()[0], x.Strides()[1]);
+   const auto [y_row_stride, y_column_stride] = std::pair(y.Strides()[0], y.Strides()[1]);
+   if(Format_ == SparseFormat::CSR)
+   {
+      const size_t* offsets = Offsets_.data();
+      const Index* indices  = Indices_.data();
+      const T* values       = Values_.data();
+      ParallelFor(nRows_, [=](const size_t i)
+      {
+         // Accumulate row i of the product from the rows of x selected by row i of the sparse matrix.
+         T* y_row = y_data + i * y_row_stride;
+         FOR(j, n) y_row[j * y_column_stride] = T{};
+         for(size_t k = offsets[i]; k < offsets[i + 1]; ++k)
+         {
+            const T value = values[k];
+            const T* x_row = x_data + indices[k] * x_row_stride;
+            FOR(j, n) y_row[j * y_column_stride] += value * x_row[j * x_column_stride];
+         }
+      });
+   }
+   else
+   {
+      FOR(i, nRows_) FOR(j, n) y_data[i * y_row_stride + j * y_column_stride] = T{};
+      ForEachEntry([=](const size_t row, const size_t column, const T& value)
+      {
+         FOR(j, n) y_data[row * y_row_stride + j * y_column_stride] += value * x_data[column * x_row_stride + j * x_column_stride];
+      });
+   }
+}
+
+/** Private Functions */
+template<Arithmetic T>
+void
+SparseMatrix<T>::Compress(const SparseFormat format)
+{
+   DEBUG_ASSERT(Format_ == SparseFormat::COO && format != SparseFormat::COO, "Only COO matrices can be compressed.")
+
+   Format_ = format;
+   const auto& majors = format == SparseFormat::CSR ? RowIndices_ : Indices_;
+   const auto& minors = format == SparseFormat::CSR ? Indices_ : RowIndices_;
+   const size_t n_major = nMajor();
+   const size_t n_entries = Values_.size();
+
+   // Counting sort of the entries by major index.
+   DArray<size_t> offsets(n_major + 1, 0);
+   FOR_EACH_CONST(major, majors) ++offsets[major + 1];
+   FOR(i, n_major) offsets[i + 1] += offsets[i];
+
+   DArray<Index> indices(n_entries);
+   DArray<T> values(n_entries);
+   {
+      DArray<size_t> next(offsets);
+      FOR(k, n_entries)
+      {
+         const size_t position = next.data()[majors.data()[k]]++;
+         indices.data()[position] = minors.data()[k];
+         values.data()[position]  = Values_.data()[k];
+      }
+   }
+
+   // Sort each major line by minor index and sum duplicate entries, compacting the lines in place.
+   Index* index = indices.data();
+   T* value     = values.data();
+   size_t n_compressed{};
+   DArray<std::pair<Index, T>> line;
+   FOR(i, n_major)
+   {
+      const size_t first = offsets[i];
+      const size_t last  = offsets[i + 1];
+      if(!std::is_sorted(index + first, index + last))
+      {
+         line.clear();
+         FOR(k, first, last) line.emplace_back(index[k], value[k]);
+         std::stable_sort(line.begin(), line.end(), [](const auto& a, const auto& b){ return a.first < b.first; });
+         FOR(k, first, last) std::tie(index[k], value[k]) = line[k - first];
+      }
+
+      offsets[i] = n_compressed;
+      FOR(k, first, last)
+      {
+         if(n_compressed > offsets[i] && index[n_compressed - 1] == index[k]) value[n_compressed - 1] += value[k];
+         else
+         {
+            index[n_compressed] = index[k];
+            value[n_compressed] = value[k];
+            ++n_compressed;
+         }
+      }
+   }
+   offsets[n_major] = n_compressed;
+   indices.resize(n_compressed);
+   values.resize(n_compressed);
+
+   Offsets_    = std::move(offsets);
+   Indices_    = std::move(indices);
+   Values_     = std::move(values);
+   RowIndices_ = DArray<Index>();
+}
+
+template<Arithmetic T>
+void
+SparseMatrix<T>::Decompress()
+{
+   DEBUG_ASSERT(Format_ != SparseFormat::COO, "The matrix is already in COO format.")
+
+   DArray<Index> majors(Values_.size());
+   FOR(i, nMajor()) std::fill(majors.begin() + Offsets_[i], majors.begin() + Offsets_[i + 1], static_cast<Index>(i));
+
+   if(Format_ == SparseFormat::CSR) RowIndices_ = std::move(majors);
+   else
+   {
+      RowIndices_ = std::move(Indices_);
+      Indices_    = std::move(majors);
+   }
+   Offsets_ = DArray<size_t>();
+   Format_  = SparseFormat::COO;
+}
+
+template<Arithmetic T>
+template<class F>
+void
+SparseMatrix<T>::ForEachEntry(F&& function) const
+{
+   // Raw pointers bypass the bounds-checked subscript operators in these hot loops.
+   const Index* indices = Indices_.data();
+   const T* values      = Values_.data();
+   if(Format_ == SparseFormat::COO)
+   {
+      const Index* rows = RowIndices_.data();
+      FOR(k, Values_.size()) function(rows[k], indices[k], values[k]);
+   }
+   else if(Format_ == SparseFormat::CSR) FOR(i, nRows_) FOR(k, Offsets_.data()[i], Offsets_.data()[i + 1]) function(i, indices[k], values[k]);
+   else FOR(j, nColumns_) FOR(k, Offsets_.data()[j], Offsets_.data()[j + 1]) function(indices[k], j, values[k]);
+}
+
+/***************************************************************************************************************************************************************
+* Sparse Matrix Construction
+***************************************************************************************************************************************************************/
+template<Arithmetic T>
+SparseMatrix<T>
+PoissonMatrix(const size_t n, const size_t n_dims)
+{
+   ASSERT(n && n_dims, "The Poisson matrix grid must be non-empty.")
+
+   const size_t n_points = iPow(n, static_cast<unsigned>(n_dims));
+   SparseMatrix<T> matrix(n_points, n_points);
+   matrix.Reserve((2 * n_dims + 1) * n_points);
+   FOR(point, n_points)
+   {
+      matrix.Insert(point, point, static_cast<T>(2 * n_dims));
+      for(size_t dim = 0, stride = 1; dim < n_dims; ++dim, stride *= n)
+      {
+         const size_t coordinate = point / stride % n;
+         if(coordinate > 0)     matrix.Insert(point, point - stride, static_cast<T>(-1));
+         if(coordinate < n - 1) matrix.Insert(point, point + stride, static_cast<T>(-1));
+      }
+   }
+   matrix.Convert(SparseFormat::CSR);
+   return matrix;
+}
+
+}
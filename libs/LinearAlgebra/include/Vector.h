@@ -40,6 +40,9 @@ class Vector : public detail::NumericContainer<T, D>
 
    constexpr const T& z() const { return Derived()[2]; }
 
+   /** Expression Evaluation */
+   using detail::NumericContainer<T, D>::operator=;
+
    /** Derived Class Access */
    constexpr D& Derived() noexcept { return static_cast<D&>(*this); }
 
@@ -75,9 +78,14 @@ class StaticVector final : public StaticArray<T, N>,
    constexpr StaticVector(const It first, const It last)
      : BaseArray(first, last) {}
 
+   template<class E>
+   constexpr StaticVector(const detail::Expression<T, E>& expression)
+     : BaseArray() { *this = expression; }
+
    /** Operators */
    using BaseArray::operator[];
    using BaseArray::operator=;
+   using Vector<T, StaticVector<T, N>>::operator=;
 };
 
 /***************************************************************************************************************************************************************
@@ -109,9 +117,14 @@ class DynamicVector final : public DynamicArray<T>,
    DynamicVector(const It first, const It last)
      : BaseArray(first, last) {}
 
+   template<class E>
+   DynamicVector(const detail::Expression<T, E>& expression)
+     : BaseArray() { *this = expression; }
+
    /** Operators */
    using BaseArray::operator[];
    using BaseArray::operator=;
+   using Vector<T, DynamicVector<T>>::operator=;
 };
 
 /***************************************************************************************************************************************************************
@@ -170,4 +183,32 @@ ToVector(const SVector<T, M>& from)
    return to;
 }
 
+template<size_t N, class E>
+requires detail::AnyExpressionOperand<E>
+constexpr auto
+ToVector(const E& from) { return ToVector<N>(Evaluate(from)); }
+
+/***************************************************************************************************************************************************************
+* Vector Precision Conversion
+***************************************************************************************************************************************************************/
+
+/** Convert entries to another scalar type, e.g. to hand single-precision geometry to a double-precision solver. */
+template<typename T2, typename T, size_t N>
+constexpr SVector<T2, N>
+VectorCast(const SVector<T, N>& from)
+{
+   SVector<T2, N> to;
+   std::transform(from.begin(), from.end(), to.begin(), [](const T entry){ return static_cast<T2>(entry); });
+   return to;
+}
+
+template<typename T2, typename T>
+DVector<T2>
+VectorCast(const DVector<T>& from)
+{
+   DVector<T2> to(from.size());
+   std::transform(from.begin(), from.end(), to.begin(), [](const T entry){ return static_cast<T2>(entry); });
+   return to;
+}
+
 }
@@ -15,8 +15,13 @@
 #pragma once
 
 #include "../../../include/Global.h"
+#include "../../../include/Parallel.h"
+#include "../../DataContainer/include/SoAArray.h"
 #include "../../LinearAlgebra/include/Vector.h"
 
+#include <array>
+#include <numeric>
+
 namespace aprn {
 
 /***************************************************************************************************************************************************************
@@ -28,19 +33,24 @@ InnerProduct(const Vector<T, D>& vector0, const Vector<T, D>& vector1)
 {
    const auto& v0 = vector0.Derived();
    const auto& v1 = vector1.Derived();
-   return std::inner_product(v0.begin(), v0.end(), v1.begin(), static_cast<T>(Zero));
+   if constexpr(simd::Vectorisable<D>)
+   {
+      DEBUG_ASSERT(v0.size() == v1.size(), "The vector sizes ", v0.size(), " and ", v1.size(), " must be equal.")
+      return simd::Dot(v0.data(), v1.data(), v0.size());
+   }
+   else return std::inner_product(v0.begin(), v0.end(), v1.begin(), static_cast<T>(Zero));
 }
 
 template<typename T, class D>
-constexpr SVectorR3
+constexpr SVector3<T>
 CrossProduct(const Vector<T, D>& vector0, const Vector<T, D>& vector1)
 {
    const auto& v0 = vector0.Derived();
    const auto& v1 = vector1.Derived();
    ASSERT(v0.size() == v1.size() && (v0.size() == 2 || v0.size() == 3), "Cross products can only be computed for 2D or 3D vectors.")
 
-   return v0.size() == 2 ? SVectorR3{Zero, Zero, v0[0] * v1[1] - v0[1] * v1[0]} :
-          SVectorR3{v0[1] * v1[2] - v0[2] * v1[1], v0[2] * v1[0] - v0[0] * v1[2], v0[0] * v1[1] - v0[1] * v1[0]};
+   return v0.size() == 2 ? SVector3<T>{T{}, T{}, v0[0] * v1[1] - v0[1] * v1[0]} :
+          SVector3<T>{v0[1] * v1[2] - v0[2] * v1[1], v0[2] * v1[0] - v0[0] * v1[2], v0[0] * v1[1] - v0[1] * v1[0]};
 }
 
 /***************************************************************************************************************************************************************
@@ -56,7 +66,8 @@ LpNorm(const Vector<T, D>& v)
    const auto& vector = v.Derived();
    switch(p)
    {
-      case 1: return Sum(vector.begin(), vector.end());
+      case 1: if constexpr(simd::Vectorisable<D>) return simd::SumAbs(vector.data(), vector.size());
+              else return std::accumulate(vector.begin(), vector.end(), T{}, [](const T sum, const T entry){ return sum + Abs(entry); });
       case 2: return std::sqrt(InnerProduct(vector, vector));
       case 3: throw("TODO");
    }
@@ -72,7 +83,12 @@ L2Norm(const Vector<T, D>& v) { return LpNorm<2>(v); }
 
 template<typename T, class D>
 constexpr T
-LInfNorm(const Vector<T, D>& v) { return MaxEntry(v.Derived().begin(), v.Derived().end()); }
+LInfNorm(const Vector<T, D>& v)
+{
+   const auto& vector = v.Derived();
+   if constexpr(simd::Vectorisable<D>) return simd::MaxAbs(vector.data(), vector.size());
+   else return std::accumulate(vector.begin(), vector.end(), T{}, [](const T norm, const T entry){ return Max(norm, Abs(entry)); });
+}
 
 template<typename T, class D>
 constexpr Real
@@ -91,15 +107,15 @@ Normalise(const Vector<T, D>& v)
 }
 
 /***************************************************************************************************************************************************************
-* Vector Angle/Alignment/Rotation
+* Vector Angle/Alignment
 ***************************************************************************************************************************************************************/
 template<bool orientangle = false, typename T, class D>
 constexpr Real
 ComputeAngle(const Vector<T, D>& v0, const Vector<T, D>& v1, const SVectorR3& orient = zAxis3)
 {
-   const auto smallangle = std::acos(InnerProduct(Normalise(v0), Normalise(v1)));
+   const auto smallangle = std::acos(std::clamp(InnerProduct(Normalise(v0), Normalise(v1)), -One, One));
    if constexpr(!orientangle) return smallangle;
-   else return Sgn(InnerProduct(CrossProduct(v0, v1), orient)) * smallangle;
+   else return Sgn(InnerProduct(VectorCast<Real>(CrossProduct(v0, v1)), orient)) * smallangle;
 }
 
 template<typename T, class D>
@@ -111,20 +127,219 @@ isAligned(const Vector<T, D>& v0, const Vector<T, D>& v1, const Real angle_thres
                                                  throw std::domain_error("Angle threshold is out of bounds.");
 }
 
+/***************************************************************************************************************************************************************
+* Vector Expression Overloads
+***************************************************************************************************************************************************************/
+
+/** Unevaluated vector expressions are evaluated into their plain vector type before being passed on. */
+template<class V0, class V1>
+requires detail::AnyExpressionOperand<V0, V1>
+constexpr auto
+InnerProduct(const V0& vector0, const V1& vector1) { return InnerProduct(Evaluate(vector0), Evaluate(vector1)); }
+
+template<class V0, class V1>
+requires detail::AnyExpressionOperand<V0, V1>
+constexpr auto
+CrossProduct(const V0& vector0, const V1& vector1) { return CrossProduct(Evaluate(vector0), Evaluate(vector1)); }
+
+template<size_t p, class E>
+requires detail::AnyExpressionOperand<E>
+constexpr Real
+LpNorm(const E& v) { return LpNorm<p>(Evaluate(v)); }
+
+template<class E>
+requires detail::AnyExpressionOperand<E>
+constexpr auto
+L1Norm(const E& v) { return L1Norm(Evaluate(v)); }
+
+template<class E>
+requires detail::AnyExpressionOperand<E>
+constexpr Real
+L2Norm(const E& v) { return L2Norm(Evaluate(v)); }
+
+template<class E>
+requires detail::AnyExpressionOperand<E>
+constexpr auto
+LInfNorm(const E& v) { return LInfNorm(Evaluate(v)); }
+
+template<class E>
+requires detail::AnyExpressionOperand<E>
+constexpr Real
+Magnitude(const E& v) { return Magnitude(Evaluate(v)); }
+
+template<class E>
+requires detail::AnyExpressionOperand<E>
+constexpr bool
+isNormalised(const E& v) { return isNormalised(Evaluate(v)); }
+
+template<class E>
+requires detail::AnyExpressionOperand<E>
+constexpr auto
+Normalise(const E& v) { return Normalise(Evaluate(v)); }
+
+template<bool orientangle = false, class V0, class V1>
+requires detail::AnyExpressionOperand<V0, V1>
+constexpr Real
+ComputeAngle(const V0& v0, const V1& v1, const SVectorR3& orient = zAxis3) { return ComputeAngle<orientangle>(Evaluate(v0), Evaluate(v1), orient); }
+
+template<class V0, class V1>
+requires detail::AnyExpressionOperand<V0, V1>
+constexpr bool
+isAligned(const V0& v0, const V1& v1, const Real angle_thresh = TwelfthPi) { return isAligned(Evaluate(v0), Evaluate(v1), angle_thresh); }
+
+/***************************************************************************************************************************************************************
+* Vector Rotation
+***************************************************************************************************************************************************************/
+/** Rotations are right-handed, by Rodrigues' formula for 3D vectors. 2D vectors are rotated in the xy-plane, about an axis along +/- z. As for the rotation
+ *  matrices, these are not constexpr, since std::cos and std::sin are not usable in constant expressions. */
 template<typename T, class D>
-constexpr D
+inline D
 RotateAbout(const Vector<T, D>& vector, const Real& angle, const SVectorR3& axis = zAxis3)
 {
-   EXIT("TODO")
-   return D{};
+   const auto& v = vector.Derived();
+   ASSERT(v.size() == 2 || v.size() == 3, "Vectors can only be rotated in 2D or 3D.")
+
+   const Real cos = std::cos(angle);
+   const Real sin = std::sin(angle);
+   D rotated(v);
+   if(v.size() == 2)
+   {
+      ASSERT(axis[0] == Zero && axis[1] == Zero && axis[2] != Zero, "2D vectors can only be rotated about the z-axis.")
+      const Real signed_sin = Sgn(axis[2]) * sin;
+      rotated[0] = static_cast<T>(cos * v[0] - signed_sin * v[1]);
+      rotated[1] = static_cast<T>(signed_sin * v[0] + cos * v[1]);
+   }
+   else
+   {
+      const auto k = Normalise(axis);
+      const Real k_dot_v = k[0] * v[0] + k[1] * v[1] + k[2] * v[2];
+      const SVectorR3 k_cross_v{k[1] * v[2] - k[2] * v[1], k[2] * v[0] - k[0] * v[2], k[0] * v[1] - k[1] * v[0]};
+      FOR(i, 3) rotated[i] = static_cast<T>(cos * v[i] + sin * k_cross_v[i] + (One - cos) * k_dot_v * k[i]);
+   }
+   return rotated;
 }
 
+/** Rotate a vector by an angle in the plane it spans with a reference vector, towards the reference. */
 template<typename T, class D>
-constexpr D
+inline D
 RotateTowards(const Vector<T, D>& vector, const Real& angle, const Vector<T, D>& reference)
 {
-   EXIT("TODO")
-   return D{};
+   const auto axis = VectorCast<Real>(CrossProduct(vector, reference));
+   ASSERT(!isEqual(Magnitude(axis), Zero), "The vector cannot be rotated towards a parallel reference vector.")
+   return RotateAbout(vector, angle, axis);
+}
+
+/***************************************************************************************************************************************************************
+* Batched Vector Geometry
+***************************************************************************************************************************************************************/
+
+/** 3D Real vectors stored as a structure of arrays, e.g. the points and normals of a large mesh. */
+using SoAVectorsR3 = SoAArray<Real, Real, Real>;
+
+namespace detail {
+
+/** Number of vectors processed by each SIMD kernel call, and the unit of work split between threads. */
+constexpr size_t BatchChunkSize = 4096;
+
+inline simd::Vectors3<const Real>
+MakeVectors3(const SoAVectorsR3& vectors, const size_t first)
+{
+   return {vectors.Field<0>().data() + first, vectors.Field<1>().data() + first, vectors.Field<2>().data() + first};
+}
+
+inline simd::Vectors3<Real>
+MakeVectors3(SoAVectorsR3& vectors, const size_t first)
+{
+   return {vectors.Field<0>().data() + first, vectors.Field<1>().data() + first, vectors.Field<2>().data() + first};
+}
+
+/** Apply a function to each chunk [first, last) of [0, n), with the chunks split between threads. */
+template<class F>
+void
+BatchedFor(const size_t n, F&& function)
+{
+   ParallelFor((n + BatchChunkSize - 1) / BatchChunkSize, [&](const size_t chunk)
+   {
+      const size_t first = chunk * BatchChunkSize;
+      function(first, Min(first + BatchChunkSize, n));
+   }, BatchChunkSize);
+}
+
+/** Sum of the values returned by a function of each chunk [first, last) of [0, n), with the chunks split between threads. */
+template<class F>
+size_t
+BatchedReduce(const size_t n, F&& function)
+{
+   return ParallelReduce((n + BatchChunkSize - 1) / BatchChunkSize, size_t{}, [&](const size_t chunk)
+   {
+      const size_t first = chunk * BatchChunkSize;
+      return function(first, Min(first + BatchChunkSize, n));
+   }, std::plus<size_t>(), BatchChunkSize);
+}
+
+}//detail
+
+/** Batched counterparts of the above over millions of vectors, using the SIMD kernels. Sizes are checked once per batch, and the outputs are resized to the
+ *  batch size. Instead of throwing, vectors too small to be normalised or to define an angle are flagged in a degenerate mask, and their number is returned.
+ *  Their normalisations are zero, and the angles involving them are zero. The outputs may be the same arrays as the inputs. */
+inline void
+CrossProduct(const SoAVectorsR3& vectors0, const SoAVectorsR3& vectors1, SoAVectorsR3& cross_products)
+{
+   ASSERT(vectors0.size() == vectors1.size(), "The vector batch sizes ", vectors0.size(), " and ", vectors1.size(), " must be equal.")
+
+   cross_products.resize(vectors0.size());
+   detail::BatchedFor(vectors0.size(), [&](const size_t first, const size_t last)
+   {
+      simd::Cross(detail::MakeVectors3(vectors0, first), detail::MakeVectors3(vectors1, first), detail::MakeVectors3(cross_products, first), last - first);
+   });
+}
+
+inline size_t
+Normalise(const SoAVectorsR3& vectors, SoAVectorsR3& normalised, DArrayB& degenerate)
+{
+   normalised.resize(vectors.size());
+   degenerate.resize(vectors.size());
+   return detail::BatchedReduce(vectors.size(), [&](const size_t first, const size_t last)
+   {
+      return simd::Normalise(detail::MakeVectors3(vectors, first), detail::MakeVectors3(normalised, first), degenerate.data() + first, last - first,
+                             ZeroTolerance);
+   });
+}
+
+inline size_t
+ComputeAngle(const SoAVectorsR3& vectors0, const SoAVectorsR3& vectors1, DArrayF& angles, DArrayB& degenerate)
+{
+   ASSERT(vectors0.size() == vectors1.size(), "The vector batch sizes ", vectors0.size(), " and ", vectors1.size(), " must be equal.")
+
+   angles.resize(vectors0.size());
+   degenerate.resize(vectors0.size());
+   return detail::BatchedReduce(vectors0.size(), [&](const size_t first, const size_t last)
+   {
+      const size_t n_degenerate = simd::CosAngle(detail::MakeVectors3(vectors0, first), detail::MakeVectors3(vectors1, first), angles.data() + first,
+                                                 degenerate.data() + first, last - first, ZeroTolerance);
+      FOR(i, first, last) angles[i] = std::acos(angles[i]);
+      return n_degenerate;
+   });
+}
+
+/** Vectors are aligned if their angle is within the threshold of either zero or pi, i.e. if the absolute cosine of their angle is at least its cosine. */
+inline size_t
+isAligned(const SoAVectorsR3& vectors0, const SoAVectorsR3& vectors1, DArrayB& aligned, DArrayB& degenerate, const Real angle_thresh = TwelfthPi)
+{
+   ASSERT(vectors0.size() == vectors1.size(), "The vector batch sizes ", vectors0.size(), " and ", vectors1.size(), " must be equal.")
+   ASSERT(isBounded(angle_thresh, Zero, HalfPi), "The angle threshold ", angle_thresh, " is out of bounds.")
+
+   const Real cos_thresh = std::cos(angle_thresh);
+   aligned.resize(vectors0.size());
+   degenerate.resize(vectors0.size());
+   return detail::BatchedReduce(vectors0.size(), [&](const size_t first, const size_t last)
+   {
+      std::array<Real, detail::BatchChunkSize> cosines;
+      const size_t n_degenerate = simd::CosAngle(detail::MakeVectors3(vectors0, first), detail::MakeVectors3(vectors1, first), cosines.data(),
+                                                 degenerate.data() + first, last - first, ZeroTolerance);
+      FOR(i, first, last) aligned[i] = std::abs(cosines[i - first]) > cos_thresh;
+      return n_degenerate;
+   });
 }
 
 }
@@ -0,0 +1,138 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+
+#include <gtest/gtest.h>
+
+#include "../../../include/Global.h"
+#include "../include/IterativeSolver.h"
+#include "../include/VectorOperations.h"
+
+#ifdef DEBUG_MODE
+
+namespace aprn {
+
+/***************************************************************************************************************************************************************
+* Iterative Solver Test Fixture
+***************************************************************************************************************************************************************/
+class IterativeSolverTest : public testing::Test
+{
+ public:
+   static constexpr size_t nGrid = 24;
+   static constexpr Real Tolerance = 1.0e-10;
+
+   SparseMatrix<Real> Poisson;
+   SparseMatrix<Real> Convection;
+   DVectorR Rhs;
+
+   IterativeSolverTest()
+      : Poisson(PoissonMatrix(nGrid, 2)), Convection(nGrid * nGrid, nGrid * nGrid), Rhs(nGrid * nGrid)
+   {
+      // Non-symmetric convection-diffusion matrix, from an upwinded first derivative along the grid rows.
+      FOR(i, nGrid * nGrid)
+      {
+         Convection.Insert(i, i, Six);
+         if(i % nGrid) Convection.Insert(i, i - 1, -Two);
+         if((i + 1) % nGrid) Convection.Insert(i, i + 1, -One);
+         if(i >= nGrid) Convection.Insert(i, i - nGrid, -One);
+         if(i + nGrid < nGrid * nGrid) Convection.Insert(i, i + nGrid, -One);
+      }
+      Convection.Convert(SparseFormat::CSR);
+      Rhs.Randomise();
+   }
+
+   /** Relative residual |b - A x| / |b|. */
+   static Real Residual(const SparseMatrix<Real>& matrix, const DVectorR& x, const DVectorR& b)
+   {
+      const DVectorR r = b - matrix * x;
+      return L2Norm(r) / L2Norm(b);
+   }
+
+   template<class Solver, class P>
+   void ExpectSolved(Solver&& solver, const SparseMatrix<Real>& matrix, const P& preconditioner)
+   {
+      DVectorR x;
+      const SolverResult result = solver([&](const DVectorR& v, DVectorR& y){ matrix.Multiply(v, y); }, Rhs, x, SolverSettings{Tolerance, 2000, 30},
+                                         preconditioner);
+      EXPECT_TRUE(result.isConverged);
+      EXPECT_GT(result.nIterations, 0);
+      EXPECT_LE(result.RelativeResidual, Tolerance);
+      EXPECT_LT(Residual(matrix, x, Rhs), 10.0 * Tolerance);
+   }
+};
+
+#define SOLVER(name) [](auto&&... args){ return name(std::forward<decltype(args)>(args)...); }
+
+/***************************************************************************************************************************************************************
+* Test Solvers
+***************************************************************************************************************************************************************/
+TEST_F(IterativeSolverTest, ConjugateGradient)
+{
+   // Force the parallel kernels on the small test problem.
+   const size_t threshold = ParallelThreshold();
+   const size_t n_threads = nThreads();
+   SetParallelThreshold(0);
+   SetThreads(4);
+
+   ExpectSolved(SOLVER(ConjugateGradient), Poisson, IdentityPreconditioner());
+   ExpectSolved(SOLVER(ConjugateGradient), Poisson, JacobiPreconditioner(Poisson));
+   ExpectSolved(SOLVER(ConjugateGradient), Poisson, SSORPreconditioner(Poisson, 1.5));
+   ExpectSolved(SOLVER(ConjugateGradient), Poisson, ILU0Preconditioner(Poisson));
+
+   SetThreads(n_threads);
+   SetParallelThreshold(threshold);
+}
+
+TEST_F(IterativeSolverTest, BiCGSTAB)
+{
+   ExpectSolved(SOLVER(BiCGSTAB), Convection, IdentityPreconditioner());
+   ExpectSolved(SOLVER(BiCGSTAB), Convection, JacobiPreconditioner(Convection));
+   ExpectSolved(SOLVER(BiCGSTAB), Convection, ILU0Preconditioner(Convection));
+   ExpectSolved(SOLVER(BiCGSTAB), Poisson, SSORPreconditioner(Poisson));
+}
+
+TEST_F(IterativeSolverTest, GMRES)
+{
+   ExpectSolved(SOLVER(GMRES), Convection, IdentityPreconditioner());
+   ExpectSolved(SOLVER(GMRES), Convection, JacobiPreconditioner(Convection));
+   ExpectSolved(SOLVER(GMRES), Convection, SSORPreconditioner(Convection));
+   ExpectSolved(SOLVER(GMRES), Poisson, ILU0Preconditioner(Poisson));
+
+   // Residuals of zero right-hand sides are absolute.
+   DVectorR x(Rhs.size(), One), zero(Rhs.size(), Zero);
+   const auto poisson = [&](const DVectorR& v, DVectorR& y){ Poisson.Multiply(v, y); };
+   EXPECT_TRUE(GMRES(poisson, zero, x).isConverged);
+   EXPECT_LE(L2Norm(DVectorR(Poisson * x)), SolverSettings().Tolerance);
+}
+
+TEST_F(IterativeSolverTest, Preconditioners)
+{
+   // Preconditioning reduces the iteration count, and ILU(0) is exact for tridiagonal matrices.
+   const auto poisson = [&](const DVectorR& v, DVectorR& y){ Poisson.Multiply(v, y); };
+   DVectorR x0, x1;
+   const size_t n_plain = ConjugateGradient(poisson, Rhs, x0).nIterations;
+   EXPECT_LT(ConjugateGradient(poisson, Rhs, x1, {}, ILU0Preconditioner(Poisson)).nIterations, n_plain);
+
+   const SparseMatrix<Real> tridiagonal = PoissonMatrix(50, 1);
+   DVectorR b(50), x(50), z;
+   b.Randomise();
+   const ILU0Preconditioner ilu(tridiagonal);
+   ilu(b, z);
+   EXPECT_LT(Residual(tridiagonal, z, b), Tolerance);
+   EXPECT_EQ(BiCGSTAB([&](const DVectorR& v, DVectorR& y){ tridiagonal.Multiply(v, y); }, b, x, {}, ilu).nIterations, 1);
+}
+
+}
+
+#endif
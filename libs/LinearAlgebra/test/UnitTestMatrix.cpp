@@ -0,0 +1,285 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+
+#include <gtest/gtest.h>
+
+#include "../../../include/Global.h"
+#include "../../DataContainer/include/MultiArray.h"
+#include "../include/MatrixOperations.h"
+
+#ifdef DEBUG_MODE
+
+namespace aprn {
+
+/***************************************************************************************************************************************************************
+* Matrix Test Fixture
+***************************************************************************************************************************************************************/
+class MatrixTest : public testing::Test
+{
+ public:
+   Random<int> RandomInt;
+
+   MatrixTest()
+      : RandomInt(-10, 10) {}
+
+   template<class A>
+   void Randomise(A& array) { FOR_EACH(entry, array) entry = static_cast<Real>(RandomInt()); }
+};
+
+/***************************************************************************************************************************************************************
+* Test Small Matrix Products
+***************************************************************************************************************************************************************/
+TEST_F(MatrixTest, StaticProduct)
+{
+   constexpr SMatrixR3 rotation{0.0, 1.0, 0.0, -1.0, 0.0, 0.0, 0.0, 0.0, 1.0};
+   constexpr SMatrixR3 square = MatrixProduct(rotation, rotation);
+   constexpr SMatrixR3 identity = MatrixProduct(square, square);
+   static_assert(square(0, 0) == -1.0 && square(1, 1) == -1.0 && square(2, 2) == 1.0 && square(1, 0) == 0.0);
+   static_assert(identity(0, 0) == 1.0 && identity(1, 1) == 1.0 && identity(0, 1) == 0.0);
+   static_assert(MatrixVectorProduct(rotation, SVectorR3{1.0, 0.0, 0.0})[1] == 1.0);
+
+   SMatrixR4 a, b;
+   SMatrix<Real, 4, 5> c;
+   Randomise(a);
+   Randomise(b);
+   Randomise(c);
+   const auto ab  = MatrixProduct(a, b);
+   const auto abc = MatrixProduct(ab, c);
+   const auto bc  = MatrixProduct(b, c);
+   FOR(i, 4) FOR(j, 4)
+   {
+      Real expected{};
+      FOR(p, 4) expected += a(i, p) * b(p, j);
+      EXPECT_DOUBLE_EQ(ab(i, j), expected);
+   }
+   FOR(i, 4) FOR(j, 5) EXPECT_DOUBLE_EQ(abc(i, j), MatrixProduct(a, bc)(i, j));
+}
+
+/***************************************************************************************************************************************************************
+* Test General Matrix Products
+***************************************************************************************************************************************************************/
+TEST_F(MatrixTest, Gemm)
+{
+   // Force the parallel kernel on small matrices.
+   const size_t threshold = ParallelThreshold();
+   const size_t n_threads = nThreads();
+   SetParallelThreshold(0);
+   SetThreads(4);
+
+   // Sizes straddle the tile and block edges, and row-major and transposed operands exercise the strided packing.
+   for(const auto [m, k, n] : {std::array<size_t, 3>{1, 1, 1}, {5, 3, 7}, {17, 9, 13}, {64, 64, 64}, {131, 300, 37}, {250, 20, 1600}})
+   {
+      DynamicMultiArray<Real, RowMajor> a(m, k);
+      DynamicMultiArray<Real> b(n, k);
+      DynamicMatrix<Real> c(m, n);
+      Randomise(a);
+      Randomise(b);
+      Randomise(c);
+      const DynamicMatrix<Real> c0 = c;
+
+      Gemm(Two, std::as_const(a).View<2>(), std::as_const(b).View<2>().Transpose(), -One, c.View<2>());
+      FOR(i, m) FOR(j, n)
+      {
+         Real expected = -c0(i, j);
+         FOR(p, k) expected += Two * a(i, p) * b(j, p);
+         EXPECT_DOUBLE_EQ(c(i, j), expected);
+      }
+   }
+   SetThreads(n_threads);
+   SetParallelThreshold(threshold);
+}
+
+TEST_F(MatrixTest, SinglePrecision)
+{
+   // Small integer entries keep every partial sum exact in single precision, so the float kernels must match double precision exactly.
+   const size_t m = 67, k = 300, n = 45;
+   DynamicMatrix<Real> a(m, k), b(k, n);
+   Randomise(a);
+   Randomise(b);
+   const auto a_float = MatrixCast<float>(a);
+   const auto b_float = MatrixCast<float>(b);
+   DynamicMatrix<float> c(m, n);
+   DynamicVector<float> x(k, 1.0f), y(m);
+
+   FOR(level, static_cast<size_t>(simd::DetectSimdLevel()) + 1)
+   {
+      simd::SetSimdLevel(static_cast<simd::SimdLevel>(level));
+      Gemm(1.0f, a_float.View<2>(), b_float.View<2>(), 0.0f, c.View<2>());
+      Gemv(1.0f, a_float.View<2>(), x.data(), 0.0f, y.data());
+      FOR(i, m)
+      {
+         Real row_sum{};
+         FOR(p, k) row_sum += a(i, p);
+         EXPECT_FLOAT_EQ(y[i], static_cast<float>(row_sum));
+         FOR(j, n)
+         {
+            Real expected{};
+            FOR(p, k) expected += a(i, p) * b(p, j);
+            EXPECT_FLOAT_EQ(c(i, j), static_cast<float>(expected));
+         }
+      }
+   }
+   simd::SetSimdLevel(simd::DetectSimdLevel());
+
+   const auto c_double = MatrixCast<Real>(c);
+   FOR(i, m) FOR(j, n) EXPECT_DOUBLE_EQ(c_double(i, j), static_cast<Real>(c(i, j)));
+}
+
+TEST_F(MatrixTest, DynamicProduct)
+{
+   DynamicMatrix<Real> a(70, 90), b(90, 50);
+   DynamicMatrix<Int> ai(3, 4, 2), bi(4, 2, 3);
+   Randomise(a);
+   Randomise(b);
+
+   const auto ab = MatrixProduct(a, b);
+   EXPECT_EQ(ab.nRows(), 70);
+   EXPECT_EQ(ab.nColumns(), 50);
+   FOR(i, 70) FOR(j, 50)
+   {
+      Real expected{};
+      FOR(p, 90) expected += a(i, p) * b(p, j);
+      EXPECT_DOUBLE_EQ(ab(i, j), expected);
+   }
+   FOR_EACH_CONST(entry, MatrixProduct(ai, bi)) EXPECT_EQ(entry, 24);
+}
+
+TEST_F(MatrixTest, Gemv)
+{
+   const size_t threshold = ParallelThreshold();
+   SetParallelThreshold(0);
+
+   constexpr size_t m = 37;
+   constexpr size_t n = 23;
+   DynamicMultiArray<Real> a(2 * m, n);
+   DynamicMultiArray<Real, RowMajor> a_rows(m, n);
+   DVectorR x(n);
+   Randomise(a);
+   Randomise(a_rows);
+   Randomise(x);
+
+   // Contiguous columns, contiguous rows, and non-contiguous strides.
+   const auto a_view = std::as_const(a).View<2>();
+   for(const auto& view : {a_view.Block({0, 0}, {m, n}), std::as_const(a_rows).View<2>(), a_view.Block({1, 0}, {m, n}, {2, 1})})
+   {
+      DVectorR y(m);
+      Randomise(y);
+      const DVectorR y0 = y;
+      Gemv(-Two, view, x.data(), One, y.data());
+      FOR(i, m)
+      {
+         Real expected = y0[i];
+         FOR(j, n) expected += -Two * view(i, j) * x[j];
+         EXPECT_DOUBLE_EQ(y[i], expected);
+      }
+   }
+
+   DynamicMatrix<Real> matrix(m, n);
+   DVectorR vector(n);
+   Randomise(matrix);
+   Randomise(vector);
+   const DVectorR product = MatrixVectorProduct(matrix, vector);
+   FOR(i, m)
+   {
+      Real expected{};
+      FOR(j, n) expected += matrix(i, j) * vector[j];
+      EXPECT_DOUBLE_EQ(product[i], expected);
+   }
+   SetParallelThreshold(threshold);
+}
+
+
+/***************************************************************************************************************************************************************
+* Test Small Square Matrix Operations
+***************************************************************************************************************************************************************/
+TEST_F(MatrixTest, Transpose)
+{
+   constexpr SMatrix<Real, 2, 3> a{1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+   constexpr auto transpose = Transpose(a);
+   static_assert(transpose(0, 1) == 2.0 && transpose(2, 0) == 5.0 && transpose(1, 1) == 4.0);
+   static_assert(Transpose(transpose)(1, 2) == 6.0);
+}
+
+TEST_F(MatrixTest, DeterminantInverse)
+{
+   constexpr SMatrixR2 a2{2.0, 1.0, 1.0, 3.0};
+   static_assert(Determinant(a2) == 5.0);
+   static_assert(Determinant(IdentityMatrix<Real, 4>()) == 1.0);
+   static_assert(Inverse(SMatrixR3{2.0, 0.0, 0.0, 0.0, 4.0, 0.0, 0.0, 0.0, 8.0})(2, 2) == 0.125);
+
+   const auto check_inverse = [this]<size_t N>(SMatrix<Real, N, N> a)
+   {
+      Randomise(a);
+      FOR(i, N) a.begin()[i * (N + 1)] += 20.0; // Diagonally dominant, hence non-singular.
+      const auto identity = MatrixProduct(a, Inverse(a));
+      FOR(i, N) FOR(j, N) EXPECT_NEAR(identity(i, j), i == j ? One : Zero, Small);
+
+      // The determinant is the product of the pivots of Gaussian elimination.
+      auto u = a;
+      Real det = One;
+      FOR(p, N)
+      {
+         det *= u(p, p);
+         for(size_t i = p + 1; i < N; ++i) for(size_t j = N; j-- > p;) u(i, j) -= u(i, p) / u(p, p) * u(p, j);
+      }
+      EXPECT_NEAR(Determinant(a), det, Small * std::abs(det));
+   };
+   check_inverse(SMatrixR2{});
+   check_inverse(SMatrixR3{});
+   check_inverse(SMatrixR4{});
+}
+
+TEST_F(MatrixTest, Rotation)
+{
+   const auto rotation2 = RotationMatrix(HalfPi);
+   const auto rotated2 = MatrixVectorProduct(rotation2, xAxis2);
+   EXPECT_NEAR(rotated2[0], Zero, Small);
+   EXPECT_NEAR(rotated2[1], One, Small);
+
+   // The rotation matrix, quaternion and vector rotation agree, and rotation matrices are orthogonal with unit determinant.
+   SVectorR3 axis, vector;
+   axis.Randomise();
+   vector.Randomise();
+   const Real angle = 0.7;
+   const auto rotation = RotationMatrix(angle, axis);
+   const auto from_quaternion = RotationMatrix(AxisAngleQuaternion(angle, axis));
+   const auto rotated = MatrixVectorProduct(rotation, vector);
+   const auto expected = RotateAbout(vector, angle, axis);
+   FOR(i, 3) EXPECT_NEAR(rotated[i], expected[i], Small);
+   FOR(i, 3) FOR(j, 3) EXPECT_NEAR(from_quaternion(i, j), rotation(i, j), Small);
+   const auto identity = MatrixProduct(Transpose(rotation), rotation);
+   FOR(i, 3) FOR(j, 3) EXPECT_NEAR(identity(i, j), i == j ? One : Zero, Small);
+   EXPECT_NEAR(Determinant(rotation), One, Small);
+
+   // Quaternion products compose rotations.
+   const auto q0 = AxisAngleQuaternion(angle, axis);
+   const auto q1 = AxisAngleQuaternion(-0.3, vector);
+   const auto composed = RotationMatrix(QuaternionProduct(q1, q0));
+   const auto product = MatrixProduct(RotationMatrix(-0.3, vector), rotation);
+   FOR(i, 3) FOR(j, 3) EXPECT_NEAR(composed(i, j), product(i, j), Small);
+   static_assert(RotationMatrix(SVectorR4{0.0, 0.0, 1.0, 0.0})(0, 0) == -1.0);
+
+   // Affine transformations act on homogeneous points.
+   const auto affine = AffineMatrix(rotation, SVectorR3{1.0, 2.0, 3.0});
+   const auto transformed = MatrixVectorProduct(affine, SVectorR4{vector[0], vector[1], vector[2], One});
+   FOR(i, 3) EXPECT_NEAR(transformed[i], rotated[i] + static_cast<Real>(i + 1), Small);
+   EXPECT_DOUBLE_EQ(transformed[3], One);
+   const auto inverse = MatrixProduct(Inverse(affine), affine);
+   FOR(i, 4) FOR(j, 4) EXPECT_NEAR(inverse(i, j), i == j ? One : Zero, Small);
+}
+
+}
+
+#endif
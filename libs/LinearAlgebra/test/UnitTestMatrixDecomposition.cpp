@@ -0,0 +1,154 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+
+#include <gtest/gtest.h>
+
+#include "../../../include/Global.h"
+#include "../include/MatrixDecomposition.h"
+
+#ifdef DEBUG_MODE
+
+namespace aprn {
+
+/***************************************************************************************************************************************************************
+* Matrix Decomposition Test Fixture
+***************************************************************************************************************************************************************/
+class MatrixDecompositionTest : public testing::Test
+{
+ public:
+   /** Sizes straddle the panel width, so that the trailing updates are exercised. */
+   static constexpr size_t nRows = 300;
+   static constexpr size_t nColumns = 260;
+   static constexpr size_t nRhs = 5;
+   static constexpr Real Tolerance = 1.0e-10;
+
+   DynamicMatrix<Real> Matrix;
+   DynamicMatrix<Real> Rhs;
+
+   MatrixDecompositionTest()
+      : Matrix(nRows, nRows), Rhs(nRows, nRhs)
+   {
+      // Symmetric and strictly diagonally dominant, hence positive definite.
+      Random<Real> random(-One, One);
+      FOR(j, nRows) FOR(i, j, nRows) Matrix(i, j) = Matrix(j, i) = i == j ? static_cast<Real>(nRows) : random();
+      FOR_EACH(entry, Rhs) entry = random();
+   }
+
+   /** Maximum entry of A X - B. */
+   static Real Residual(const DynamicMatrix<Real>& a, const MultiArrayView<const Real, 2>& x, const MultiArrayView<const Real, 2>& b)
+   {
+      DynamicMatrix<Real> residual(b.Dimensions()[0], b.Dimensions()[1]);
+      residual.View<2>() = b;
+      Gemm(One, a.View<2>(), x, -One, residual.View<2>());
+      Real max_residual{};
+      FOR_EACH_CONST(entry, residual) max_residual = Max(max_residual, Abs(entry));
+      return max_residual;
+   }
+};
+
+/***************************************************************************************************************************************************************
+* Test LU Decomposition
+***************************************************************************************************************************************************************/
+TEST_F(MatrixDecompositionTest, LU)
+{
+   // Make the matrix non-symmetric, with a zero leading entry requiring a row swap.
+   FOR(j, nRows) Matrix(0, j) = static_cast<Real>(j % 7);
+   const LUDecomposition lu(Matrix);
+   EXPECT_NE(lu.Pivots()[0], 0);
+
+   DynamicMatrix<Real> x = Rhs;
+   lu.Solve(x.View<2>());
+   EXPECT_LT(Residual(Matrix, std::as_const(x).View<2>(), std::as_const(Rhs).View<2>()), Tolerance);
+
+   DVectorR b(nRows);
+   b.Randomise();
+   const DVectorR y = lu.Solve(b);
+   EXPECT_LT(Residual(Matrix, MultiArrayView<const Real, 2>(y.data(), {nRows, size_t{1}}), MultiArrayView<const Real, 2>(b.data(), {nRows, size_t{1}})), Tolerance);
+
+   DynamicMatrix<Real> small(3, 3);
+   small(0, 0) = Zero; small(0, 1) = Two; small(0, 2) = One;
+   small(1, 0) = One;  small(1, 1) = One; small(1, 2) = Zero;
+   small(2, 0) = Four; small(2, 1) = Two; small(2, 2) = Three;
+   EXPECT_NEAR(LUDecomposition(small).Determinant(), -8.0, Tolerance);
+}
+
+/***************************************************************************************************************************************************************
+* Test Cholesky Decomposition
+***************************************************************************************************************************************************************/
+TEST_F(MatrixDecompositionTest, Cholesky)
+{
+   // Force the parallel triangular solves and products on the small test matrix.
+   const size_t threshold = ParallelThreshold();
+   const size_t n_threads = nThreads();
+   SetParallelThreshold(0);
+   SetThreads(4);
+
+   const CholeskyDecomposition cholesky(Matrix);
+   const auto l = std::as_const(cholesky.Factors()).View<2>();
+   DynamicMatrix<Real> product(nRows, nRows);
+   Gemm(One, l, l.Transpose(), Zero, product.View<2>());
+   FOR(j, nRows) FOR(i, nRows) EXPECT_NEAR(product(i, j), Matrix(i, j), Tolerance);
+   EXPECT_EQ(cholesky.Factors()(0, 1), Zero);
+
+   DynamicMatrix<Real> x = Rhs;
+   cholesky.Solve(x.View<2>());
+   EXPECT_LT(Residual(Matrix, std::as_const(x).View<2>(), std::as_const(Rhs).View<2>()), Tolerance);
+
+   SetThreads(n_threads);
+   SetParallelThreshold(threshold);
+}
+
+/***************************************************************************************************************************************************************
+* Test QR Decomposition
+***************************************************************************************************************************************************************/
+TEST_F(MatrixDecompositionTest, QR)
+{
+   DynamicMatrix<Real> tall(nRows, nColumns);
+   tall.View<2>() = std::as_const(Matrix).View<2>().Block({0, 0}, {nRows, nColumns});
+   const QRDecomposition qr(tall);
+
+   // Q R recovers the matrix, and Q is orthogonal.
+   DynamicMatrix<Real> r(nRows, nColumns, Zero);
+   FOR(j, nColumns) FOR(i, j + 1) r(i, j) = qr.Factors()(i, j);
+   qr.MultiplyQ(r.View<2>());
+   FOR(j, nColumns) FOR(i, nRows) EXPECT_NEAR(r(i, j), tall(i, j), Tolerance);
+
+   DynamicMatrix<Real> q(nRows, nRows, Zero);
+   FOR(i, nRows) q(i, i) = One;
+   qr.MultiplyQ(q.View<2>());
+   qr.MultiplyQTranspose(q.View<2>());
+   FOR(j, nRows) FOR(i, nRows) EXPECT_NEAR(q(i, j), i == j ? One : Zero, Tolerance);
+
+   // Least-squares residuals are orthogonal to the columns.
+   DynamicMatrix<Real> x = Rhs;
+   qr.Solve(x.View<2>());
+   DynamicMatrix<Real> residual = Rhs;
+   Gemm(One, std::as_const(tall).View<2>(), std::as_const(x).View<2>().Block({0, 0}, {nColumns, nRhs}), -One, residual.View<2>());
+   DynamicMatrix<Real> normal(nColumns, nRhs);
+   Gemm(One, std::as_const(tall).View<2>().Transpose(), std::as_const(residual).View<2>(), Zero, normal.View<2>());
+   FOR_EACH_CONST(entry, normal) EXPECT_NEAR(entry, Zero, 1.0e-8);
+
+   // Consistent systems are solved exactly.
+   DVectorR solution(nColumns), b(nRows, Zero);
+   solution.Randomise();
+   Gemv(One, std::as_const(tall).View<2>(), solution.data(), Zero, b.data());
+   const DVectorR y = qr.Solve(b);
+   ASSERT_EQ(y.size(), nColumns);
+   FOR(i, nColumns) EXPECT_NEAR(y[i], solution[i], Tolerance);
+}
+
+}
+
+#endif
@@ -0,0 +1,158 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+
+#include <gtest/gtest.h>
+
+#include "../../../include/Global.h"
+#include "../../DataContainer/include/MultiArray.h"
+#include "../include/SparseMatrix.h"
+
+#ifdef DEBUG_MODE
+
+namespace aprn {
+
+/***************************************************************************************************************************************************************
+* Sparse Matrix Test Fixture
+***************************************************************************************************************************************************************/
+class SparseMatrixTest : public testing::Test
+{
+ public:
+   static constexpr size_t nRows = 7;
+   static constexpr size_t nColumns = 5;
+
+   Random<int> RandomInt;
+   SparseMatrix<Real> Matrix;
+   StaticMultiArray<Real, nRows, nColumns> Dense;
+
+   SparseMatrixTest()
+      : RandomInt(-10, 10), Matrix(nRows, nColumns), Dense(Zero) {}
+
+   void SetUp() override
+   {
+      // Insert entries in scrambled order, with some duplicates.
+      FOR(k, 6 * nRows)
+      {
+         const size_t i = (5 * k + 3) % nRows;
+         const size_t j = (3 * k + 1) % nColumns;
+         const auto value = static_cast<Real>(RandomInt());
+         Matrix.Insert(i, j, value);
+         Dense(i, j) += value;
+      }
+   }
+
+   void ExpectEqualToDense(const SparseMatrix<Real>& matrix) const
+   {
+      FOR(i, nRows) FOR(j, nColumns) EXPECT_DOUBLE_EQ(matrix(i, j), Dense(i, j));
+   }
+};
+
+/***************************************************************************************************************************************************************
+* Test Format Conversion
+***************************************************************************************************************************************************************/
+TEST_F(SparseMatrixTest, Convert)
+{
+   ExpectEqualToDense(Matrix);
+   EXPECT_EQ(Matrix.nNonZeros(), 6 * nRows);
+
+   Matrix.Convert(SparseFormat::CSR);
+   EXPECT_EQ(Matrix.Format(), SparseFormat::CSR);
+   EXPECT_EQ(Matrix.Offsets().size(), nRows + 1);
+   EXPECT_EQ(Matrix.nNonZeros(), nRows * nColumns);
+   ExpectEqualToDense(Matrix);
+
+   // Compressed lines are sorted and free of duplicates.
+   FOR(i, nRows) FOR(k, Matrix.Offsets()[i] + 1, Matrix.Offsets()[i + 1]) EXPECT_LT(Matrix.Indices()[k - 1], Matrix.Indices()[k]);
+
+   Matrix.Convert(SparseFormat::CSC);
+   EXPECT_EQ(Matrix.Offsets().size(), nColumns + 1);
+   ExpectEqualToDense(Matrix);
+
+   Matrix.Convert(SparseFormat::COO);
+   EXPECT_TRUE(Matrix.Offsets().empty());
+   ExpectEqualToDense(Matrix);
+}
+
+TEST_F(SparseMatrixTest, Transpose)
+{
+   Matrix.Convert(SparseFormat::CSR);
+   Matrix.Transpose();
+   EXPECT_EQ(Matrix.Format(), SparseFormat::CSC);
+   EXPECT_EQ(Matrix.nRows(), nColumns);
+   FOR(i, nRows) FOR(j, nColumns) EXPECT_DOUBLE_EQ(Matrix(j, i), Dense(i, j));
+}
+
+/***************************************************************************************************************************************************************
+* Test Products
+***************************************************************************************************************************************************************/
+TEST_F(SparseMatrixTest, MatrixVectorProduct)
+{
+   DVectorR x(nColumns);
+   FOR(j, nColumns) x[j] = static_cast<Real>(RandomInt());
+
+   DVectorR expected(nRows, Zero);
+   FOR(i, nRows) FOR(j, nColumns) expected[i] += Dense(i, j) * x[j];
+
+   // Force the parallel kernel on the small test matrix.
+   const size_t threshold = ParallelThreshold();
+   SetParallelThreshold(0);
+   for(const auto format : {SparseFormat::COO, SparseFormat::CSR, SparseFormat::CSC})
+   {
+      Matrix.Convert(format);
+      const DVectorR y = Matrix * x;
+      FOR(i, nRows) EXPECT_DOUBLE_EQ(y[i], expected[i]);
+   }
+   SetParallelThreshold(threshold);
+}
+
+TEST_F(SparseMatrixTest, MatrixMatrixProduct)
+{
+   constexpr size_t n = 3;
+   DynamicMultiArray<Real> x(nColumns, n);
+   DynamicMultiArray<Real, RowMajor> y(nRows, n);
+   FOR(j, nColumns) FOR(k, n) x(j, k) = static_cast<Real>(RandomInt());
+
+   for(const auto format : {SparseFormat::CSR, SparseFormat::CSC})
+   {
+      Matrix.Convert(format);
+      Matrix.Multiply(std::as_const(x).View<2>(), y.View<2>());
+      FOR(i, nRows) FOR(k, n)
+      {
+         Real expected{};
+         FOR(j, nColumns) expected += Dense(i, j) * x(j, k);
+         EXPECT_DOUBLE_EQ(y(i, k), expected);
+      }
+   }
+}
+
+TEST_F(SparseMatrixTest, PoissonMatrix)
+{
+   // Interior rows of the Laplacian annihilate linear functions.
+   constexpr size_t n = 6;
+   const auto poisson = PoissonMatrix(n, 3);
+   EXPECT_EQ(poisson.nRows(), n * n * n);
+   EXPECT_EQ(poisson.nNonZeros(), n * n * n * 7 - 6 * n * n);
+
+   DVectorR x(poisson.nColumns());
+   FOR(k, n) FOR(j, n) FOR(i, n) x[i + n * (j + n * k)] = static_cast<Real>(i + 2 * j + 3 * k);
+   const DVectorR y = poisson * x;
+   FOR(k, 1, n - 1) FOR(j, 1, n - 1) FOR(i, 1, n - 1) EXPECT_DOUBLE_EQ(y[i + n * (j + n * k)], Zero);
+   EXPECT_DOUBLE_EQ(poisson(0, 0), Six);
+   EXPECT_DOUBLE_EQ(poisson(0, 1), -One);
+   EXPECT_DOUBLE_EQ(poisson(0, 2), Zero);
+}
+
+}
+
+#endif
@@ -398,6 +398,92 @@ TEST_F(VectorTest, VectorDivideEqual)
     EXPECT_EQ(RealStaticVectorTest[i], One);
     EXPECT_EQ(RealDynamicVectorTest[i], One);
   }
+
+  // A zero divisor in the last entry is also caught on the vectorised paths.
+  RealDynamicVector[ContainerSize - 1] = Zero;
+  EXPECT_DEATH(RealDynamicVectorTest /= RealDynamicVector, "");
+  EXPECT_DEATH(RealDynamicVectorTest = RealDynamicVectorTest / RealDynamicVector, "");
+}
+
+TEST_F(VectorTest, CompoundExpression)
+{
+  Real random_float = RandomReal();
+
+  // Test assignment
+  RealStaticVectorTest = RealStaticVector + RealStaticVector * random_float - Two * RealStaticVector / random_float;
+  RealDynamicVectorTest = RealDynamicVector + RealDynamicVector * random_float - Two * RealDynamicVector / random_float;
+
+  FOR(i, ContainerSize)
+  {
+    EXPECT_DOUBLE_EQ(RealStaticVectorTest[i], RealStaticVector[i] + RealStaticVector[i] * random_float - Two * RealStaticVector[i] / random_float);
+    EXPECT_DOUBLE_EQ(RealDynamicVectorTest[i], RealDynamicVector[i] + RealDynamicVector[i] * random_float - Two * RealDynamicVector[i] / random_float);
+  }
+
+  // Test construction
+  const StaticVector<Real, ContainerSize> static_vector = -(RealStaticVector - RealStaticVectorTest) * Half;
+  const DynamicVector<Real> dynamic_vector = -(RealDynamicVector - RealDynamicVectorTest) * Half;
+
+  FOR(i, ContainerSize)
+  {
+    EXPECT_DOUBLE_EQ(static_vector[i], -(RealStaticVector[i] - RealStaticVectorTest[i]) * Half);
+    EXPECT_DOUBLE_EQ(dynamic_vector[i], -(RealDynamicVector[i] - RealDynamicVectorTest[i]) * Half);
+  }
+
+  // Test compound assignment
+  IntStaticVectorTest = IntStaticVector;
+  IntDynamicVectorTest = IntDynamicVector;
+  IntStaticVectorTest += IntStaticVector * 2 - IntStaticVector;
+  IntDynamicVectorTest += IntDynamicVector * 2 - IntDynamicVector;
+
+  FOR(i, ContainerSize)
+  {
+    EXPECT_EQ(IntStaticVectorTest[i], 2 * IntStaticVector[i]);
+    EXPECT_EQ(IntDynamicVectorTest[i], 2 * IntDynamicVector[i]);
+  }
+
+  // Compound assignment from an expression of a different size fails.
+  const DynamicVector<Real> shorter_vector(ContainerSize - 1, One);
+  EXPECT_DEATH(RealDynamicVectorTest += shorter_vector * Two, "");
+  EXPECT_DEATH(RealDynamicVectorTest -= shorter_vector * Two, "");
+  EXPECT_DEATH(RealDynamicVectorTest *= shorter_vector * Two, "");
+  EXPECT_DEATH(RealDynamicVectorTest /= shorter_vector * Two, "");
+
+  // Test comparison and aliasing
+  EXPECT_TRUE(IntStaticVectorTest == IntStaticVector + IntStaticVector);
+  EXPECT_TRUE(IntDynamicVector * 2 == IntDynamicVectorTest);
+
+  IntStaticVectorTest = IntStaticVectorTest - IntStaticVector;
+  IntDynamicVectorTest = IntDynamicVectorTest - IntDynamicVector;
+  EXPECT_TRUE(IntStaticVectorTest == IntStaticVector);
+  EXPECT_TRUE(IntDynamicVectorTest == IntDynamicVector);
+}
+
+TEST_F(VectorTest, ParallelExpression)
+{
+  // Force parallel evaluation of the small test vectors.
+  const size_t threshold = ParallelThreshold();
+  const size_t n_threads = nThreads();
+  SetParallelThreshold(0);
+  SetThreads(4);
+
+  Real random_float = RandomReal();
+  RealStaticVectorTest.Assign<Par>(RealStaticVector + RealStaticVector * random_float);
+  RealDynamicVectorTest.Assign<Par>(RealDynamicVector - Two * RealDynamicVector / random_float);
+  IntDynamicVectorTest.Assign<Seq>(IntDynamicVector * 3);
+
+  FOR(i, ContainerSize)
+  {
+    EXPECT_DOUBLE_EQ(RealStaticVectorTest[i], RealStaticVector[i] + RealStaticVector[i] * random_float);
+    EXPECT_DOUBLE_EQ(RealDynamicVectorTest[i], RealDynamicVector[i] - Two * RealDynamicVector[i] / random_float);
+    EXPECT_EQ(IntDynamicVectorTest[i], 3 * IntDynamicVector[i]);
+  }
+
+  // Test aliasing
+  IntDynamicVectorTest.Assign<Par>(IntDynamicVectorTest - IntDynamicVector);
+  EXPECT_TRUE(IntDynamicVectorTest == IntDynamicVector * 2);
+
+  SetParallelThreshold(threshold);
+  SetThreads(n_threads);
 }
 
 /***************************************************************************************************************************************************************
@@ -459,8 +545,13 @@ TEST_F(VectorTest, CrossProduct)
 
 TEST_F(VectorTest, L1Norm)
 {
-  EXPECT_DOUBLE_EQ(L1Norm(RealStaticVector), std::accumulate(RealStaticVector.begin(), RealStaticVector.end(), Zero));
-  EXPECT_EQ(L1Norm(IntStaticVector), std::accumulate(IntStaticVector.begin(), IntStaticVector.end(), 0));
+  const auto abs_sum = [](const auto sum, const auto entry){ return sum + Abs(entry); };
+  EXPECT_DOUBLE_EQ(L1Norm(RealStaticVector), std::accumulate(RealStaticVector.begin(), RealStaticVector.end(), Zero, abs_sum));
+  EXPECT_EQ(L1Norm(IntStaticVector), std::accumulate(IntStaticVector.begin(), IntStaticVector.end(), 0, abs_sum));
+
+  // Dynamic vectors use the SIMD kernels, whose summation order differs.
+  const Real dynamic_norm = std::accumulate(RealDynamicVector.begin(), RealDynamicVector.end(), Zero, abs_sum);
+  EXPECT_NEAR(L1Norm(RealDynamicVector), dynamic_norm, TenSmall * dynamic_norm);
 }
 
 TEST_F(VectorTest, L2Norm)
@@ -476,8 +567,15 @@ TEST_F(VectorTest, L2Norm)
 
 TEST_F(VectorTest, LInfNorm)
 {
-  EXPECT_EQ(LInfNorm(RealStaticVector), *std::max_element(RealStaticVector.begin(), RealStaticVector.end()));
-  EXPECT_EQ(LInfNorm(IntStaticVector), *std::max_element(IntStaticVector.begin(), IntStaticVector.end()));
+  const auto abs_less = [](const auto a, const auto b){ return Abs(a) < Abs(b); };
+  EXPECT_EQ(LInfNorm(RealStaticVector), Abs(*std::max_element(RealStaticVector.begin(), RealStaticVector.end(), abs_less)));
+  EXPECT_EQ(LInfNorm(IntStaticVector), Abs(*std::max_element(IntStaticVector.begin(), IntStaticVector.end(), abs_less)));
+  EXPECT_EQ(LInfNorm(RealDynamicVector), Abs(*std::max_element(RealDynamicVector.begin(), RealDynamicVector.end(), abs_less)));
+
+  // The largest magnitude entry is negative.
+  EXPECT_EQ(LInfNorm(SVectorR2{-Five, One}), Five);
+  EXPECT_EQ(LInfNorm(DVectorR{-Five, One}), Five);
+  EXPECT_EQ(LInfNorm(SVector<int, 2>{-5, 1}), 5);
 }
 
 TEST_F(VectorTest, isNormalised)
@@ -552,6 +650,114 @@ TEST_F(VectorTest, isAligned)
   EXPECT_THROW(isAligned(xAxis3, SVectorR3{One, Zero, Zero}, DegToRad(90.00001)), std::domain_error);
 }
 
+
+TEST_F(VectorTest, RotateAbout)
+{
+  const SVectorR2 rotated2 = RotateAbout(xAxis2, HalfPi);
+  EXPECT_NEAR(rotated2[0], Zero, Small);
+  EXPECT_NEAR(rotated2[1], One, Small);
+  EXPECT_NEAR(RotateAbout(xAxis2, HalfPi, -zAxis3)[1], -One, Small);
+
+  const SVectorR3 rotated3 = RotateAbout(xAxis3, HalfPi, Two * zAxis3);
+  FOR(i, 3) EXPECT_NEAR(rotated3[i], yAxis3[i], Small);
+
+  SVectorR3 random0, random1;
+  random0.Randomise();
+  random1.Randomise();
+  const auto rotated = RotateAbout(random0, ThirdPi, random1);
+  EXPECT_NEAR(Magnitude(rotated), Magnitude(random0), Small);
+  EXPECT_NEAR(InnerProduct(rotated, random1), InnerProduct(random0, random1), Small);
+  const auto unrotated = RotateAbout(rotated, -ThirdPi, random1);
+  FOR(i, 3) EXPECT_NEAR(unrotated[i], random0[i], Small);
+}
+
+TEST_F(VectorTest, RotateTowards)
+{
+  const SVectorR2 rotated2 = RotateTowards(xAxis2, QuarterPi, SVectorR2{Zero, -One});
+  EXPECT_NEAR(ComputeAngle<true>(xAxis2, rotated2), -QuarterPi, Small);
+
+  SVectorR3 random0, random1;
+  random0.Randomise();
+  random1.Randomise();
+  const Real angle = ComputeAngle(random0, random1);
+  const auto rotated = RotateTowards(random0, Half * angle, random1);
+  EXPECT_NEAR(ComputeAngle(rotated, random1), Half * angle, Small);
+  EXPECT_NEAR(ComputeAngle(rotated, random0), Half * angle, Small);
+  EXPECT_NEAR(Magnitude(rotated), Magnitude(random0), Small);
+}
+
+
+TEST_F(VectorTest, BatchedGeometry)
+{
+  // The batch straddles the chunk boundaries and the SIMD tails, and holds zero, tiny, parallel and anti-parallel vectors.
+  constexpr size_t n = 2 * detail::BatchChunkSize + 7;
+  SoAVectorsR3 vectors0(n), vectors1(n);
+  FOR(i, n)
+  {
+    const SVectorR3 v0{RandomReal(), RandomReal(), RandomReal()};
+    const SVectorR3 v1 = i % 11 == 1 ? -Two * v0 : i % 11 == 2 ? Half * v0 : SVectorR3{RandomReal(), RandomReal(), RandomReal()};
+    vectors0[i] = std::make_tuple(v0[0], v0[1], v0[2]);
+    vectors1[i] = std::make_tuple(v1[0], v1[1], v1[2]);
+  }
+  for(size_t i = 0; i < n; i += 101) vectors0[i] = std::make_tuple(Zero, Zero, Zero);
+  for(size_t i = 50; i < n; i += 101) vectors1[i] = std::make_tuple(Small, Zero, -Small);
+  const auto vector0 = [&](const size_t i){ const auto [x, y, z] = vectors0[i]; return SVectorR3{x, y, z}; };
+  const auto vector1 = [&](const size_t i){ const auto [x, y, z] = vectors1[i]; return SVectorR3{x, y, z}; };
+
+  const size_t threshold = ParallelThreshold();
+  const size_t n_threads = nThreads();
+  SetParallelThreshold(0);
+  SetThreads(4);
+  for(int level = 0; level <= static_cast<int>(simd::DetectSimdLevel()); ++level)
+  {
+    simd::SetSimdLevel(static_cast<simd::SimdLevel>(level));
+    SoAVectorsR3 cross_products, normalised;
+    DArrayB degenerate0, degenerate1, degenerate2, aligned;
+    DArrayF angles;
+    CrossProduct(vectors0, vectors1, cross_products);
+    const size_t n_degenerate0 = Normalise(vectors0, normalised, degenerate0);
+    const size_t n_degenerate1 = ComputeAngle(vectors0, vectors1, angles, degenerate1);
+    const size_t n_degenerate2 = isAligned(vectors0, vectors1, aligned, degenerate2);
+
+    size_t n_zero{}, n_either_zero{};
+    FOR(i, n)
+    {
+      const auto v0 = vector0(i);
+      const auto v1 = vector1(i);
+      const bool isZero0 = isEqual(Magnitude(v0), Zero);
+      const bool isZero1 = isEqual(Magnitude(v1), Zero);
+      n_zero += isZero0;
+      n_either_zero += isZero0 || isZero1;
+
+      const auto [cx, cy, cz] = cross_products[i];
+      const auto expected_cross = CrossProduct(v0, v1);
+      EXPECT_NEAR(cx, expected_cross[0], Small);
+      EXPECT_NEAR(cy, expected_cross[1], Small);
+      EXPECT_NEAR(cz, expected_cross[2], Small);
+
+      const auto [nx, ny, nz] = normalised[i];
+      EXPECT_EQ(static_cast<bool>(degenerate0[i]), isZero0);
+      if(isZero0) EXPECT_TRUE(nx == Zero && ny == Zero && nz == Zero);
+      else FOR(j, 3) EXPECT_NEAR((SVectorR3{nx, ny, nz})[j], Normalise(v0)[j], Small);
+
+      EXPECT_EQ(static_cast<bool>(degenerate1[i]), isZero0 || isZero1);
+      EXPECT_EQ(static_cast<bool>(degenerate2[i]), isZero0 || isZero1);
+      if(isZero0 || isZero1) EXPECT_EQ(angles[i], Zero);
+      else
+      {
+        EXPECT_NEAR(angles[i], ComputeAngle(v0, v1), 1.0e-6);
+        EXPECT_EQ(static_cast<bool>(aligned[i]), isAligned(v0, v1));
+      }
+    }
+    EXPECT_EQ(n_degenerate0, n_zero);
+    EXPECT_EQ(n_degenerate1, n_either_zero);
+    EXPECT_EQ(n_degenerate2, n_either_zero);
+  }
+  simd::SetSimdLevel(simd::DetectSimdLevel());
+  SetThreads(n_threads);
+  SetParallelThreshold(threshold);
+}
+
 }
 
 #endif
\ No newline at end of file
@@ -21,19 +21,21 @@ namespace aprn::mnfld {
 /***************************************************************************************************************************************************************
 * Curve Class Definition
 ***************************************************************************************************************************************************************/
-template<size_t ambient_dim = 3>
+
+/** Parametric curves in an ambient space of a given dimension, with coordinates and parameters of scalar type T, e.g. float for geometry sent to the GPU. */
+template<size_t ambient_dim = 3, typename T = Real>
 class Curve
 {
-   using Vector = SVectorR<ambient_dim>;
+   using Vector = SVector<T, ambient_dim>;
 
  public:
-   virtual constexpr Vector Point(const Real param) const = 0;
+   virtual constexpr Vector Point(const T param) const = 0;
 
-   virtual constexpr Vector Tangent(const Real param) const = 0;
+   virtual constexpr Vector Tangent(const T param) const = 0;
 
-   virtual constexpr Vector Normal(const Real param) const = 0;
+   virtual constexpr Vector Normal(const T param) const = 0;
 
-   virtual constexpr Real Length() const = 0;
+   virtual constexpr T Length() const = 0;
 
    constexpr Vector Binormal(const Vector& tangent, const Vector& normal) const;
 
@@ -49,83 +51,83 @@ class Curve
 
 /** Line
 ***************************************************************************************************************************************************************/
-template<size_t ambient_dim = 2>
-class Line : public Curve<ambient_dim>
+template<size_t ambient_dim = 2, typename T = Real>
+class Line : public Curve<ambient_dim, T>
 {
-   using Vector = SVectorR<ambient_dim>;
+   using Vector = SVector<T, ambient_dim>;
 
  public:
    constexpr Line(const Vector& direction, const Vector& point = Vector{});
 
-   constexpr Vector Point(const Real t) const override;
+   constexpr Vector Point(const T t) const override;
 
-   constexpr Vector Tangent(const Real t) const override;
+   constexpr Vector Tangent(const T t) const override;
 
-   constexpr Vector Normal(const Real t) const override;
+   constexpr Vector Normal(const T t) const override;
 
-   constexpr Real Length() const override { return InfFloat<>; }
+   constexpr T Length() const override { return InfFloat<T>; }
 
  protected:
    Vector Direction;
    Vector Start;
-   Real   DirectionNorm_;
-   Real   Normaliser_;
+   T      DirectionNorm_;
+   T      Normaliser_;
 };
 
 /** Ray
 ***************************************************************************************************************************************************************/
-template<size_t ambient_dim = 2>
-class Ray final : public Line<ambient_dim>
+template<size_t ambient_dim = 2, typename T = Real>
+class Ray final : public Line<ambient_dim, T>
 {
-   using Vector = SVectorR<ambient_dim>;
+   using Vector = SVector<T, ambient_dim>;
 
  public:
    constexpr Ray(const Vector& direction, const Vector& start = Vector{});
 
-   constexpr Vector Point(const Real t) const override;
+   constexpr Vector Point(const T t) const override;
 
-   constexpr Real Length() const override { return InfFloat<>; }
+   constexpr T Length() const override { return InfFloat<T>; }
 };
 
 /** Line Segment
 ***************************************************************************************************************************************************************/
-template<size_t ambient_dim = 2>
-class LineSegment final : public Line<ambient_dim>
+template<size_t ambient_dim = 2, typename T = Real>
+class LineSegment final : public Line<ambient_dim, T>
 {
-   using Vector = SVectorR<ambient_dim>;
+   using Vector = SVector<T, ambient_dim>;
 
  public:
    constexpr LineSegment(const Vector& start, const Vector& end);
 
-   constexpr Vector Point(const Real t) const override;
+   constexpr Vector Point(const T t) const override;
 
-   constexpr Real Length() const override { return this->DirectionNorm_; }
+   constexpr T Length() const override { return this->DirectionNorm_; }
 };
 
 /** Line Segment Chain
 ***************************************************************************************************************************************************************/
-template<size_t ambient_dim = 2>
-class LineSegmentChain final : public Curve<ambient_dim>
+template<size_t ambient_dim = 2, typename T = Real>
+class LineSegmentChain final : public Curve<ambient_dim, T>
 {
-   using Vector  = SVectorR<ambient_dim>;
-   using Segment = LineSegment<ambient_dim>;
+   using Vector  = SVector<T, ambient_dim>;
+   using Segment = LineSegment<ambient_dim, T>;
 
  public:
    template<class D>
    LineSegmentChain(const Array<Vector, D>& vertices, bool is_closed = false);
 
-   constexpr Vector Point(const Real l) const override;
+   constexpr Vector Point(const T l) const override;
 
-   constexpr Vector Tangent(const Real t) const override;
+   constexpr Vector Tangent(const T t) const override;
 
-   constexpr Vector Normal(const Real t) const override;
+   constexpr Vector Normal(const T t) const override;
 
-   constexpr Real Length() const override { return ChainLength_; }
+   constexpr T Length() const override { return ChainLength_; }
 
  private:
    DArray<Segment> Segments_;
-   DArray<Real>    CumulativeLengths_;
-   Real            ChainLength_;
+   DArray<T>       CumulativeLengths_;
+   T               ChainLength_;
    bool            Closed_;
 };
 
@@ -135,81 +137,81 @@ class LineSegmentChain final : public Curve<ambient_dim>
 
 /** Circle
 ***************************************************************************************************************************************************************/
-template<size_t ambient_dim = 2>
-class Circle : public Curve<ambient_dim>
+template<size_t ambient_dim = 2, typename T = Real>
+class Circle : public Curve<ambient_dim, T>
 {
-   using Vector = SVectorR<ambient_dim>;
+   using Vector = SVector<T, ambient_dim>;
 
  public:
-   Circle(const Real radius, const Vector& centre = Vector{});
+   Circle(const T radius, const Vector& centre = Vector{});
 
-   Circle(const Real radius, const Real start_angle, const Vector& centre = Vector{});
+   Circle(const T radius, const T start_angle, const Vector& centre = Vector{});
 
-   constexpr Vector Point(const Real t) const override;
+   constexpr Vector Point(const T t) const override;
 
-   constexpr Vector Tangent(const Real t) const override;
+   constexpr Vector Tangent(const T t) const override;
 
-   constexpr Vector Normal(const Real t) const override;
+   constexpr Vector Normal(const T t) const override;
 
-   constexpr Real Length() const override { return Length_; }
+   constexpr T Length() const override { return Length_; }
 
  protected:
-   constexpr Real Angle(const Real t) const;
+   constexpr T Angle(const T t) const;
 
    Vector Centre_;
-   Real   Radius_;
-   Real   StartAngle_{Zero};
-   Real   Normaliser_;
-   Real   Length_;
+   T      Radius_;
+   T      StartAngle_{};
+   T      Normaliser_;
+   T      Length_;
 };
 
 /** Circular Arc
 ***************************************************************************************************************************************************************/
-template<size_t ambient_dim = 2>
-class Arc final : public Circle<ambient_dim>
+template<size_t ambient_dim = 2, typename T = Real>
+class Arc final : public Circle<ambient_dim, T>
 {
-   using Vector = SVectorR<ambient_dim>;
+   using Vector = SVector<T, ambient_dim>;
 
  public:
-   Arc(const Real radius, const Real angle, const Vector& centre = Vector{});
+   Arc(const T radius, const T angle, const Vector& centre = Vector{});
 
-   Arc(const Real radius, const Real start_angle, const Real end_angle, const Vector& centre = Vector{});
+   Arc(const T radius, const T start_angle, const T end_angle, const Vector& centre = Vector{});
 
-   constexpr Vector Point(const Real t) const override;
+   constexpr Vector Point(const T t) const override;
 
-   constexpr Vector Tangent(const Real t) const override;
+   constexpr Vector Tangent(const T t) const override;
 
-   constexpr Vector Normal(const Real t) const override;
+   constexpr Vector Normal(const T t) const override;
 
-   constexpr void CheckAngle(const Real t) const;
+   constexpr void CheckAngle(const T t) const;
 
  private:
-   Real EndAngle_;
+   T EndAngle_;
 };
 
 /** Ellipse
 ***************************************************************************************************************************************************************/
-template<size_t ambient_dim = 2>
-class Ellipse final : public Curve<ambient_dim>
+template<size_t ambient_dim = 2, typename T = Real>
+class Ellipse final : public Curve<ambient_dim, T>
 {
-   using Vector = SVectorR<ambient_dim>;
+   using Vector = SVector<T, ambient_dim>;
 
  public:
-   Ellipse(const Real radius_x, const Real radius_y, const Vector& centre = Vector{});
+   Ellipse(const T radius_x, const T radius_y, const Vector& centre = Vector{});
 
-   constexpr Vector Point(const Real t) const override;
+   constexpr Vector Point(const T t) const override;
 
-   constexpr Vector Tangent(const Real t) const override;
+   constexpr Vector Tangent(const T t) const override;
 
-   constexpr Vector Normal(const Real t) const override;
+   constexpr Vector Normal(const T t) const override;
 
-   constexpr Real Length() const override { return Length_; }
+   constexpr T Length() const override { return Length_; }
 
  private:
    Vector Centre_;
-   Real   RadiusX_;
-   Real   RadiusY_;
-   Real   Length_;
+   T      RadiusX_;
+   T      RadiusY_;
+   T      Length_;
 
 };
 
@@ -234,10 +236,10 @@ class Ellipse final : public Curve<ambient_dim>
 
 ///** Curve Chain
 //***************************************************************************************************************************************************************/
-//template<size_t ambient_dim = 2>
-//class CurveChain final : public Curve<ambient_dim>
+//template<size_t ambient_dim = 2, typename T = Real>
+//class CurveChain final : public Curve<ambient_dim, T>
 //{
-//   using Vector = SVectorR<ambient_dim>;
+//   using Vector = SVector<T, ambient_dim>;
 //
 // public:
 //   template<class D>
@@ -254,9 +256,9 @@ class Ellipse final : public Curve<ambient_dim>
 //
 //   constexpr Vector ComputeNormal(const Parameter& t) const override;
 //
-//   DArray<Curve<ambient_dim>> Curves;
-//   DArray<Real>               CumulativeLengths_;
-//   Real                       ChainLength_;
+//   DArray<Curve<ambient_dim, T>> Curves;
+//   DArray<T>                  CumulativeLengths_;
+//   T                          ChainLength_;
 //   bool                       Closed_;
 //   bool                       UnitSpeed_{false};
 //};
@@ -21,9 +21,9 @@ namespace aprn::mnfld {
 * Curve Class Implementation
 ***************************************************************************************************************************************************************/
 
-template<size_t D>
-constexpr SVectorR<D>
-Curve<D>::Binormal(const Vector& tangent, const Vector& normal) const { return CrossProduct(tangent, normal); }
+template<size_t D, typename T>
+constexpr SVector<T, D>
+Curve<D, T>::Binormal(const Vector& tangent, const Vector& normal) const { return CrossProduct(tangent, normal); }
 
 /***************************************************************************************************************************************************************
 * Linear/Piecewise Linear Curves
@@ -31,21 +31,21 @@ Curve<D>::Binormal(const Vector& tangent, const Vector& normal) const { return C
 
 /** Line
 ***************************************************************************************************************************************************************/
-template<size_t D>
-constexpr Line<D>::Line(const Vector& direction, const Vector& point)
-   : Direction(direction), Start(point), DirectionNorm_(Magnitude(Direction)), Normaliser_(One / DirectionNorm_) {}
+template<size_t D, typename T>
+constexpr Line<D, T>::Line(const Vector& direction, const Vector& point)
+   : Direction(direction), Start(point), DirectionNorm_(Magnitude(Direction)), Normaliser_(static_cast<T>(One) / DirectionNorm_) {}
 
-template<size_t D>
-constexpr SVectorR<D>
-Line<D>::Point(const Real t) const { return Start + t * (this->UnitSpeed_ ? Normaliser_ : One) * Direction; }
+template<size_t D, typename T>
+constexpr SVector<T, D>
+Line<D, T>::Point(const T t) const { return Start + t * (this->UnitSpeed_ ? Normaliser_ : static_cast<T>(One)) * Direction; }
 
-template<size_t D>
-constexpr SVectorR<D>
-Line<D>::Tangent([[maybe_unused]] const Real t) const { return (this->UnitSpeed_ ? Normaliser_ : One) * Direction; }
+template<size_t D, typename T>
+constexpr SVector<T, D>
+Line<D, T>::Tangent([[maybe_unused]] const T t) const { return (this->UnitSpeed_ ? Normaliser_ : static_cast<T>(One)) * Direction; }
 
-template<size_t D>
-constexpr SVectorR<D>
-Line<D>::Normal(const Real t) const
+template<size_t D, typename T>
+constexpr SVector<T, D>
+Line<D, T>::Normal(const T t) const
 {
    EXIT("TODO")
    return Direction;
@@ -53,44 +53,44 @@ Line<D>::Normal(const Real t) const
 
 /** Ray
 ***************************************************************************************************************************************************************/
-template<size_t D>
-constexpr Ray<D>::Ray(const Vector& direction, const Vector& start)
-   : Line<D>::Line(direction, start) {}
+template<size_t D, typename T>
+constexpr Ray<D, T>::Ray(const Vector& direction, const Vector& start)
+   : Line<D, T>::Line(direction, start) {}
 
-template<size_t D>
-constexpr SVectorR<D>
-Ray<D>::Point(const Real t) const
+template<size_t D, typename T>
+constexpr SVector<T, D>
+Ray<D, T>::Point(const T t) const
 {
-   return Positive(t) ? Line<D>::Point(t) : throw std::domain_error("The parameter must be positive for rays.");
+   return Positive(t) ? Line<D, T>::Point(t) : throw std::domain_error("The parameter must be positive for rays.");
 }
 
 /** Segment
 ***************************************************************************************************************************************************************/
-template<size_t D>
-constexpr LineSegment<D>::LineSegment(const Vector& start, const Vector& end)
-   : Line<D>::Line(end - start, start) {}
+template<size_t D, typename T>
+constexpr LineSegment<D, T>::LineSegment(const Vector& start, const Vector& end)
+   : Line<D, T>::Line(end - start, start) {}
 
-template<size_t D>
-constexpr SVectorR<D>
-LineSegment<D>::Point(const Real t) const
+template<size_t D, typename T>
+constexpr SVector<T, D>
+LineSegment<D, T>::Point(const T t) const
 {
-   const Real max_bound = this->UnitSpeed_ ? Length() : One;
-   return isBounded<true, true>(t, Zero, max_bound) ? Line<D>::Point(t) :
+   const T max_bound = this->UnitSpeed_ ? Length() : static_cast<T>(One);
+   return isBounded<true, true>(t, T{}, max_bound) ? Line<D, T>::Point(t) :
           throw std::domain_error("The parameter must be in the range [0, " + ToString(max_bound) + "] for this segment.");
 }
 
 /** SegmentChain
 ***************************************************************************************************************************************************************/
-template<size_t Dim>
+template<size_t Dim, typename T>
 template<class D>
-LineSegmentChain<Dim>::LineSegmentChain(const Array<Vector, D>& vertex_list, const bool is_closed)
+LineSegmentChain<Dim, T>::LineSegmentChain(const Array<Vector, D>& vertex_list, const bool is_closed)
    : Closed_(is_closed)
 {
    const auto& vertices = vertex_list.Derived();
 
    Segments_.reserve(vertices.size());
    CumulativeLengths_.reserve(vertices.size());
-   ChainLength_ = Zero;
+   ChainLength_ = T{};
 
    FOR(i, vertices.size() - static_cast<size_t>(!Closed_))
    {
@@ -102,31 +102,31 @@ LineSegmentChain<Dim>::LineSegmentChain(const Array<Vector, D>& vertex_list, con
    }
 }
 
-template<size_t D>
-constexpr SVectorR<D>
-LineSegmentChain<D>::Point(const Real t) const
+template<size_t D, typename T>
+constexpr SVector<T, D>
+LineSegmentChain<D, T>::Point(const T t) const
 {
-   const Real upper_bound  = this->UnitSpeed_ ? ChainLength_ : One;
-   const Real param_length = isBounded<true, true, true>(t, Zero, upper_bound) ? t * (this->UnitSpeed_ ? One : ChainLength_) :
+   const T upper_bound  = this->UnitSpeed_ ? ChainLength_ : static_cast<T>(One);
+   const T param_length = isBounded<true, true, true>(t, T{}, upper_bound) ? t * (this->UnitSpeed_ ? static_cast<T>(One) : ChainLength_) :
                              throw std::domain_error("The parameter must be in the range [0, " + ToString(upper_bound) + "] for this segment.");
    const auto iter  = std::find_if(CumulativeLengths_.begin(), CumulativeLengths_.end(), [param_length](auto l){ return param_length <= l; });
    const auto index = std::distance(CumulativeLengths_.begin(), iter);
-   const Real param = param_length - (index != 0 ? CumulativeLengths_[index - 1] : Zero);
+   const T param = param_length - (index != 0 ? CumulativeLengths_[index - 1] : T{});
 
-   return isBounded<true, true>(param, Zero, Segments_[index].Length()) ? Segments_[index].Point(param) :
+   return isBounded<true, true>(param, T{}, Segments_[index].Length()) ? Segments_[index].Point(param) :
           throw std::domain_error("The parameter for segment " + ToString(index) + " in the chain is out of bounds.");
 }
 
-template<size_t D>
-constexpr SVectorR<D>
-LineSegmentChain<D>::Tangent(const Real t) const
+template<size_t D, typename T>
+constexpr SVector<T, D>
+LineSegmentChain<D, T>::Tangent(const T t) const
 {
    EXIT("TODO")
 }
 
-template<size_t D>
-constexpr SVectorR<D>
-LineSegmentChain<D>::Normal(const Real t) const
+template<size_t D, typename T>
+constexpr SVector<T, D>
+LineSegmentChain<D, T>::Normal(const T t) const
 {
    EXIT("TODO")
 }
@@ -137,87 +137,87 @@ LineSegmentChain<D>::Normal(const Real t) const
 
 /** Circle
 ***************************************************************************************************************************************************************/
-template<size_t D>
-Circle<D>::Circle(const Real radius, const Vector& centre)
-   : Circle(radius, Zero, centre) {}
+template<size_t D, typename T>
+Circle<D, T>::Circle(const T radius, const Vector& centre)
+   : Circle(radius, T{}, centre) {}
 
-template<size_t D>
-Circle<D>::Circle(const Real radius, const Real start_angle, const Vector& centre)
-   : Centre_(centre), Radius_(radius), StartAngle_(start_angle), Normaliser_(One / Radius_) { ASSERT(Positive(radius), "A circle's radius cannot be negative.") }
+template<size_t D, typename T>
+Circle<D, T>::Circle(const T radius, const T start_angle, const Vector& centre)
+   : Centre_(centre), Radius_(radius), StartAngle_(start_angle), Normaliser_(static_cast<T>(One) / Radius_) { ASSERT(Positive(radius), "A circle's radius cannot be negative.") }
 
-template<size_t D>
-constexpr SVectorR<D>
-Circle<D>::Point(const Real t) const
+template<size_t D, typename T>
+constexpr SVector<T, D>
+Circle<D, T>::Point(const T t) const
 {
-   const Real max_bound = this->UnitSpeed_ ? TwoPi * Radius_ : One;
-   ASSERT((isBounded<true, true>(t, Zero, max_bound)), "The parameter exceeds the expected bounds.")
+   const T max_bound = this->UnitSpeed_ ? static_cast<T>(TwoPi) * Radius_ : static_cast<T>(One);
+   ASSERT((isBounded<true, true>(t, T{}, max_bound)), "The parameter exceeds the expected bounds.")
 
    const auto theta = Angle(t);
-   return ToVector<D>(SVectorR3{Radius_ * std::cos(theta), Radius_ * std::sin(theta), Zero}) + Centre_;
+   return ToVector<D>(SVector3<T>{Radius_ * std::cos(theta), Radius_ * std::sin(theta), T{}}) + Centre_;
 }
 
-template<size_t D>
-constexpr SVectorR<D>
-Circle<D>::Tangent(const Real t) const
+template<size_t D, typename T>
+constexpr SVector<T, D>
+Circle<D, T>::Tangent(const T t) const
 {
    const auto theta = Angle(t);
-   return ToVector<D>(SVectorR3{-Radius_ * std::sin(theta), Radius_ * std::cos(theta), Zero});
+   return ToVector<D>(SVector3<T>{-Radius_ * std::sin(theta), Radius_ * std::cos(theta), T{}});
 }
 
-template<size_t D>
-constexpr SVectorR<D>
-Circle<D>::Normal(const Real t) const
+template<size_t D, typename T>
+constexpr SVector<T, D>
+Circle<D, T>::Normal(const T t) const
 {
    const auto theta = Angle(t);
-   return ToVector<D>(SVectorR3{-Radius_ * std::cos(theta), -Radius_ * std::sin(theta), Zero});
+   return ToVector<D>(SVector3<T>{-Radius_ * std::cos(theta), -Radius_ * std::sin(theta), T{}});
 }
 
-template<size_t D>
-constexpr Real
-Circle<D>::Angle(const Real t) const { return StartAngle_ + t * (this->UnitSpeed_ ? Normaliser_ : TwoPi); }
+template<size_t D, typename T>
+constexpr T
+Circle<D, T>::Angle(const T t) const { return StartAngle_ + t * (this->UnitSpeed_ ? Normaliser_ : static_cast<T>(TwoPi)); }
 
 /** Circular Arc
 ***************************************************************************************************************************************************************/
-template<size_t D>
-Arc<D>::Arc(const Real radius, const Real angle, const Vector& centre)
-   : Arc(radius, Zero, angle, centre) {}
+template<size_t D, typename T>
+Arc<D, T>::Arc(const T radius, const T angle, const Vector& centre)
+   : Arc(radius, T{}, angle, centre) {}
 
-template<size_t D>
-Arc<D>::Arc(const Real radius, const Real start_angle, const Real end_angle, const Vector& centre)
-   : Circle<D>(radius, start_angle, centre), EndAngle_(end_angle)
+template<size_t D, typename T>
+Arc<D, T>::Arc(const T radius, const T start_angle, const T end_angle, const Vector& centre)
+   : Circle<D, T>(radius, start_angle, centre), EndAngle_(end_angle)
 {
    ASSERT(Positive(radius), "An arc's radius cannot be negative.")
-   ASSERT((isBounded<true, true>(start_angle, Zero, TwoPi)), "An arc's start angle must be in the range [0, 2*PI].")
-   ASSERT((isBounded<true, true>(end_angle, Zero, TwoPi)), "An arc's end angle must be in the range [0, 2*PI].")
+   ASSERT((isBounded<true, true>(start_angle, T{}, static_cast<T>(TwoPi))), "An arc's start angle must be in the range [0, 2*PI].")
+   ASSERT((isBounded<true, true>(end_angle, T{}, static_cast<T>(TwoPi))), "An arc's end angle must be in the range [0, 2*PI].")
 }
 
-template<size_t D>
-constexpr SVectorR<D>
-Arc<D>::Point(const Real t) const
+template<size_t D, typename T>
+constexpr SVector<T, D>
+Arc<D, T>::Point(const T t) const
 {
    CheckAngle(t);
-   return Circle<D>::Point(t);
+   return Circle<D, T>::Point(t);
 }
 
-template<size_t D>
-constexpr SVectorR<D>
-Arc<D>::Tangent(const Real t) const
+template<size_t D, typename T>
+constexpr SVector<T, D>
+Arc<D, T>::Tangent(const T t) const
 {
    CheckAngle(t);
-   return Circle<D>::Tangent(t);
+   return Circle<D, T>::Tangent(t);
 }
 
-template<size_t D>
-constexpr SVectorR<D>
-Arc<D>::Normal(const Real t) const
+template<size_t D, typename T>
+constexpr SVector<T, D>
+Arc<D, T>::Normal(const T t) const
 {
    CheckAngle(t);
-   return Circle<D>::Normal(t);
+   return Circle<D, T>::Normal(t);
 }
 
-template<size_t D>
+template<size_t D, typename T>
 constexpr void
-Arc<D>::CheckAngle(const Real t) const
+Arc<D, T>::CheckAngle(const T t) const
 {
    const auto theta = this->Angle(t);
    const auto min_max = std::minmax(this->StartAngle_, EndAngle_);
@@ -227,27 +227,27 @@ Arc<D>::CheckAngle(const Real t) const
 
 /** Ellipse
 ***************************************************************************************************************************************************************/
-template<size_t D>
-Ellipse<D>::Ellipse(const Real radius_x, const Real radius_y, const Vector& centre)
+template<size_t D, typename T>
+Ellipse<D, T>::Ellipse(const T radius_x, const T radius_y, const Vector& centre)
    : Centre_(centre), RadiusX_(radius_x), RadiusY_(radius_y) { ASSERT(Positive(radius_x) && Positive(radius_y), "An ellipse's radii cannot be negative.") }
 
-template<size_t D>
-constexpr SVectorR<D>
-Ellipse<D>::Point(const Real t) const
+template<size_t D, typename T>
+constexpr SVector<T, D>
+Ellipse<D, T>::Point(const T t) const
 {
-   return ToVector<D>(SVectorR3{RadiusX_ * std::cos(t), RadiusY_ * std::sin(t), Zero}) + Centre_;
+   return ToVector<D>(SVector3<T>{RadiusX_ * std::cos(t), RadiusY_ * std::sin(t), T{}}) + Centre_;
 }
 
-template<size_t D>
-constexpr SVectorR<D>
-Ellipse<D>::Tangent(const Real t) const
+template<size_t D, typename T>
+constexpr SVector<T, D>
+Ellipse<D, T>::Tangent(const T t) const
 {
    EXIT("TODO")
 }
 
-template<size_t D>
-constexpr SVectorR<D>
-Ellipse<D>::Normal(const Real t) const
+template<size_t D, typename T>
+constexpr SVector<T, D>
+Ellipse<D, T>::Normal(const T t) const
 {
    EXIT("TODO")
 }
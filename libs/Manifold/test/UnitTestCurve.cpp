@@ -339,6 +339,72 @@ TEST_F(CurveTest, Ellipse)
   // Unit speed parametrised - requires root-finding and quadrature first.
 }
 
+/***************************************************************************************************************************************************************
+* Single-precision Curves
+***************************************************************************************************************************************************************/
+TEST_F(CurveTest, SinglePrecision)
+{
+  RandomReal.Reset(One, Ten);
+  const Real radius = RandomReal();
+  SVectorR3 direction, centre;
+  direction.Randomise();
+  centre.Randomise();
+
+  // Single-precision curves agree with their double-precision counterparts to float precision.
+  const Line<3> line(direction, centre);
+  const Line<3, float> line_float(VectorCast<float>(direction), VectorCast<float>(centre));
+  const Circle<2> circle(radius, ToVector<2>(centre));
+  const Circle<2, float> circle_float(static_cast<float>(radius), VectorCast<float>(ToVector<2>(centre)));
+  for(const Real t : {Zero, Eighth, Quarter, Half, One})
+  {
+    const auto p = line.Point(t);
+    const auto p_float = line_float.Point(static_cast<float>(t));
+    FOR(i, 3) EXPECT_NEAR(p_float[i], p[i], 1e-5 * (One + Abs(p[i])));
+
+    const auto q = circle.Point(t);
+    const auto q_float = circle_float.Point(static_cast<float>(t));
+    FOR(i, 2) EXPECT_NEAR(q_float[i], q[i], 1e-5 * (One + Abs(q[i])));
+  }
+  static_assert(isTypeSame<decltype(line_float.Point(0.0f)), SVector3<float>>());
+
+  // Arcs and ellipses, evaluated over parameters that stay inside the arc's angular range.
+  const Real start_angle = Half;
+  const Real end_angle   = Two;
+  const Arc<2> arc(radius, start_angle, end_angle, ToVector<2>(centre));
+  const Arc<2, float> arc_float(static_cast<float>(radius), static_cast<float>(start_angle), static_cast<float>(end_angle),
+                                VectorCast<float>(ToVector<2>(centre)));
+  const Ellipse<2> ellipse(radius, Two * radius, ToVector<2>(centre));
+  const Ellipse<2, float> ellipse_float(static_cast<float>(radius), static_cast<float>(Two * radius), VectorCast<float>(ToVector<2>(centre)));
+  for(const Real t : {Zero, 0.05, 0.1, 0.2})
+  {
+    const auto p = arc.Point(t);
+    const auto p_float = arc_float.Point(static_cast<float>(t));
+    FOR(i, 2) EXPECT_NEAR(p_float[i], p[i], 1e-5 * (One + Abs(p[i])));
+
+    const auto q = ellipse.Point(t * TwoPi);
+    const auto q_float = ellipse_float.Point(static_cast<float>(t * TwoPi));
+    FOR(i, 2) EXPECT_NEAR(q_float[i], q[i], 1e-5 * (One + Abs(q[i])));
+  }
+  static_assert(isTypeSame<decltype(arc_float.Point(0.0f)), SVector2<float>>());
+  static_assert(isTypeSame<decltype(ellipse_float.Point(0.0f)), SVector2<float>>());
+
+  // Line segment chains, with segment lengths that are exact in single precision.
+  const DynamicArray<SVectorR2> vertices{SVectorR2{Zero, Zero}, SVectorR2{One, Zero}, SVectorR2{One, Two}, SVectorR2{Three, Two}};
+  DynamicArray<SVector2<float>> vertices_float(vertices.size());
+  FOR(i, vertices.size()) vertices_float[i] = VectorCast<float>(vertices[i]);
+
+  const LineSegmentChain<2> chain(vertices);
+  const LineSegmentChain<2, float> chain_float(vertices_float);
+  EXPECT_FLOAT_EQ(chain_float.Length(), static_cast<float>(chain.Length()));
+  for(const Real t : {Zero, 0.1, 0.5, 0.9, One})
+  {
+    const auto p = chain.Point(t);
+    const auto p_float = chain_float.Point(static_cast<float>(t));
+    FOR(i, 2) EXPECT_NEAR(p_float[i], p[i], 1e-5 * (One + Abs(p[i])));
+  }
+  static_assert(isTypeSame<decltype(chain_float.Point(0.0f)), SVector2<float>>());
+}
+
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,96 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#include "../../../include/Global.h"
+#include "../../Benchmark/include/Benchmark.h"
+#include "../../../include/Random.h"
+#include "../include/ParallelSort.h"
+
+#include <string>
+#include <tuple>
+
+using namespace aprn;
+
+/** Glyph record of a cache line, with its depth and id keys. */
+struct Glyph
+{
+   float    Depth;
+   unsigned Id;
+   float    Attributes[14];
+};
+
+/***************************************************************************************************************************************************************
+* Times the parallel sorts on 10^6 keys and up, against std::sort, for doubles and for permutations of doubles, and depth sorts of up to 10^7 glyph records.
+* The largest size is 10^7 by default, and up to 10^9 if given as a power of ten by the first argument, e.g. "BenchmarkSort 9", which needs about 40 GB of
+* memory.
+***************************************************************************************************************************************************************/
+int main(int argc, char* argv[])
+{
+   const size_t max_exponent = argc > 1 ? std::stoul(argv[1]) : 7;
+   Benchmark benchmark;
+   Random<Real> random(-One, One);
+   Real checksum{};
+
+   for(size_t exponent = 6, n = 1000000; exponent <= max_exponent; ++exponent, n *= 10)
+   {
+      std::vector<Real> keys(n);
+      FOR(i, n) keys[i] = random();
+      std::vector<Real> entries(n);
+      const std::string size = " 1e" + std::to_string(exponent);
+
+      const auto time = [&](const std::string& name, const auto& sort)
+      {
+         std::copy(keys.begin(), keys.end(), entries.begin());
+         benchmark.StartTimer(name + size);
+         sort();
+         benchmark.StopTimer(name + size);
+         checksum += entries[n / 2];
+      };
+      time("std::sort",    [&]{ std::sort(entries.begin(), entries.end()); });
+      time("MergeSort",    [&]{ MergeSort<Par>(entries.begin(), entries.end()); });
+      time("SampleSort",   [&]{ SampleSort<Par>(entries.begin(), entries.end()); });
+      time("RadixSort",    [&]{ RadixSort<Par>(entries.begin(), entries.end()); });
+      time("Permutation",  [&]{ checksum += static_cast<Real>(SortPermutation<Par>(entries.begin(), entries.end())[n / 2]); });
+      // Depth sorting of glyphs by (depth, id), moving whole records, against sorting their indices, which suffices to draw them in order, and then applying
+      // the permutation to the records.
+      if(exponent > 7) continue;
+      std::vector<Glyph> glyphs(n);
+      DArray<float> depths(n);
+      DArray<unsigned> ids(n);
+      FOR(i, n)
+      {
+         depths[i] = static_cast<float>(std::round(100.0 * keys[i]));
+         ids[i] = static_cast<unsigned>(i * 7919 % 1000);
+         glyphs[i] = {depths[i], ids[i], {}};
+      }
+      std::vector<Glyph> sorted_glyphs = glyphs;
+
+      benchmark.StartTimer("Glyphs" + size);
+      std::sort(sorted_glyphs.begin(), sorted_glyphs.end(), [](const Glyph& a, const Glyph& b){ return std::tie(a.Depth, a.Id) < std::tie(b.Depth, b.Id); });
+      benchmark.StopTimer("Glyphs" + size);
+      checksum += sorted_glyphs[n / 2].Id;
+
+      benchmark.StartTimer("Glyph argsort" + size);
+      const auto permutation = StableArgSort<Par>(depths, ids);
+      benchmark.StopTimer("Glyph argsort" + size);
+
+      benchmark.StartTimer("Glyph apply" + size);
+      ApplyPermutation(permutation, glyphs);
+      benchmark.StopTimer("Glyph apply" + size);
+      checksum += glyphs[n / 2].Id;
+   }
+
+   Print("Checksum:", checksum);
+   benchmark.PrintResults();
+}
@@ -0,0 +1,107 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+#include "../../../include/Global.h"
+#include "../../DataContainer/include/Array.h"
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <tuple>
+#include <vector>
+
+namespace aprn {
+
+/***************************************************************************************************************************************************************
+* Comparison Sorts
+***************************************************************************************************************************************************************/
+
+/** Stable merge sort, e.g. MergeSort<Par>(first, last). The parallel variant sorts the halves of the range as OpenMP tasks, and merges them by splitting the
+ *  merge in two at the median of the larger half, recursively, so that the merges are parallel too. Requires a buffer as large as the range. */
+template<ExecutionPolicy P, std::random_access_iterator It, class Compare = std::less<>>
+void MergeSort(It first, It last, Compare compare = {});
+
+/** Unstable sample sort. The parallel variant picks bucket splitters from a regular sample of the range, scatters each block of the range to the buckets in
+ *  parallel, and sorts the buckets in parallel. Requires a buffer as large as the range. */
+template<ExecutionPolicy P, std::random_access_iterator It, class Compare = std::less<>>
+void SampleSort(It first, It last, Compare compare = {});
+
+/***************************************************************************************************************************************************************
+* Radix Sorts
+***************************************************************************************************************************************************************/
+
+/** Keys sorted by their bits: integers, and floats and doubles, whose bits are mapped to unsigned integers of the same order. NaNs go to the end, or to the
+ *  start if their sign bit is set. */
+template<typename T>
+concept RadixKey = (std::integral<T> && !isTypeSame<T, bool>()) || isTypeSame<T, float>() || isTypeSame<T, double>();
+
+/** Comparisons of radix keys that a radix sort can follow, which are ascending and descending order. */
+template<class Compare, typename T>
+concept RadixOrder = isTypeSame<Compare, std::less<>>()    || isTypeSame<Compare, std::less<T>>() ||
+                     isTypeSame<Compare, std::greater<>>() || isTypeSame<Compare, std::greater<T>>();
+
+/** Stable LSD radix sort over 8-bit digits, skipping the digits shared by every key. The parallel variant counts the digits of each block of the range in
+ *  parallel, and scatters the blocks to consecutive slots, so that it is stable as well. Requires a buffer as large as the range. */
+template<ExecutionPolicy P, std::contiguous_iterator It, class Compare = std::less<>>
+requires RadixKey<IterType<It>> && RadixOrder<Compare, IterType<It>>
+void RadixSort(It first, It last, Compare compare = {});
+
+/***************************************************************************************************************************************************************
+* Sorting
+***************************************************************************************************************************************************************/
+
+/** Sort a range with the fastest applicable algorithm: radix sort for contiguous radix keys in ascending or descending order, and sample sort otherwise, or
+ *  std::sort when serial. */
+template<ExecutionPolicy P, std::random_access_iterator It, class Compare = std::less<>>
+void SortEntries(It first, It last, Compare compare = {});
+
+/** Permutation sorting the keys projected from a range, such that the i-th smallest entry is at first[permutation[i]]. Only (key, index) pairs are sorted, so
+ *  that the entries, e.g. large payloads, are never moved. The sort is stable, by radix sort for radix keys in ascending or descending order, and by merge sort
+ *  otherwise. */
+template<ExecutionPolicy P, std::random_access_iterator It, class Compare = std::less<>, class Projection = std::identity>
+DArray<size_t> SortPermutation(It first, It last, Compare compare = {}, Projection projection = {});
+
+/***************************************************************************************************************************************************************
+* Argsort and Permutations
+***************************************************************************************************************************************************************/
+
+/** Key columns of structure-of-arrays records, e.g. the depths and ids of glyphs, each a random-access range with an entry per record. */
+template<class C>
+concept KeyColumn = std::ranges::random_access_range<C> && std::ranges::sized_range<C>;
+
+/** Permutation sorting records by their key columns, compared lexicographically, e.g. StableArgSort<Par>(depths, ids), or StableArgSort<Par, std::greater<>>
+ *  for descending order. Records are never moved, only their indices. Radix key columns are radix sorted one at a time, from the last to the first, and other
+ *  columns are merge sorted, so that records with equal keys keep their order. */
+template<ExecutionPolicy P, class Compare = std::less<>, KeyColumn... C>
+DArray<size_t> StableArgSort(const C&... columns);
+
+/** Permutation sorting records by their key columns, as StableArgSort, but in any order for records with equal keys, by sample sort where radix sort does not
+ *  apply. */
+template<ExecutionPolicy P, class Compare = std::less<>, KeyColumn... C>
+DArray<size_t> ArgSort(const C&... columns);
+
+/** Reorder payload arrays in place by a permutation, such that payloads[i] becomes the former payloads[permutation[i]], e.g. by a permutation sorting their
+ *  keys. Each cycle of the permutation is followed once, moving every entry exactly once, with a temporary for one entry per array. */
+template<std::ranges::random_access_range... R>
+void ApplyPermutation(const DArray<size_t>& permutation, R&... payloads);
+
+}
+
+#include "ParallelSort.tpp"
@@ -0,0 +1,481 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+namespace aprn {
+namespace detail {
+
+/***************************************************************************************************************************************************************
+* Sort Utilities
+***************************************************************************************************************************************************************/
+
+/** Apply a function to each index in [0, n), in parallel for the parallel policy. */
+template<ExecutionPolicy P, class F>
+void
+PolicyFor(const size_t n, F&& function, const size_t cost = 1)
+{
+   if constexpr(isTypeSame<P, Par>()) ParallelFor(n, function, cost);
+   else FOR(i, n) function(i);
+}
+
+/** Number of contiguous blocks of a range processed by separate threads. */
+template<ExecutionPolicy P>
+size_t
+nSortBlocks(const size_t n) { return isTypeSame<P, Par>() && isParallel(n) ? nThreads() : 1; }
+
+/** Size of the ranges below which the parallel sorts stop forking tasks, which leaves a few tasks per thread for load balancing. */
+inline size_t
+SortTaskCutoff(const size_t n) { return Max(n / (8 * nThreads()), size_t{1} << 12); }
+
+/** Size of the ranges below which std::sort is faster than a radix sort. */
+constexpr size_t MinRadixSortSize = 256;
+
+/** Key and position of an entry of a range, sorted in place of the entry. */
+template<typename K>
+struct KeyIndex
+{
+   K      Key;
+   size_t Index;
+};
+
+/***************************************************************************************************************************************************************
+* Merge Sort
+***************************************************************************************************************************************************************/
+
+/** Merge two sorted ranges, splitting the merge at the median of the larger range into two independent merges, which run as tasks. */
+template<class In, class Out, class Compare>
+void
+ParallelMerge(In a_first, In a_last, In b_first, In b_last, Out out, Compare compare, const size_t cutoff)
+{
+   const auto na = static_cast<size_t>(a_last - a_first);
+   const auto nb = static_cast<size_t>(b_last - b_first);
+   if(na + nb <= cutoff)
+   {
+      std::merge(std::make_move_iterator(a_first), std::make_move_iterator(a_last), std::make_move_iterator(b_first), std::make_move_iterator(b_last), out,
+                 compare);
+      return;
+   }
+
+   // Entries of the first range equal to those of the second are kept on the left of the split, so that the merge stays stable.
+   In a_middle = a_first + na / 2;
+   In b_middle = b_first + nb / 2;
+   if(na >= nb) b_middle = std::lower_bound(b_first, b_last, *a_middle, compare);
+   else         a_middle = std::upper_bound(a_first, a_last, *b_middle, compare);
+   const Out out_middle = out + (a_middle - a_first) + (b_middle - b_first);
+
+#pragma omp task
+   ParallelMerge(a_first, a_middle, b_first, b_middle, out, compare, cutoff);
+   ParallelMerge(a_middle, a_last, b_middle, b_last, out_middle, compare, cutoff);
+#pragma omp taskwait
+}
+
+/** Sort a range into itself, or into a buffer of the same size, by sorting its halves into the other of the two as tasks, and merging them back. */
+template<class It, class B, class Compare>
+void
+MergeSortTask(It first, B buffer, const size_t n, const bool into_buffer, Compare compare, const size_t cutoff)
+{
+   if(n <= cutoff)
+   {
+      std::stable_sort(first, first + n, compare);
+      if(into_buffer) std::move(first, first + n, buffer);
+      return;
+   }
+
+   const size_t half = n / 2;
+#pragma omp task
+   MergeSortTask(first, buffer, half, !into_buffer, compare, cutoff);
+   MergeSortTask(first + half, buffer + half, n - half, !into_buffer, compare, cutoff);
+#pragma omp taskwait
+
+   if(into_buffer) ParallelMerge(first, first + half, first + half, first + n, buffer, compare, cutoff);
+   else            ParallelMerge(buffer, buffer + half, buffer + half, buffer + n, first, compare, cutoff);
+}
+
+/***************************************************************************************************************************************************************
+* Radix Sort
+***************************************************************************************************************************************************************/
+template<RadixKey T>
+using RadixBits = std::conditional_t<sizeof(T) == 1, std::uint8_t, std::conditional_t<sizeof(T) == 2, std::uint16_t,
+                  std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>>>;
+
+template<class Compare, typename T>
+constexpr bool
+isDescendingOrder() { return isTypeSame<Compare, std::greater<>>() || isTypeSame<Compare, std::greater<T>>(); }
+
+/** Unsigned bits of a radix key, in the same order as the keys, or in reverse order. Floats with the sign bit set have all their bits flipped, and others only
+ *  their sign bit, so that negative floats come first in reverse order of magnitude. Negative zero is mapped to zero, which it equals. */
+template<bool is_descending, RadixKey T>
+constexpr RadixBits<T>
+OrderedBits(const T key)
+{
+   using U = RadixBits<T>;
+   constexpr U sign = static_cast<U>(U{1} << (8 * sizeof(T) - 1));
+   U bits;
+   if constexpr(std::floating_point<T>)
+   {
+      bits = std::bit_cast<U>(key == T{} ? T{} : key);
+      bits = bits & sign ? static_cast<U>(~bits) : static_cast<U>(bits | sign);
+   }
+   else if constexpr(std::is_signed_v<T>) bits = static_cast<U>(static_cast<U>(key) ^ sign);
+   else bits = static_cast<U>(key);
+   return is_descending ? static_cast<U>(~bits) : bits;
+}
+
+/** LSD radix sort of records by the unsigned bits of their keys, one byte per pass. Each block of the range counts its digits, and scatters its records to the
+ *  consecutive slots following those of the preceding blocks. Passes over a digit shared by every record are skipped. */
+template<ExecutionPolicy P, typename R, class Bits>
+void
+RadixSortRecords(R* records, const size_t n, Bits bits_of)
+{
+   using U = decltype(bits_of(*records));
+   constexpr size_t n_digits = 256;
+   const size_t n_blocks = nSortBlocks<P>(n);
+   const auto block_begin = [n, n_blocks](const size_t block){ return n * block / n_blocks; };
+
+   std::vector<R> buffer(n);
+   DArray<size_t> offsets(n_blocks * n_digits);
+   R* source = records;
+   R* target = buffer.data();
+   FOR(pass, sizeof(U))
+   {
+      const size_t shift = 8 * pass;
+      const auto digit = [&bits_of, shift](const R& record){ return static_cast<size_t>(bits_of(record) >> shift) & (n_digits - 1); };
+
+      std::fill(offsets.begin(), offsets.end(), size_t{});
+      PolicyFor<P>(n_blocks, [&](const size_t block)
+      {
+         size_t* counts = &offsets[block * n_digits];
+         FOR(i, block_begin(block), block_begin(block + 1)) ++counts[digit(source[i])];
+      }, n / n_blocks);
+
+      bool is_shared{};
+      size_t offset{};
+      FOR(d, n_digits)
+      {
+         const size_t digit_begin = offset;
+         FOR(block, n_blocks)
+         {
+            const size_t count = offsets[block * n_digits + d];
+            offsets[block * n_digits + d] = offset;
+            offset += count;
+         }
+         if(offset - digit_begin == n) is_shared = true;
+      }
+      if(is_shared) continue;
+
+      PolicyFor<P>(n_blocks, [&](const size_t block)
+      {
+         size_t* block_offsets = &offsets[block * n_digits];
+         FOR(i, block_begin(block), block_begin(block + 1)) target[block_offsets[digit(source[i])]++] = source[i];
+      }, n / n_blocks);
+      std::swap(source, target);
+   }
+
+   if(source != records)
+      PolicyFor<P>(n_blocks, [&](const size_t block){ std::copy(source + block_begin(block), source + block_begin(block + 1), records + block_begin(block)); },
+                   n / n_blocks);
+}
+
+/** Stably sort a permutation by the radix keys of the records it points to. */
+template<ExecutionPolicy P, bool is_descending, class Key>
+void
+RadixSortIndices(DArray<size_t>& permutation, Key key_of)
+{
+   using U = RadixBits<RemoveConstRef<decltype(key_of(size_t{}))>>;
+   const size_t n = permutation.size();
+   std::vector<KeyIndex<U>> entries(n);
+   PolicyFor<P>(n, [&](const size_t i){ entries[i] = {OrderedBits<is_descending>(key_of(permutation[i])), permutation[i]}; });
+   RadixSortRecords<P>(entries.data(), n, [](const KeyIndex<U>& entry){ return entry.Key; });
+   PolicyFor<P>(n, [&](const size_t i){ permutation[i] = entries[i].Index; });
+}
+
+template<ExecutionPolicy P>
+DArray<size_t>
+IdentityPermutation(const size_t n)
+{
+   DArray<size_t> permutation(n);
+   PolicyFor<P>(n, [&permutation](const size_t i){ permutation[i] = i; });
+   return permutation;
+}
+
+/***************************************************************************************************************************************************************
+* Argsort
+***************************************************************************************************************************************************************/
+template<class C>
+using KeyColumnType = RemoveConstRef<std::ranges::range_value_t<C>>;
+
+template<class Compare, class... C>
+constexpr bool
+isRadixColumns() { return ((RadixKey<KeyColumnType<C>> && RadixOrder<Compare, KeyColumnType<C>>) && ...); }
+
+/** Lexicographic comparison of two records by their key columns. */
+template<class Compare, class C, class... Cs>
+bool
+LexicographicLess(const Compare& compare, const size_t a, const size_t b, const C& column, const Cs&... columns)
+{
+   const auto& key_a = std::ranges::begin(column)[a];
+   const auto& key_b = std::ranges::begin(column)[b];
+   if(compare(key_a, key_b)) return true;
+   if constexpr(sizeof...(Cs) > 0)
+   {
+      if(compare(key_b, key_a)) return false;
+      return LexicographicLess(compare, a, b, columns...);
+   }
+   else return false;
+}
+
+/** Number of records of key columns, which must all have the same size. */
+template<class C, class... Cs>
+size_t
+nRecords(const C& column, const Cs&... columns)
+{
+   const auto n = static_cast<size_t>(std::ranges::size(column));
+   ASSERT(((static_cast<size_t>(std::ranges::size(columns)) == n) && ...), "The key columns must have the same number of records.")
+   return n;
+}
+
+/** Radix sort of a permutation by each key column, from the last to the first, so that the stability of each pass orders the records lexicographically. */
+template<ExecutionPolicy P, class Compare, class... C>
+void
+RadixArgSort(DArray<size_t>& permutation, const C&... columns)
+{
+   const auto columns_tuple = std::forward_as_tuple(columns...);
+   [&]<size_t... is>(std::index_sequence<is...>)
+   {
+      const auto sort_by = [&permutation](const auto& column)
+      {
+         using K = KeyColumnType<RemoveConstRef<decltype(column)>>;
+         RadixSortIndices<P, isDescendingOrder<Compare, K>()>(permutation, [&column](const size_t i){ return std::ranges::begin(column)[i]; });
+      };
+      (sort_by(std::get<sizeof...(C) - 1 - is>(columns_tuple)), ...);
+   }(std::index_sequence_for<C...>{});
+}
+
+}//detail
+
+/***************************************************************************************************************************************************************
+* Comparison Sorts
+***************************************************************************************************************************************************************/
+template<ExecutionPolicy P, std::random_access_iterator It, class Compare>
+void
+MergeSort(It first, It last, Compare compare)
+{
+   if constexpr(isTypeSame<P, Seq>()) std::stable_sort(first, last, compare);
+   else
+   {
+      const auto n = static_cast<size_t>(last - first);
+      if(!isParallel(n))
+      {
+         std::stable_sort(first, last, compare);
+         return;
+      }
+
+      std::vector<IterType<It>> buffer(n);
+      const size_t cutoff = detail::SortTaskCutoff(n);
+#pragma omp parallel
+#pragma omp single
+      detail::MergeSortTask(first, buffer.begin(), n, false, compare, cutoff);
+   }
+}
+
+template<ExecutionPolicy P, std::random_access_iterator It, class Compare>
+void
+SampleSort(It first, It last, Compare compare)
+{
+   using T = IterType<It>;
+   if constexpr(isTypeSame<P, Seq>()) std::sort(first, last, compare);
+   else
+   {
+      const auto n = static_cast<size_t>(last - first);
+      if(!isParallel(n))
+      {
+         std::sort(first, last, compare);
+         return;
+      }
+
+      // Splitters between the buckets from a regular sample, with a few buckets per thread for load balancing.
+      constexpr size_t oversampling = 32;
+      const size_t n_blocks  = nThreads();
+      const size_t n_buckets = 4 * n_blocks;
+      std::vector<T> sample(n_buckets * oversampling);
+      FOR(i, sample.size()) sample[i] = first[i * n / sample.size()];
+      std::sort(sample.begin(), sample.end(), compare);
+      std::vector<T> splitters(n_buckets - 1);
+      FOR(i, n_buckets - 1) splitters[i] = sample[(i + 1) * oversampling];
+
+      // Bucket of each entry, and the number of entries of each block in each bucket.
+      const auto block_begin = [n, n_blocks](const size_t block){ return n * block / n_blocks; };
+      DArray<std::uint32_t> buckets(n);
+      DArray<size_t> offsets(n_blocks * n_buckets, 0);
+      ParallelFor(n_blocks, [&](const size_t block)
+      {
+         size_t* counts = &offsets[block * n_buckets];
+         FOR(i, block_begin(block), block_begin(block + 1))
+         {
+            buckets[i] = static_cast<std::uint32_t>(std::upper_bound(splitters.begin(), splitters.end(), first[i], compare) - splitters.begin());
+            ++counts[buckets[i]];
+         }
+      }, n / n_blocks);
+
+      DArray<size_t> bucket_begin(n_buckets + 1);
+      size_t offset{};
+      FOR(bucket, n_buckets)
+      {
+         bucket_begin[bucket] = offset;
+         FOR(block, n_blocks)
+         {
+            const size_t count = offsets[block * n_buckets + bucket];
+            offsets[block * n_buckets + bucket] = offset;
+            offset += count;
+         }
+      }
+      bucket_begin[n_buckets] = n;
+
+      // Scatter the blocks to the buckets, and sort each bucket back into the range.
+      std::vector<T> buffer(n);
+      ParallelFor(n_blocks, [&](const size_t block)
+      {
+         size_t* block_offsets = &offsets[block * n_buckets];
+         FOR(i, block_begin(block), block_begin(block + 1)) buffer[block_offsets[buckets[i]]++] = std::move(first[i]);
+      }, n / n_blocks);
+      ParallelFor(n_buckets, [&](const size_t bucket)
+      {
+         const auto bucket_first = buffer.begin() + static_cast<std::ptrdiff_t>(bucket_begin[bucket]);
+         const auto bucket_last  = buffer.begin() + static_cast<std::ptrdiff_t>(bucket_begin[bucket + 1]);
+         std::sort(bucket_first, bucket_last, compare);
+         std::move(bucket_first, bucket_last, first + static_cast<std::ptrdiff_t>(bucket_begin[bucket]));
+      }, n / n_buckets);
+   }
+}
+
+/***************************************************************************************************************************************************************
+* Radix Sorts
+***************************************************************************************************************************************************************/
+template<ExecutionPolicy P, std::contiguous_iterator It, class Compare>
+requires RadixKey<IterType<It>> && RadixOrder<Compare, IterType<It>>
+void
+RadixSort(It first, It last, Compare compare)
+{
+   using T = IterType<It>;
+   const auto n = static_cast<size_t>(last - first);
+   if(n < detail::MinRadixSortSize)
+   {
+      std::sort(first, last, compare);
+      return;
+   }
+   detail::RadixSortRecords<P>(std::to_address(first), n, [](const T key){ return detail::OrderedBits<detail::isDescendingOrder<Compare, T>()>(key); });
+}
+
+/***************************************************************************************************************************************************************
+* Sorting
+***************************************************************************************************************************************************************/
+template<ExecutionPolicy P, std::random_access_iterator It, class Compare>
+void
+SortEntries(It first, It last, Compare compare)
+{
+   using T = IterType<It>;
+   if constexpr(std::contiguous_iterator<It> && RadixKey<T> && RadixOrder<Compare, T>) RadixSort<P>(first, last, compare);
+   else SampleSort<P>(first, last, compare);
+}
+
+template<ExecutionPolicy P, std::random_access_iterator It, class Compare, class Projection>
+DArray<size_t>
+SortPermutation(It first, It last, Compare compare, Projection projection)
+{
+   using K = RemoveConstRef<std::invoke_result_t<Projection&, std::iter_reference_t<It>>>;
+   const auto n = static_cast<size_t>(last - first);
+   DArray<size_t> permutation(n);
+
+   if constexpr(RadixKey<K> && RadixOrder<Compare, K>)
+   {
+      permutation = detail::IdentityPermutation<P>(n);
+      const auto key_of = [&](const size_t i){ return static_cast<K>(std::invoke(projection, first[i])); };
+      detail::RadixSortIndices<P, detail::isDescendingOrder<Compare, K>()>(permutation, key_of);
+   }
+   else
+   {
+      std::vector<detail::KeyIndex<K>> entries(n);
+      detail::PolicyFor<P>(n, [&](const size_t i){ entries[i] = {std::invoke(projection, first[i]), i}; });
+      MergeSort<P>(entries.begin(), entries.end(), [&compare](const detail::KeyIndex<K>& a, const detail::KeyIndex<K>& b){ return compare(a.Key, b.Key); });
+      detail::PolicyFor<P>(n, [&](const size_t i){ permutation[i] = entries[i].Index; });
+   }
+   return permutation;
+}
+
+/***************************************************************************************************************************************************************
+* Argsort and Permutations
+***************************************************************************************************************************************************************/
+template<ExecutionPolicy P, class Compare, KeyColumn... C>
+DArray<size_t>
+StableArgSort(const C&... columns)
+{
+   static_assert(sizeof...(C) > 0, "At least one key column is required.");
+   auto permutation = detail::IdentityPermutation<P>(detail::nRecords(columns...));
+   if constexpr(detail::isRadixColumns<Compare, C...>()) detail::RadixArgSort<P, Compare>(permutation, columns...);
+   else
+   {
+      const auto less = [&](const size_t a, const size_t b){ return detail::LexicographicLess(Compare(), a, b, columns...); };
+      MergeSort<P>(permutation.begin(), permutation.end(), less);
+   }
+   return permutation;
+}
+
+template<ExecutionPolicy P, class Compare, KeyColumn... C>
+DArray<size_t>
+ArgSort(const C&... columns)
+{
+   static_assert(sizeof...(C) > 0, "At least one key column is required.");
+   auto permutation = detail::IdentityPermutation<P>(detail::nRecords(columns...));
+   if constexpr(detail::isRadixColumns<Compare, C...>()) detail::RadixArgSort<P, Compare>(permutation, columns...);
+   else
+   {
+      const auto less = [&](const size_t a, const size_t b){ return detail::LexicographicLess(Compare(), a, b, columns...); };
+      SampleSort<P>(permutation.begin(), permutation.end(), less);
+   }
+   return permutation;
+}
+
+template<std::ranges::random_access_range... R>
+void
+ApplyPermutation(const DArray<size_t>& permutation, R&... payloads)
+{
+   const size_t n = permutation.size();
+   ASSERT(((static_cast<size_t>(std::ranges::size(payloads)) == n) && ...), "The payload arrays must have an entry per index of the permutation.")
+
+   std::vector<bool> is_placed(n);
+   FOR(i, n)
+   {
+      if(is_placed[i] || permutation[i] == i) continue;
+
+      // Follow the cycle through i, pulling each entry from where the permutation points, and close it with the saved entries of i.
+      auto saved = std::make_tuple(std::move(std::ranges::begin(payloads)[i])...);
+      size_t j = i;
+      while(true)
+      {
+         const size_t k = permutation[j];
+         DEBUG_ASSERT(k < n && (k == i || !is_placed[k]), "The indices must be a permutation.")
+         is_placed[j] = true;
+         if(k == i) break;
+         ((std::ranges::begin(payloads)[j] = std::move(std::ranges::begin(payloads)[k])), ...);
+         j = k;
+      }
+      [&]<size_t... is>(std::index_sequence<is...>)
+      {
+         ((std::ranges::begin(payloads)[j] = std::move(std::get<is>(saved))), ...);
+      }(std::index_sequence_for<R...>{});
+   }
+}
+
+}
@@ -16,20 +16,12 @@
 
 #include "../../../include/Global.h"
 #include <DataContainer/include/Array.h>
+#include "ParallelSort.h"
 
 namespace aprn{
 
-template<typename T, unsigned N>
-struct SortObject
-{
-   size_t Index;
-   SArray<T, N> Values;
-
-   SortObject() {}
-
-   SortObject(const size_t index, const SArray<T, N>& values) : Index(index), Values(values) {}
-};
-
+/** Sorts objects, given by an index, by N keys each, compared lexicographically. The keys are stored once, as a column per key in the order they are added, and
+ *  only a sorting permutation is computed, in parallel, by a radix sort per column. Objects with equal keys stay in the order they were added. */
 template<typename T, unsigned N = 1>
 class Sort
 {
@@ -41,31 +33,38 @@ class Sort
    inline void Init(const size_t object_count)
    {
       STATIC_ASSERT(isArithmetic<T>(), "Can only sort numerical data types currently.")
-      SortObjects_.reserve(object_count);
+      Indices_.reserve(object_count);
+      FOR(k, N) Values_[k].reserve(object_count);
    }
 
-   inline void AddSortObject(const size_t index, const SArray<T, N>& values) { SortObjects_.emplace_back(index, values); }
+   inline void AddSortObject(const size_t index, const SArray<T, N>& values)
+   {
+      Indices_.push_back(index);
+      FOR(k, N) Values_[k].push_back(values[k]);
+   }
 
    inline void SortAll(const bool _is_sort_in_ascending = true)
    {
-      std::sort(SortObjects_.begin(), SortObjects_.end(), [](const SortObject<T, N>& a, const SortObject<T, N>& b)
-                                                          {
-                                                             FOR(i, N)
-                                                             {
-                                                                if     (a[i] < b[i]) return true;
-                                                                else if(a[i] > b[i]) return false;
-                                                                else continue;
-                                                             }
-                                                          });
-      if(!_is_sort_in_ascending) std::reverse(SortObjects_.begin(), SortObjects_.end());
+      const auto sort = [this]<class Compare, size_t... ks>(Compare, std::index_sequence<ks...>){ return StableArgSort<Par, Compare>(Values_[ks]...); };
+      Order_ = _is_sort_in_ascending ? sort(std::less<T>(), std::make_index_sequence<N>{}) : sort(std::greater<T>(), std::make_index_sequence<N>{});
    }
 
-   inline size_t GetIndex(const size_t i) const { return SortObjects_[i].Index_; }
+   inline size_t GetIndex(const size_t i) const { return Indices_[Order_[i]]; }
+
+   inline SArray<T, N> GetValues(const size_t i) const
+   {
+      SArray<T, N> values;
+      FOR(k, N) values[k] = Values_[k][Order_[i]];
+      return values;
+   }
 
-   inline const SArray<T, N>& GetValues(const size_t i) const { return SortObjects_[i].Values; }
+   /** Sorting permutation, e.g. to reorder payloads of the objects with ApplyPermutation. */
+   inline const DArray<size_t>& GetPermutation() const { return Order_; }
 
  private:
-   DArray<SortObject<T, N>> SortObjects_;
+   DArray<size_t>           Indices_;
+   std::array<DArray<T>, N> Values_;
+   DArray<size_t>           Order_;
 };
 
 }
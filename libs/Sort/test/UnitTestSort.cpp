@@ -0,0 +1,289 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "../../../include/Global.h"
+#include "../../../include/Random.h"
+#include "../include/Sort.h"
+
+#include <limits>
+#include <string>
+#include <tuple>
+
+#ifdef DEBUG_MODE
+
+namespace aprn {
+
+/***************************************************************************************************************************************************************
+* Sort Test Fixture
+***************************************************************************************************************************************************************/
+class SortTest : public testing::Test
+{
+ public:
+   static constexpr size_t n = 20000;
+
+   /** Force the parallel paths on small ranges, which are split between more threads than there may be cores. */
+   SortTest()
+      : Threshold(ParallelThreshold()), nThreads_(nThreads())
+   {
+      SetParallelThreshold(0);
+      SetThreads(4);
+   }
+
+   ~SortTest() override
+   {
+      SetThreads(nThreads_);
+      SetParallelThreshold(Threshold);
+   }
+
+   /** Random entries over a small range of values, so that there are many equal entries. */
+   template<typename T>
+   DArray<T> RandomEntries(const T min, const T max)
+   {
+      Random<T> random(min, max);
+      DArray<T> entries(n);
+      FOR(i, n) entries[i] = random();
+      return entries;
+   }
+
+ private:
+   size_t Threshold;
+   size_t nThreads_;
+};
+
+/***************************************************************************************************************************************************************
+* Test Comparison Sorts
+***************************************************************************************************************************************************************/
+TEST_F(SortTest, ComparisonSorts)
+{
+   const auto keys = RandomEntries<int>(0, 100);
+   std::vector<std::pair<int, size_t>> entries(n);
+   FOR(i, n) entries[i] = {keys[i], i};
+   const auto by_key = [](const auto& a, const auto& b){ return a.first < b.first; };
+
+   auto expected = entries;
+   std::stable_sort(expected.begin(), expected.end(), by_key);
+
+   // Merge sorts are stable, so the equal keys keep their original order.
+   auto merged = entries;
+   MergeSort<Par>(merged.begin(), merged.end(), by_key);
+   EXPECT_EQ(merged, expected);
+
+   merged = entries;
+   MergeSort<Seq>(merged.begin(), merged.end(), by_key);
+   EXPECT_EQ(merged, expected);
+
+   auto sampled = entries;
+   SampleSort<Par>(sampled.begin(), sampled.end(), by_key);
+   EXPECT_TRUE(std::is_sorted(sampled.begin(), sampled.end(), by_key));
+   std::sort(sampled.begin(), sampled.end());
+   std::sort(expected.begin(), expected.end());
+   EXPECT_EQ(sampled, expected);
+
+   // Entries that are not radix keys, in descending order.
+   std::vector<std::string> words(n);
+   FOR(i, n) words[i] = std::to_string(keys[i] * 7919 % 1000);
+   auto sorted_words = words;
+   std::sort(sorted_words.begin(), sorted_words.end(), std::greater<>());
+   SortEntries<Par>(words.begin(), words.end(), std::greater<>());
+   EXPECT_EQ(words, sorted_words);
+
+   // Ranges too short to be split.
+   std::vector<int> short_range{3, 1, 2};
+   MergeSort<Par>(short_range.begin(), short_range.end());
+   EXPECT_EQ(short_range, (std::vector<int>{1, 2, 3}));
+}
+
+/***************************************************************************************************************************************************************
+* Test Radix Sorts
+***************************************************************************************************************************************************************/
+TEST_F(SortTest, RadixSort)
+{
+   const auto check = [](auto entries)
+   {
+      auto expected = entries;
+      std::sort(expected.begin(), expected.end());
+      RadixSort<Par>(entries.begin(), entries.end());
+      EXPECT_EQ(entries, expected);
+
+      std::sort(expected.begin(), expected.end(), std::greater<>());
+      RadixSort<Seq>(entries.begin(), entries.end(), std::greater<>());
+      EXPECT_EQ(entries, expected);
+   };
+   check(RandomEntries<int>(-1000000, 1000000));
+   check(RandomEntries<long>(std::numeric_limits<long>::min(), std::numeric_limits<long>::max()));
+   check(RandomEntries<unsigned>(0, 500));
+   check(RandomEntries<float>(-1.0E6f, 1.0E6f));
+   check(RandomEntries<double>(-One, One));
+
+   DArray<std::int8_t> bytes(n);
+   FOR(i, n) bytes[i] = static_cast<std::int8_t>(i * 37 % 256 - 128);
+   check(bytes);
+
+   // Extreme floats.
+   DArray<double> extremes(1000);
+   FOR(i, extremes.size()) extremes[i] = std::vector<double>{-InfFloat<>, InfFloat<>, -Zero, 1.0E-300, -1.0E300, std::numeric_limits<double>::min()}[i % 6];
+   RadixSort<Par>(extremes.begin(), extremes.end());
+   EXPECT_TRUE(std::is_sorted(extremes.begin(), extremes.end()));
+}
+
+/***************************************************************************************************************************************************************
+* Test Sort Permutations
+***************************************************************************************************************************************************************/
+TEST_F(SortTest, SortPermutation)
+{
+   // Radix keys projected from larger entries, in both orders, and keys that are not radix keys.
+   const auto keys = RandomEntries<double>(-One, One);
+   DArray<SArray3<double>> entries(n);
+   FOR(i, n) entries[i] = {std::round(10.0 * keys[i]), keys[i], static_cast<double>(i)};
+
+   const auto check = [&](const DArray<size_t>& permutation, const auto& less)
+   {
+      ASSERT_EQ(permutation.size(), n);
+      DArray<Bool> is_found(n, false);
+      FOR(i, n)
+      {
+         ASSERT_LT(permutation[i], n);
+         is_found[permutation[i]] = true;
+      }
+      EXPECT_TRUE(std::all_of(is_found.begin(), is_found.end(), [](const Bool found){ return static_cast<bool>(found); }));
+
+      // Equal keys keep their original order.
+      FOR(i, 1, n)
+      {
+         const auto& a = entries[permutation[i - 1]];
+         const auto& b = entries[permutation[i]];
+         EXPECT_FALSE(less(b, a));
+         if(!less(a, b)) EXPECT_LT(permutation[i - 1], permutation[i]);
+      }
+   };
+
+   const auto first = [](const SArray3<double>& entry){ return entry[0]; };
+   check(SortPermutation<Par>(entries.begin(), entries.end(), std::less<>(), first), [](const auto& a, const auto& b){ return a[0] < b[0]; });
+   check(SortPermutation<Par>(entries.begin(), entries.end(), std::greater<>(), first), [](const auto& a, const auto& b){ return a[0] > b[0]; });
+   check(SortPermutation<Seq>(entries.begin(), entries.end(), std::less<>(), first), [](const auto& a, const auto& b){ return a[0] < b[0]; });
+
+   const auto first_two = [](const SArray3<double>& a, const SArray3<double>& b){ return a[0] < b[0] || (a[0] == b[0] && a[1] < b[1]); };
+   check(SortPermutation<Par>(entries.begin(), entries.end(), first_two), first_two);
+
+   const auto permutation = SortPermutation<Par>(keys.begin(), keys.end());
+   FOR(i, 1, n) EXPECT_LE(keys[permutation[i - 1]], keys[permutation[i]]);
+}
+
+/***************************************************************************************************************************************************************
+* Test Argsort and Permutations
+***************************************************************************************************************************************************************/
+TEST_F(SortTest, ArgSort)
+{
+   // Glyphs depth sorted by (depth, id), with few distinct depths and ids, so that many glyphs have equal keys.
+   const auto depths = RandomEntries<float>(-One, One);
+   const auto ids    = RandomEntries<unsigned>(0, 50);
+   DArray<float> rounded_depths(n);
+   FOR(i, n) rounded_depths[i] = std::round(10.0f * depths[i]);
+
+   std::vector<std::tuple<float, unsigned, size_t>> records(n);
+   FOR(i, n) records[i] = {rounded_depths[i], ids[i], i};
+   auto expected = records;
+   std::sort(expected.begin(), expected.end());
+
+   const auto stable = StableArgSort<Par>(rounded_depths, ids);
+   FOR(i, n) EXPECT_EQ(stable[i], std::get<2>(expected[i]));
+   EXPECT_EQ(StableArgSort<Seq>(rounded_depths, ids), stable);
+
+   const auto unstable = ArgSort<Par>(rounded_depths, ids);
+   FOR(i, n) EXPECT_EQ(std::make_pair(rounded_depths[unstable[i]], ids[unstable[i]]), std::make_pair(std::get<0>(expected[i]), std::get<1>(expected[i])));
+
+   // Descending order, which still keeps equal keys in order.
+   std::sort(expected.begin(), expected.end(), [](const auto& a, const auto& b)
+   {
+      return std::tie(std::get<1>(b), std::get<2>(a)) < std::tie(std::get<1>(a), std::get<2>(b));
+   });
+   const auto descending = StableArgSort<Par, std::greater<>>(ids);
+   FOR(i, n) EXPECT_EQ(descending[i], std::get<2>(expected[i]));
+
+   // Columns that are not radix keys are merge sorted, or sample sorted.
+   std::vector<std::string> names(n);
+   FOR(i, n) names[i] = std::to_string(ids[i]);
+   const auto by_name = StableArgSort<Par>(names, rounded_depths);
+   const auto by_name_unstable = ArgSort<Par>(names, rounded_depths);
+   FOR(i, 1, n)
+   {
+      EXPECT_LE(std::tie(names[by_name[i - 1]], rounded_depths[by_name[i - 1]], by_name[i - 1]),
+                std::tie(names[by_name[i]], rounded_depths[by_name[i]], by_name[i]));
+      EXPECT_LE(std::tie(names[by_name_unstable[i - 1]], rounded_depths[by_name_unstable[i - 1]]),
+                std::tie(names[by_name_unstable[i]], rounded_depths[by_name_unstable[i]]));
+   }
+}
+
+TEST_F(SortTest, ApplyPermutation)
+{
+   // Payloads reordered together by the permutation sorting their keys.
+   const auto keys = RandomEntries<int>(-1000, 1000);
+   DArray<int> sorted_keys = keys;
+   std::vector<std::string> payload(n);
+   FOR(i, n) payload[i] = std::to_string(keys[i]);
+
+   const auto permutation = StableArgSort<Par>(keys);
+   ApplyPermutation(permutation, sorted_keys, payload);
+   EXPECT_TRUE(std::is_sorted(sorted_keys.begin(), sorted_keys.end()));
+   FOR(i, n) EXPECT_EQ(payload[i], std::to_string(sorted_keys[i]));
+
+   // Cycles of every length, including fixed points.
+   const DArray<size_t> cycles{0, 2, 3, 1, 5, 4, 6};
+   std::vector<char> letters{'a', 'b', 'c', 'd', 'e', 'f', 'g'};
+   ApplyPermutation(cycles, letters);
+   EXPECT_EQ(letters, (std::vector<char>{'a', 'c', 'd', 'b', 'f', 'e', 'g'}));
+}
+
+/***************************************************************************************************************************************************************
+* Test Sort Class
+***************************************************************************************************************************************************************/
+TEST_F(SortTest, SortObjects)
+{
+   Sort<int> single(5);
+   const std::vector<int> values{4, -2, 4, 7, -2};
+   FOR(i, values.size()) single.AddSortObject(10 * i, {values[i]});
+   single.SortAll();
+   const std::vector<size_t> ascending{10, 40, 0, 20, 30};
+   FOR(i, values.size()) EXPECT_EQ(single.GetIndex(i), ascending[i]);
+   EXPECT_EQ(single.GetValues(0)[0], -2);
+
+   single.SortAll(false);
+   const std::vector<size_t> descending{30, 0, 20, 10, 40};
+   FOR(i, values.size()) EXPECT_EQ(single.GetIndex(i), descending[i]);
+
+   // Lexicographic order of several keys, including equal ones.
+   Sort<Real, 2> pairs(4);
+   pairs.AddSortObject(0, {One, Two});
+   pairs.AddSortObject(1, {One, One});
+   pairs.AddSortObject(2, {Zero, Two});
+   pairs.AddSortObject(3, {One, One});
+   pairs.SortAll();
+   const std::vector<size_t> lexicographic{2, 1, 3, 0};
+   FOR(i, 4) EXPECT_EQ(pairs.GetIndex(i), lexicographic[i]);
+   EXPECT_EQ(pairs.GetValues(3)[1], Two);
+
+   pairs.SortAll(false);
+   const std::vector<size_t> reversed{0, 1, 3, 2};
+   FOR(i, 4) EXPECT_EQ(pairs.GetIndex(i), reversed[i]);
+
+   std::vector<std::string> labels{"a", "b", "c", "d"};
+   ApplyPermutation(pairs.GetPermutation(), labels);
+   EXPECT_EQ(labels, (std::vector<std::string>{"a", "b", "d", "c"}));
+}
+
+}
+
+#endif
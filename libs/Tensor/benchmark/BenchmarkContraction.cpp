@@ -0,0 +1,96 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#include "../../../include/Global.h"
+#include "../../Benchmark/include/Benchmark.h"
+#include "../include/Contraction.h"
+
+using namespace aprn;
+
+/***************************************************************************************************************************************************************
+* Times typical rank-3 and rank-4 contractions, lowered to blocked matrix products, against plain loop nests over the same entries.
+***************************************************************************************************************************************************************/
+template<class D>
+void
+Randomise(Tensor<Real, D>& tensor)
+{
+   Random<Real> random(-One, One);
+   FOR(i, tensor.size()) tensor.Data()[i] = random();
+}
+
+int main()
+{
+   constexpr size_t n = 24;
+   constexpr size_t n_batches = 64;
+   constexpr size_t n_rows = 96;
+   Benchmark benchmark;
+   Real checksum{};
+
+   // Rank-4 contraction over two shared dimensions, which are merged into single strides.
+   DynamicTensor<Real> a(n, n, n, n), b(n, n, n, n);
+   Randomise(a);
+   Randomise(b);
+
+   benchmark.StartTimer("abcd,cdef->abef");
+   const auto ab = Contract<"abcd,cdef->abef">(a, b);
+   benchmark.StopTimer("abcd,cdef->abef");
+   checksum += ab.Data()[ab.size() - 1];
+
+   // The same contraction with shuffled dimensions, which packs an operand and the result.
+   benchmark.StartTimer("abcd,dbef->fcea");
+   const auto shuffled = Contract<"abcd,dbef->fcea">(a, b);
+   benchmark.StopTimer("abcd,dbef->fcea");
+   checksum += shuffled.Data()[shuffled.size() - 1];
+
+   benchmark.StartTimer("Loops abcd,cdef");
+   DynamicTensor<Real> ab_loops(n, n, n, n);
+   const Real* a_data = a.Data();
+   const Real* b_data = b.Data();
+   Real* c_data = ab_loops.Data();
+   FOR(f, n) FOR(e, n) FOR(d, n) FOR(c, n)
+   {
+      const Real b_entry = b_data[c + n * (d + n * (e + n * f))];
+      FOR(bb, n) FOR(aa, n) c_data[aa + n * (bb + n * (e + n * f))] += a_data[aa + n * (bb + n * (c + n * d))] * b_entry;
+   }
+   benchmark.StopTimer("Loops abcd,cdef");
+   checksum += ab_loops.Data()[ab_loops.size() - 1];
+
+   // Batched rank-3 matrix products, and a rank-3 contraction to a matrix.
+   DynamicTensor<Real> x(n_batches, n_rows, n_rows), y(n_batches, n_rows, n_rows);
+   Randomise(x);
+   Randomise(y);
+
+   benchmark.StartTimer("bij,bjk->bik");
+   const auto xy = Contract<"bij,bjk->bik">(x, y);
+   benchmark.StopTimer("bij,bjk->bik");
+   checksum += xy.Data()[xy.size() - 1];
+
+   benchmark.StartTimer("bij,bjk->ik");
+   const auto xy_sum = Contract<"bij,bjk->ik">(x, y);
+   benchmark.StopTimer("bij,bjk->ik");
+   checksum += xy_sum.Data()[xy_sum.size() - 1];
+
+   benchmark.StartTimer("Loops bij,bjk");
+   DynamicTensor<Real> xy_loops(n_batches, n_rows, n_rows);
+   const Real* x_data = x.Data();
+   const Real* y_data = y.Data();
+   Real* xy_data = xy_loops.Data();
+   FOR(k, n_rows) FOR(j, n_rows) FOR(i, n_rows) FOR(batch, n_batches)
+      xy_data[batch + n_batches * (i + n_rows * k)] += x_data[batch + n_batches * (i + n_rows * j)] * y_data[batch + n_batches * (j + n_rows * k)];
+   benchmark.StopTimer("Loops bij,bjk");
+   checksum += xy_loops.Data()[xy_loops.size() - 1];
+
+   Print("Checksum:", checksum);
+   benchmark.PrintResults();
+}
@@ -0,0 +1,116 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#include "../../../include/Global.h"
+#include "../../Benchmark/include/Benchmark.h"
+#include "../include/Contraction.h"
+#include "../include/TensorOperations.h"
+
+using namespace aprn;
+
+/***************************************************************************************************************************************************************
+* Times per-vertex evaluations of tiny static tensor contractions and broadcasts, unrolled at compile time, against run-time subscripts and shape-checked loops.
+***************************************************************************************************************************************************************/
+template<class D>
+void
+Randomise(Tensor<Real, D>& tensor)
+{
+   Random<Real> random(-One, One);
+   FOR(i, tensor.size()) tensor.Data()[i] = random();
+}
+
+int main()
+{
+   constexpr size_t n_vertices = 1000000;
+   constexpr size_t n_dynamic = 10000;
+   Benchmark benchmark;
+   Real checksum{};
+
+   // A symmetric bilinear form at each vertex, e.g. a second fundamental form evaluated along a tangent.
+   StaticTensor<Real, 3, 3, 3> form;
+   StaticTensor<Real, 3, 3> frame;
+   StaticTensor<Real, 3> tangent;
+   Randomise(form);
+   Randomise(frame);
+   Randomise(tangent);
+
+   benchmark.StartTimer("Unrolled ijk,j,k");
+   FOR(vertex, n_vertices)
+   {
+      tangent.Data()[vertex % 3] += 1.0E-9;
+      checksum += Contract<"ijk,j,k->i">(form, tangent, tangent)(0);
+   }
+   benchmark.StopTimer("Unrolled ijk,j,k");
+
+   benchmark.StartTimer("Loops ijk,j,k");
+   FOR(vertex, n_vertices)
+   {
+      tangent.Data()[vertex % 3] += 1.0E-9;
+      StaticTensor<Real, 3> result;
+      std::fill(result.begin(), result.end(), Zero);
+      FOR(k, 3) FOR(j, 3) FOR(i, 3) result(i) += form(i, j, k) * tangent(j) * tangent(k);
+      checksum += result(0);
+   }
+   benchmark.StopTimer("Loops ijk,j,k");
+
+   // Run-time subscripts plan and allocate on every call, so are timed over a hundredth of the vertices.
+   benchmark.StartTimer("Run-time ijk,j,k");
+   FOR(vertex, n_dynamic)
+   {
+      tangent.Data()[vertex % 3] += 1.0E-9;
+      checksum += Contract("ijk,j,k->i", form, tangent, tangent).Data()[0];
+   }
+   benchmark.StopTimer("Run-time ijk,j,k");
+
+   // A change of frame at each vertex, and an offset broadcast over its columns.
+   benchmark.StartTimer("Unrolled ij,jk,lk");
+   FOR(vertex, n_vertices)
+   {
+      frame.Data()[vertex % 9] += 1.0E-9;
+      checksum += Contract<"ij,jk,lk->il">(frame, frame, frame)(2, 2);
+   }
+   benchmark.StopTimer("Unrolled ij,jk,lk");
+
+   benchmark.StartTimer("Loops ij,jk,lk");
+   FOR(vertex, n_vertices)
+   {
+      frame.Data()[vertex % 9] += 1.0E-9;
+      StaticTensor<Real, 3, 3> result;
+      std::fill(result.begin(), result.end(), Zero);
+      FOR(l, 3) FOR(k, 3) FOR(j, 3) FOR(i, 3) result(i, l) += frame(i, j) * frame(j, k) * frame(l, k);
+      checksum += result(2, 2);
+   }
+   benchmark.StopTimer("Loops ij,jk,lk");
+
+   benchmark.StartTimer("Unrolled broadcast");
+   FOR(vertex, n_vertices)
+   {
+      tangent.Data()[vertex % 3] += 1.0E-9;
+      checksum += Broadcast(frame, tangent, std::plus<Real>())(1, 2);
+   }
+   benchmark.StopTimer("Unrolled broadcast");
+
+   benchmark.StartTimer("Loops broadcast");
+   FOR(vertex, n_vertices)
+   {
+      tangent.Data()[vertex % 3] += 1.0E-9;
+      StaticTensor<Real, 3, 3> result;
+      FOR(j, 3) FOR(i, 3) result(i, j) = frame(i, j) + tangent(j);
+      checksum += result(1, 2);
+   }
+   benchmark.StopTimer("Loops broadcast");
+
+   Print("Checksum:", checksum);
+   benchmark.PrintResults();
+}
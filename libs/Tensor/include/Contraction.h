@@ -0,0 +1,138 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+#include "../../../include/Global.h"
+#include "../../LinearAlgebra/include/MatrixOperations.h"
+#include "Tensor.h"
+#include "TensorOperations.h"
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace aprn {
+
+/***************************************************************************************************************************************************************
+* Contraction Subscripts
+***************************************************************************************************************************************************************/
+
+/** Bounds on the number of tensors in a contraction, and on the number of distinct index labels, which are the letters a-z and A-Z. */
+constexpr size_t MaxContractionOperands = 8;
+constexpr size_t MaxIndexLabels = 52;
+
+/** Index labels of a tensor, one per dimension, and the set of labels as a bit mask. */
+struct IndexLabels
+{
+   std::array<char, MaxIndexLabels> Labels{};
+   size_t                           Rank{};
+   std::uint64_t                    Mask{};
+
+   constexpr void Append(const char label);
+
+   /** Position of the first dimension with the label, or the rank if there is none. */
+   constexpr size_t Find(const char label) const;
+};
+
+/** Einsum subscripts, e.g. "ij,jk->ik" for a matrix product. Labels repeated within a tensor take its diagonal, and labels missing from the output are summed
+ *  over. Without an explicit output, the output labels are those appearing exactly once, in alphabetical order. */
+struct ContractionSubscripts
+{
+   std::array<IndexLabels, MaxContractionOperands> Inputs{};
+   IndexLabels                                     Output;
+   size_t                                          nInputs{};
+};
+
+constexpr ContractionSubscripts ParseSubscripts(const std::string_view subscripts);
+
+/** Subscripts passed as a template argument, e.g. Contract<"ij,jk->ik">(a, b), which are parsed and checked at compile time. */
+template<size_t N>
+struct SubscriptString
+{
+   constexpr SubscriptString(const char (&subscripts)[N]) { std::copy_n(subscripts, N, Value); }
+
+   constexpr std::string_view View() const { return {Value, N - 1}; }
+
+   char Value[N]{};
+};
+
+/***************************************************************************************************************************************************************
+* Contraction Path
+***************************************************************************************************************************************************************/
+
+/** Sizes of the labelled dimensions, indexed by LabelIndex, or zero for unused labels. */
+using LabelDimensions = std::array<size_t, MaxIndexLabels>;
+
+/** Position of a label in a LabelDimensions array and in an IndexLabels mask. */
+constexpr size_t LabelIndex(const char label);
+
+/** Record the dimensions of a tensor with the given labels, checking its rank and that equally labelled dimensions have equal sizes. */
+constexpr void AddLabelDimensions(const IndexLabels& labels, const std::span<const size_t> dimensions, LabelDimensions& label_dimensions);
+
+/** Order of pairwise contractions. Each step contracts two tensors of the current list, removes them, and appends the result to the end of the list, as in
+ *  numpy's einsum_path. The cost is the total number of multiply-adds. */
+struct ContractionPath
+{
+   std::array<std::array<size_t, 2>, MaxContractionOperands> Steps{};
+   size_t                                                    nSteps{};
+   Real                                                      Cost{};
+};
+
+/** Contraction order with the fewest multiply-adds, found by dynamic programming over the subsets of the tensors. */
+constexpr ContractionPath PlanContraction(const ContractionSubscripts& subscripts, const LabelDimensions& dimensions);
+
+/***************************************************************************************************************************************************************
+* Static Contraction Shapes
+***************************************************************************************************************************************************************/
+namespace detail {
+
+template<class... S>
+constexpr bool isContractible(const ContractionSubscripts& subscripts);
+
+template<size_t rank, class... S>
+constexpr std::array<size_t, rank> ContractionDimensions(const ContractionSubscripts& subscripts);
+
+}//detail
+
+/** Static shapes compatible with einsum subscripts: one shape per labelled tensor, each of the labelled rank, with equal sizes for equally labelled dimensions. */
+template<SubscriptString subscripts, class... S>
+concept ContractibleShapes = detail::isContractible<S...>(ParseSubscripts(subscripts.View()));
+
+/** Shape of the contraction of static shapes, which has a single entry for full contractions. */
+template<SubscriptString subscripts, class... S>
+requires ContractibleShapes<subscripts, S...>
+using ContractionShape = ShapeFromArray<detail::ContractionDimensions<Max(ParseSubscripts(subscripts.View()).Output.Rank, size_t{1}), S...>(
+                                        ParseSubscripts(subscripts.View()))>;
+
+/***************************************************************************************************************************************************************
+* Tensor Contraction
+***************************************************************************************************************************************************************/
+
+/** Contract tensors according to einsum subscripts, e.g. Contract("bij,bjk->bik", a, b) for batched matrix products. Each pairwise contraction is lowered to
+ *  matrix products over strided views of the tensors, which are only packed into a new layout where their dimensions cannot be merged into single strides.
+ *  Full contractions give a tensor with a single entry. */
+template<typename T, class... D>
+DynamicTensor<T> Contract(const std::string_view subscripts, const Tensor<T, D>&... tensors);
+
+/** Contract tensors with compile-time subscripts. Static tensors give a static tensor, or a scalar for full contractions, whose shape is checked and determined
+ *  at compile time. Contractions of at most MaxUnrolledTensorSize terms are unrolled into straight-line multiply-adds, e.g. for per-vertex computations, and
+ *  can be evaluated at compile time; larger ones follow a contraction path planned at compile time. */
+template<SubscriptString subscripts, typename T, class... D>
+constexpr auto Contract(const Tensor<T, D>&... tensors);
+
+}
+
+#include "Contraction.tpp"
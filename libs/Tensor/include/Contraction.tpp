@@ -0,0 +1,667 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+namespace aprn {
+
+/***************************************************************************************************************************************************************
+* Contraction Subscripts
+***************************************************************************************************************************************************************/
+constexpr size_t
+LabelIndex(const char label)
+{
+   ASSERT(('a' <= label && label <= 'z') || ('A' <= label && label <= 'Z'), "The index label '", label, "' must be a letter.")
+   return label >= 'a' ? static_cast<size_t>(label - 'a') : static_cast<size_t>(label - 'A') + 26;
+}
+
+constexpr void
+IndexLabels::Append(const char label)
+{
+   ASSERT(Rank < MaxIndexLabels, "A tensor can have at most ", MaxIndexLabels, " dimensions.")
+   Labels[Rank++] = label;
+   Mask |= std::uint64_t{1} << LabelIndex(label);
+}
+
+constexpr size_t
+IndexLabels::Find(const char label) const
+{
+   FOR(i, Rank) if(Labels[i] == label) return i;
+   return Rank;
+}
+
+constexpr ContractionSubscripts
+ParseSubscripts(const std::string_view subscripts)
+{
+   ContractionSubscripts parsed;
+   const size_t arrow = subscripts.find("->");
+   const std::string_view inputs = subscripts.substr(0, arrow);
+
+   parsed.nInputs = 1;
+   FOR_EACH_CONST(c, inputs)
+   {
+      if(c == ' ') continue;
+      if(c == ',')
+      {
+         ASSERT(parsed.nInputs < MaxContractionOperands, "A contraction can have at most ", MaxContractionOperands, " tensors.")
+         ++parsed.nInputs;
+      }
+      else parsed.Inputs[parsed.nInputs - 1].Append(c);
+   }
+
+   if(arrow != std::string_view::npos)
+   {
+      std::uint64_t input_labels{};
+      FOR(i, parsed.nInputs) input_labels |= parsed.Inputs[i].Mask;
+      FOR_EACH_CONST(c, subscripts.substr(arrow + 2))
+      {
+         if(c == ' ') continue;
+         ASSERT(!parsed.Output.Mask || parsed.Output.Find(c) == parsed.Output.Rank, "The output label '", c, "' is repeated.")
+         ASSERT(input_labels >> LabelIndex(c) & 1, "The output label '", c, "' does not label any input.")
+         parsed.Output.Append(c);
+      }
+   }
+   else
+   {
+      // Implicit output of the labels appearing exactly once, in alphabetical order, with upper case first.
+      for(const char first : {'A', 'a'})
+      {
+         FOR(offset, 26)
+         {
+            const char label = static_cast<char>(first + offset);
+            size_t count{};
+            FOR(i, parsed.nInputs) FOR(j, parsed.Inputs[i].Rank) count += parsed.Inputs[i].Labels[j] == label;
+            if(count == 1) parsed.Output.Append(label);
+         }
+      }
+   }
+   return parsed;
+}
+
+/***************************************************************************************************************************************************************
+* Contraction Path
+***************************************************************************************************************************************************************/
+constexpr void
+AddLabelDimensions(const IndexLabels& labels, const std::span<const size_t> dimensions, LabelDimensions& label_dimensions)
+{
+   ASSERT(labels.Rank == dimensions.size(), "The tensor rank ", dimensions.size(), " does not match its ", labels.Rank, " subscript labels.")
+   FOR(i, labels.Rank)
+   {
+      size_t& dimension = label_dimensions[LabelIndex(labels.Labels[i])];
+      ASSERT(!dimension || dimension == dimensions[i], "The dimensions labelled '", labels.Labels[i], "' have different sizes ", dimension, " and ",
+             dimensions[i], ".")
+      dimension = dimensions[i];
+   }
+}
+
+namespace detail {
+
+/** Number of entries spanned by a set of labels. */
+constexpr Real
+LabelSetSize(std::uint64_t mask, const LabelDimensions& dimensions)
+{
+   Real size{1};
+   for(; mask; mask &= mask - 1) size *= static_cast<Real>(dimensions[std::countr_zero(mask)]);
+   return size;
+}
+
+/** Append the contractions of a subset of the tensors to a path, given the optimal split of every subset, in post-order. The operand list holds the subset
+ *  of the original tensors contained in each current operand. */
+constexpr void
+AppendContractionSteps(const std::array<size_t, 1 << MaxContractionOperands>& splits, const size_t subset,
+                       std::array<size_t, MaxContractionOperands>& operands, size_t& n_operands, ContractionPath& path)
+{
+   if(std::popcount(subset) == 1) return;
+
+   const size_t first  = splits[subset];
+   const size_t second = subset ^ first;
+   AppendContractionSteps(splits, first, operands, n_operands, path);
+   AppendContractionSteps(splits, second, operands, n_operands, path);
+
+   const auto position = [&](const size_t s){ size_t i{}; while(operands[i] != s) ++i; return i; };
+   const size_t i = position(first);
+   const size_t j = position(second);
+   path.Steps[path.nSteps++] = {i, j};
+
+   // Remove both operands, preserving the order of the rest, and append their contraction.
+   size_t n{};
+   FOR(k, n_operands) if(k != i && k != j) operands[n++] = operands[k];
+   operands[n++] = subset;
+   n_operands = n;
+}
+
+}
+
+constexpr ContractionPath
+PlanContraction(const ContractionSubscripts& subscripts, const LabelDimensions& dimensions)
+{
+   const size_t n = subscripts.nInputs;
+   const size_t all = (size_t{1} << n) - 1;
+
+   // Labels of each subset of the tensors, and those kept after contracting the subset, which appear in other tensors or in the output.
+   std::array<std::uint64_t, 1 << MaxContractionOperands> labels{}, kept{};
+   std::array<Real, 1 << MaxContractionOperands> costs{};
+   std::array<size_t, 1 << MaxContractionOperands> splits{};
+   FOR(subset, 1, all + 1) FOR(i, n) if(subset >> i & 1) labels[subset] |= subscripts.Inputs[i].Mask;
+   FOR(subset, 1, all + 1) kept[subset] = labels[subset] & (labels[all ^ subset] | subscripts.Output.Mask);
+
+   // Subsets are visited after all of their proper subsets, each split into two with the first holding its lowest tensor to visit every split once.
+   FOR(subset, 1, all + 1)
+   {
+      if(std::popcount(subset) == 1) continue;
+      costs[subset] = InfFloat<Real>;
+      const size_t lowest = subset & (~subset + 1);
+      for(size_t first = (subset - 1) & subset; first; first = (first - 1) & subset)
+      {
+         if(!(first & lowest)) continue;
+         const size_t second = subset ^ first;
+         const Real cost = costs[first] + costs[second] + detail::LabelSetSize(kept[first] | kept[second], dimensions);
+         if(cost < costs[subset])
+         {
+            costs[subset]  = cost;
+            splits[subset] = first;
+         }
+      }
+   }
+
+   ContractionPath path;
+   path.Cost = costs[all];
+   std::array<size_t, MaxContractionOperands> operands{};
+   FOR(i, n) operands[i] = size_t{1} << i;
+   size_t n_operands = n;
+   detail::AppendContractionSteps(splits, all, operands, n_operands, path);
+   return path;
+}
+
+/***************************************************************************************************************************************************************
+* Contraction Operands
+***************************************************************************************************************************************************************/
+namespace detail {
+
+/** Strided tensor taking part in a contraction, with distinct labels. */
+template<typename T>
+struct ContractionOperand
+{
+   T*                                 Data{};
+   IndexLabels                        Labels;
+   std::array<size_t, MaxIndexLabels> Strides{};
+
+   /** Stride of the dimension with a label, or zero if there is none, which broadcasts the operand along it. */
+   constexpr size_t Stride(const char label) const
+   {
+      const size_t i = Labels.Find(label);
+      return i < Labels.Rank ? Strides[i] : 0;
+   }
+
+   operator ContractionOperand<const T>() const { return {Data, Labels, Strides}; }
+};
+
+/** Column-major tensor entries with the given labels. Repeated labels are merged into one dimension, whose stride is their sum, viewing the diagonal. */
+template<typename T>
+ContractionOperand<T>
+MakeOperand(T* data, const IndexLabels& labels, const LabelDimensions& dimensions)
+{
+   ContractionOperand<T> operand;
+   operand.Data = data;
+   size_t stride{1};
+   FOR(i, labels.Rank)
+   {
+      const char label = labels.Labels[i];
+      const size_t j = operand.Labels.Find(label);
+      if(j == operand.Labels.Rank)
+      {
+         operand.Labels.Append(label);
+         operand.Strides[j] = stride;
+      }
+      else operand.Strides[j] += stride;
+      stride *= dimensions[LabelIndex(label)];
+   }
+   return operand;
+}
+
+/** New zeroed column-major tensor with the given labels, owned by a list of buffers. */
+template<typename T>
+ContractionOperand<T>
+AllocateOperand(const IndexLabels& labels, const LabelDimensions& dimensions, DynamicArray<DynamicArray<T>>& buffers)
+{
+   size_t size{1};
+   FOR(i, labels.Rank) size *= dimensions[LabelIndex(labels.Labels[i])];
+   buffers.emplace_back(size, T{});
+   return MakeOperand(buffers.back().data(), labels, dimensions);
+}
+
+/** Visit every multi-index over the labelled dimensions, passing the offsets of the corresponding entries of two operands, with the first label varying
+ *  fastest. */
+template<typename T0, typename T1, class F>
+void
+ForEachOffset(const IndexLabels& labels, const LabelDimensions& dimensions, const ContractionOperand<T0>& operand0, const ContractionOperand<T1>& operand1,
+              F&& function)
+{
+   std::array<size_t, MaxIndexLabels> extents{}, strides0{}, strides1{}, index{};
+   FOR(d, labels.Rank)
+   {
+      extents[d]  = dimensions[LabelIndex(labels.Labels[d])];
+      strides0[d] = operand0.Stride(labels.Labels[d]);
+      strides1[d] = operand1.Stride(labels.Labels[d]);
+      if(!extents[d]) return;
+   }
+   if(!labels.Rank)
+   {
+      function(size_t{}, size_t{});
+      return;
+   }
+
+   size_t offset0{}, offset1{};
+   while(true)
+   {
+      FOR(i, extents[0]) function(offset0 + i * strides0[0], offset1 + i * strides1[0]);
+
+      size_t d = 1;
+      for(; d < labels.Rank; ++d)
+      {
+         offset0 += strides0[d];
+         offset1 += strides1[d];
+         if(++index[d] < extents[d]) break;
+         offset0 -= extents[d] * strides0[d];
+         offset1 -= extents[d] * strides1[d];
+         index[d] = 0;
+      }
+      if(d == labels.Rank) return;
+   }
+}
+
+/** Copy the entries of an operand into another with the same labels in a different layout. */
+template<typename T>
+void
+PermuteOperand(const ContractionOperand<const T>& from, const ContractionOperand<T>& to, const LabelDimensions& dimensions)
+{
+   ForEachOffset(to.Labels, dimensions, from, to, [&](const size_t i, const size_t j){ to.Data[j] = from.Data[i]; });
+}
+
+/** Sum an operand over its labels outside a kept set, unless all of its labels are kept. */
+template<typename T>
+ContractionOperand<const T>
+ReduceOperand(const ContractionOperand<const T>& operand, const std::uint64_t kept, const LabelDimensions& dimensions,
+              DynamicArray<DynamicArray<T>>& buffers)
+{
+   if(!(operand.Labels.Mask & ~kept)) return operand;
+
+   IndexLabels labels;
+   FOR(i, operand.Labels.Rank) if(kept >> LabelIndex(operand.Labels.Labels[i]) & 1) labels.Append(operand.Labels.Labels[i]);
+   const auto reduced = AllocateOperand(labels, dimensions, buffers);
+   ForEachOffset(operand.Labels, dimensions, operand, reduced, [&](const size_t i, const size_t j){ reduced.Data[j] += operand.Data[i]; });
+   return reduced;
+}
+
+/***************************************************************************************************************************************************************
+* Pairwise Contraction
+***************************************************************************************************************************************************************/
+
+/** Labels of a pairwise contraction sharing a role, in the order in which they are merged into a single matrix dimension. */
+struct LabelGroup
+{
+   IndexLabels Labels;
+   size_t      Extent{1};
+
+   void Append(const char label, const LabelDimensions& dimensions)
+   {
+      Labels.Append(label);
+      Extent *= dimensions[LabelIndex(label)];
+   }
+
+   /** Whether the labelled dimensions of an operand are nested in order, so that they can be traversed with a single stride. */
+   template<typename T>
+   bool isMergeable(const ContractionOperand<T>& operand, const LabelDimensions& dimensions) const
+   {
+      FOR(i, 1, Labels.Rank)
+         if(operand.Stride(Labels.Labels[i]) != operand.Stride(Labels.Labels[i - 1]) * dimensions[LabelIndex(Labels.Labels[i - 1])]) return false;
+      return true;
+   }
+
+   template<typename T>
+   size_t Stride(const ContractionOperand<T>& operand) const { return Labels.Rank ? operand.Stride(Labels.Labels[0]) : 1; }
+};
+
+/** Labels of an operand in a mask, ordered by increasing stride, skipping unit dimensions which do not affect the layout. */
+template<typename T>
+LabelGroup
+MakeLabelGroup(const ContractionOperand<T>& operand, const std::uint64_t mask, const LabelDimensions& dimensions)
+{
+   std::array<char, MaxIndexLabels> labels{};
+   size_t n{};
+   FOR(i, operand.Labels.Rank)
+   {
+      const char label = operand.Labels.Labels[i];
+      if(!(mask >> LabelIndex(label) & 1) || dimensions[LabelIndex(label)] == 1) continue;
+      size_t j = n++;
+      for(; j > 0 && operand.Stride(labels[j - 1]) > operand.Strides[i]; --j) labels[j] = labels[j - 1];
+      labels[j] = label;
+   }
+   LabelGroup group;
+   FOR(i, n) group.Append(labels[i], dimensions);
+   return group;
+}
+
+/** Concatenated labels of several groups. */
+inline IndexLabels
+ConcatenateLabels(const std::initializer_list<const LabelGroup*> groups)
+{
+   IndexLabels labels;
+   FOR_EACH_CONST(group, groups) FOR(i, group->Labels.Rank) labels.Append(group->Labels.Labels[i]);
+   return labels;
+}
+
+/** Contract two operands into a result with the given labels, which may be a preallocated output. The labels are split into batch labels, shared by all
+ *  three, row and column labels, in the result and one operand, and contracted labels, in both operands only. Each batch is then a matrix product, whose
+ *  operands are strided views of the tensors when each group of labels can be merged into a single stride. Otherwise, the operands are packed, or the result
+ *  is computed in a temporary, with the groups in order. */
+template<typename T>
+ContractionOperand<T>
+ContractPair(ContractionOperand<const T> a, ContractionOperand<const T> b, const std::uint64_t result_labels, const ContractionOperand<T>* output,
+             const LabelDimensions& dimensions, DynamicArray<DynamicArray<T>>& buffers)
+{
+   const std::uint64_t a_labels = a.Labels.Mask;
+   const std::uint64_t b_labels = b.Labels.Mask;
+   const LabelGroup rows       = MakeLabelGroup(a, a_labels & ~b_labels & result_labels, dimensions);
+   const LabelGroup contracted = MakeLabelGroup(a, a_labels & b_labels & ~result_labels, dimensions);
+   const LabelGroup batches    = MakeLabelGroup(a, a_labels & b_labels & result_labels, dimensions);
+   const LabelGroup columns    = MakeLabelGroup(b, b_labels & ~a_labels & result_labels, dimensions);
+
+   if(!rows.isMergeable(a, dimensions) || !contracted.isMergeable(a, dimensions))
+   {
+      const auto packed = AllocateOperand(ConcatenateLabels({&rows, &contracted, &batches}), dimensions, buffers);
+      PermuteOperand(a, packed, dimensions);
+      a = packed;
+   }
+   if(!contracted.isMergeable(b, dimensions) || !columns.isMergeable(b, dimensions))
+   {
+      const auto packed = AllocateOperand(ConcatenateLabels({&contracted, &columns, &batches}), dimensions, buffers);
+      PermuteOperand(b, packed, dimensions);
+      b = packed;
+   }
+
+   const bool direct = output && rows.isMergeable(*output, dimensions) && columns.isMergeable(*output, dimensions);
+   const auto c = direct ? *output : AllocateOperand(ConcatenateLabels({&rows, &columns, &batches}), dimensions, buffers);
+
+   const size_t m = rows.Extent;
+   const size_t k = contracted.Extent;
+   const size_t n = columns.Extent;
+   const StaticArray<size_t, 2> a_strides{rows.Stride(a), contracted.Stride(a)};
+   const StaticArray<size_t, 2> b_strides{contracted.Stride(b), columns.Stride(b)};
+   const StaticArray<size_t, 2> c_strides{rows.Stride(c), columns.Stride(c)};
+
+   const auto multiply = [&](const size_t batch)
+   {
+      size_t a_offset{}, b_offset{}, c_offset{}, index = batch;
+      FOR(d, batches.Labels.Rank)
+      {
+         const char label = batches.Labels.Labels[d];
+         const size_t extent = dimensions[LabelIndex(label)];
+         const size_t i = index % extent;
+         index /= extent;
+         a_offset += i * a.Stride(label);
+         b_offset += i * b.Stride(label);
+         c_offset += i * c.Stride(label);
+      }
+      Gemm(T{1}, MultiArrayView<const T, 2>(a.Data + a_offset, {m, k}, a_strides), MultiArrayView<const T, 2>(b.Data + b_offset, {k, n}, b_strides), T{},
+           MultiArrayView<T, 2>(c.Data + c_offset, {m, n}, c_strides));
+   };
+
+   // Batches are split between threads when there are enough of them, or when they are too small for the blocked matrix product, which is otherwise
+   // parallelised itself.
+   if(batches.Extent < nThreads() && m * n * k >= GemmBlockedThreshold) FOR(batch, batches.Extent) multiply(batch);
+   else ParallelFor(batches.Extent, multiply, m * n * k);
+
+   if(output && !direct) PermuteOperand(ContractionOperand<const T>(c), *output, dimensions);
+   return output ? *output : c;
+}
+
+/** Contract tensors with column-major entries along a given path, writing to column-major output entries. */
+template<typename T>
+void
+ExecuteContraction(const ContractionSubscripts& subscripts, const ContractionPath& path, const LabelDimensions& dimensions,
+                   const std::array<const T*, MaxContractionOperands>& inputs, T* output)
+{
+   DynamicArray<DynamicArray<T>> buffers;
+   std::array<ContractionOperand<const T>, MaxContractionOperands> operands;
+   const size_t n = subscripts.nInputs;
+
+   // Each input is first summed over the labels appearing nowhere else.
+   FOR(i, n)
+   {
+      std::uint64_t others = subscripts.Output.Mask;
+      FOR(j, n) if(j != i) others |= subscripts.Inputs[j].Mask;
+      operands[i] = ReduceOperand(MakeOperand(inputs[i], subscripts.Inputs[i], dimensions), others, dimensions, buffers);
+   }
+   const auto result = MakeOperand(output, subscripts.Output, dimensions);
+   if(!path.nSteps)
+   {
+      PermuteOperand(operands[0], result, dimensions);
+      return;
+   }
+
+   size_t n_operands = n;
+   FOR(step, path.nSteps)
+   {
+      const auto [i, j] = path.Steps[step];
+      const auto a = operands[i];
+      const auto b = operands[j];
+      size_t m{};
+      FOR(k, n_operands) if(k != i && k != j) operands[m++] = operands[k];
+      n_operands = m;
+
+      std::uint64_t remaining = subscripts.Output.Mask;
+      FOR(k, n_operands) remaining |= operands[k].Labels.Mask;
+      const bool last = step + 1 == path.nSteps;
+      operands[n_operands++] = ContractPair(a, b, (a.Labels.Mask | b.Labels.Mask) & remaining, last ? &result : nullptr, dimensions, buffers);
+   }
+}
+
+/***************************************************************************************************************************************************************
+* Static Contraction Shapes
+***************************************************************************************************************************************************************/
+template<class... S>
+constexpr bool
+isContractible(const ContractionSubscripts& subscripts)
+{
+   if(subscripts.nInputs != sizeof...(S)) return false;
+
+   LabelDimensions dimensions{};
+   bool contractible{true};
+   size_t i{};
+   const auto add_dimensions = [&](const IndexLabels& labels, const auto& shape_dimensions)
+   {
+      if(labels.Rank != shape_dimensions.size()) contractible = false;
+      else FOR(d, labels.Rank)
+      {
+         size_t& dimension = dimensions[LabelIndex(labels.Labels[d])];
+         if(dimension && dimension != shape_dimensions[d]) contractible = false;
+         dimension = shape_dimensions[d];
+      }
+   };
+   (add_dimensions(subscripts.Inputs[i++], S::Dimensions), ...);
+   return contractible;
+}
+
+template<class... S>
+constexpr LabelDimensions
+StaticLabelDimensions(const ContractionSubscripts& subscripts)
+{
+   LabelDimensions dimensions{};
+   size_t i{};
+   (AddLabelDimensions(subscripts.Inputs[i++], S::Dimensions, dimensions), ...);
+   return dimensions;
+}
+
+template<size_t rank, class... S>
+constexpr std::array<size_t, rank>
+ContractionDimensions(const ContractionSubscripts& subscripts)
+{
+   const LabelDimensions dimensions = StaticLabelDimensions<S...>(subscripts);
+   std::array<size_t, rank> output{};
+   output.fill(1);
+   FOR(d, subscripts.Output.Rank) output[d] = dimensions[LabelIndex(subscripts.Output.Labels[d])];
+   return output;
+}
+
+/***************************************************************************************************************************************************************
+* Unrolled Static Contraction
+***************************************************************************************************************************************************************/
+
+/** Term of a contraction summed over every label, with the offsets of its input entries and of the output entry it is added to, or assigned to if it is the
+ *  first term of the entry, so that the output needs no initialisation. */
+struct ContractionTerm
+{
+   std::array<size_t, MaxContractionOperands> Offsets{};
+   size_t                                     OutputOffset{};
+   bool                                       isFirst{};
+};
+
+/** Number of terms, which is the product of the dimensions of all labels. */
+constexpr size_t
+ContractionTermCount(const ContractionSubscripts& subscripts, const LabelDimensions& dimensions)
+{
+   std::uint64_t mask{};
+   FOR(i, subscripts.nInputs) mask |= subscripts.Inputs[i].Mask;
+   size_t count{1};
+   for(; mask; mask &= mask - 1) count *= dimensions[std::countr_zero(mask)];
+   return count;
+}
+
+constexpr size_t
+LabelledOffset(const IndexLabels& labels, const LabelDimensions& indices, const LabelDimensions& dimensions)
+{
+   size_t offset{};
+   size_t stride{1};
+   FOR(d, labels.Rank)
+   {
+      const size_t label = LabelIndex(labels.Labels[d]);
+      offset += indices[label] * stride;
+      stride *= dimensions[label];
+   }
+   return offset;
+}
+
+/** Terms of a contraction, enumerating the values of the labels as an odometer. */
+template<size_t n_terms>
+constexpr std::array<ContractionTerm, n_terms>
+ContractionTerms(const ContractionSubscripts& subscripts, const LabelDimensions& dimensions)
+{
+   std::array<ContractionTerm, n_terms> terms{};
+   std::array<bool, n_terms> is_assigned{};
+   LabelDimensions indices{};
+   FOR(t, n_terms)
+   {
+      FOR(i, subscripts.nInputs) terms[t].Offsets[i] = LabelledOffset(subscripts.Inputs[i], indices, dimensions);
+      terms[t].OutputOffset = LabelledOffset(subscripts.Output, indices, dimensions);
+      terms[t].isFirst = !is_assigned[terms[t].OutputOffset];
+      is_assigned[terms[t].OutputOffset] = true;
+
+      FOR(label, MaxIndexLabels)
+      {
+         if(!dimensions[label]) continue;
+         if(++indices[label] < dimensions[label]) break;
+         indices[label] = 0;
+      }
+   }
+   return terms;
+}
+
+template<auto term, typename T, size_t... is>
+constexpr void
+AddContractionTerm(const std::array<const T*, sizeof...(is)>& inputs, T* output, std::index_sequence<is...>)
+{
+   const T product = (inputs[is][term.Offsets[is]] * ...);
+   if constexpr(term.isFirst) output[term.OutputOffset] = product;
+   else                       output[term.OutputOffset] += product;
+}
+
+template<auto terms, typename T, size_t... is, size_t... ts>
+constexpr void
+UnrolledContraction(const std::array<const T*, sizeof...(is)>& inputs, T* output, std::index_sequence<is...> operands, std::index_sequence<ts...>)
+{
+   (AddContractionTerm<terms[ts]>(inputs, output, operands), ...);
+}
+
+/** Contraction of tensors of run-time dimensions, with parsed subscripts. */
+template<typename T, class... D>
+DynamicTensor<T>
+ContractDynamic(const ContractionSubscripts& subscripts, const Tensor<T, D>&... tensors)
+{
+   ASSERT(subscripts.nInputs == sizeof...(D), "The subscripts label ", subscripts.nInputs, " tensors, but ", sizeof...(D), " were given.")
+
+   LabelDimensions dimensions{};
+   size_t i{};
+   const auto add_dimensions = [&](const auto& tensor)
+   {
+      DynamicArray<size_t> tensor_dimensions(tensor.Rank());
+      FOR(d, tensor.Rank()) tensor_dimensions[d] = tensor.Dimension(d);
+      AddLabelDimensions(subscripts.Inputs[i++], tensor_dimensions, dimensions);
+   };
+   (add_dimensions(tensors), ...);
+
+   DynamicArray<size_t> output_dimensions(Max(subscripts.Output.Rank, size_t{1}), 1);
+   FOR(d, subscripts.Output.Rank) output_dimensions[d] = dimensions[LabelIndex(subscripts.Output.Labels[d])];
+   DynamicTensor<T> result(output_dimensions);
+   ExecuteContraction(subscripts, PlanContraction(subscripts, dimensions), dimensions, {tensors.Data()...}, result.Data());
+   return result;
+}
+
+}//detail
+
+/***************************************************************************************************************************************************************
+* Tensor Contraction
+***************************************************************************************************************************************************************/
+template<typename T, class... D>
+DynamicTensor<T>
+Contract(const std::string_view subscripts, const Tensor<T, D>&... tensors) { return detail::ContractDynamic(ParseSubscripts(subscripts), tensors...); }
+
+template<SubscriptString subscripts, typename T, class... D>
+constexpr auto
+Contract(const Tensor<T, D>&... tensors)
+{
+   constexpr ContractionSubscripts parsed = ParseSubscripts(subscripts.View());
+   static_assert(parsed.nInputs == sizeof...(D), "The number of tensors must match the subscripts.");
+
+   if constexpr((StaticShaped<D> && ...))
+   {
+      static_assert(ContractibleShapes<subscripts, ShapeOf<D>...>, "The tensor shapes must match the subscripts.");
+      constexpr LabelDimensions dimensions = detail::StaticLabelDimensions<ShapeOf<D>...>(parsed);
+      constexpr size_t n_terms = detail::ContractionTermCount(parsed, dimensions);
+      constexpr size_t rank = parsed.Output.Rank;
+
+      std::conditional_t<rank == 0, T, typename ContractionShape<subscripts, ShapeOf<D>...>::template TensorType<T>> result{};
+      T* output{};
+      if constexpr(rank == 0) output = &result;
+      else                    output = result.Data();
+
+      const std::array<const T*, sizeof...(D)> inputs{tensors.Data()...};
+      if constexpr(0 < n_terms && n_terms <= MaxUnrolledTensorSize)
+      {
+         constexpr auto terms = detail::ContractionTerms<n_terms>(parsed, dimensions);
+         detail::UnrolledContraction<terms>(inputs, output, std::make_index_sequence<sizeof...(D)>{}, std::make_index_sequence<n_terms>{});
+      }
+      else
+      {
+         constexpr ContractionPath path = PlanContraction(parsed, dimensions);
+         std::array<const T*, MaxContractionOperands> operands{};
+         std::copy(inputs.begin(), inputs.end(), operands.begin());
+         detail::ExecuteContraction(parsed, path, dimensions, operands, output);
+      }
+      return result;
+   }
+   else return detail::ContractDynamic(parsed, tensors...);
+}
+
+}
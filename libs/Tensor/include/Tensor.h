@@ -24,7 +24,7 @@ namespace aprn{
 * Tensor Abstract Base Class
 ***************************************************************************************************************************************************************/
 template<typename T, class D>
-class Tensor : public detail::NumericContainer<T, Tensor<T, D>>
+class Tensor : public detail::NumericContainer<T, D>
 {
 protected:
   constexpr Tensor();
@@ -38,6 +38,8 @@ public:
   operator()(const std::convertible_to<size_t> auto... multi_index) const;
 
   /** Assignment operator overloads. */
+  using detail::NumericContainer<T, D>::operator=;
+
   constexpr D&
   operator=(const std::initializer_list<T>& _value_array) noexcept;
 
@@ -57,6 +59,24 @@ public:
   constexpr const auto
   end() const { return Derived().Entries.end(); }
 
+  /** Number of entries. */
+  constexpr size_t
+  size() const { return Derived().Entries.size(); }
+
+  /** Number of dimensions, and size along a given dimension. */
+  constexpr size_t
+  Rank() const { return Derived().Entries.nDimensions(); }
+
+  constexpr size_t
+  Dimension(const size_t dim) const { return Derived().Entries.Dimension(dim); }
+
+  /** Entries in column-major order. */
+  constexpr T*
+  Data() { return Derived().Entries.Data(); }
+
+  constexpr const T*
+  Data() const { return Derived().Entries.Data(); }
+
 private:
   std::pair<size_t, size_t> Type;
 
@@ -77,7 +97,9 @@ class StaticTensor : public Tensor<T, StaticTensor<T, dims...>>
   friend Tensor<T, StaticTensor<T, dims...>>;
 
 public:
-  StaticTensor();
+  constexpr StaticTensor();
+
+  using Tensor<T, StaticTensor<T, dims...>>::operator=;
 
 private:
   StaticMultiArray<T, dims...> Entries;
@@ -96,6 +118,10 @@ public:
 
   DynamicTensor(const std::convertible_to<size_t> auto... _dimensions);
 
+  explicit DynamicTensor(const DynamicArray<size_t>& _dimensions);
+
+  using Tensor<T, DynamicTensor<T>>::operator=;
+
   inline void Resize(const std::convertible_to<size_t> auto... _dimensions) { Entries.Resize(_dimensions...); }
 
 private:
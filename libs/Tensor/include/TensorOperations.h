@@ -0,0 +1,119 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+#include "../../../include/Global.h"
+#include "Tensor.h"
+
+#include <array>
+#include <utility>
+
+namespace aprn {
+namespace detail {
+
+template<size_t rank>
+constexpr std::array<size_t, rank> ColumnMajorStrides(const std::array<size_t, rank>& dimensions);
+
+template<size_t rank0, size_t rank1>
+constexpr bool isBroadcastable(const std::array<size_t, rank0>& dimensions0, const std::array<size_t, rank1>& dimensions1);
+
+template<size_t rank0, size_t rank1>
+constexpr std::array<size_t, Max(rank0, rank1)> BroadcastDimensions(const std::array<size_t, rank0>& dimensions0, const std::array<size_t, rank1>& dimensions1);
+
+template<auto dimensions, class Sequence>
+struct ShapeFromArray;
+
+}//detail
+
+/***************************************************************************************************************************************************************
+* Static Tensor Shapes
+***************************************************************************************************************************************************************/
+
+/** Dimensions of a static tensor as a type, with its number of entries and the strides of its column-major layout, e.g. for checking shapes at compile time. */
+template<size_t... dims>
+struct TensorShape
+{
+   static constexpr size_t Rank = sizeof...(dims);
+   static constexpr size_t Size = (dims * ... * 1);
+   static constexpr std::array<size_t, Rank> Dimensions{dims...};
+   static constexpr std::array<size_t, Rank> Strides = detail::ColumnMajorStrides(Dimensions);
+
+   template<typename T>
+   using TensorType = StaticTensor<T, dims...>;
+};
+
+template<class D>
+struct TensorShapeOf;
+
+template<typename T, size_t... dims>
+struct TensorShapeOf<StaticTensor<T, dims...>>
+{
+   using Type = TensorShape<dims...>;
+};
+
+/** Tensors whose dimensions are known at compile time, and their shape. */
+template<class D>
+concept StaticShaped = requires { typename TensorShapeOf<D>::Type; };
+
+template<class D>
+using ShapeOf = typename TensorShapeOf<D>::Type;
+
+/** Shape with dimensions given by a constexpr array. */
+template<auto dimensions>
+using ShapeFromArray = typename detail::ShapeFromArray<dimensions, std::make_index_sequence<dimensions.size()>>::Type;
+
+/***************************************************************************************************************************************************************
+* Static Shape Algebra
+***************************************************************************************************************************************************************/
+
+/** Shapes compatible under broadcasting, as in numpy: aligned at their last dimensions, each pair of dimensions is equal or one of them is 1, and the missing
+ *  leading dimensions of the lower-rank shape are taken as 1. */
+template<class S0, class S1>
+concept BroadcastableShapes = detail::isBroadcastable(S0::Dimensions, S1::Dimensions);
+
+/** Shape of two broadcast shapes, which has the higher rank, and the larger of each pair of aligned dimensions. */
+template<class S0, class S1>
+requires BroadcastableShapes<S0, S1>
+using BroadcastShape = ShapeFromArray<detail::BroadcastDimensions(S0::Dimensions, S1::Dimensions)>;
+
+/** Shapes with the same number of entries, so that a tensor of one can be reshaped to the other. */
+template<class S0, class S1>
+concept ReshapeableShapes = S0::Size == S1::Size;
+
+/***************************************************************************************************************************************************************
+* Unrolled Static Tensor Operations
+***************************************************************************************************************************************************************/
+
+/** Bound on the number of entries, or of terms of a contraction, up to which static tensor kernels are fully unrolled into straight-line code. Larger tensors
+ *  loop over offsets precomputed at compile time. */
+constexpr size_t MaxUnrolledTensorSize = 256;
+
+/** Apply an operation to each entry of a static tensor. */
+template<typename T, size_t... dims, class Op>
+constexpr auto Map(const StaticTensor<T, dims...>& tensor, Op operation);
+
+/** Apply a binary operation to the entries of two static tensors of broadcastable shapes, e.g. adding a 3 vector to each row of a 4x3 tensor. */
+template<typename T, size_t... dims0, size_t... dims1, class Op>
+requires BroadcastableShapes<TensorShape<dims0...>, TensorShape<dims1...>>
+constexpr auto Broadcast(const StaticTensor<T, dims0...>& a, const StaticTensor<T, dims1...>& b, Op operation);
+
+/** Static tensor with the same entries in column-major order, and new dimensions of the same total size. */
+template<size_t... new_dims, typename T, size_t... dims>
+requires ReshapeableShapes<TensorShape<dims...>, TensorShape<new_dims...>>
+constexpr StaticTensor<T, new_dims...> Reshape(const StaticTensor<T, dims...>& tensor);
+
+}
+
+#include "TensorOperations.tpp"
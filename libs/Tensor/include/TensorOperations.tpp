@@ -0,0 +1,167 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#pragma once
+
+namespace aprn {
+namespace detail {
+
+/***************************************************************************************************************************************************************
+* Static Tensor Shapes
+***************************************************************************************************************************************************************/
+template<size_t rank>
+constexpr std::array<size_t, rank>
+ColumnMajorStrides(const std::array<size_t, rank>& dimensions)
+{
+   std::array<size_t, rank> strides{};
+   size_t stride = 1;
+   FOR(d, rank)
+   {
+      strides[d] = stride;
+      stride *= dimensions[d];
+   }
+   return strides;
+}
+
+template<auto dimensions, size_t... ds>
+struct ShapeFromArray<dimensions, std::index_sequence<ds...>>
+{
+   using Type = TensorShape<dimensions[ds]...>;
+};
+
+/***************************************************************************************************************************************************************
+* Static Shape Algebra
+***************************************************************************************************************************************************************/
+
+/** Dimension of a shape aligned at its last dimension with a shape of a given rank, which is 1 before its first dimension. */
+template<size_t rank>
+constexpr size_t
+AlignedDimension(const std::array<size_t, rank>& dimensions, const size_t aligned_rank, const size_t d)
+{
+   return d + rank < aligned_rank ? 1 : dimensions[d + rank - aligned_rank];
+}
+
+template<size_t rank0, size_t rank1>
+constexpr bool
+isBroadcastable(const std::array<size_t, rank0>& dimensions0, const std::array<size_t, rank1>& dimensions1)
+{
+   constexpr size_t rank = Max(rank0, rank1);
+   FOR(d, rank)
+   {
+      const size_t dim0 = AlignedDimension(dimensions0, rank, d);
+      const size_t dim1 = AlignedDimension(dimensions1, rank, d);
+      if(dim0 != dim1 && dim0 != 1 && dim1 != 1) return false;
+   }
+   return true;
+}
+
+template<size_t rank0, size_t rank1>
+constexpr std::array<size_t, Max(rank0, rank1)>
+BroadcastDimensions(const std::array<size_t, rank0>& dimensions0, const std::array<size_t, rank1>& dimensions1)
+{
+   constexpr size_t rank = Max(rank0, rank1);
+   std::array<size_t, rank> dimensions{};
+   FOR(d, rank)
+   {
+      const size_t dim0 = AlignedDimension(dimensions0, rank, d);
+      const size_t dim1 = AlignedDimension(dimensions1, rank, d);
+      dimensions[d] = dim0 == 1 ? dim1 : dim0;
+   }
+   return dimensions;
+}
+
+/** Offset of the entry of a tensor broadcast to each entry of the broadcast shape, in column-major order. */
+template<class S, class B>
+constexpr std::array<size_t, B::Size>
+BroadcastOffsets()
+{
+   std::array<size_t, B::Size> offsets{};
+   FOR(i, B::Size)
+   {
+      size_t remainder = i;
+      FOR(d, B::Rank)
+      {
+         const size_t index = remainder % B::Dimensions[d];
+         remainder /= B::Dimensions[d];
+         if(d + S::Rank >= B::Rank && S::Dimensions[d + S::Rank - B::Rank] != 1) offsets[i] += index * S::Strides[d + S::Rank - B::Rank];
+      }
+   }
+   return offsets;
+}
+
+/***************************************************************************************************************************************************************
+* Unrolled Static Tensor Operations
+***************************************************************************************************************************************************************/
+
+/** Apply a function to each index of a compile-time range, as straight-line code up to MaxUnrolledTensorSize indices, and as a loop otherwise. */
+template<class F, size_t... is>
+constexpr void
+UnrolledFor(F&& function, std::index_sequence<is...>)
+{
+   (function(std::integral_constant<size_t, is>{}), ...);
+}
+
+template<size_t n, class F>
+constexpr void
+StaticFor(F&& function)
+{
+   if constexpr(n <= MaxUnrolledTensorSize) UnrolledFor(function, std::make_index_sequence<n>{});
+   else FOR(i, n) function(i);
+}
+
+}//detail
+
+template<typename T, size_t... dims, class Op>
+constexpr auto
+Map(const StaticTensor<T, dims...>& tensor, Op operation)
+{
+   StaticTensor<T, dims...> result;
+   const T* entries = tensor.Data();
+   T* result_entries = result.Data();
+   detail::StaticFor<TensorShape<dims...>::Size>([&](const size_t i){ result_entries[i] = operation(entries[i]); });
+   return result;
+}
+
+template<typename T, size_t... dims0, size_t... dims1, class Op>
+requires BroadcastableShapes<TensorShape<dims0...>, TensorShape<dims1...>>
+constexpr auto
+Broadcast(const StaticTensor<T, dims0...>& a, const StaticTensor<T, dims1...>& b, Op operation)
+{
+   using S0 = TensorShape<dims0...>;
+   using S1 = TensorShape<dims1...>;
+   using B  = BroadcastShape<S0, S1>;
+   constexpr auto offsets0 = detail::BroadcastOffsets<S0, B>();
+   constexpr auto offsets1 = detail::BroadcastOffsets<S1, B>();
+
+   typename B::template TensorType<T> result;
+   const T* a_entries = a.Data();
+   const T* b_entries = b.Data();
+   T* result_entries = result.Data();
+   detail::StaticFor<B::Size>([&](const size_t i){ result_entries[i] = operation(a_entries[offsets0[i]], b_entries[offsets1[i]]); });
+   return result;
+}
+
+template<size_t... new_dims, typename T, size_t... dims>
+requires ReshapeableShapes<TensorShape<dims...>, TensorShape<new_dims...>>
+constexpr StaticTensor<T, new_dims...>
+Reshape(const StaticTensor<T, dims...>& tensor)
+{
+   StaticTensor<T, new_dims...> result;
+   const T* entries = tensor.Data();
+   T* result_entries = result.Data();
+   detail::StaticFor<TensorShape<dims...>::Size>([&](const size_t i){ result_entries[i] = entries[i]; });
+   return result;
+}
+
+}
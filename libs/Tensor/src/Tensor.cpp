@@ -47,6 +47,7 @@ constexpr D&
 Tensor<T, D>::operator=(const std::initializer_list<T>& _value_array) noexcept
 {
   Derived().Entries = _value_array;
+  return Derived();
 }
 
 template<typename T, class D>
@@ -54,13 +55,14 @@ constexpr D&
 Tensor<T, D>::operator=(const std::initializer_list<std::initializer_list<T>>& _value_matrix) noexcept
 {
   Derived().Entries = _value_matrix;
+  return Derived();
 }
 
 /***************************************************************************************************************************************************************
 * Static Tensor Class
 ***************************************************************************************************************************************************************/
 template<typename T, size_t... dims>
-StaticTensor<T, dims...>::StaticTensor()
+constexpr StaticTensor<T, dims...>::StaticTensor()
 {
   STATIC_ASSERT(0 < sizeof...(dims), "A tensor must have at least 1 dimension.")
 }
@@ -76,6 +78,10 @@ template<typename T>
 DynamicTensor<T>::DynamicTensor(const std::convertible_to<size_t> auto... _dimensions)
   : Entries(_dimensions...) {}
 
+template<typename T>
+DynamicTensor<T>::DynamicTensor(const DynamicArray<size_t>& _dimensions)
+  : Entries(_dimensions) {}
+
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,222 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "../../../include/Global.h"
+#include "../include/Contraction.h"
+
+#include <vector>
+
+#ifdef DEBUG_MODE
+
+namespace aprn {
+
+/***************************************************************************************************************************************************************
+* Contraction Test Fixture
+***************************************************************************************************************************************************************/
+class ContractionTest : public testing::Test
+{
+ public:
+   Random<int> RandomInt;
+
+   ContractionTest()
+      : RandomInt(-5, 5) {}
+
+   /** Small integer entries, so that every contraction order gives exactly the same result. */
+   template<class D>
+   void Randomise(Tensor<Real, D>& tensor) { FOR(i, tensor.size()) tensor.Data()[i] = static_cast<Real>(RandomInt()); }
+
+   /** Reference contraction summing the product of the entries over every assignment of values to the labels. */
+   static DynamicTensor<Real> NaiveContract(const std::string_view subscripts, const std::vector<const DynamicTensor<Real>*>& tensors)
+   {
+      const auto parsed = ParseSubscripts(subscripts);
+      LabelDimensions dimensions{};
+      std::vector<char> labels;
+      FOR(i, tensors.size())
+      {
+         DynamicArray<size_t> tensor_dimensions(tensors[i]->Rank());
+         FOR(d, tensors[i]->Rank()) tensor_dimensions[d] = tensors[i]->Dimension(d);
+         AddLabelDimensions(parsed.Inputs[i], tensor_dimensions, dimensions);
+         FOR(d, parsed.Inputs[i].Rank) if(std::find(labels.begin(), labels.end(), parsed.Inputs[i].Labels[d]) == labels.end())
+            labels.push_back(parsed.Inputs[i].Labels[d]);
+      }
+      DynamicArray<size_t> output_dimensions(Max(parsed.Output.Rank, size_t{1}), 1);
+      FOR(d, parsed.Output.Rank) output_dimensions[d] = dimensions[LabelIndex(parsed.Output.Labels[d])];
+      DynamicTensor<Real> result(output_dimensions);
+
+      const auto offset = [&](const IndexLabels& tensor_labels, const LabelDimensions& values)
+      {
+         size_t offset{}, stride{1};
+         FOR(d, tensor_labels.Rank)
+         {
+            offset += values[LabelIndex(tensor_labels.Labels[d])] * stride;
+            stride *= dimensions[LabelIndex(tensor_labels.Labels[d])];
+         }
+         return offset;
+      };
+
+      LabelDimensions values{};
+      while(true)
+      {
+         Real product{1};
+         FOR(i, tensors.size()) product *= tensors[i]->Data()[offset(parsed.Inputs[i], values)];
+         result.Data()[offset(parsed.Output, values)] += product;
+
+         size_t d{};
+         for(; d < labels.size(); ++d)
+         {
+            auto& value = values[LabelIndex(labels[d])];
+            if(++value < dimensions[LabelIndex(labels[d])]) break;
+            value = 0;
+         }
+         if(d == labels.size()) return result;
+      }
+   }
+};
+
+/***************************************************************************************************************************************************************
+* Test Subscripts and Contraction Paths
+***************************************************************************************************************************************************************/
+TEST_F(ContractionTest, Subscripts)
+{
+   constexpr auto explicit_output = ParseSubscripts("ij,jk->ki");
+   static_assert(explicit_output.nInputs == 2 && explicit_output.Inputs[1].Labels[0] == 'j' && explicit_output.Output.Labels[0] == 'k');
+
+   // Implicit outputs hold the labels appearing once, in alphabetical order.
+   constexpr auto implicit_output = ParseSubscripts("kj,ji");
+   static_assert(implicit_output.Output.Rank == 2 && implicit_output.Output.Labels[0] == 'i' && implicit_output.Output.Labels[1] == 'k');
+   static_assert(ParseSubscripts("ii").Output.Rank == 0);
+
+   EXPECT_DEATH(ParseSubscripts("ij->k"), "");
+   EXPECT_DEATH(ParseSubscripts("ij->ii"), "");
+   EXPECT_DEATH(ParseSubscripts("i1->i"), "");
+   EXPECT_DEATH(Contract("ij,jk->ik", DynamicTensor<Real>(2, 3), DynamicTensor<Real>(4, 5)), "");
+   EXPECT_DEATH(Contract("ij,jk->ik", DynamicTensor<Real>(2, 3)), "");
+}
+
+TEST_F(ContractionTest, Path)
+{
+   // A matrix chain is cheapest contracted from the left here, with 10 x 100 x 5 + 10 x 5 x 50 multiply-adds.
+   constexpr auto subscripts = ParseSubscripts("ij,jk,kl->il");
+   constexpr LabelDimensions dimensions = [](const ContractionSubscripts& chain)
+   {
+      LabelDimensions label_dimensions{};
+      AddLabelDimensions(chain.Inputs[0], std::array<size_t, 2>{10, 100}, label_dimensions);
+      AddLabelDimensions(chain.Inputs[1], std::array<size_t, 2>{100, 5}, label_dimensions);
+      AddLabelDimensions(chain.Inputs[2], std::array<size_t, 2>{5, 50}, label_dimensions);
+      return label_dimensions;
+   }(subscripts);
+   constexpr auto path = PlanContraction(subscripts, dimensions);
+   static_assert(path.nSteps == 2 && path.Cost == 7500.0);
+   static_assert(path.Steps[0][0] == 0 && path.Steps[0][1] == 1 && path.Steps[1][0] == 1 && path.Steps[1][1] == 0);
+
+   // Contracting an outer product last avoids forming it.
+   const auto outer = ParseSubscripts("i,j,ij->");
+   LabelDimensions outer_dimensions{};
+   outer_dimensions[LabelIndex('i')] = outer_dimensions[LabelIndex('j')] = 100;
+   const auto outer_path = PlanContraction(outer, outer_dimensions);
+   EXPECT_EQ(outer_path.Cost, 100.0 * 100.0 + 100.0);
+}
+
+/***************************************************************************************************************************************************************
+* Test Contractions
+***************************************************************************************************************************************************************/
+TEST_F(ContractionTest, StaticContraction)
+{
+   StaticTensor<Real, 3, 4> a;
+   StaticTensor<Real, 4, 5> b;
+   StaticTensor<Real, 3, 4, 2> c;
+   Randomise(a);
+   Randomise(b);
+   Randomise(c);
+
+   const auto product = Contract<"ij,jk->ik">(a, b);
+   static_assert(isTypeSame<decltype(product), const StaticTensor<Real, 3, 5>>());
+   FOR(i, 3) FOR(k, 5)
+   {
+      Real expected{};
+      FOR(j, 4) expected += a(i, j) * b(j, k);
+      EXPECT_DOUBLE_EQ(product(i, k), expected);
+   }
+
+   const auto transposed = Contract<"ijk->kji">(c);
+   static_assert(isTypeSame<decltype(transposed), const StaticTensor<Real, 2, 4, 3>>());
+   FOR(i, 3) FOR(j, 4) FOR(k, 2) EXPECT_DOUBLE_EQ(transposed(k, j, i), c(i, j, k));
+
+   const Real norm = Contract<"ijk,ijk">(c, c);
+   Real expected{};
+   FOR(i, c.size()) expected += c.Data()[i] * c.Data()[i];
+   EXPECT_DOUBLE_EQ(norm, expected);
+}
+
+TEST_F(ContractionTest, DynamicContraction)
+{
+   // Force the parallel paths on small tensors.
+   const size_t threshold = ParallelThreshold();
+   const size_t n_threads = nThreads();
+   SetParallelThreshold(0);
+   SetThreads(4);
+
+   // Contractions with strided and packed operands, permuted outputs, batches, diagonals, reductions, and more than two tensors.
+   const std::vector<std::pair<std::string_view, std::vector<std::vector<size_t>>>> cases
+   {
+      {"ijk,jkl->il",      {{5, 6, 7}, {6, 7, 8}}},
+      {"ikj,jlk->il",      {{5, 7, 6}, {6, 8, 7}}},
+      {"bij,bjk->bik",     {{3, 9, 10}, {3, 10, 11}}},
+      {"abcd,cdef->abef",  {{6, 7, 8, 9}, {8, 9, 5, 4}}},
+      {"abcd,dbef->fcea",  {{4, 5, 6, 7}, {7, 5, 3, 2}}},
+      {"ijkl,kjm->mil",    {{4, 5, 6, 3}, {6, 5, 7}}},
+      {"ij,jk,kl->li",     {{7, 30}, {30, 4}, {4, 9}}},
+      {"i,j->ij",          {{7}, {9}}},
+      {"ij,ij->ij",        {{8, 9}, {8, 9}}},
+      {"ii->i",            {{6, 6}}},
+      {"iij,jk->ik",       {{5, 5, 4}, {4, 3}}},
+      {"ijk,k->",          {{3, 4, 5}, {5}}},
+      {"ijk->",            {{3, 4, 5}}}
+   };
+   for(const auto& [subscripts, shapes] : cases)
+   {
+      std::vector<DynamicTensor<Real>> tensors;
+      FOR_EACH_CONST(shape, shapes)
+      {
+         tensors.emplace_back(DynamicArray<size_t>(shape.begin(), shape.end()));
+         Randomise(tensors.back());
+      }
+      std::vector<const DynamicTensor<Real>*> pointers;
+      FOR_EACH_CONST(tensor, tensors) pointers.push_back(&tensor);
+
+      const auto expected = NaiveContract(subscripts, pointers);
+      const auto result = tensors.size() == 1 ? Contract(subscripts, tensors[0]) :
+                          tensors.size() == 2 ? Contract(subscripts, tensors[0], tensors[1]) : Contract(subscripts, tensors[0], tensors[1], tensors[2]);
+      ASSERT_EQ(result.Rank(), expected.Rank()) << subscripts;
+      FOR(d, result.Rank()) ASSERT_EQ(result.Dimension(d), expected.Dimension(d)) << subscripts;
+      FOR(i, result.size()) EXPECT_DOUBLE_EQ(result.Data()[i], expected.Data()[i]) << subscripts;
+   }
+
+   // Compile-time subscripts with run-time dimensions.
+   DynamicTensor<Real> a(3, 4, 5), b(3, 5, 2);
+   Randomise(a);
+   Randomise(b);
+   const auto result = Contract<"bij,bjk->bik">(a, b);
+   const auto expected = NaiveContract("bij,bjk->bik", {&a, &b});
+   FOR(i, result.size()) EXPECT_DOUBLE_EQ(result.Data()[i], expected.Data()[i]);
+
+   SetThreads(n_threads);
+   SetParallelThreshold(threshold);
+}
+
+}
+
+#endif
@@ -0,0 +1,176 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "../../../include/Global.h"
+#include "../include/Contraction.h"
+#include "../include/TensorOperations.h"
+
+#ifdef DEBUG_MODE
+
+namespace aprn {
+
+/***************************************************************************************************************************************************************
+* Tensor Operations Test Fixture
+***************************************************************************************************************************************************************/
+class TensorOperationsTest : public testing::Test
+{
+ public:
+   Random<int> RandomInt;
+
+   TensorOperationsTest()
+      : RandomInt(-5, 5) {}
+
+   template<class D>
+   void Randomise(Tensor<Real, D>& tensor) { FOR(i, tensor.size()) tensor.Data()[i] = static_cast<Real>(RandomInt()); }
+};
+
+/** Static tensor with entries 1, 2, 3, ... in column-major order, which can be built at compile time. */
+template<typename T, size_t... dims>
+constexpr StaticTensor<T, dims...>
+Iota()
+{
+   StaticTensor<T, dims...> tensor;
+   FOR(i, tensor.size()) tensor.Data()[i] = static_cast<T>(i + 1);
+   return tensor;
+}
+
+/***************************************************************************************************************************************************************
+* Test Static Shape Algebra
+***************************************************************************************************************************************************************/
+TEST_F(TensorOperationsTest, ShapeAlgebra)
+{
+   using S = TensorShape<2, 3, 4>;
+   static_assert(S::Rank == 3 && S::Size == 24);
+   static_assert(S::Strides == std::array<size_t, 3>{1, 2, 6});
+   static_assert(isTypeSame<ShapeOf<StaticTensor<Real, 2, 3, 4>>, S>());
+   static_assert(StaticShaped<StaticTensor<Real, 2>> && !StaticShaped<DynamicTensor<Real>>);
+
+   // Broadcasting aligns the last dimensions.
+   static_assert(BroadcastableShapes<TensorShape<4, 3>, TensorShape<3>>);
+   static_assert(BroadcastableShapes<TensorShape<4, 1>, TensorShape<1, 3>>);
+   static_assert(!BroadcastableShapes<TensorShape<4, 3>, TensorShape<4>>);
+   static_assert(isTypeSame<BroadcastShape<TensorShape<4, 3>, TensorShape<3>>, TensorShape<4, 3>>());
+   static_assert(isTypeSame<BroadcastShape<TensorShape<4, 1>, TensorShape<2, 1, 3>>, TensorShape<2, 4, 3>>());
+
+   static_assert(ReshapeableShapes<TensorShape<2, 3, 4>, TensorShape<6, 4>>);
+   static_assert(!ReshapeableShapes<TensorShape<2, 3>, TensorShape<5>>);
+
+   static_assert(ContractibleShapes<"ij,jk->ik", TensorShape<3, 4>, TensorShape<4, 5>>);
+   static_assert(!ContractibleShapes<"ij,jk->ik", TensorShape<3, 4>, TensorShape<5, 4>>);
+   static_assert(!ContractibleShapes<"ij,jk->ik", TensorShape<3, 4, 1>, TensorShape<4, 5>>);
+   static_assert(!ContractibleShapes<"ij,jk->ik", TensorShape<3, 4>>);
+   static_assert(ContractibleShapes<"ii->i", TensorShape<3, 3>> && !ContractibleShapes<"ii->i", TensorShape<3, 2>>);
+   static_assert(isTypeSame<ContractionShape<"ijk,kj->ki", TensorShape<2, 3, 4>, TensorShape<4, 3>>, TensorShape<4, 2>>());
+   static_assert(isTypeSame<ContractionShape<"ij,ij", TensorShape<2, 3>, TensorShape<2, 3>>, TensorShape<1>>());
+}
+
+/***************************************************************************************************************************************************************
+* Test Unrolled Static Tensor Operations
+***************************************************************************************************************************************************************/
+TEST_F(TensorOperationsTest, ElementWise)
+{
+   StaticTensor<Real, 4, 3> a;
+   StaticTensor<Real, 3> b;
+   StaticTensor<Real, 4, 1> c;
+   Randomise(a);
+   Randomise(b);
+   Randomise(c);
+
+   const auto sum = Broadcast(a, b, std::plus<Real>());
+   static_assert(isTypeSame<decltype(sum), const StaticTensor<Real, 4, 3>>());
+   FOR(i, 4) FOR(j, 3) EXPECT_EQ(sum(i, j), a(i, j) + b(j));
+
+   const auto outer = Broadcast(c, b, std::multiplies<Real>());
+   static_assert(isTypeSame<decltype(outer), const StaticTensor<Real, 4, 3>>());
+   FOR(i, 4) FOR(j, 3) EXPECT_EQ(outer(i, j), c(i, 0) * b(j));
+
+   const auto negated = Map(a, std::negate<Real>());
+   FOR(i, 4) FOR(j, 3) EXPECT_EQ(negated(i, j), -a(i, j));
+
+   const auto reshaped = Reshape<2, 6>(a);
+   FOR(i, a.size()) EXPECT_EQ(reshaped.Data()[i], a.Data()[i]);
+
+   // Tensors beyond the unroll bound loop over the same offsets.
+   StaticTensor<Real, 20, 20> large;
+   StaticTensor<Real, 20> row;
+   Randomise(large);
+   Randomise(row);
+   const auto large_sum = Broadcast(large, row, std::minus<Real>());
+   FOR(i, 20) FOR(j, 20) EXPECT_EQ(large_sum(i, j), large(i, j) - row(j));
+
+   // Everything can be evaluated at compile time.
+   constexpr auto x = Iota<int, 2, 3>();
+   constexpr auto y = Iota<int, 3>();
+   constexpr auto z = Broadcast(x, y, std::multiplies<int>());
+   static_assert(z.Data()[0] == 1 && z.Data()[1] == 2 && z.Data()[2] == 3 * 2 && z.Data()[5] == 6 * 3);
+   static_assert(Reshape<6>(Map(x, [](const int v){ return v * v; })).Data()[5] == 36);
+}
+
+TEST_F(TensorOperationsTest, UnrolledContraction)
+{
+   StaticTensor<Real, 3, 3> a;
+   StaticTensor<Real, 3, 3, 3> b;
+   StaticTensor<Real, 3> v;
+   Randomise(a);
+   Randomise(b);
+   Randomise(v);
+
+   const auto bilinear = Contract<"ijk,j,k->i">(b, v, v);
+   FOR(i, 3)
+   {
+      Real expected{};
+      FOR(j, 3) FOR(k, 3) expected += b(i, j, k) * v(j) * v(k);
+      EXPECT_EQ(bilinear(i), expected);
+   }
+
+   const auto diagonal = Contract<"ii->i">(a);
+   FOR(i, 3) EXPECT_EQ(diagonal(i), a(i, i));
+
+   const Real trace = Contract<"ii">(a);
+   EXPECT_EQ(trace, a(0, 0) + a(1, 1) + a(2, 2));
+
+   const auto rotated = Contract<"ij,jk,lk->il">(a, a, a);
+   FOR(i, 3) FOR(l, 3)
+   {
+      Real expected{};
+      FOR(j, 3) FOR(k, 3) expected += a(i, j) * a(j, k) * a(l, k);
+      EXPECT_EQ(rotated(i, l), expected);
+   }
+
+   // Contractions beyond the unroll bound follow the planned path, and agree with the unrolled terms.
+   StaticTensor<Real, 8, 8> c;
+   StaticTensor<Real, 8, 8> d;
+   Randomise(c);
+   Randomise(d);
+   const auto product = Contract<"ij,jk->ik">(c, d);
+   FOR(i, 8) FOR(k, 8)
+   {
+      Real expected{};
+      FOR(j, 8) expected += c(i, j) * d(j, k);
+      EXPECT_EQ(product(i, k), expected);
+   }
+
+   // Output entries are assigned by their first term, even though integer entries are not initialised to zero.
+   constexpr auto x = Iota<int, 2, 3>();
+   constexpr auto y = Iota<int, 3, 2>();
+   constexpr auto xy = Contract<"ij,jk->ik">(x, y);
+   static_assert(xy.Data()[0] == 1 * 1 + 3 * 2 + 5 * 3 && xy.Data()[3] == 2 * 4 + 4 * 5 + 6 * 6);
+   static_assert(Contract<"ij,ij">(x, x) == 1 + 4 + 9 + 16 + 25 + 36);
+}
+
+}
+
+#endif
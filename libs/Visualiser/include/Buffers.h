@@ -16,6 +16,7 @@
 
 #include "../../../include/Global.h"
 #include "../../DataContainer/include/Array.h"
+#include "../../DataContainer/include/SmallArray.h"
 #include "GLDebug.h"
 #include "GLTypes.h"
 #include "Mesh.h"
@@ -138,7 +139,7 @@ struct FrameBuffer : public detail::Buffer<BufferType::FBO>
 
    void Draw(GLenum attachment) const;
 
-   void Draw(const DArray<GLenum>& attachments) const;
+   void Draw(const SmallArray<GLenum, 8>& attachments) const;
 
    void Read(GLenum attachment) const;
 
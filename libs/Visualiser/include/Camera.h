@@ -18,6 +18,7 @@
 #include "../../DataContainer/include/Array.h"
 #include "../../LinearAlgebra/include/Vector.h"
 
+#include <array>
 #include <GL/glew.h>
 #include <GLFW/glfw3.h>
 #include <glm/glm.hpp>
@@ -50,6 +51,12 @@ class Camera
 
    void UpdateProjMatrix();
 
+   /** Planes (a, b, c, d) bounding the view frustum in world space, facing its interior, a x + b y + c z + d >= 0, e.g. for culling with a BVH. */
+   std::array<SVector4<GLfloat>, 6> FrustumPlanes() const;
+
+   /** Origin, on the near plane, and direction of the ray through a point in normalised device coordinates, e.g. the cursor, for picking with a BVH. */
+   Pair<glm::vec3> PickingRay(const glm::vec2& device_point) const;
+
    inline const glm::vec3& Position() const { return Position_; }
 
    inline const glm::mat4& ViewMatrix() const { return ViewMatrix_; }
@@ -15,6 +15,7 @@
 #pragma once
 
 #include "../../../include/Global.h"
+#include "../../LinearAlgebra/include/Matrix.h"
 #include "../../LinearAlgebra/include/Vector.h"
 
 #include <GL/glew.h>
@@ -74,4 +75,24 @@ SVectorToGlmVec(const SVector<T, N>& in)
   return out;
 }
 
+/** Convert a GLM matrix to a static matrix. Both are stored column-major. */
+template<typename T, glm::length_t N, glm::length_t M, glm::qualifier Q = glm::defaultp>
+constexpr SMatrix<T, M, N>
+GlmMatToSMatrix(const glm::mat<N, M, T, Q>& in)
+{
+  SMatrix<T, M, N> out;
+  FOR(j, N) FOR(i, M) out.begin()[i + j * M] = in[j][i];
+  return out;
+}
+
+/** Convert a static matrix to a GLM matrix. */
+template<typename T, size_t M, size_t N, glm::qualifier Q = glm::defaultp>
+constexpr glm::mat<N, M, T, Q>
+SMatrixToGlmMat(const SMatrix<T, M, N>& in)
+{
+  glm::mat<N, M, T, Q> out;
+  FOR(j, N) FOR(i, M) out[j][i] = in.begin()[i + j * M];
+  return out;
+}
+
 }
@@ -16,6 +16,8 @@
 
 #include "../../../include/Global.h"
 #include "../../DataContainer/include/Array.h"
+#include "../../DataContainer/include/SmallArray.h"
+#include "../../DataContainer/include/SoAArray.h"
 #include "Animator.h"
 
 #include <optional>
@@ -26,6 +28,10 @@ namespace aprn::vis {
 
 enum class ShadingType { Flat, Phong };
 
+/** CPU-side vertex storage. Interleaved vertices are uploaded as they are, whereas separate attribute arrays are faster to process in bulk, e.g. when computing
+ *  normals on large meshes, and are interleaved only when uploaded. */
+enum class VertexStorage { Interleaved, Separate };
+
 struct Vertex
 {
    glm::vec3 Position;
@@ -52,10 +58,14 @@ struct VertexAttributeLayout
    template<typename T>
    void AddAttribute(GLuint n_values);
 
-   DArray<VertexAttribute> Attributes;
-   GLuint                  Stride;
+   SmallArray<VertexAttribute, 8> Attributes;
+   GLuint                         Stride;
 };
 
+/** Vertex attributes stored as separate arrays. Each coordinate of the position, normal, and tangent has its own array, so that bulk operations on them stream
+ *  contiguous values, followed by the colour and the texture coordinates. */
+using VertexArrays = SoAArray<GLfloat, GLfloat, GLfloat, GLfloat, GLfloat, GLfloat, GLfloat, GLfloat, GLfloat, glm::vec4, glm::vec2>;
+
 class Mesh
 {
  public:
@@ -63,7 +73,30 @@ class Mesh
 
    void ComputeVertexNormals();
 
-   inline bool Loaded() const { return !Vertices_.empty(); }
+   void SetVertexColour(const glm::vec4& colour);
+
+   /** Vertex attribute access, in either storage. */
+   void ResizeVertices(const size_t n_vertices);
+
+   glm::vec3 VertexPosition(const size_t index) const;
+
+   void SetVertexPosition(const size_t index, const glm::vec3& position);
+
+   void SetVertexTangent(const size_t index, const glm::vec3& tangent);
+
+   void SetVertexTextureCoordinates(const size_t index, const glm::vec2& texture_coordinates);
+
+   /** Convert the vertices to the given storage. */
+   void SetVertexStorage(const VertexStorage storage);
+
+   /** Interleaved vertices for upload, packed from the separate attribute arrays if they have been modified since they were last packed. */
+   const DArray<Vertex>& InterleavedVertices();
+
+   inline size_t nVertices() const { return Storage_ == VertexStorage::Interleaved ? Vertices_.size() : SeparateVertices_.size(); }
+
+   inline bool Loaded() const { return nVertices() > 0; }
+
+   inline VertexStorage Storage() const { return Storage_; }
 
    inline const auto& VertexLayout() const { return VertexLayout_; }
 
@@ -71,11 +104,19 @@ class Mesh
    friend class Model;
    friend class ObjectFactory;
    friend class TeXGlyph;
+   friend class MeshTest;
+
+   void ComputeInterleavedNormals();
+
+   void ComputeSeparateNormals();
 
    VertexAttributeLayout VertexLayout_;
-   DArray<Vertex>        Vertices_;
+   DArray<Vertex>        Vertices_; // Only an upload buffer in separate storage.
+   VertexArrays          SeparateVertices_;
    DArray<GLuint>        Indices_;
    ShadingType           Shading_{ShadingType::Flat};
+   VertexStorage         Storage_{VertexStorage::Interleaved};
+   bool                  isPacked_{true}; // Whether the upload buffer is up to date with the separate attribute arrays.
 };
 
 }
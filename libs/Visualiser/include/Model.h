@@ -16,6 +16,7 @@
 
 #include "../../../include/Global.h"
 #include "DataContainer/include/Array.h"
+#include "Graph/include/BVH.h"
 #include "Buffers.h"
 #include "Colour.h"
 #include "Material.h"
@@ -54,6 +55,9 @@ class Model : public Object
 
    Model* SetTexture(const std::string& material, const std::string& item, size_t index, size_t resolution, Real dispacement_scale) override;
 
+   /** Set the CPU-side storage of the mesh vertices, e.g. separate attribute arrays for large meshes, which are processed in bulk and interleaved on upload. */
+   Model* SetVertexStorage(VertexStorage storage);
+
    /** Set Model Actions
    ************************************************************************************************************************************************************/
    Model* OffsetPosition(const SVectorR3& displacement) override;
@@ -92,6 +96,10 @@ class Model : public Object
 
    inline const auto& ModelMatrix() const { return Animator_.ModelMatrix(); }
 
+   /** Bounding volume hierarchy over the mesh triangles in world space, e.g. for picking and culling. It is built on the first call, and refitted on the first
+    *  call after each update, which keeps its tree, as the animator moves the vertices without changing the triangles. */
+   const graph::BVH<GLfloat>& BoundingVolumes();
+
    inline const auto& ModelMesh() const { return Mesh_; }
 
    inline const auto& TextureRequest() const { return TextureRequest_; }
@@ -128,6 +136,8 @@ class Model : public Object
    UMap<Texture&>                  Textures_;       // Textures (diffuse, height, normal, etc.) used by this model.
    Colour                          FillColour_;
    glm::vec3                       Centroid_;
+   graph::BVH<GLfloat>             BVH_;
+   bool                            isBVHFitted_{false}; // Whether the BVH is fitted to the current model matrix and mesh.
 };
 
 }
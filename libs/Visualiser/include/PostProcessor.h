@@ -66,6 +66,7 @@ class PostProcessor
    UMap<FrameImage>          BlurBuffers_;
    UMap<Shader>              Shaders_;
    SPtr<Object>              ScreenQuad_;
+   MemoryArena               FrameArena_{64 * 1024}; // For transient per-frame arrays, sized so a frame fits in one block.
    UInt                      Width_;
    UInt                      Height_;
    bool                      Init_{};
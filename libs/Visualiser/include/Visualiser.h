@@ -100,6 +100,7 @@ class Visualiser
    UMap<Shader>        Shaders_;
    UMap<UMap<Texture>> Textures_;
    PostProcessor       PostProcessor_;
+   MemoryArena         FrameArena_; // For transient per-frame arrays.
    Camera*             ActiveCamera_;
    Scene*              CurrentScene_;
    GUI                 GUI_;
@@ -242,7 +242,7 @@ void
 FrameBuffer::Draw(const GLenum attachment) const { GLCall(glNamedFramebufferDrawBuffer(ID_, attachment)) }
 
 void
-FrameBuffer::Draw(const DArray<GLenum>& attachments) const { GLCall(glNamedFramebufferDrawBuffers(ID_, attachments.size(), attachments.data())) }
+FrameBuffer::Draw(const SmallArray<GLenum, 8>& attachments) const { GLCall(glNamedFramebufferDrawBuffers(ID_, attachments.size(), attachments.data())) }
 
 void
 FrameBuffer::Read(const GLenum attachment) const { GLCall(glNamedFramebufferReadBuffer(ID_, attachment)) }
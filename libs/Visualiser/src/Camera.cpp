@@ -111,5 +111,31 @@ void Camera::UpdateProjMatrix()
    ProjMatrix_ = glm::perspective(glm::radians(FieldOfView_), AspectRatio_, NearPlane_, FarPlane_);
 }
 
+std::array<SVector4<GLfloat>, 6> Camera::FrustumPlanes() const
+{
+   // Each plane is the sum or difference of the last row of the view-projection matrix and one of its other rows, where glm matrices are column-major.
+   const glm::mat4 clip = ProjMatrix_ * ViewMatrix_;
+   const auto row = [&clip](const int i){ return glm::vec4(clip[0][i], clip[1][i], clip[2][i], clip[3][i]); };
+
+   std::array<SVector4<GLfloat>, 6> planes;
+   FOR(i, 3)
+   {
+      const glm::vec4 lower = row(3) + row(static_cast<int>(i));
+      const glm::vec4 upper = row(3) - row(static_cast<int>(i));
+      planes[2 * i]     = {lower.x, lower.y, lower.z, lower.w};
+      planes[2 * i + 1] = {upper.x, upper.y, upper.z, upper.w};
+   }
+   return planes;
+}
+
+Pair<glm::vec3> Camera::PickingRay(const glm::vec2& device_point) const
+{
+   const glm::mat4 inverse = glm::inverse(ProjMatrix_ * ViewMatrix_);
+   const glm::vec4 near_point = inverse * glm::vec4(device_point, -1.0f, 1.0f);
+   const glm::vec4 far_point  = inverse * glm::vec4(device_point, 1.0f, 1.0f);
+   const glm::vec3 origin = glm::vec3(near_point) / near_point.w;
+   return {origin, glm::normalize(glm::vec3(far_point) / far_point.w - origin)};
+}
+
 }
 
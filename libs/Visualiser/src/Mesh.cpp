@@ -14,6 +14,7 @@
 
 #include "../include/Mesh.h"
 #include "../include/GLTypes.h"
+#include "../../DataContainer/include/Simd.h"
 
 namespace aprn::vis {
 
@@ -36,8 +37,161 @@ Mesh::Mesh()
   DEBUG_ASSERT(VertexLayout_.Stride == sizeof(Vertex), "Check if the vertex attribute layout has changed.")
 }
 
+namespace {
+
+/** First field of each attribute in the separate vertex attribute arrays. */
+constexpr size_t PositionField = 0;
+constexpr size_t NormalField   = 3;
+constexpr size_t TangentField  = 6;
+constexpr size_t ColourField   = 9;
+constexpr size_t TextureField  = 10;
+
+template<size_t I, class Arrays>
+simd::Vectors3<GLfloat>
+Coordinates(Arrays& arrays) { return {arrays.template Field<I>().data(), arrays.template Field<I + 1>().data(), arrays.template Field<I + 2>().data()}; }
+
+simd::Vectors3<const GLfloat>
+AsConst(const simd::Vectors3<GLfloat>& vectors) { return {vectors.X, vectors.Y, vectors.Z}; }
+
+template<size_t I>
+glm::vec3
+LoadVector(const VertexArrays& vertices, const size_t index)
+{
+  return {vertices.Field<I>()[index], vertices.Field<I + 1>()[index], vertices.Field<I + 2>()[index]};
+}
+
+template<size_t I>
+void
+StoreVector(VertexArrays& vertices, const size_t index, const glm::vec3& vector)
+{
+  vertices.Field<I>()[index]     = vector.x;
+  vertices.Field<I + 1>()[index] = vector.y;
+  vertices.Field<I + 2>()[index] = vector.z;
+}
+
+Vertex
+LoadVertex(const VertexArrays& vertices, const size_t index)
+{
+  return {LoadVector<PositionField>(vertices, index), LoadVector<NormalField>(vertices, index), LoadVector<TangentField>(vertices, index),
+          vertices.Field<ColourField>()[index], vertices.Field<TextureField>()[index]};
+}
+
+void
+StoreVertex(VertexArrays& vertices, const size_t index, const Vertex& vertex)
+{
+  StoreVector<PositionField>(vertices, index, vertex.Position);
+  StoreVector<NormalField>(vertices, index, vertex.Normal);
+  StoreVector<TangentField>(vertices, index, vertex.Tangent);
+  vertices.Field<ColourField>()[index]  = vertex.Colour;
+  vertices.Field<TextureField>()[index] = vertex.TextureCoordinates;
+}
+
+}
+
 void
 Mesh::ComputeVertexNormals()
+{
+  if(Storage_ == VertexStorage::Interleaved) ComputeInterleavedNormals();
+  else ComputeSeparateNormals();
+}
+
+void
+Mesh::SetVertexColour(const glm::vec4& colour)
+{
+  if(Storage_ == VertexStorage::Interleaved) FOR_EACH(vertex, Vertices_) vertex.Colour = colour;
+  else
+  {
+    FOR_EACH(vertex_colour, SeparateVertices_.Field<ColourField>()) vertex_colour = colour;
+    isPacked_ = false;
+  }
+}
+
+void
+Mesh::ResizeVertices(const size_t n_vertices)
+{
+  if(Storage_ == VertexStorage::Interleaved) { Vertices_.resize(n_vertices); return; }
+
+  // Give any new vertices the default attributes of an interleaved vertex.
+  const size_t n_old_vertices = SeparateVertices_.size();
+  SeparateVertices_.resize(n_vertices);
+  FOR(iv, n_old_vertices, n_vertices) StoreVertex(SeparateVertices_, iv, Vertex{});
+  isPacked_ = false;
+}
+
+glm::vec3
+Mesh::VertexPosition(const size_t index) const
+{
+  return Storage_ == VertexStorage::Interleaved ? Vertices_[index].Position : LoadVector<PositionField>(SeparateVertices_, index);
+}
+
+void
+Mesh::SetVertexPosition(const size_t index, const glm::vec3& position)
+{
+  if(Storage_ == VertexStorage::Interleaved) Vertices_[index].Position = position;
+  else
+  {
+    StoreVector<PositionField>(SeparateVertices_, index, position);
+    isPacked_ = false;
+  }
+}
+
+void
+Mesh::SetVertexTangent(const size_t index, const glm::vec3& tangent)
+{
+  if(Storage_ == VertexStorage::Interleaved) Vertices_[index].Tangent = tangent;
+  else
+  {
+    StoreVector<TangentField>(SeparateVertices_, index, tangent);
+    isPacked_ = false;
+  }
+}
+
+void
+Mesh::SetVertexTextureCoordinates(const size_t index, const glm::vec2& texture_coordinates)
+{
+  if(Storage_ == VertexStorage::Interleaved) Vertices_[index].TextureCoordinates = texture_coordinates;
+  else
+  {
+    SeparateVertices_.Field<TextureField>()[index] = texture_coordinates;
+    isPacked_ = false;
+  }
+}
+
+void
+Mesh::SetVertexStorage(const VertexStorage storage)
+{
+  if(storage == Storage_) return;
+
+  if(storage == VertexStorage::Separate)
+  {
+    // The interleaved vertices are kept as the packed upload buffer.
+    SeparateVertices_.resize(Vertices_.size());
+    FOR(iv, Vertices_.size()) StoreVertex(SeparateVertices_, iv, Vertices_[iv]);
+    Storage_  = storage;
+    isPacked_ = true;
+  }
+  else
+  {
+    InterleavedVertices();
+    Storage_ = storage;
+    SeparateVertices_.clear();
+  }
+}
+
+const DArray<Vertex>&
+Mesh::InterleavedVertices()
+{
+  if(Storage_ == VertexStorage::Separate && !isPacked_)
+  {
+    Vertices_.resize(SeparateVertices_.size());
+    FOR(iv, SeparateVertices_.size()) Vertices_[iv] = LoadVertex(SeparateVertices_, iv);
+    isPacked_ = true;
+  }
+  return Vertices_;
+}
+
+void
+Mesh::ComputeInterleavedNormals()
 {
   if(Shading_ == ShadingType::Flat)
   {
@@ -66,32 +220,73 @@ Mesh::ComputeVertexNormals()
       FOR(iv, 3) Vertices_[Indices_[it + iv]].Normal += face_normal;
     }
 
-    // Normalise all vertex normals.
-    FOR_EACH(vertex, Vertices_) vertex.Normal = glm::normalize(vertex.Normal);
+    // Normalise all vertex normals. As in separate storage, vertices whose faces are all degenerate are given a zero normal, rather than a NaN one.
+    const GLfloat tolerance = static_cast<GLfloat>(ZeroTolerance);
+    FOR_EACH(vertex, Vertices_)
+    {
+      const GLfloat magnitude2 = glm::dot(vertex.Normal, vertex.Normal);
+      vertex.Normal = magnitude2 < tolerance * tolerance ? glm::vec3(0.0, 0.0, 0.0) : vertex.Normal / std::sqrt(magnitude2);
+    }
   }
   else EXIT("Unrecognised shading type prescribed.")
+}
 
-  if(Shading_ == ShadingType::Phong) FOR_EACH(vertex, Vertices_) vertex.Normal = glm::vec3(0.0, 0.0, 0.0);
+void
+Mesh::ComputeSeparateNormals()
+{
+  if(Shading_ != ShadingType::Flat && Shading_ != ShadingType::Phong) EXIT("Unrecognised shading type prescribed.")
 
-  for(size_t it = 0; it < Indices_.size(); it += 3)
+  // Gather the two edges of each triangle into coordinate arrays, so that the face normals are computed by the cross product kernel. The face normals then
+  // overwrite the first edges.
+  const size_t n_faces = Indices_.size() / 3;
+  SoAArray<GLfloat, GLfloat, GLfloat, GLfloat, GLfloat, GLfloat> edges(n_faces);
+  const auto edges0    = Coordinates<0>(edges);
+  const auto edges1    = Coordinates<3>(edges);
+  const auto positions = Coordinates<PositionField>(SeparateVertices_);
+  FOR(it, n_faces)
   {
-    // Compute the normal of the current triangular face and update the normal at each vertex in the current triangle accordingly.
-    const GLuint iv0 = Indices_[it];
-    const GLuint iv1 = Indices_[it + 1];
-    const GLuint iv2 = Indices_[it + 2];
-    glm::vec3 face_normal = glm::cross(Vertices_[iv1].Position - Vertices_[iv0].Position, Vertices_[iv2].Position - Vertices_[iv0].Position);
-
-    if(Shading_ == ShadingType::Flat)
-    {
-      face_normal = glm::normalize(face_normal);
-      FOR(iv, 3) Vertices_[Indices_[it + iv]].Normal = face_normal;
-    }
-    else if(Shading_ == ShadingType::Phong) FOR(iv, 3) Vertices_[Indices_[it + iv]].Normal += face_normal;
-    else EXIT("Unrecognised shading type prescribed.")
+    const GLuint iv0 = Indices_[3 * it];
+    const GLuint iv1 = Indices_[3 * it + 1];
+    const GLuint iv2 = Indices_[3 * it + 2];
+    edges0.X[it] = positions.X[iv1] - positions.X[iv0];
+    edges0.Y[it] = positions.Y[iv1] - positions.Y[iv0];
+    edges0.Z[it] = positions.Z[iv1] - positions.Z[iv0];
+    edges1.X[it] = positions.X[iv2] - positions.X[iv0];
+    edges1.Y[it] = positions.Y[iv2] - positions.Y[iv0];
+    edges1.Z[it] = positions.Z[iv2] - positions.Z[iv0];
   }
+  simd::Cross(AsConst(edges0), AsConst(edges1), edges0, n_faces);
 
-  if(Shading_ == ShadingType::Phong) FOR_EACH(vertex, Vertices_) vertex.Normal = glm::normalize(vertex.Normal);
-}
+  // Assign the face normals to, or accumulate them at, the vertices of each face.
+  const auto& face_normals = edges0;
+  const auto  normals      = Coordinates<NormalField>(SeparateVertices_);
+  const size_t n_vertices  = SeparateVertices_.size();
+  const auto assign_normal = [&](const GLuint iv, const size_t it)
+  {
+    normals.X[iv] = face_normals.X[it];
+    normals.Y[iv] = face_normals.Y[it];
+    normals.Z[iv] = face_normals.Z[it];
+  };
+  const auto accumulate_normal = [&](const GLuint iv, const size_t it)
+  {
+    normals.X[iv] += face_normals.X[it];
+    normals.Y[iv] += face_normals.Y[it];
+    normals.Z[iv] += face_normals.Z[it];
+  };
+
+  if(Shading_ == ShadingType::Flat) FOR(it, n_faces) FOR(iv, 3) assign_normal(Indices_[3 * it + iv], it);
+  else
+  {
+    std::fill_n(normals.X, n_vertices, 0.0f);
+    std::fill_n(normals.Y, n_vertices, 0.0f);
+    std::fill_n(normals.Z, n_vertices, 0.0f);
+    FOR(it, n_faces) FOR(iv, 3) accumulate_normal(Indices_[3 * it + iv], it);
 
+    // Normalise the accumulated vertex normals. Vertices whose faces are all degenerate are given a zero normal.
+    DArrayB degenerate(n_vertices);
+    simd::Normalise(AsConst(normals), normals, degenerate.data(), n_vertices, static_cast<GLfloat>(ZeroTolerance));
+  }
+  isPacked_ = false;
 }
 
+}
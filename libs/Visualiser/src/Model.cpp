@@ -51,7 +51,7 @@ Model::SetColour(const SVectorR4& rgba_colour) { return SetColour(Colour{rgba_co
 Model*
 Model::SetColour(const Colour& colour)
 {
-   FOR_EACH(vertex, Mesh_.Vertices_) vertex.Colour = SVectorToGlmVec(colour.Values);
+   Mesh_.SetVertexColour(glm::vec4(SVectorToGlmVec(colour.Values)));
    return this;
 }
 
@@ -76,6 +76,13 @@ Model::SetTexture(const std::string& material, const std::string& item, const si
    return this;
 }
 
+Model*
+Model::SetVertexStorage(const VertexStorage storage)
+{
+   Mesh_.SetVertexStorage(storage);
+   return this;
+}
+
 /** Set Model Actions
 ***************************************************************************************************************************************************************/
 Model*
@@ -187,6 +194,8 @@ Model::operator=(const Model& model)
    TextureRequest_ = model.TextureRequest_;
    Material_       = model.Material_;
    Centroid_       = model.Centroid_;
+   BVH_            = graph::BVH<GLfloat>();
+   isBVHFitted_    = false;
 
    return *this;
 }
@@ -203,6 +212,8 @@ Model::operator=(Model&& model) noexcept
    TextureRequest_ = std::move(model.TextureRequest_);
    Material_       = std::move(model.Material_);
    Centroid_       = std::move(model.Centroid_);
+   BVH_            = graph::BVH<GLfloat>();
+   isBVHFitted_    = false;
 
    // Reset moved-from model as it is now in an undefined state. Note: to avoid an infinite regress, we need to specifically invoke the copy assigment operator
    // here, NOT the move assignment operator.
@@ -211,6 +222,30 @@ Model::operator=(Model&& model) noexcept
    return *this;
 }
 
+/** Other
+***************************************************************************************************************************************************************/
+const graph::BVH<GLfloat>&
+Model::BoundingVolumes()
+{
+   if(isBVHFitted_) return BVH_;
+
+   // Transform the vertex positions to world space.
+   const size_t n_vertices = Mesh_.nVertices();
+   const glm::mat4& model_matrix = ModelMatrix();
+   DArray<SVector3<GLfloat>> positions(n_vertices);
+   ParallelFor(n_vertices, [&](const size_t i)
+   {
+      const glm::vec4 position = model_matrix * glm::vec4(Mesh_.VertexPosition(i), 1.0f);
+      positions[i] = {position.x, position.y, position.z};
+   });
+
+   // Refit the hierarchy if it has already been built over the mesh.
+   if(BVH_.NodeCount()) BVH_.Refit(positions);
+   else BVH_.Build(positions, Mesh_.Indices_);
+   isBVHFitted_ = true;
+   return BVH_;
+}
+
 /***************************************************************************************************************************************************************
 * Model Protected Interface
 ***************************************************************************************************************************************************************/
@@ -228,7 +263,7 @@ Model::Init()
 
    // Initialise VAO, VBO, and EBO.
    VAO_.Init();
-   VBO_.Init(Mesh_.Vertices_);
+   VBO_.Init(Mesh_.InterleavedVertices());
    EBO_.Init(Mesh_.Indices_);
 
    // Add vertex buffer to vertex array object.
@@ -254,11 +289,12 @@ Model::Update(const Real global_time)
 {
    if(!Init_) return;
 
-   // Direct the animator to update the model.
+   // Direct the animator to update the model, which may move it, or modify its mesh.
    Animator_.Update(global_time);
+   isBVHFitted_ = false;
 
    // Update the vertex buffer if the mesh has been modified.
-   VBO_.Update(Mesh_.Vertices_);
+   VBO_.Update(Mesh_.InterleavedVertices());
 }
 
 void
@@ -82,13 +82,13 @@ ObjectFactory::Quadrilateral(const SArray4<Point>& points, const float border_wi
    auto& mesh = std::dynamic_pointer_cast<Model>(quad)->Mesh_;
 
    // Set tangents
-   FOR_EACH(vertex, mesh.Vertices_) vertex.Tangent = glm::vec3(1.0f, 0.0f, 0.0f);
+   FOR(i, mesh.nVertices()) mesh.SetVertexTangent(i, glm::vec3(1.0f, 0.0f, 0.0f));
 
    // Set texture coordinates
-   mesh.Vertices_[0].TextureCoordinates = glm::vec2(0.0f, 0.0f);
-   mesh.Vertices_[1].TextureCoordinates = glm::vec2(1.0f, 0.0f);
-   mesh.Vertices_[2].TextureCoordinates = glm::vec2(1.0f, 1.0f);
-   mesh.Vertices_[3].TextureCoordinates = glm::vec2(0.0f, 1.0f);
+   mesh.SetVertexTextureCoordinates(0, glm::vec2(0.0f, 0.0f));
+   mesh.SetVertexTextureCoordinates(1, glm::vec2(1.0f, 0.0f));
+   mesh.SetVertexTextureCoordinates(2, glm::vec2(1.0f, 1.0f));
+   mesh.SetVertexTextureCoordinates(3, glm::vec2(0.0f, 1.0f));
 
    return quad;
 }
@@ -99,12 +99,12 @@ ObjectFactory::Polygon(const DArray<Point>& points, const float border_width)
    Model poly;
    poly.Mesh_.Shading_ = ShadingType::Flat;
 
-   auto& vertices = poly.Mesh_.Vertices_;
-   auto& indices  = poly.Mesh_.Indices_;
+   auto& mesh    = poly.Mesh_;
+   auto& indices = mesh.Indices_;
 
    const auto n_points = points.size();
-   vertices.resize(n_points);
-   FOR(i, n_points) vertices[i].Position = SVectorToGlmVec(points[i]);
+   mesh.ResizeVertices(n_points);
+   FOR(i, n_points) mesh.SetVertexPosition(i, SVectorToGlmVec(points[i]));
 
    // TODO - extend to non-convex polygons as well!
    indices.resize(3 * (n_points - 2));
@@ -164,12 +164,12 @@ ObjectFactory::Tetrahedron(const SArray4<Point>& points)
    Model part;
    part.Mesh_.Shading_ = ShadingType::Flat;
 
-   auto& vertices = part.Mesh_.Vertices_;
-   auto& indices  = part.Mesh_.Indices_;
+   auto& mesh    = part.Mesh_;
+   auto& indices = mesh.Indices_;
 
-   vertices.resize(4);
+   mesh.ResizeVertices(4);
    indices.resize(12);
-   FOR(i, 4) vertices[i].Position = SVectorToGlmVec(points[i]);
+   FOR(i, 4) mesh.SetVertexPosition(i, SVectorToGlmVec(points[i]));
 
    // Face 0
    indices[0] = 0;
@@ -216,18 +216,18 @@ ObjectFactory::Cuboid(const float length, const float width, const float height)
    Model part;
    part.Mesh_.Shading_ = ShadingType::Flat;
 
-   auto& vertices = part.Mesh_.Vertices_;
-   auto& indices  = part.Mesh_.Indices_;
-
-   vertices.resize(8);
-   vertices[0].Position = SVectorToGlmVec(v0);
-   vertices[1].Position = SVectorToGlmVec(v1);
-   vertices[2].Position = SVectorToGlmVec(v2);
-   vertices[3].Position = SVectorToGlmVec(v3);
-   vertices[4].Position = SVectorToGlmVec(v4);
-   vertices[5].Position = SVectorToGlmVec(v5);
-   vertices[6].Position = SVectorToGlmVec(v6);
-   vertices[7].Position = SVectorToGlmVec(v7);
+   auto& mesh    = part.Mesh_;
+   auto& indices = mesh.Indices_;
+
+   mesh.ResizeVertices(8);
+   mesh.SetVertexPosition(0, SVectorToGlmVec(v0));
+   mesh.SetVertexPosition(1, SVectorToGlmVec(v1));
+   mesh.SetVertexPosition(2, SVectorToGlmVec(v2));
+   mesh.SetVertexPosition(3, SVectorToGlmVec(v3));
+   mesh.SetVertexPosition(4, SVectorToGlmVec(v4));
+   mesh.SetVertexPosition(5, SVectorToGlmVec(v5));
+   mesh.SetVertexPosition(6, SVectorToGlmVec(v6));
+   mesh.SetVertexPosition(7, SVectorToGlmVec(v7));
 
    indices.resize(36);
    // Face 0
@@ -56,7 +56,7 @@ PostProcessor::InitMultiSampledBuffers()
 
    // Attach MSAA textures as the frame buffer's colour buffers.
    size_t i = 0;
-   DArray<GLenum> attachments;
+   SmallArray<GLenum, 8> attachments;
    for (std::string name : { "HDR", "Bright" }) // Note: must be attached to the frame buffer in this order.
    {
       auto& texture = textures.at(name);
@@ -91,7 +91,7 @@ PostProcessor::InitResolvedBuffers()
 
    // Attach textures as frame buffer's colour buffers.
    size_t i = 0;
-   DArray<GLenum> attachments;
+   SmallArray<GLenum, 8> attachments;
    for (std::string name : { "HDR", "Bright" }) // Note: must be attached to the frame buffer in this order.
    {
       auto& texture = textures.at(name);
@@ -169,9 +169,12 @@ PostProcessor::Render()
    GLCall(glClear(GL_COLOR_BUFFER_BIT))
    GLCall(glDisable(GL_DEPTH_TEST))
 
+   // Recycle the memory of the previous frame's transient arrays.
+   FrameArena_.Reset();
+
    // Apply Gaussian blur.
-   DArray<FrameImage*> buffers = { &BlurBuffers_.at("Ping"),
-                                   &BlurBuffers_.at("Pong") };
+   ArenaDArray<FrameImage*> buffers({ &BlurBuffers_.at("Ping"),
+                                      &BlurBuffers_.at("Pong") }, ArenaAllocator<FrameImage*>(FrameArena_));
    const size_t n_passes = 6;
    bool horizontal = true;
    auto& blur_shader = Shaders_.at("Blur");
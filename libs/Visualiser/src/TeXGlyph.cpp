@@ -110,7 +110,7 @@ TeXGlyph::ComputeDimensions(const GlyphSheet& glyph_sheet, const UChar font_size
    auto rectangle = ObjectFactory::Rectangle(glyph_dims.x(), glyph_dims.y(), false);
    Mesh_ = std::dynamic_pointer_cast<Model>(rectangle)->ModelMesh();
    auto set_tex_coor = [&](const size_t i, const SVectorR2& point)
-      { Mesh_.Vertices_[i].TextureCoordinates = glm::vec2(point.x() / texbox_dims.x(), point.y() / texbox_dims.y()); };
+      { Mesh_.SetVertexTextureCoordinates(i, glm::vec2(point.x() / texbox_dims.x(), point.y() / texbox_dims.y())); };
    set_tex_coor(0, glyph_anchor);
    set_tex_coor(1, glyph_anchor + SVectorR2{glyph_dims.x(), Zero });
    set_tex_coor(2, glyph_anchor + glyph_dims);
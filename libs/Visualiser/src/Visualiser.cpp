@@ -145,8 +145,8 @@ Visualiser::InitScenes()
 void
 Visualiser::InitTeXBoxes()
 {
-   // Linearise pointers to all TeX-boxes to allow for parallel initialisation.
-   DArray<TeXBox*> tex_boxes;
+   // Linearise pointers to all TeX-boxes to allow for parallel initialisation. Note: the frame arena is reset before it is used by the first frame.
+   ArenaDArray<TeXBox*> tex_boxes{ArenaAllocator<TeXBox*>(FrameArena_)};
    tex_boxes.reserve(10 * Scenes_.size());
    FOR_EACH(scene, Scenes_) FOR_EACH(tex_box, scene.TeXBoxes_) tex_boxes.push_back(tex_box.get());
 
@@ -243,8 +243,9 @@ Visualiser::InitPostProcessor() { if(PostProcess_) PostProcessor_.Init(Window_.V
 void
 Visualiser::BeginFrame()
 {
-   // Clear currently bound frame buffer.
+   // Clear currently bound frame buffer, and recycle the memory of the previous frame's transient arrays.
    ClearFrameBuffer();
+   FrameArena_.Reset();
 
    // Set new GUI frame, if debugging.
 #ifdef DEBUG_MODE
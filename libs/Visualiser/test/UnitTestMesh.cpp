@@ -0,0 +1,139 @@
+/***************************************************************************************************************************************************************
+* GPL-3.0 License
+* Copyright (C) 2022 Niran A. Ilangakoon
+*
+* This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as
+* published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License along with this program.
+* If not, see <https://www.gnu.org/licenses/>.
+***************************************************************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include "../include/Mesh.h"
+
+#ifdef DEBUG_MODE
+
+namespace aprn::vis {
+
+class MeshTest : public testing::Test
+{
+ public:
+   /** Wavy grid of n x n vertices with two triangles per cell, followed by a degenerate triangle whose three vertices coincide. */
+   static Mesh
+   Grid(const size_t n, const ShadingType shading)
+   {
+      Mesh mesh;
+      mesh.Shading_ = shading;
+      mesh.ResizeVertices(n * n + 3);
+      FOR(j, n) FOR(i, n) mesh.SetVertexPosition(i + n * j, glm::vec3(static_cast<GLfloat>(i), static_cast<GLfloat>(j), std::sin(static_cast<GLfloat>(i + 2 * j))));
+      FOR(i, 3) mesh.SetVertexPosition(n * n + i, glm::vec3(-1.0, -1.0, -1.0));
+
+      const auto m = static_cast<GLuint>(n);
+      FOR(j, m - 1) FOR(i, m - 1)
+      {
+         const GLuint iv = i + m * j;
+         for(const GLuint index : {iv, iv + 1, iv + m, iv + 1, iv + m + 1, iv + m}) mesh.Indices_.push_back(index);
+      }
+      FOR(i, 3) mesh.Indices_.push_back(m * m + i);
+      return mesh;
+   }
+
+   static void
+   ExpectNear(const glm::vec3& vector0, const glm::vec3& vector1)
+   {
+      EXPECT_NEAR(vector0.x, vector1.x, 1.0e-6f);
+      EXPECT_NEAR(vector0.y, vector1.y, 1.0e-6f);
+      EXPECT_NEAR(vector0.z, vector1.z, 1.0e-6f);
+   }
+
+   static void
+   ExpectNear(const Vertex& vertex0, const Vertex& vertex1)
+   {
+      ExpectNear(vertex0.Position, vertex1.Position);
+      ExpectNear(vertex0.Normal, vertex1.Normal);
+      ExpectNear(vertex0.Tangent, vertex1.Tangent);
+      ExpectNear(glm::vec3(vertex0.Colour.x, vertex0.Colour.y, vertex0.Colour.z), glm::vec3(vertex1.Colour.x, vertex1.Colour.y, vertex1.Colour.z));
+      EXPECT_EQ(vertex0.Colour.w, vertex1.Colour.w);
+      EXPECT_EQ(vertex0.TextureCoordinates.x, vertex1.TextureCoordinates.x);
+      EXPECT_EQ(vertex0.TextureCoordinates.y, vertex1.TextureCoordinates.y);
+   }
+};
+
+/***************************************************************************************************************************************************************
+* Test Vertex Storage
+***************************************************************************************************************************************************************/
+TEST_F(MeshTest, SeparateStorage)
+{
+   for(const auto shading : {ShadingType::Flat, ShadingType::Phong})
+   {
+      Mesh interleaved = Grid(20, shading);
+      Mesh separate = interleaved;
+      separate.SetVertexStorage(VertexStorage::Separate);
+      EXPECT_EQ(separate.Storage(), VertexStorage::Separate);
+      EXPECT_EQ(separate.nVertices(), interleaved.nVertices());
+
+      // Attributes set and normals computed in either storage agree.
+      FOR(i, interleaved.nVertices())
+      {
+         interleaved.SetVertexTangent(i, glm::vec3(1.0, 0.0, 0.0));
+         separate.SetVertexTangent(i, glm::vec3(1.0, 0.0, 0.0));
+      }
+      interleaved.SetVertexTextureCoordinates(3, glm::vec2(0.5f, 0.25f));
+      separate.SetVertexTextureCoordinates(3, glm::vec2(0.5f, 0.25f));
+      interleaved.ComputeVertexNormals();
+      separate.ComputeVertexNormals();
+
+      const auto& interleaved_vertices = interleaved.InterleavedVertices();
+      const auto& separate_vertices = separate.InterleavedVertices();
+      ASSERT_EQ(separate_vertices.size(), interleaved_vertices.size());
+      FOR(i, interleaved_vertices.size()) ExpectNear(separate_vertices[i], interleaved_vertices[i]);
+
+      // Vertices whose faces are all degenerate have a zero normal in either storage.
+      for(const auto* vertices : {&interleaved_vertices, &separate_vertices})
+      {
+         const glm::vec3& normal = vertices->back().Normal;
+         EXPECT_TRUE(normal.x == 0.0f && normal.y == 0.0f && normal.z == 0.0f);
+      }
+   }
+}
+
+TEST_F(MeshTest, InterleavedVertices)
+{
+   Mesh mesh = Grid(4, ShadingType::Phong);
+   const Vertex original = mesh.InterleavedVertices()[5];
+   mesh.SetVertexStorage(VertexStorage::Separate);
+   ExpectNear(mesh.InterleavedVertices()[5], original);
+
+   // The upload buffer is repacked once the separate attribute arrays have been modified.
+   mesh.SetVertexPosition(5, glm::vec3(7.0, 8.0, 9.0));
+   mesh.SetVertexColour(glm::vec4(0.5f));
+   mesh.ComputeVertexNormals();
+   const auto& vertices = mesh.InterleavedVertices();
+   ExpectNear(vertices[5].Position, glm::vec3(7.0, 8.0, 9.0));
+   ExpectNear(vertices[5].Position, mesh.VertexPosition(5));
+   EXPECT_EQ(vertices[0].Colour.w, 0.5f);
+   EXPECT_NEAR(glm::dot(vertices[5].Normal, vertices[5].Normal), 1.0f, 1.0e-6f);
+
+   // New vertices are given the default attributes of an interleaved vertex.
+   const size_t n_vertices = mesh.nVertices();
+   mesh.ResizeVertices(n_vertices + 1);
+   EXPECT_EQ(mesh.InterleavedVertices().size(), n_vertices + 1);
+   ExpectNear(mesh.InterleavedVertices().back(), Vertex{});
+
+   // Converting back to interleaved storage keeps the modified attributes.
+   mesh.SetVertexPosition(0, glm::vec3(-2.0, 0.0, 0.0));
+   mesh.SetVertexStorage(VertexStorage::Interleaved);
+   EXPECT_EQ(mesh.Storage(), VertexStorage::Interleaved);
+   EXPECT_EQ(mesh.nVertices(), n_vertices + 1);
+   ExpectNear(mesh.VertexPosition(0), glm::vec3(-2.0, 0.0, 0.0));
+   ExpectNear(mesh.VertexPosition(5), glm::vec3(7.0, 8.0, 9.0));
+   EXPECT_EQ(mesh.InterleavedVertices()[0].Colour.w, 0.5f);
+}
+
+}
+
+#endif
@@ -96,6 +96,16 @@ TEST_F(ApeironTest, MinEntry)
   Real minFloat = MaxFloat<>;
   FOR_EACH(entry, RealArray) minFloat = Min(minFloat, entry);
   EXPECT_EQ(MinEntry(RealArray.begin(), RealArray.end()), minFloat);
+
+  // Force a parallel reduction of the test arrays.
+  const size_t threshold = ParallelThreshold();
+  const size_t n_threads = nThreads();
+  SetParallelThreshold(0);
+  SetThreads(4);
+  EXPECT_EQ(MinEntry<Par>(IntArray.begin(), IntArray.end()), minInt);
+  EXPECT_EQ(MinEntry<Par>(RealArray.begin(), RealArray.end()), minFloat);
+  SetParallelThreshold(threshold);
+  SetThreads(n_threads);
 }
 
 TEST_F(ApeironTest, MaxEntry)
@@ -107,6 +117,17 @@ TEST_F(ApeironTest, MaxEntry)
   Real maxFloat = MinFloat<>;
   FOR_EACH(entry, RealArray) maxFloat = Max(maxFloat, entry);
   EXPECT_EQ(MaxEntry(RealArray.begin(), RealArray.end()), maxFloat);
+
+  // Force a parallel reduction of the test arrays.
+  const size_t threshold = ParallelThreshold();
+  const size_t n_threads = nThreads();
+  SetParallelThreshold(0);
+  SetThreads(4);
+  EXPECT_EQ(MaxEntry<Par>(IntArray.begin(), IntArray.end()), maxInt);
+  EXPECT_EQ(MaxEntry<Seq>(RealArray.begin(), RealArray.end()), maxFloat);
+  EXPECT_EQ(MaxEntry<Par>(RealArray.begin(), RealArray.end()), maxFloat);
+  SetParallelThreshold(threshold);
+  SetThreads(n_threads);
 }
 
 TEST_F(ApeironTest, MinMaxEntries)
@@ -145,6 +166,21 @@ TEST_F(ApeironTest, BoundEntries)
     EXPECT_GE(entry, minFloat);
     EXPECT_LE(entry, maxFloat);
   }
+
+  // Force parallel clipping of the test arrays.
+  const size_t threshold = ParallelThreshold();
+  const size_t n_threads = nThreads();
+  SetParallelThreshold(0);
+  SetThreads(4);
+  BoundEntries<Par>(IntArray.begin(), IntArray.end(), -1, 1);
+  FOR_EACH(entry, IntArray)
+  {
+    EXPECT_GE(entry, -1);
+    EXPECT_LE(entry, 1);
+  }
+  EXPECT_THROW(BoundEntries<Par>(IntArray.begin(), IntArray.end(), 1, -1), std::invalid_argument);
+  SetParallelThreshold(threshold);
+  SetThreads(n_threads);
 }
 
 /***************************************************************************************************************************************************************
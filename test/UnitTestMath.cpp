@@ -39,6 +39,19 @@ TEST_F(ApeironTest, Sum)
 
   constexpr Real floatSum = Sum(1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0);
   EXPECT_DOUBLE_EQ(floatSum, 55.0);
+
+  // Force parallel summation of the test arrays.
+  const size_t threshold = ParallelThreshold();
+  const size_t n_threads = nThreads();
+  SetParallelThreshold(0);
+  SetThreads(4);
+
+  EXPECT_EQ(Sum<Par>(IntArray.begin(), IntArray.end()), Sum(IntArray.begin(), IntArray.end()));
+  EXPECT_EQ(Sum<Seq>(IntArray.begin(), IntArray.end()), Sum(IntArray.begin(), IntArray.end()));
+  EXPECT_NEAR(Sum<Par>(RealArray.begin(), RealArray.end()), Sum(RealArray.begin(), RealArray.end()), 1.0e-12);
+
+  SetParallelThreshold(threshold);
+  SetThreads(n_threads);
 }
 
 TEST_F(ApeironTest, Product)
@@ -48,6 +61,20 @@ TEST_F(ApeironTest, Product)
 
   constexpr Real floatProd = Product(1.0, 2.0, 3.0, 4.0, 5.0);
   EXPECT_DOUBLE_EQ(floatProd, 120.0);
+
+  // Force parallel multiplication of the test arrays.
+  const size_t threshold = ParallelThreshold();
+  const size_t n_threads = nThreads();
+  SetParallelThreshold(0);
+  SetThreads(4);
+
+  std::array<Real, 20> factors;
+  FOR(i, factors.size()) factors[i] = static_cast<Real>(i + 1) / Ten;
+  EXPECT_NEAR(Product<Par>(factors.begin(), factors.end()), Product(factors.begin(), factors.end()), 1.0e-12);
+  EXPECT_EQ(Product<Par>(IntArray.begin(), IntArray.begin() + 5), Product(IntArray.begin(), IntArray.begin() + 5));
+
+  SetParallelThreshold(threshold);
+  SetThreads(n_threads);
 }
 
 TEST_F(ApeironTest, Divide)